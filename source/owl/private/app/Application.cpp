@@ -11,10 +11,14 @@
 #include "app/Application.h"
 
 #include "core/Environment.h"
+#include "core/FrameArena.h"
 #include "core/external/yaml.h"
 #include "core/utils/StringUtils.h"
+#include "data/assets/AssetIndex.h"
 #include "input/Input.h"
+#include "io/video/Device.h"
 #include "renderer/Renderer.h"
+#include "renderer/utils/TextureUploadQueue.h"
 #include "sound/SoundSystem.h"
 
 OWL_DIAG_PUSH
@@ -24,6 +28,18 @@ OWL_DIAG_POP
 
 namespace owl::app {
 
+namespace {
+auto assetIndexCache(const std::filesystem::path& iWorkingDirectory) -> std::filesystem::path {
+	return iWorkingDirectory / "cache" / "asset_index.txt";
+}
+
+auto assetRoots(const std::list<Application::AssetDirectory>& iDirectories) -> std::vector<std::filesystem::path> {
+	std::vector<std::filesystem::path> roots;
+	for (const auto& [title, assetsPath]: iDirectories) roots.push_back(assetsPath);
+	return roots;
+}
+}// namespace
+
 Application* Application::s_instance = nullptr;
 
 Application::Application(AppParams iAppParams)// NOLINT(readability-function-cognitive-complexity)
@@ -66,6 +82,7 @@ Application::Application(AppParams iAppParams)// NOLINT(readability-function-cog
 			packPath = m_workingDirectory / packPath;
 		if (openPack(packPath)) {
 			const auto assetsDir = m_workingDirectory / "assets";
+			std::vector<std::string> toExtract;
 			for (const auto& entryPath: m_packReader.listEntries()) {
 				if (entryPath.ends_with(".slang")) {
 					const auto spvPath = assetsDir / (entryPath + ".spv");
@@ -79,15 +96,26 @@ Application::Application(AppParams iAppParams)// NOLINT(readability-function-cog
 					if (entrySize.has_value() && std::filesystem::file_size(destFile, ec) == *entrySize && !ec)
 						continue;
 				}
-				auto data = m_packReader.readEntry(entryPath);
-				if (!data)
-					continue;
-
-				std::filesystem::create_directories(destFile.parent_path());
+				toExtract.push_back(entryPath);
+			}
+			// Decode in parallel, a slice at a time to bound the resident memory.
+			constexpr size_t extractBatch = 64;
+			for (size_t first = 0; first < toExtract.size(); first += extractBatch) {
+				const auto batch = std::span<const std::string>(toExtract).subspan(
+						first, std::min(extractBatch, toExtract.size() - first));
+				auto datas = m_packReader.readEntries(batch, m_scheduler);
+				for (size_t i = 0; i < batch.size(); ++i) {
+					const auto& data = datas[i];
+					if (!data)
+						continue;
+					const auto destFile = assetsDir / batch[i];
+					std::filesystem::create_directories(destFile.parent_path());
 
-				std::ofstream out(destFile, std::ios::binary);
-				if (out.good())
-					out.write(reinterpret_cast<const char*>(data->data()), static_cast<std::streamsize>(data->size()));
+					std::ofstream out(destFile, std::ios::binary);
+					if (out.good())
+						out.write(reinterpret_cast<const char*>(data->data()),
+								  static_cast<std::streamsize>(data->size()));
+				}
 			}
 		} else {
 			OWL_CORE_ERROR("Failed to open asset pack: {}.", packPath.string())
@@ -120,6 +148,10 @@ Application::Application(AppParams iAppParams)// NOLINT(readability-function-cog
 			}
 		}
 #endif
+		// Index the asset files once: the cached index only lists again the directories that changed.
+		auto& index = data::assets::AssetIndex::get();
+		index.load(assetIndexCache(m_workingDirectory));
+		index.build(assetRoots(m_assetDirectories), m_scheduler);
 	}
 
 	// Create the renderer
@@ -275,6 +307,8 @@ void Application::disableDocking() const {
 Application::~Application() {
 	OWL_PROFILE_FUNCTION()
 
+	// grab threads convert on the task scheduler: stop them before it goes away.
+	io::video::Device::stopAllCaptures();
 	m_fontLibrary.destroy();
 	if (renderer::gpu::RenderCommand::getState() != renderer::gpu::RenderAPI::State::Error) {
 		// Ensure the GPU is idle before tearing anything down.
@@ -308,6 +342,7 @@ Application::~Application() {
 
 		OWL_CORE_TRACE("Sound system shut down and invalidated.")
 	}
+	data::assets::AssetIndex::get().save(assetIndexCache(m_workingDirectory));
 	invalidate();
 }
 
@@ -315,6 +350,7 @@ void Application::addAssetDirectory(const AssetDirectory& iDir) { m_assetDirecto
 
 void Application::removeAssetDirectory(const std::filesystem::path& iPath) {
 	m_assetDirectories.remove_if([&iPath](const AssetDirectory& iDir) -> bool { return iDir.assetsPath == iPath; });
+	data::assets::AssetIndex::get().removeRoot(iPath);
 }
 
 void Application::setWindowTitle(const std::string& iTitle) {
@@ -332,10 +368,12 @@ void Application::run() {
 #if OWL_TRACKER_VERBOSITY >= 3
 	uint64_t frameCount = 0;
 #endif
+	core::FrameArena::frame().setFrameLoop(true);
 	while (m_state == State::Running) {
 		OWL_PROFILE_SCOPE("RunLoop")
 		OWL_CORE_FRAME_ADVANCE
 		m_stepper.update();
+		core::FrameArena::frame().reset();
 
 		// Graphics part.
 		if (!m_minimized) {
@@ -344,6 +382,8 @@ void Application::run() {
 				m_state = State::Error;
 				continue;
 			}
+			// Streamed textures progress by a bounded amount each frame.
+			renderer::utils::TextureUploadQueue::get().process();
 			{
 
 				OWL_PROFILE_SCOPE("LayerStack onUpdate")
@@ -390,6 +430,7 @@ void Application::run() {
 		++frameCount;
 #endif
 	}
+	core::FrameArena::frame().setFrameLoop(false);
 }
 
 void Application::onEvent(event::Event& ioEvent) {
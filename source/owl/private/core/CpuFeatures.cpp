@@ -0,0 +1,33 @@
+/**
+ * @file CpuFeatures.cpp
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright (c) 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#include "owlpch.h"
+
+#include "core/CpuFeatures.h"
+
+namespace owl::core {
+
+namespace {
+auto detectSimdLevel() -> SimdLevel {
+#if defined(__x86_64__) || defined(_M_X64)
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("avx2"))
+		return SimdLevel::Avx2;
+	if (__builtin_cpu_supports("sse4.1"))
+		return SimdLevel::Sse41;
+#endif
+	return SimdLevel::Scalar;
+}
+}// namespace
+
+auto getSimdLevel() -> SimdLevel {
+	static const SimdLevel level = detectSimdLevel();
+	return level;
+}
+
+}// namespace owl::core
@@ -0,0 +1,77 @@
+/**
+ * @file FrameArena.cpp
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright (c) 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#include "owlpch.h"
+
+#include "core/FrameArena.h"
+
+namespace owl::core {
+
+FrameArena::FrameArena(const size_t iBlockSize) : m_blockSize{std::max<size_t>(iBlockSize, 64)} {}
+
+FrameArena::~FrameArena() = default;
+
+auto FrameArena::frame() -> FrameArena& {
+	static FrameArena arena;
+	return arena;
+}
+
+void FrameArena::reset() {
+	m_peak = std::max(m_peak, m_used);
+	if (m_blocks.size() > 1) {
+		// This frame overflowed: replace the chain by one block big enough for it.
+		const size_t total = getCapacity();
+		m_blocks.clear();
+		m_blocks.push_back({.data = std::make_unique_for_overwrite<std::byte[]>(total), .size = total});
+	}
+	m_current = 0;
+	m_offset = 0;
+	m_used = 0;
+}
+
+auto FrameArena::getCapacity() const -> size_t {
+	size_t total = 0;
+	for (const auto& block: m_blocks) total += block.size;
+	return total;
+}
+
+auto FrameArena::tryBump(const size_t iBytes, const size_t iAlignment) -> void* {
+	if (m_current >= m_blocks.size())
+		return nullptr;
+	auto& block = m_blocks[m_current];
+	void* ptr = block.data.get() + m_offset;
+	size_t space = block.size - m_offset;
+	if (std::align(iAlignment, iBytes, ptr, space) == nullptr)
+		return nullptr;
+	m_offset = block.size - space + iBytes;
+	return ptr;
+}
+
+auto FrameArena::do_allocate(const size_t iBytes, const size_t iAlignment) -> void* {
+	const size_t bytes = std::max<size_t>(iBytes, 1);
+	void* ptr = tryBump(bytes, iAlignment);
+	while (ptr == nullptr) {
+		if (m_current + 1 < m_blocks.size()) {
+			++m_current;
+		} else {
+			const size_t size = std::max(m_blockSize, bytes + iAlignment);
+			m_blocks.push_back({.data = std::make_unique_for_overwrite<std::byte[]>(size), .size = size});
+			m_current = m_blocks.size() - 1;
+		}
+		m_offset = 0;
+		ptr = tryBump(bytes, iAlignment);
+	}
+	m_used += bytes;
+	return ptr;
+}
+
+void FrameArena::do_deallocate(void* /*iPtr*/, size_t /*iBytes*/, size_t /*iAlignment*/) {}
+
+auto FrameArena::do_is_equal(const memory_resource& iOther) const noexcept -> bool { return this == &iOther; }
+
+}// namespace owl::core
@@ -12,6 +12,25 @@
 #include "core/task/SchedulerImpl.h"
 
 namespace owl::core::task {
+/**
+ * @brief
+ *  Run a taskflow to completion on the executor.
+ *
+ * From a thread that is not one of the executor's workers this is a plain
+ * blocking `run().wait()`. From inside a worker (e.g. a `Scheduler` task that
+ * fans out a batch) it co-runs the graph instead, so the calling worker keeps
+ * executing sub-tasks rather than blocking a pool thread — which would
+ * deadlock on a single-worker pool.
+ * @param[in,out] ioExecutor The Taskflow executor to use.
+ * @param[in,out] ioTaskflow The graph to run.
+ */
+inline void runAndWait(tf::Executor& ioExecutor, tf::Taskflow& ioTaskflow) {
+	if (ioExecutor.this_worker_id() >= 0)
+		ioExecutor.corun(ioTaskflow);
+	else
+		ioExecutor.run(ioTaskflow).wait();
+}
+
 /**
  * @brief
  *  Execute a function in parallel over a container range.
@@ -26,7 +45,7 @@ template<typename Iterator, typename Callable>
 void parallelForEach(tf::Executor& ioExecutor, Iterator iBegin, Iterator iEnd, Callable&& iFunc) {
 	tf::Taskflow taskflow;
 	taskflow.for_each(iBegin, iEnd, std::forward<Callable>(iFunc));
-	ioExecutor.run(taskflow).wait();
+	runAndWait(ioExecutor, taskflow);
 }
 
 /**
@@ -44,7 +63,7 @@ template<typename IndexType, typename Callable>
 void parallelForIndex(tf::Executor& ioExecutor, IndexType iBegin, IndexType iEnd, IndexType iStep, Callable&& iFunc) {
 	tf::Taskflow taskflow;
 	taskflow.for_each_index(iBegin, iEnd, iStep, std::forward<Callable>(iFunc));
-	ioExecutor.run(taskflow).wait();
+	runAndWait(ioExecutor, taskflow);
 }
 
 /**
@@ -12,26 +12,51 @@
 
 namespace owl::core::task {
 
-Scheduler::Scheduler() : mp_impl{mkUniq<SchedulerImpl>()} {}
+Scheduler::Scheduler() : Scheduler{std::thread::hardware_concurrency()} {}
+
+Scheduler::Scheduler(const uint32_t iWorkerCount) : mp_impl{mkUniq<SchedulerImpl>(iWorkerCount)} {}
 
 auto Scheduler::getImpl() const -> SchedulerImpl& { return *mp_impl; }
 
 Scheduler::~Scheduler() {
-	mp_impl->tasksQueue.clear();
+	clearQueue();
 	waitRunning();
+	// Cancelled tasks may still be in the executor's queues.
+	mp_impl->executor.wait_for_all();
 }
 
 auto Scheduler::pushTask(Task&& iTask) -> size_t {
-	const size_t taskId = mp_impl->nextTaskId;
+	const size_t taskId = mp_impl->nextTaskId.fetch_add(1, std::memory_order_relaxed);
 	iTask.m_taskId = taskId;
-	mp_impl->tasksQueue.push_back(mkShared<Task>(std::move(iTask)));
-	++mp_impl->nextTaskId;
+	iTask.m_state = Task::State::Waiting;
+	auto task = std::allocate_shared<Task>(std::pmr::polymorphic_allocator<Task>{&mp_impl->taskPool}, std::move(iTask));
+	// Held until every dependency is linked, so that none can release the task early.
+	task->m_pendingDependencies.store(1, std::memory_order_relaxed);
+	{
+		const std::scoped_lock lock{mp_impl->tasksMutex};
+		for (const size_t dependency: task->m_dependencies) {
+			const auto it = mp_impl->tasks.find(dependency);
+			if (it == mp_impl->tasks.end())
+				continue;
+			Task& predecessor = *it->second;
+			const std::scoped_lock successorLock{predecessor.m_successorsMutex};
+			if (predecessor.m_actionDone) {
+				if (predecessor.isCancelled())
+					task->m_dependencyCancelled.store(true, std::memory_order_relaxed);
+				continue;
+			}
+			predecessor.m_successors.push_back(task);
+			task->m_pendingDependencies.fetch_add(1, std::memory_order_relaxed);
+		}
+		mp_impl->tasks.emplace(taskId, task);
+	}
+	mp_impl->release(task);
 	return taskId;
 }
 
 void Scheduler::frame(const Timestep& iTimestep) {
-	// process asynchronous tasks.
-	mp_impl->frameInternal();
+	// Terminate the asynchronous tasks finished since the last frame.
+	mp_impl->drainCompleted();
 
 	// Process timers
 	for (const auto& timer: mp_impl->timers) { timer->frame(iTimestep, this); }
@@ -40,38 +65,52 @@ void Scheduler::frame(const Timestep& iTimestep) {
 }
 
 void Scheduler::waitRunning() {
-	while (!mp_impl->runningTasks.empty()) {
-		mp_impl->frameInternal(false);
-		if (!mp_impl->runningTasks.empty())
+	while (mp_impl->hasTask(Task::State::Running)) {
+		if (mp_impl->drainCompleted() == 0)
 			std::this_thread::yield();
 	}
 }
 
 void Scheduler::waitEmptyQueue() {
-	while (!mp_impl->tasksQueue.empty() || !mp_impl->runningTasks.empty()) {
-		mp_impl->frameInternal();
-		if (!mp_impl->tasksQueue.empty() || !mp_impl->runningTasks.empty())
+	while (true) {
+		{
+			const std::scoped_lock lock{mp_impl->tasksMutex};
+			if (mp_impl->tasks.empty())
+				break;
+		}
+		if (mp_impl->drainCompleted() == 0)
 			std::this_thread::yield();
 	}
 }
 
 auto Scheduler::isTaskFinished(const size_t iTaskId) const -> bool {
-	return iTaskId < mp_impl->nextTaskId && !(isTaskRunning(iTaskId) || isTaskInQueue(iTaskId));
+	return iTaskId < mp_impl->nextTaskId.load(std::memory_order_relaxed) && !mp_impl->getState(iTaskId).has_value();
 }
 
 auto Scheduler::isTaskRunning(const size_t iTaskId) const -> bool {
-	return std::ranges::find_if(mp_impl->runningTasks, [iTaskId](const shared<Task>& iTask) -> bool {
-			   return iTask->m_taskId == iTaskId;
-		   }) != mp_impl->runningTasks.end();
+	return mp_impl->getState(iTaskId) == Task::State::Running;
 }
 
 auto Scheduler::isTaskInQueue(const size_t iTaskId) const -> bool {
-	return std::ranges::find_if(mp_impl->tasksQueue, [iTaskId](const shared<Task>& iTask) -> bool {
-			   return iTask->m_taskId == iTaskId;
-		   }) != mp_impl->tasksQueue.end();
+	return mp_impl->getState(iTaskId) == Task::State::Waiting;
 }
 
-void Scheduler::clearQueue() { mp_impl->tasksQueue.clear(); }
+void Scheduler::clearQueue() {
+	std::vector<shared<Task>> cancelled;
+	{
+		const std::scoped_lock lock{mp_impl->tasksMutex};
+		// A task is cancelled only if no worker has taken it yet.
+		std::erase_if(mp_impl->tasks, [&cancelled](const auto& iEntry) -> bool {
+			auto expected = Task::State::Waiting;
+			if (!iEntry.second->m_state.compare_exchange_strong(expected, Task::State::Terminated,
+																std::memory_order_acq_rel))
+				return false;
+			cancelled.push_back(iEntry.second);
+			return true;
+		});
+	}
+	for (const auto& task: cancelled) mp_impl->finishAction(*task, true);
+}
 
 auto Scheduler::pushTimer(const TimerParam& iTimerParam) -> weak<Timer> {
 	mp_impl->timers.push_back(mkShared<Timer>(iTimerParam));
@@ -80,28 +119,112 @@ auto Scheduler::pushTimer(const TimerParam& iTimerParam) -> weak<Timer> {
 
 void Scheduler::clearTimers() { mp_impl->timers.clear(); }
 
-void SchedulerImpl::frameInternal(const bool iTreatQueue) {
-	// Poll all running tasks.
-	for (const auto& task: runningTasks) { task->poll(); }
-
-	// Check finished tasks.
-	std::erase_if(runningTasks,
-				  [](const shared<Task>& iTask) -> bool { return iTask->getState() == Task::State::Terminated; });
-
-	// Launch new tasks from the queue using the Taskflow executor.
-	while (iTreatQueue && !tasksQueue.empty() && (runningTasks.size() < maxRunningTasks)) {
-		auto& task = tasksQueue.front();
-		// Bridge std::promise to keep std::future<void> in the public Task header.
-		auto promise = mkShared<std::promise<void>>();
-		task->m_future = promise->get_future();
-		executor.silent_async([action = task->m_action, promise]() -> void {
-			action();
-			promise->set_value();
-		});
-		task->m_state = Task::State::Running;
-		runningTasks.push_back(std::move(task));
-		tasksQueue.pop_front();
+void SchedulerImpl::release(const shared<Task>& iTask) {
+	if (iTask->m_pendingDependencies.fetch_sub(1, std::memory_order_acq_rel) != 1)
+		return;
+	if (iTask->m_dependencyCancelled.load(std::memory_order_acquire)) {
+		cancel(iTask);
+		return;
+	}
+	{
+		const std::scoped_lock lock{readyMutex};
+		ready[static_cast<size_t>(iTask->m_priority)].push_back(iTask);
+	}
+	executor.silent_async([this]() -> void { runNext(); });
+}
+
+void SchedulerImpl::runNext() {
+	shared<Task> task;
+	{
+		const std::scoped_lock lock{readyMutex};
+		const auto queue = std::ranges::find_if(ready, [](const auto& iQueue) -> bool { return !iQueue.empty(); });
+		if (queue == ready.end())
+			return;
+		task = std::move(queue->front());
+		queue->pop_front();
+	}
+	auto expected = Task::State::Waiting;
+	if (!task->m_state.compare_exchange_strong(expected, Task::State::Running, std::memory_order_acq_rel))
+		return;// cancelled by clearQueue()
+	// A token cancelled before the start skips the action.
+	if (!task->isCancelled())
+		task->m_action();
+	finishAction(*task, task->isCancelled());
+	pushCompleted(*task);
+}
+
+void SchedulerImpl::finishAction(Task& ioTask, const bool iCancelled) {
+	std::vector<shared<Task>> successors;
+	{
+		const std::scoped_lock lock{ioTask.m_successorsMutex};
+		ioTask.m_actionDone = true;
+		successors.swap(ioTask.m_successors);
+	}
+	for (const auto& successor: successors) {
+		if (iCancelled)
+			successor->m_dependencyCancelled.store(true, std::memory_order_release);
+		release(successor);
 	}
 }
 
+void SchedulerImpl::cancel(const shared<Task>& iTask) {
+	auto expected = Task::State::Waiting;
+	if (!iTask->m_state.compare_exchange_strong(expected, Task::State::Terminated, std::memory_order_acq_rel))
+		return;
+	{
+		const std::scoped_lock lock{tasksMutex};
+		tasks.erase(iTask->m_taskId);
+	}
+	finishAction(*iTask, true);
+}
+
+void SchedulerImpl::pushCompleted(Task& ioTask) {
+	Task* head = completed.load(std::memory_order_relaxed);
+	do {
+		ioTask.mp_nextCompleted = head;
+	} while (!completed.compare_exchange_weak(head, &ioTask, std::memory_order_release, std::memory_order_relaxed));
+}
+
+auto SchedulerImpl::drainCompleted() -> size_t {
+	// The whole list is taken at once, newest first.
+	Task* head = completed.exchange(nullptr, std::memory_order_acquire);
+	if (head == nullptr)
+		return 0;
+	// Reuse the storage; a callback that waits on the scheduler drains into a fresh one.
+	auto finished = std::move(drained);
+	finished.clear();
+	{
+		const std::scoped_lock lock{tasksMutex};
+		for (Task* task = head; task != nullptr; task = task->mp_nextCompleted) {
+			const auto it = tasks.find(task->m_taskId);
+			finished.push_back(std::move(it->second));
+			tasks.erase(it);
+		}
+	}
+	// Callbacks run without the lock: they may push new tasks. Cancelled tasks have none.
+	for (const auto& task: std::views::reverse(finished)) {
+		if (!task->isCancelled())
+			task->m_termination();
+		task->m_state.store(Task::State::Terminated, std::memory_order_release);
+	}
+	const size_t count = finished.size();
+	finished.clear();
+	drained = std::move(finished);
+	return count;
+}
+
+auto SchedulerImpl::getState(const size_t iTaskId) const -> std::optional<Task::State> {
+	const std::scoped_lock lock{tasksMutex};
+	const auto it = tasks.find(iTaskId);
+	if (it == tasks.end())
+		return std::nullopt;
+	return it->second->getState();
+}
+
+auto SchedulerImpl::hasTask(const Task::State iState) const -> bool {
+	const std::scoped_lock lock{tasksMutex};
+	return std::ranges::any_of(tasks,
+							   [iState](const auto& iEntry) -> bool { return iEntry.second->getState() == iState; });
+}
+
 }// namespace owl::core::task
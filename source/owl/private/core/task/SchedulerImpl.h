@@ -9,36 +9,129 @@
 #pragma once
 #include "core/external/taskflow.h"
 #include "core/task/Scheduler.h"
+#include "core/task/TaskPool.h"
+#include <array>
 #include <deque>
+#include <memory_resource>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
 
 namespace owl::core::task {
 /**
  * @brief
  *  Private implementation of the Scheduler, hiding Taskflow internals.
+ *
+ * Tasks are handed to the executor as soon as they are pushed. A worker that
+ * finishes a task's action links the task into a lock-free completion list
+ * (multi-producer, single consumer), which the main thread drains to run the
+ * termination callbacks, so no task is ever polled.
+ *
+ * Each submission to the executor runs one task: the oldest ready task of the
+ * highest priority class at that time, not necessarily the one submitted. A
+ * task with dependencies is submitted once the last of them has finished.
+ *
+ * Pushing a task does not allocate in steady state: tasks live in recycled
+ * `TaskPool` slots, their closures are stored inline, and the task table and
+ * ready queues draw their nodes from pools.
  */
 struct SchedulerImpl {
+	/// Room for the shared pointer control block next to a pooled task.
+	static constexpr size_t g_controlBlockSize = 64;
+	/**
+	 * @brief
+	 *  Constructor.
+	 * @param[in] iWorkerCount Number of worker threads.
+	 */
+	explicit SchedulerImpl(const uint32_t iWorkerCount)
+		: executor{std::max(iWorkerCount, 1u)}, tasks{&tablePool},
+		  ready{std::pmr::deque<shared<Task>>{&readyPool}, std::pmr::deque<shared<Task>>{&readyPool},
+				std::pmr::deque<shared<Task>>{&readyPool}} {}
 	/**
 	 * @brief
 	 *  The Taskflow executor (thread pool) — declared first so it is destroyed last.
 	 */
-	tf::Executor executor{std::thread::hardware_concurrency()};
-	/// Tasks waiting to be submitted.
-	std::deque<shared<Task>> tasksQueue;
-	/// Currently running tasks.
-	std::vector<shared<Task>> runningTasks;
-	/// Maximum number of concurrent tasks (adapts to hardware).
-	size_t maxRunningTasks = std::thread::hardware_concurrency();
+	tf::Executor executor;
+	/// Slots of the tasks and their control blocks; outlives every task reference below.
+	TaskPool taskPool{sizeof(Task) + g_controlBlockSize};
+	/// Node pool of the task table, guarded by its lock.
+	std::pmr::unsynchronized_pool_resource tablePool;
+	/// Submitted tasks not terminated yet, by ID.
+	std::pmr::unordered_map<size_t, shared<Task>> tasks;
+	/// Lock of the task table: tasks may be pushed from worker threads.
+	mutable std::mutex tasksMutex;
+	/// Node pool of the ready queues, guarded by their lock.
+	std::pmr::unsynchronized_pool_resource readyPool;
+	/// Tasks ready to run, by priority class.
+	std::array<std::pmr::deque<shared<Task>>, 3> ready;
+	/// Lock of the ready queues.
+	std::mutex readyMutex;
+	/// Head of the list of tasks whose action has finished, linked through `Task::mp_nextCompleted`.
+	std::atomic<Task*> completed = nullptr;
 	/// Next task ID counter.
-	size_t nextTaskId = 1;
+	std::atomic<size_t> nextTaskId = 1;
 	/// Active timers.
 	std::vector<shared<Timer>> timers;
+	/// Storage reused by `drainCompleted()`.
+	std::vector<shared<Task>> drained;
+
+	/**
+	 * @brief
+	 *  Release one hold on a registered task; the last one makes it ready, or cancels it.
+	 * @param[in] iTask The task.
+	 */
+	void release(const shared<Task>& iTask);
+
+	/**
+	 * @brief
+	 *  Run the next ready task; executed by the workers.
+	 */
+	void runNext();
+
+	/**
+	 * @brief
+	 *  Mark the action of a task as done and release its successors.
+	 * @param[in,out] ioTask The task.
+	 * @param[in] iCancelled If the task was cancelled: its successors are cancelled too.
+	 */
+	void finishAction(Task& ioTask, bool iCancelled);
+
+	/**
+	 * @brief
+	 *  Cancel a task that has not started, and its successors.
+	 * @param[in] iTask The task.
+	 */
+	void cancel(const shared<Task>& iTask);
+
+	/**
+	 * @brief
+	 *  Link a task whose action has finished into the completion list; called by the workers.
+	 * @param[in,out] ioTask The task.
+	 */
+	void pushCompleted(Task& ioTask);
+
+	/**
+	 * @brief
+	 *  Run the termination callbacks of the finished tasks, in completion order, and forget them.
+	 * @return The number of terminated tasks.
+	 */
+	auto drainCompleted() -> size_t;
+
+	/**
+	 * @brief
+	 *  Get the state of a known task.
+	 * @param[in] iTaskId The task's ID.
+	 * @return The state, or nullopt if the task is terminated or unknown.
+	 */
+	[[nodiscard]] auto getState(size_t iTaskId) const -> std::optional<Task::State>;
 
 	/**
 	 * @brief
-	 *  Internal frame processing: poll running tasks, clean finished, launch queued.
-	 * @param[in] iTreatQueue Whether to dequeue and launch new tasks.
+	 *  Check if a task is in the given state.
+	 * @param[in] iState The state to look for.
+	 * @return True if at least one known task is in that state.
 	 */
-	void frameInternal(bool iTreatQueue = true);
+	[[nodiscard]] auto hasTask(Task::State iState) const -> bool;
 };
 
 }// namespace owl::core::task
@@ -11,28 +11,13 @@
 
 namespace owl::core::task {
 
-Task::Task(const std::function<void()>& iExec, const std::function<void()>& iEnds)
-	: m_action{iExec}, m_termination{iEnds} {}
-
 Task::Task(Task&& iOther) noexcept
-	: m_state(iOther.m_state), m_future(std::move(iOther.m_future)), m_action(std::move(iOther.m_action)),
-	  m_termination(std::move(iOther.m_termination)), m_taskId(iOther.m_taskId) {
+	: m_state(iOther.m_state.load(std::memory_order_acquire)), m_action(std::move(iOther.m_action)),
+	  m_termination(std::move(iOther.m_termination)), m_taskId(iOther.m_taskId), m_priority(iOther.m_priority),
+	  m_token(std::move(iOther.m_token)), m_dependencies(std::move(iOther.m_dependencies)) {
 	iOther.m_state = State::Waiting;
 }
 
-Task::~Task() {
-	if (m_state == State::Running) {
-		m_future.wait();
-	}
-}
-
-void Task::poll() {
-	if (m_state == State::Running) {
-		if (m_future.wait_for(std::chrono::milliseconds(0)) == std::future_status::ready) {
-			m_termination();
-			m_state = State::Terminated;
-		}
-	}
-}
+Task::~Task() = default;
 
 }// namespace owl::core::task
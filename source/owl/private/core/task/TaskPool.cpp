@@ -0,0 +1,65 @@
+/**
+ * @file TaskPool.cpp
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright (c) 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#include "owlpch.h"
+
+#include "TaskPool.h"
+
+namespace owl::core::task {
+
+namespace {
+constexpr size_t g_slotAlignment = alignof(std::max_align_t);
+}// namespace
+
+TaskPool::TaskPool(const size_t iSlotSize)
+	: m_slotSize{(std::max(iSlotSize, sizeof(FreeSlot)) + g_slotAlignment - 1) / g_slotAlignment * g_slotAlignment} {}
+
+TaskPool::~TaskPool() = default;
+
+auto TaskPool::getSlotCount() const -> size_t {
+	const std::scoped_lock lock{m_mutex};
+	return m_blocks.size() * g_slotsPerBlock;
+}
+
+auto TaskPool::getUsedSlotCount() const -> size_t {
+	const std::scoped_lock lock{m_mutex};
+	return m_used;
+}
+
+OWL_DIAG_PUSH
+OWL_DIAG_DISABLE_CLANG19("-Wunsafe-buffer-usage")
+auto TaskPool::do_allocate(const size_t iBytes, const size_t iAlignment) -> void* {
+	if (iBytes > m_slotSize || iAlignment > g_slotAlignment)
+		return std::pmr::new_delete_resource()->allocate(iBytes, iAlignment);
+	const std::scoped_lock lock{m_mutex};
+	if (mp_free == nullptr) {
+		// operator new[] of std::byte is aligned on max_align_t.
+		auto& block = m_blocks.emplace_back(std::make_unique_for_overwrite<std::byte[]>(m_slotSize * g_slotsPerBlock));
+		for (size_t slot = g_slotsPerBlock; slot > 0; --slot)
+			mp_free = new (block.get() + (slot - 1) * m_slotSize) FreeSlot{mp_free};
+	}
+	FreeSlot* slot = mp_free;
+	mp_free = slot->next;
+	++m_used;
+	return slot;
+}
+OWL_DIAG_POP
+
+void TaskPool::do_deallocate(void* iPtr, const size_t iBytes, const size_t iAlignment) {
+	if (iBytes > m_slotSize || iAlignment > g_slotAlignment) {
+		std::pmr::new_delete_resource()->deallocate(iPtr, iBytes, iAlignment);
+		return;
+	}
+	const std::scoped_lock lock{m_mutex};
+	mp_free = new (iPtr) FreeSlot{mp_free};
+	--m_used;
+}
+
+auto TaskPool::do_is_equal(const memory_resource& iOther) const noexcept -> bool { return this == &iOther; }
+
+}// namespace owl::core::task
@@ -0,0 +1,93 @@
+/**
+ * @file TaskPool.h
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright (c) 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+#include "core/Core.h"
+#include <memory_resource>
+#include <mutex>
+
+namespace owl::core::task {
+
+/**
+ * @brief
+ *  Thread-safe pool of fixed-size slots, recycled through a free list.
+ *
+ * The scheduler allocates its tasks (with their shared pointer control block)
+ * from it: once the pool has grown to the number of tasks in flight, pushing a
+ * task no longer touches the heap. Requests larger than a slot go to the heap.
+ */
+class TaskPool final : public std::pmr::memory_resource {
+public:
+	/// Number of slots added when the free list is empty.
+	static constexpr size_t g_slotsPerBlock = 256;
+
+	/**
+	 * @brief
+	 *  Constructor.
+	 * @param[in] iSlotSize Size of a slot in bytes.
+	 */
+	explicit TaskPool(size_t iSlotSize);
+
+	/**
+	 * @brief
+	 *  Destructor.
+	 */
+	~TaskPool() override;
+
+	TaskPool(const TaskPool&) = delete;
+
+	TaskPool(TaskPool&&) = delete;
+
+	auto operator=(const TaskPool&) -> TaskPool& = delete;
+
+	auto operator=(TaskPool&&) -> TaskPool& = delete;
+
+	/**
+	 * @brief
+	 *  Total number of slots.
+	 * @return Slot count.
+	 */
+	[[nodiscard]] auto getSlotCount() const -> size_t;
+
+	/**
+	 * @brief
+	 *  Number of slots in use.
+	 * @return Used slot count.
+	 */
+	[[nodiscard]] auto getUsedSlotCount() const -> size_t;
+
+	/**
+	 * @brief
+	 *  Size of a slot.
+	 * @return Slot size in bytes.
+	 */
+	[[nodiscard]] auto getSlotSize() const -> size_t { return m_slotSize; }
+
+private:
+	auto do_allocate(size_t iBytes, size_t iAlignment) -> void* override;
+	void do_deallocate(void* iPtr, size_t iBytes, size_t iAlignment) override;
+	[[nodiscard]] auto do_is_equal(const memory_resource& iOther) const noexcept -> bool override;
+
+	/// A free slot, holding the next one.
+	struct FreeSlot {
+		/// Next free slot.
+		FreeSlot* next = nullptr;
+	};
+	/// Size of a slot.
+	size_t m_slotSize;
+	/// The slot blocks.
+	std::vector<uniq<std::byte[]>> m_blocks;
+	/// Head of the free list.
+	FreeSlot* mp_free = nullptr;
+	/// Number of slots in use.
+	size_t m_used = 0;
+	/// Access lock.
+	mutable std::mutex m_mutex;
+};
+
+}// namespace owl::core::task
@@ -0,0 +1,577 @@
+/**
+ * @file AssetIndex.cpp
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright (c) 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#include "owlpch.h"
+
+#include "data/assets/AssetIndex.h"
+
+#include "app/Application.h"
+#include "core/task/ParallelUtils.h"
+
+#include <charconv>
+#include <fstream>
+
+#if defined(OWL_PLATFORM_LINUX)
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+namespace owl::data::assets {
+
+namespace {
+/// Header line of a saved index.
+constexpr std::string_view g_cacheHeader = "owl-asset-index 1";
+
+/// A listed directory, before it is merged into the index.
+template<typename Content>
+struct Listing {
+	/// Directory relative to the root.
+	std::string directory;
+	/// Its content.
+	Content content;
+};
+
+auto join(const std::string& iDirectory, const std::string& iName) -> std::string {
+	return iDirectory.empty() ? iName : iDirectory + "/" + iName;
+}
+
+auto stampOf(const std::filesystem::path& iPath) -> int64_t {
+	std::error_code error;
+	const auto time = std::filesystem::last_write_time(iPath, error);
+	return error ? -1 : static_cast<int64_t>(time.time_since_epoch().count());
+}
+
+auto isInside(const std::string& iDirectory, const std::string& iParent) -> bool {
+	return iParent.empty() || iDirectory == iParent ||
+		   (iDirectory.starts_with(iParent) && iDirectory.size() > iParent.size() && iDirectory[iParent.size()] == '/');
+}
+
+auto rootKey(const std::filesystem::path& iRoot) -> std::filesystem::path {
+	std::error_code error;
+	auto root = std::filesystem::absolute(iRoot, error);
+	if (error)
+		root = iRoot;
+	root = root.lexically_normal();
+	if (!root.has_filename() && root.has_parent_path() && root != root.root_path())
+		root = root.parent_path();
+	return root;
+}
+
+/**
+ * @brief
+ *  List one directory.
+ * @param[in] iPath The absolute directory path.
+ * @param[out] oFiles The file names.
+ * @param[out] oDirectories The sub-directory names; symbolic links are not followed, like a recursive walk.
+ * @return The directory modification time.
+ */
+auto listDirectory(const std::filesystem::path& iPath, std::vector<std::string>& oFiles,
+				   std::vector<std::string>& oDirectories) -> int64_t {
+	const int64_t stamp = stampOf(iPath);
+	std::error_code error;
+	for (std::filesystem::directory_iterator it(iPath, std::filesystem::directory_options::skip_permission_denied,
+												error),
+		 end;
+		 !error && it != end; it.increment(error)) {
+		std::error_code typeError;
+		if (it->is_directory(typeError) && !it->is_symlink(typeError))
+			oDirectories.push_back(it->path().filename().string());
+		else if (it->is_regular_file(typeError))
+			oFiles.push_back(it->path().filename().string());
+	}
+	return stamp;
+}
+
+}// namespace
+
+AssetIndex::AssetIndex() = default;
+
+AssetIndex::~AssetIndex() {
+#if defined(OWL_PLATFORM_LINUX)
+	if (m_notifyHandle >= 0)
+		close(m_notifyHandle);
+#endif
+}
+
+auto AssetIndex::get() -> AssetIndex& {
+	static AssetIndex index;
+	return index;
+}
+
+void AssetIndex::build(const std::span<const std::filesystem::path> iRoots, core::task::Scheduler& ioScheduler) {
+	OWL_PROFILE_FUNCTION()
+
+	const std::lock_guard lock(m_mutex);
+	processEvents();
+	for (const auto& root: iRoots) acquireRoot(root, &ioScheduler);
+}
+
+void AssetIndex::build(const std::span<const std::filesystem::path> iRoots) {
+	if (app::Application::instanced()) {
+		build(iRoots, app::Application::get().getTaskScheduler());
+		return;
+	}
+	const std::lock_guard lock(m_mutex);
+	processEvents();
+	for (const auto& root: iRoots) acquireRoot(root, nullptr);
+}
+
+auto AssetIndex::find(const std::span<const std::filesystem::path> iRoots, const std::string& iName,
+					  const std::span<const std::string> iExtensions) -> std::optional<std::filesystem::path> {
+	OWL_PROFILE_FUNCTION()
+
+	const std::filesystem::path name(iName);
+	const bool hasExtension = name.has_extension();
+	std::vector<std::string> fileNames;
+	if (hasExtension) {
+		fileNames.push_back(name.filename().string());
+	} else {
+		for (const auto& extension: iExtensions) fileNames.push_back(name.filename().string() + extension);
+	}
+	const std::string parent = name.parent_path().generic_string();
+
+	const std::lock_guard lock(m_mutex);
+	processEvents();
+	const auto search = [&](const bool iCheckBase) -> std::optional<std::filesystem::path> {
+		for (const auto& rootPath: iRoots) {
+			// Right under the root: a direct check is always up to date.
+			if (iCheckBase) {
+				const std::filesystem::path filePath = rootPath / name;
+				if (hasExtension) {
+					if (std::filesystem::exists(filePath))
+						return filePath;
+				} else {
+					for (const auto& extension: iExtensions) {
+						if (std::filesystem::path filePathWithExt = filePath.string() + extension;
+							std::filesystem::exists(filePathWithExt))
+							return filePathWithExt;
+					}
+				}
+			}
+			// Sub-directories: candidates from the index, shallowest first.
+			Root* root = acquireRoot(rootPath, nullptr);
+			if (root == nullptr)
+				continue;
+			struct Candidate {
+				size_t depth;
+				const std::string* directory;
+				size_t nameIndex;
+			};
+			std::vector<Candidate> candidates;
+			for (size_t nameIndex = 0; nameIndex < fileNames.size(); ++nameIndex) {
+				const auto bucket = root->byName.find(fileNames[nameIndex]);
+				if (bucket == root->byName.end())
+					continue;
+				for (const auto& directory: bucket->second) {
+					if (directory.empty() || directory == parent)
+						continue;
+					if (!parent.empty() &&
+						!(directory.ends_with(parent) && directory[directory.size() - parent.size() - 1] == '/'))
+						continue;
+					candidates.push_back({.depth = static_cast<size_t>(std::ranges::count(directory, '/')),
+										  .directory = &directory,
+										  .nameIndex = nameIndex});
+				}
+			}
+			std::ranges::sort(candidates, [](const Candidate& iA, const Candidate& iB) -> bool {
+				return std::tie(iA.depth, *iA.directory, iA.nameIndex) <
+					   std::tie(iB.depth, *iB.directory, iB.nameIndex);
+			});
+			for (const auto& candidate: candidates) {
+				// A file removed since the last notification is skipped.
+				if (auto filePath = root->path / *candidate.directory / fileNames[candidate.nameIndex];
+					std::filesystem::exists(filePath))
+					return filePath;
+			}
+		}
+		return std::nullopt;
+	};
+	if (auto found = search(true); found.has_value())
+		return found;
+	if (const bool revalidated = !isWatchingUnlocked() && revalidateOnMiss(); revalidated)
+		return search(false);
+	return std::nullopt;
+}
+
+auto AssetIndex::list(const std::span<const std::filesystem::path> iRoots,
+					  const std::span<const std::string> iExtensions) -> std::vector<std::string> {
+	OWL_PROFILE_FUNCTION()
+
+	const std::lock_guard lock(m_mutex);
+	processEvents();
+	std::vector<std::string> result;
+	for (const auto& rootPath: iRoots) {
+		const Root* root = acquireRoot(rootPath, nullptr);
+		if (root == nullptr)
+			continue;
+		const auto first = static_cast<std::ptrdiff_t>(result.size());
+		for (const auto& [directory, content]: root->directories) {
+			for (const auto& file: content.files) {
+				if (std::ranges::find(iExtensions, std::filesystem::path(file).extension().string()) !=
+					iExtensions.end())
+					result.push_back((std::filesystem::path(directory) / file).string());
+			}
+		}
+		std::sort(result.begin() + first, result.end());
+	}
+	return result;
+}
+
+void AssetIndex::update() {
+	const std::lock_guard lock(m_mutex);
+	processEvents();
+}
+
+void AssetIndex::removeRoot(const std::filesystem::path& iRoot) {
+	const std::lock_guard lock(m_mutex);
+	const auto it = m_roots.find(rootKey(iRoot).generic_string());
+	if (it == m_roots.end())
+		return;
+	removeTree(*it->second, "");
+	m_roots.erase(it);
+}
+
+void AssetIndex::clear() {
+	const std::lock_guard lock(m_mutex);
+	for (auto& [key, root]: m_roots) removeTree(*root, "");
+	m_roots.clear();
+}
+
+auto AssetIndex::save(const std::filesystem::path& iFile) const -> bool {
+	OWL_PROFILE_FUNCTION()
+
+	const std::lock_guard lock(m_mutex);
+	std::error_code error;
+	if (iFile.has_parent_path())
+		std::filesystem::create_directories(iFile.parent_path(), error);
+	std::ofstream out(iFile, std::ios::trunc);
+	if (!out.is_open()) {
+		OWL_CORE_WARN("AssetIndex: cannot write {}.", iFile.string())
+		return false;
+	}
+	out << g_cacheHeader << '\n';
+	for (const auto& [key, root]: m_roots) {
+		out << "root " << key << '\n';
+		for (const auto& [directory, content]: root->directories) {
+			out << "dir " << content.stamp << ' ' << directory << '\n';
+			for (const auto& file: content.files) out << "file " << file << '\n';
+		}
+	}
+	return out.good();
+}
+
+auto AssetIndex::load(const std::filesystem::path& iFile) -> bool {
+	OWL_PROFILE_FUNCTION()
+
+	std::ifstream in(iFile);
+	std::string line;
+	if (!in.is_open() || !std::getline(in, line) || line != g_cacheHeader)
+		return false;
+	std::vector<Listing<uniq<Root>>> roots;
+	Directory* directory = nullptr;
+	while (std::getline(in, line)) {
+		if (line.starts_with("root ")) {
+			roots.push_back({.directory = line.substr(5), .content = mkUniq<Root>()});
+			roots.back().content->path = std::filesystem::path(roots.back().directory);
+			roots.back().content->needValidation = true;
+			directory = nullptr;
+		} else if (line.starts_with("dir ") && !roots.empty()) {
+			const size_t space = line.find(' ', 4);
+			if (space == std::string::npos)
+				return false;
+			int64_t stamp = 0;
+			if (const auto [end, error] = std::from_chars(line.data() + 4, line.data() + space, stamp);
+				error != std::errc{} || end != line.data() + space)
+				return false;
+			auto& root = *roots.back().content;
+			directory = &root.directories[line.substr(space + 1)];
+			directory->stamp = stamp;
+		} else if (line.starts_with("file ") && directory != nullptr) {
+			directory->files.push_back(line.substr(5));
+		} else {
+			return false;
+		}
+	}
+
+	const std::lock_guard lock(m_mutex);
+	for (auto& [key, root]: roots) {
+		if (m_roots.contains(key))
+			continue;
+		for (const auto& [name, content]: root->directories)
+			for (const auto& file: content.files) root->byName[file].push_back(name);
+		m_roots.emplace(key, std::move(root));
+	}
+	return true;
+}
+
+void AssetIndex::setWatching(const bool iWatch) {
+	const std::lock_guard lock(m_mutex);
+	m_watching = iWatch;
+	if (!iWatch) {
+		stopNotifications();
+		return;
+	}
+	// Changes made while not watching were missed.
+	for (auto& [key, root]: m_roots) root->needValidation = true;
+}
+
+auto AssetIndex::isWatching() const -> bool {
+	const std::lock_guard lock(m_mutex);
+	return isWatchingUnlocked();
+}
+
+auto AssetIndex::getFileCount(const std::filesystem::path& iRoot) const -> size_t {
+	const std::lock_guard lock(m_mutex);
+	const auto it = m_roots.find(rootKey(iRoot).generic_string());
+	if (it == m_roots.end())
+		return 0;
+	size_t count = 0;
+	for (const auto& [directory, content]: it->second->directories) count += content.files.size();
+	return count;
+}
+
+auto AssetIndex::acquireRoot(const std::filesystem::path& iRoot, core::task::Scheduler* ioScheduler) -> Root* {
+	const auto path = rootKey(iRoot);
+	std::error_code error;
+	if (!std::filesystem::is_directory(path, error))
+		return nullptr;
+	startNotifications();
+	auto& root = m_roots[path.generic_string()];
+	if (root == nullptr) {
+		root = mkUniq<Root>();
+		root->path = path;
+		scanTree(*root, "", ioScheduler);
+	} else if (root->needValidation) {
+		validate(*root);
+	}
+	return root.get();
+}
+
+void AssetIndex::scanTree(Root& ioRoot, const std::string& iDirectory, core::task::Scheduler* ioScheduler) {
+	OWL_PROFILE_FUNCTION()
+
+	Directory content;
+	std::vector<std::string> subDirectories;
+	content.stamp = listDirectory(ioRoot.path / iDirectory, content.files, subDirectories);
+	setDirectory(ioRoot, iDirectory, std::move(content));
+
+	// Each sub-tree is crawled on its own, then merged: the index itself is only touched from here.
+	std::vector<std::vector<Listing<Directory>>> subTrees(subDirectories.size());
+	const auto crawl = [&ioRoot, &iDirectory, &subDirectories, &subTrees](const size_t iIndex) -> void {
+		std::vector<std::string> stack{join(iDirectory, subDirectories[iIndex])};
+		while (!stack.empty()) {
+			Listing<Directory> listing{.directory = std::move(stack.back()), .content = {}};
+			stack.pop_back();
+			std::vector<std::string> children;
+			listing.content.stamp = listDirectory(ioRoot.path / listing.directory, listing.content.files, children);
+			for (const auto& child: children) stack.push_back(join(listing.directory, child));
+			subTrees[iIndex].push_back(std::move(listing));
+		}
+	};
+	if (ioScheduler != nullptr && subDirectories.size() > 1) {
+		core::task::parallelForIndex(*ioScheduler, size_t{0}, subDirectories.size(), size_t{1}, crawl);
+	} else {
+		for (size_t index = 0; index < subDirectories.size(); ++index) crawl(index);
+	}
+	for (auto& subTree: subTrees)
+		for (auto& listing: subTree) setDirectory(ioRoot, listing.directory, std::move(listing.content));
+}
+
+void AssetIndex::setDirectory(Root& ioRoot, const std::string& iDirectory, Directory&& iContent) {
+	auto& directory = ioRoot.directories[iDirectory];
+	for (const auto& file: directory.files) unlinkName(ioRoot, iDirectory, file);
+	const int watchId = directory.watch;
+	directory = std::move(iContent);
+	directory.watch = watchId;
+	for (const auto& file: directory.files) ioRoot.byName[file].push_back(iDirectory);
+	watch(ioRoot, iDirectory);
+}
+
+void AssetIndex::removeTree(Root& ioRoot, const std::string& iDirectory) {
+	for (auto it = ioRoot.directories.lower_bound(iDirectory);
+		 it != ioRoot.directories.end() && it->first.starts_with(iDirectory);) {
+		if (!isInside(it->first, iDirectory)) {
+			++it;
+			continue;
+		}
+		unwatch(it->second);
+		for (const auto& file: it->second.files) unlinkName(ioRoot, it->first, file);
+		it = ioRoot.directories.erase(it);
+	}
+}
+
+void AssetIndex::setFile(Root& ioRoot, const std::string& iDirectory, const std::string& iName, const bool iPresent) {
+	const auto it = ioRoot.directories.find(iDirectory);
+	if (it == ioRoot.directories.end())
+		return;
+	auto& files = it->second.files;
+	const auto file = std::ranges::find(files, iName);
+	if (iPresent && file == files.end()) {
+		files.push_back(iName);
+		ioRoot.byName[iName].push_back(iDirectory);
+	} else if (!iPresent && file != files.end()) {
+		files.erase(file);
+		unlinkName(ioRoot, iDirectory, iName);
+	}
+}
+
+void AssetIndex::unlinkName(Root& ioRoot, const std::string& iDirectory, const std::string& iName) {
+	const auto bucket = ioRoot.byName.find(iName);
+	if (bucket == ioRoot.byName.end())
+		return;
+	std::erase(bucket->second, iDirectory);
+	if (bucket->second.empty())
+		ioRoot.byName.erase(bucket);
+}
+
+void AssetIndex::validate(Root& ioRoot) {
+	OWL_PROFILE_FUNCTION()
+
+	ioRoot.needValidation = false;
+	std::vector<std::string> directories;
+	directories.reserve(ioRoot.directories.size());
+	for (const auto& [directory, content]: ioRoot.directories) directories.push_back(directory);
+	for (const auto& directory: directories) {
+		const auto it = ioRoot.directories.find(directory);
+		if (it == ioRoot.directories.end())
+			continue;// Removed with its parent.
+		const auto path = ioRoot.path / directory;
+		std::error_code error;
+		if (!std::filesystem::is_directory(path, error)) {
+			removeTree(ioRoot, directory);
+			continue;
+		}
+		if (stampOf(path) == it->second.stamp) {
+			watch(ioRoot, directory);
+			continue;
+		}
+		Directory content;
+		std::vector<std::string> subDirectories;
+		content.stamp = listDirectory(path, content.files, subDirectories);
+		setDirectory(ioRoot, directory, std::move(content));
+		for (const auto& subDirectory: subDirectories) {
+			if (const auto child = join(directory, subDirectory); !ioRoot.directories.contains(child))
+				scanTree(ioRoot, child, nullptr);
+		}
+	}
+}
+
+auto AssetIndex::revalidateOnMiss() -> bool {
+	const auto now = std::chrono::steady_clock::now();
+	if (now - m_lastRevalidation < g_revalidatePeriod)
+		return false;
+	m_lastRevalidation = now;
+	for (auto& [key, root]: m_roots) validate(*root);
+	return true;
+}
+
+void AssetIndex::startNotifications() {
+#if defined(OWL_PLATFORM_LINUX)
+	if (!m_watching || m_notifyHandle >= 0 || m_notifyFailed)
+		return;
+	m_notifyHandle = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+	if (m_notifyHandle < 0) {
+		OWL_CORE_WARN("AssetIndex: no file system notifications, the index is revalidated on misses.")
+		m_notifyFailed = true;
+	}
+#endif
+}
+
+void AssetIndex::stopNotifications() {
+#if defined(OWL_PLATFORM_LINUX)
+	if (m_notifyHandle >= 0)
+		close(m_notifyHandle);
+#endif
+	m_notifyHandle = -1;
+	m_watches.clear();
+	for (auto& [key, root]: m_roots)
+		for (auto& [directory, content]: root->directories) content.watch = -1;
+}
+
+void AssetIndex::watch([[maybe_unused]] Root& ioRoot, [[maybe_unused]] const std::string& iDirectory) {
+#if defined(OWL_PLATFORM_LINUX)
+	if (m_notifyHandle < 0)
+		return;
+	auto& directory = ioRoot.directories.at(iDirectory);
+	if (directory.watch >= 0)
+		return;
+	const int watchId = inotify_add_watch(m_notifyHandle, (ioRoot.path / iDirectory).c_str(),
+										  IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO | IN_ONLYDIR);
+	if (watchId < 0) {
+		// Most likely the per-user watch limit: fall back to revalidation for everything.
+		OWL_CORE_WARN("AssetIndex: cannot watch {}, the index is revalidated on misses.",
+					  (ioRoot.path / iDirectory).string())
+		m_notifyFailed = true;
+		stopNotifications();
+		return;
+	}
+	directory.watch = watchId;
+	m_watches[watchId] = {.root = &ioRoot, .directory = iDirectory};
+#endif
+}
+
+void AssetIndex::unwatch(Directory& ioDirectory) {
+	if (ioDirectory.watch < 0)
+		return;
+#if defined(OWL_PLATFORM_LINUX)
+	if (m_notifyHandle >= 0)
+		inotify_rm_watch(m_notifyHandle, ioDirectory.watch);
+#endif
+	m_watches.erase(ioDirectory.watch);
+	ioDirectory.watch = -1;
+}
+
+OWL_DIAG_PUSH
+OWL_DIAG_DISABLE_CLANG19("-Wunsafe-buffer-usage")
+void AssetIndex::processEvents() {
+#if defined(OWL_PLATFORM_LINUX)
+	alignas(inotify_event) std::array<char, 16384> buffer{};
+	while (m_notifyHandle >= 0) {
+		const ssize_t length = read(m_notifyHandle, buffer.data(), buffer.size());
+		if (length <= 0)
+			break;
+		for (ssize_t offset = 0; offset < length;) {
+			const auto* event = reinterpret_cast<const inotify_event*>(buffer.data() + offset);
+			offset += static_cast<ssize_t>(sizeof(inotify_event) + event->len);
+			if ((event->mask & IN_Q_OVERFLOW) != 0u) {
+				// Events were lost: check everything on next use.
+				for (auto& [key, root]: m_roots) root->needValidation = true;
+				continue;
+			}
+			const auto found = m_watches.find(event->wd);
+			if (found == m_watches.end())
+				continue;
+			// Copied: handling the event may drop the watch.
+			const Watch source = found->second;
+			if ((event->mask & IN_IGNORED) != 0u) {
+				// The directory is gone; its parent reports the removal.
+				m_watches.erase(found);
+				if (const auto directory = source.root->directories.find(source.directory);
+					directory != source.root->directories.end() && directory->second.watch == event->wd)
+					directory->second.watch = -1;
+				continue;
+			}
+			if (event->len == 0)
+				continue;
+			const std::string name{event->name};
+			const bool added = (event->mask & (IN_CREATE | IN_MOVED_TO)) != 0u;
+			if ((event->mask & IN_ISDIR) != 0u) {
+				const auto child = join(source.directory, name);
+				removeTree(*source.root, child);
+				if (added)
+					scanTree(*source.root, child, nullptr);
+			} else {
+				setFile(*source.root, source.directory, name, added);
+			}
+		}
+	}
+#endif
+}
+OWL_DIAG_POP
+
+}// namespace owl::data::assets
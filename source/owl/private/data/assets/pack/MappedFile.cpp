@@ -0,0 +1,100 @@
+/**
+ * @file MappedFile.cpp
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright (c) 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#include "data/assets/pack/MappedFile.h"
+
+#include <utility>
+
+#ifdef OWL_PLATFORM_WINDOWS
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace owl::data::assets::pack {
+
+MappedFile::~MappedFile() { unmap(); }
+
+MappedFile::MappedFile(MappedFile&& ioOther) noexcept
+	: mp_data{std::exchange(ioOther.mp_data, nullptr)}, m_size{std::exchange(ioOther.m_size, 0)},
+	  mp_handle{std::exchange(ioOther.mp_handle, nullptr)} {}
+
+auto MappedFile::operator=(MappedFile&& ioOther) noexcept -> MappedFile& {
+	if (this != &ioOther) {
+		unmap();
+		mp_data = std::exchange(ioOther.mp_data, nullptr);
+		m_size = std::exchange(ioOther.m_size, 0);
+		mp_handle = std::exchange(ioOther.mp_handle, nullptr);
+	}
+	return *this;
+}
+
+auto MappedFile::map(const std::filesystem::path& iFile) -> bool {
+	unmap();
+#ifdef OWL_PLATFORM_WINDOWS
+	HANDLE file = CreateFileW(iFile.wstring().c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+							  FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (file == INVALID_HANDLE_VALUE)
+		return false;
+	LARGE_INTEGER fileSize{};
+	if (GetFileSizeEx(file, &fileSize) == 0 || fileSize.QuadPart <= 0) {
+		CloseHandle(file);
+		return false;
+	}
+	HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	// The mapping object keeps its own reference on the file.
+	CloseHandle(file);
+	if (mapping == nullptr)
+		return false;
+	void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	if (view == nullptr) {
+		CloseHandle(mapping);
+		return false;
+	}
+	mp_data = static_cast<const uint8_t*>(view);
+	m_size = static_cast<size_t>(fileSize.QuadPart);
+	mp_handle = mapping;
+#else
+	const int fd = ::open(iFile.c_str(), O_RDONLY | O_CLOEXEC);
+	if (fd < 0)
+		return false;
+	struct stat info{};
+	if (fstat(fd, &info) != 0 || info.st_size <= 0) {
+		::close(fd);
+		return false;
+	}
+	const auto size = static_cast<size_t>(info.st_size);
+	void* view = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+	// The mapping keeps its own reference on the file.
+	::close(fd);
+	if (view == MAP_FAILED)
+		return false;
+	mp_data = static_cast<const uint8_t*>(view);
+	m_size = size;
+#endif
+	return true;
+}
+
+void MappedFile::unmap() {
+	if (mp_data == nullptr)
+		return;
+#ifdef OWL_PLATFORM_WINDOWS
+	UnmapViewOfFile(mp_data);
+	CloseHandle(mp_handle);
+#else
+	munmap(const_cast<uint8_t*>(mp_data), m_size);
+#endif
+	mp_data = nullptr;
+	m_size = 0;
+	mp_handle = nullptr;
+}
+
+}// namespace owl::data::assets::pack
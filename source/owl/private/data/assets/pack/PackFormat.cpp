@@ -9,6 +9,7 @@
 #include "data/assets/pack/PackFormat.h"
 #include "core/Macros.h"
 
+#include <algorithm>
 #include <cstring>
 
 OWL_DIAG_PUSH
@@ -36,9 +37,31 @@ auto hashPath(const std::string& iPath) -> uint64_t {
 	return hash;
 }
 
-void obfuscateBuffer(std::vector<uint8_t>& ioBuffer, const uint32_t iEntryIndex) {
+auto hashContent(const std::span<const uint8_t> iData) -> uint64_t {
+	uint64_t hash = g_fnvBasis ^ iData.size();
+	size_t offset = 0;
+	for (; offset + sizeof(uint64_t) <= iData.size(); offset += sizeof(uint64_t)) {
+		uint64_t word = 0;
+		std::memcpy(&word, iData.data() + offset, sizeof(uint64_t));
+		hash ^= word;
+		hash *= g_fnvPrime;
+	}
+	for (; offset < iData.size(); ++offset) {
+		hash ^= iData[offset];
+		hash *= g_fnvPrime;
+	}
+	// Final avalanche (murmur3 fmix64) so that every input bit reaches the high bits.
+	hash ^= hash >> 33u;
+	hash *= 0xff51afd7ed558ccdULL;
+	hash ^= hash >> 33u;
+	hash *= 0xc4ceb9fe1a85ec53ULL;
+	hash ^= hash >> 33u;
+	return hash;
+}
+
+void obfuscateBuffer(const std::span<uint8_t> ioBuffer, const uint32_t iEntryIndex, const uint64_t iBlockOffset) {
 	for (size_t i = 0; i < ioBuffer.size(); ++i) {
-		const auto key = static_cast<uint8_t>((g_obfuscationSeed ^ iEntryIndex) + i * 37);
+		const auto key = static_cast<uint8_t>((g_obfuscationSeed ^ iEntryIndex) + (iBlockOffset + i) * 37);
 		ioBuffer[i] ^= key;
 	}
 }
@@ -55,7 +78,8 @@ auto compressBuffer(const std::vector<uint8_t>& iData) -> std::vector<uint8_t> {
 	return compressed;
 }
 
-auto decompressBuffer(const std::vector<uint8_t>& iCompressed, const uint64_t iOriginalSize) -> std::vector<uint8_t> {
+auto decompressBuffer(const std::span<const uint8_t> iCompressed, const uint64_t iOriginalSize)
+		-> std::vector<uint8_t> {
 	if (iCompressed.empty() || iOriginalSize == 0)
 		return {};
 	std::vector<uint8_t> decompressed(iOriginalSize);
@@ -65,9 +89,42 @@ auto decompressBuffer(const std::vector<uint8_t>& iCompressed, const uint64_t iO
 	return decompressed;
 }
 
-auto serializeToc(const std::vector<TocEntry>& iEntries) -> std::vector<uint8_t> {
+auto decompressInto(const std::span<const uint8_t> iCompressed, const std::span<uint8_t> oDestination) -> bool {
+	if (iCompressed.empty() || oDestination.empty())
+		return iCompressed.empty() && oDestination.empty();
+	const auto result =
+			ZSTD_decompress(oDestination.data(), oDestination.size(), iCompressed.data(), iCompressed.size());
+	return ZSTD_isError(result) == 0u && result == oDestination.size();
+}
+
+auto compressFrames(const std::span<const uint8_t> iData, const uint32_t iFrameSize,
+					std::vector<uint64_t>& oFrameOffsets) -> std::vector<uint8_t> {
+	oFrameOffsets.clear();
+	if (iData.empty() || iFrameSize == 0)
+		return {};
+	const size_t frameCount = (iData.size() + iFrameSize - 1) / iFrameSize;
+	oFrameOffsets.reserve(frameCount);
+	std::vector<uint8_t> compressed(frameCount * ZSTD_compressBound(iFrameSize));
+	size_t written = 0;
+	for (size_t offset = 0; offset < iData.size(); offset += iFrameSize) {
+		const auto frame = iData.subspan(offset, std::min<size_t>(iFrameSize, iData.size() - offset));
+		const auto result = ZSTD_compress(compressed.data() + written, compressed.size() - written, frame.data(),
+										  frame.size(), 3);
+		if (ZSTD_isError(result) != 0u) {
+			oFrameOffsets.clear();
+			return {};
+		}
+		oFrameOffsets.push_back(written);
+		written += result;
+	}
+	compressed.resize(written);
+	return compressed;
+}
+
+auto serializeToc(const std::vector<TocEntry>& iEntries, const uint16_t iVersion) -> std::vector<uint8_t> {
 	std::vector<uint8_t> data;
-	for (const auto& [pathHash, path, dataOffset, dataSize, originalSize, assetType]: iEntries) {
+	for (const auto& [pathHash, path, dataOffset, dataSize, originalSize, assetType, frameSize, frameOffsets]:
+		 iEntries) {
 		// pathHash (8 bytes)
 		data.insert(data.end(), reinterpret_cast<const uint8_t*>(&pathHash),
 					reinterpret_cast<const uint8_t*>(&pathHash) + sizeof(pathHash));
@@ -88,11 +145,23 @@ auto serializeToc(const std::vector<TocEntry>& iEntries) -> std::vector<uint8_t>
 					reinterpret_cast<const uint8_t*>(&originalSize) + sizeof(originalSize));
 		// assetType (1 byte)
 		data.push_back(static_cast<uint8_t>(assetType));
+		if (iVersion < 2)
+			continue;
+		// frameSize (4 bytes)
+		data.insert(data.end(), reinterpret_cast<const uint8_t*>(&frameSize),
+					reinterpret_cast<const uint8_t*>(&frameSize) + sizeof(frameSize));
+		// frameCount (4 bytes)
+		const auto frameCount = static_cast<uint32_t>(frameOffsets.size());
+		data.insert(data.end(), reinterpret_cast<const uint8_t*>(&frameCount),
+					reinterpret_cast<const uint8_t*>(&frameCount) + sizeof(frameCount));
+		// frameOffsets (8 bytes each)
+		data.insert(data.end(), reinterpret_cast<const uint8_t*>(frameOffsets.data()),
+					reinterpret_cast<const uint8_t*>(frameOffsets.data() + frameOffsets.size()));
 	}
 	return data;
 }
 
-auto deserializeToc(const std::vector<uint8_t>& iData) -> std::vector<TocEntry> {
+auto deserializeToc(const std::vector<uint8_t>& iData, const uint16_t iVersion) -> std::vector<TocEntry> {
 	std::vector<TocEntry> entries;
 	size_t offset = 0;
 	while (offset < iData.size()) {
@@ -133,6 +202,27 @@ auto deserializeToc(const std::vector<uint8_t>& iData) -> std::vector<TocEntry>
 			break;
 		entry.assetType = static_cast<AssetType>(iData[offset]);
 		offset += 1;
+		if (iVersion >= 2) {
+			// frameSize (4 bytes)
+			if (offset + sizeof(uint32_t) > iData.size())
+				break;
+			std::memcpy(&entry.frameSize, iData.data() + offset, sizeof(uint32_t));
+			offset += sizeof(uint32_t);
+			// frameCount (4 bytes)
+			if (offset + sizeof(uint32_t) > iData.size())
+				break;
+			uint32_t frameCount = 0;
+			std::memcpy(&frameCount, iData.data() + offset, sizeof(uint32_t));
+			offset += sizeof(uint32_t);
+			// frameOffsets (8 bytes each)
+			if (frameCount > (iData.size() - offset) / sizeof(uint64_t))
+				break;
+			if (frameCount > 0) {
+				entry.frameOffsets.resize(frameCount);
+				std::memcpy(entry.frameOffsets.data(), iData.data() + offset, frameCount * sizeof(uint64_t));
+				offset += frameCount * sizeof(uint64_t);
+			}
+		}
 		entries.push_back(std::move(entry));
 	}
 	return entries;
@@ -8,28 +8,39 @@
 
 #include "data/assets/pack/PackReader.h"
 
+#include "app/Application.h"
+#include "core/task/ParallelUtils.h"
+
+#include <algorithm>
 #include <cstring>
 
 namespace owl::data::assets::pack {
 
 PackReader::~PackReader() { close(); }
 
-auto PackReader::tryOpen(const std::filesystem::path& iPackFile) -> owl::expected<void, PackOpenError> {
+auto PackReader::tryOpen(const std::filesystem::path& iPackFile, const PackReadMode iMode)
+		-> owl::expected<void, PackOpenError> {
 	close();
 
-	m_fileStream.open(iPackFile, std::ios::binary);
-	if (!m_fileStream.is_open()) {
-		OWL_CORE_WARN("Pack: cannot open '{}' for reading.", iPackFile.string())
-		return owl::unexpected{PackOpenError::CannotOpenFile};
+	m_mode = iMode;
+	if (m_mode == PackReadMode::Mapped && !m_mapping.map(iPackFile))
+		m_mode = PackReadMode::Stream;
+	if (m_mode == PackReadMode::Stream) {
+		m_fileStream.open(iPackFile, std::ios::binary);
+		if (!m_fileStream.is_open()) {
+			OWL_CORE_WARN("Pack: cannot open '{}' for reading.", iPackFile.string())
+			return owl::unexpected{PackOpenError::CannotOpenFile};
+		}
 	}
 
 	// Read header.
-	m_fileStream.read(reinterpret_cast<char*>(&m_header), sizeof(PackHeader));
-	if (!m_fileStream.good()) {
+	const auto headerData = readRaw(0, sizeof(PackHeader));
+	if (!headerData.has_value()) {
 		OWL_CORE_ERROR("Pack: short read on '{}' header.", iPackFile.string())
 		close();
 		return owl::unexpected{PackOpenError::ShortHeader};
 	}
+	std::memcpy(&m_header, headerData->data(), sizeof(PackHeader));
 
 	// Validate magic.
 	if (m_header.magic != g_packMagic) {
@@ -39,7 +50,7 @@ auto PackReader::tryOpen(const std::filesystem::path& iPackFile) -> owl::expecte
 	}
 
 	// Validate version.
-	if (m_header.version != g_packVersion) {
+	if (m_header.version < g_packMinVersion || m_header.version > g_packVersion) {
 		OWL_CORE_ERROR("Pack: '{}' has unsupported version {} (current {}).", iPackFile.string(), m_header.version,
 					   g_packVersion)
 		close();
@@ -51,14 +62,13 @@ auto PackReader::tryOpen(const std::filesystem::path& iPackFile) -> owl::expecte
 	const bool obfuscated = hasFlag(flags, PackFlags::Obfuscated);
 
 	// Read TOC.
-	m_fileStream.seekg(static_cast<std::streamoff>(m_header.tocOffset));
-	std::vector<uint8_t> tocData(m_header.tocSize);
-	m_fileStream.read(reinterpret_cast<char*>(tocData.data()), static_cast<std::streamsize>(m_header.tocSize));
-	if (!m_fileStream.good() && !m_fileStream.eof()) {
+	auto tocRead = readRaw(m_header.tocOffset, m_header.tocSize);
+	if (!tocRead.has_value()) {
 		OWL_CORE_ERROR("Pack: TOC read failed on '{}'.", iPackFile.string())
 		close();
 		return owl::unexpected{PackOpenError::TocReadFailed};
 	}
+	auto tocData = std::move(tocRead.value());
 
 	if (obfuscated)
 		obfuscateBuffer(tocData, m_header.entryCount);
@@ -75,7 +85,7 @@ auto PackReader::tryOpen(const std::filesystem::path& iPackFile) -> owl::expecte
 		tocData.clear();
 	}
 
-	m_toc = deserializeToc(tocData);
+	m_toc = deserializeToc(tocData, m_header.version);
 	if (m_toc.size() != m_header.entryCount) {
 		OWL_CORE_ERROR("Pack: TOC entry count mismatch on '{}' ({} read, {} expected).", iPackFile.string(),
 					   m_toc.size(), m_header.entryCount)
@@ -88,16 +98,29 @@ auto PackReader::tryOpen(const std::filesystem::path& iPackFile) -> owl::expecte
 	m_hashIndex.reserve(m_toc.size());
 	for (size_t i = 0; i < m_toc.size(); ++i) { m_hashIndex[m_toc[i].pathHash] = i; }
 
+	// Deduplicated entries share the blob, hence the obfuscation key, of the first entry stored at their offset.
+	m_obfuscationKeys.resize(m_toc.size());
+	std::unordered_map<uint64_t, uint32_t> blobOwners;
+	for (size_t i = 0; i < m_toc.size(); ++i) {
+		m_obfuscationKeys[i] = static_cast<uint32_t>(i);
+		if (m_toc[i].dataSize > 0)
+			m_obfuscationKeys[i] = blobOwners.try_emplace(m_toc[i].dataOffset, static_cast<uint32_t>(i)).first->second;
+	}
+
 	return {};
 }
 
-auto PackReader::open(const std::filesystem::path& iPackFile) -> bool { return tryOpen(iPackFile).has_value(); }
+auto PackReader::open(const std::filesystem::path& iPackFile, const PackReadMode iMode) -> bool {
+	return tryOpen(iPackFile, iMode).has_value();
+}
 
 void PackReader::close() {
+	m_mapping.unmap();
 	if (m_fileStream.is_open())
 		m_fileStream.close();
 	m_toc.clear();
 	m_hashIndex.clear();
+	m_obfuscationKeys.clear();
 	m_header = {};
 }
 
@@ -107,31 +130,106 @@ auto PackReader::readEntry(const std::string& iPath) const -> std::optional<std:
 	const auto* entry = findEntry(iPath);
 	if (entry == nullptr)
 		return std::nullopt;
+	return decodeEntry(*entry);
+}
+
+auto PackReader::viewEntry(const std::string& iPath) const -> std::optional<std::span<const uint8_t>> {
+	if (m_mode != PackReadMode::Mapped || !m_mapping.isMapped())
+		return std::nullopt;
+	const auto flags = static_cast<PackFlags>(m_header.flags);
+	if (hasFlag(flags, PackFlags::Compressed) || hasFlag(flags, PackFlags::Obfuscated))
+		return std::nullopt;
+	const auto* entry = findEntry(iPath);
+	if (entry == nullptr)
+		return std::nullopt;
+	return mappedBlock(entry->dataOffset, entry->dataSize);
+}
+
+auto PackReader::readRange(const std::string& iPath, const uint64_t iOffset, const uint64_t iLength) const
+		-> std::optional<std::vector<uint8_t>> {
+	const auto* entry = findEntry(iPath);
+	if (entry == nullptr || iOffset > entry->originalSize)
+		return std::nullopt;
+	const uint64_t length = std::min(iLength, entry->originalSize - iOffset);
+	if (length == 0)
+		return std::vector<uint8_t>{};
 
 	const auto flags = static_cast<PackFlags>(m_header.flags);
 	const bool compressed = hasFlag(flags, PackFlags::Compressed);
 	const bool obfuscated = hasFlag(flags, PackFlags::Obfuscated);
 
-	// Find the entry index for obfuscation key.
-	const auto it = m_hashIndex.find(entry->pathHash);
-	if (it == m_hashIndex.end())
-		return std::nullopt;
-	const auto entryIndex = static_cast<uint32_t>(it->second);
+	if (!compressed) {
+		// Stored bytes are the asset bytes: read just the slice.
+		auto block = readRaw(entry->dataOffset + iOffset, length);
+		if (block.has_value() && obfuscated) {
+			const auto index = obfuscationKey(*entry);
+			if (!index.has_value())
+				return std::nullopt;
+			obfuscateBuffer(*block, *index, iOffset);
+		}
+		return block;
+	}
 
-	// Read the compressed/obfuscated block.
-	m_fileStream.seekg(static_cast<std::streamoff>(entry->dataOffset));
-	std::vector<uint8_t> block(entry->dataSize);
-	m_fileStream.read(reinterpret_cast<char*>(block.data()), static_cast<std::streamsize>(entry->dataSize));
-	if (!m_fileStream.good() && !m_fileStream.eof())
-		return std::nullopt;
+	if (!entry->isFramed()) {
+		// Single-blob entry (small, or written by a version 1 pack): no choice but a full decode.
+		auto whole = decodeEntry(*entry);
+		if (!whole.has_value())
+			return std::nullopt;
+		const auto first = whole->begin() + static_cast<std::ptrdiff_t>(iOffset);
+		return std::vector<uint8_t>(first, first + static_cast<std::ptrdiff_t>(length));
+	}
 
-	if (obfuscated)
-		obfuscateBuffer(block, entryIndex);
+	// Only decode the frames overlapping the range.
+	std::vector<uint8_t> result(length);
+	std::vector<uint8_t> scratch;
+	const uint64_t end = iOffset + length;
+	const uint64_t frameSize = entry->frameSize;
+	for (uint64_t frame = iOffset / frameSize; frame * frameSize < end; ++frame) {
+		const uint64_t frameBegin = frame * frameSize;
+		const uint64_t frameLength = std::min(frameSize, entry->originalSize - frameBegin);
+		const uint64_t copyBegin = std::max(iOffset, frameBegin);
+		const uint64_t copyEnd = std::min(end, frameBegin + frameLength);
+		const auto target = std::span<uint8_t>(result).subspan(copyBegin - iOffset, copyEnd - copyBegin);
+		if (copyBegin == frameBegin && copyEnd == frameBegin + frameLength) {
+			// Whole frame inside the range: decode in place.
+			if (!decodeFrame(*entry, static_cast<size_t>(frame), target))
+				return std::nullopt;
+			continue;
+		}
+		scratch.resize(frameLength);
+		if (!decodeFrame(*entry, static_cast<size_t>(frame), scratch))
+			return std::nullopt;
+		std::copy_n(scratch.begin() + static_cast<std::ptrdiff_t>(copyBegin - frameBegin), target.size(),
+					target.begin());
+	}
+	return result;
+}
 
-	if (compressed)
-		return decompressBuffer(block, entry->originalSize);
+auto PackReader::readEntries(const std::span<const std::string> iPaths, core::task::Scheduler& ioScheduler) const
+		-> std::vector<std::optional<std::vector<uint8_t>>> {
+	OWL_PROFILE_FUNCTION()
 
-	return block;
+	std::vector<std::optional<std::vector<uint8_t>>> results(iPaths.size());
+	if (iPaths.size() < 2) {
+		for (size_t i = 0; i < iPaths.size(); ++i) results[i] = readEntry(iPaths[i]);
+		return results;
+	}
+	// Each index writes its own slot: no synchronisation needed beyond the reader's own.
+	core::task::parallelForIndex(ioScheduler, size_t{0}, iPaths.size(), size_t{1},
+								 [this, &iPaths, &results](const size_t iIndex) {
+									 results[iIndex] = readEntry(iPaths[iIndex]);
+								 });
+	return results;
+}
+
+auto PackReader::readEntries(const std::span<const std::string> iPaths) const
+		-> std::vector<std::optional<std::vector<uint8_t>>> {
+	if (app::Application::instanced())
+		return readEntries(iPaths, app::Application::get().getTaskScheduler());
+	std::vector<std::optional<std::vector<uint8_t>>> results;
+	results.reserve(iPaths.size());
+	for (const auto& path: iPaths) results.push_back(readEntry(path));
+	return results;
 }
 
 auto PackReader::listEntries() const -> std::vector<std::string> {
@@ -169,4 +267,108 @@ auto PackReader::findEntry(const std::string& iPath) const -> const TocEntry* {
 	return &entry;
 }
 
+auto PackReader::obfuscationKey(const TocEntry& iEntry) const -> std::optional<uint32_t> {
+	const auto it = m_hashIndex.find(iEntry.pathHash);
+	if (it == m_hashIndex.end())
+		return std::nullopt;
+	return m_obfuscationKeys[it->second];
+}
+
+auto PackReader::mappedBlock(const uint64_t iOffset, const uint64_t iSize) const
+		-> std::optional<std::span<const uint8_t>> {
+	const auto bytes = m_mapping.bytes();
+	if (iOffset > bytes.size() || iSize > bytes.size() - iOffset)
+		return std::nullopt;
+	return bytes.subspan(iOffset, iSize);
+}
+
+auto PackReader::readRaw(const uint64_t iOffset, const uint64_t iSize) const -> std::optional<std::vector<uint8_t>> {
+	if (m_mode == PackReadMode::Mapped) {
+		const auto block = mappedBlock(iOffset, iSize);
+		if (!block.has_value())
+			return std::nullopt;
+		return std::vector<uint8_t>(block->begin(), block->end());
+	}
+	std::vector<uint8_t> block(iSize);
+	const std::scoped_lock lock(*m_streamMutex);
+	m_fileStream.clear();
+	m_fileStream.seekg(static_cast<std::streamoff>(iOffset));
+	m_fileStream.read(reinterpret_cast<char*>(block.data()), static_cast<std::streamsize>(iSize));
+	if (static_cast<uint64_t>(m_fileStream.gcount()) != iSize)
+		return std::nullopt;
+	return block;
+}
+
+auto PackReader::decodeFrame(const TocEntry& iEntry, const size_t iFrame, const std::span<uint8_t> oDestination) const
+		-> bool {
+	if (iFrame >= iEntry.frameOffsets.size())
+		return false;
+	const uint64_t begin = iEntry.frameOffsets[iFrame];
+	const uint64_t end = iFrame + 1 < iEntry.frameOffsets.size() ? iEntry.frameOffsets[iFrame + 1] : iEntry.dataSize;
+	if (end < begin || end > iEntry.dataSize)
+		return false;
+
+	const bool obfuscated = hasFlag(static_cast<PackFlags>(m_header.flags), PackFlags::Obfuscated);
+	if (!obfuscated && m_mode == PackReadMode::Mapped) {
+		const auto frame = mappedBlock(iEntry.dataOffset + begin, end - begin);
+		return frame.has_value() && decompressInto(*frame, oDestination);
+	}
+
+	auto frame = readRaw(iEntry.dataOffset + begin, end - begin);
+	if (!frame.has_value())
+		return false;
+	if (obfuscated) {
+		const auto index = obfuscationKey(iEntry);
+		if (!index.has_value())
+			return false;
+		obfuscateBuffer(*frame, *index, begin);
+	}
+	return decompressInto(*frame, oDestination);
+}
+
+auto PackReader::decodeEntry(const TocEntry& iEntry) const -> std::optional<std::vector<uint8_t>> {
+	const auto flags = static_cast<PackFlags>(m_header.flags);
+	const bool compressed = hasFlag(flags, PackFlags::Compressed);
+	const bool obfuscated = hasFlag(flags, PackFlags::Obfuscated);
+
+	if (compressed && iEntry.isFramed()) {
+		const uint64_t frameSize = iEntry.frameSize;
+		if (iEntry.frameOffsets.size() != (iEntry.originalSize + frameSize - 1) / frameSize)
+			return std::nullopt;
+		std::vector<uint8_t> result(iEntry.originalSize);
+		const auto output = std::span<uint8_t>(result);
+		for (size_t frame = 0; frame < iEntry.frameOffsets.size(); ++frame) {
+			const uint64_t frameBegin = frame * frameSize;
+			const auto target = output.subspan(frameBegin, std::min(frameSize, result.size() - frameBegin));
+			if (!decodeFrame(iEntry, frame, target))
+				return std::nullopt;
+		}
+		return result;
+	}
+
+	// Compressed-only blocks decompress straight out of the mapping, without an intermediate copy.
+	if (compressed && !obfuscated && m_mode == PackReadMode::Mapped) {
+		const auto block = mappedBlock(iEntry.dataOffset, iEntry.dataSize);
+		if (!block.has_value())
+			return std::nullopt;
+		return decompressBuffer(*block, iEntry.originalSize);
+	}
+
+	auto block = readRaw(iEntry.dataOffset, iEntry.dataSize);
+	if (!block.has_value())
+		return std::nullopt;
+
+	if (obfuscated) {
+		const auto index = obfuscationKey(iEntry);
+		if (!index.has_value())
+			return std::nullopt;
+		obfuscateBuffer(*block, *index);
+	}
+
+	if (compressed)
+		return decompressBuffer(*block, iEntry.originalSize);
+
+	return block;
+}
+
 }// namespace owl::data::assets::pack
@@ -8,10 +8,19 @@
 
 #include "data/assets/pack/PackWriter.h"
 
+#include "app/Application.h"
+#include "core/task/ParallelUtils.h"
+
 #include <fstream>
+#include <unordered_map>
 
 namespace owl::data::assets::pack {
 
+namespace {
+/// Entries encoded per parallel batch: bounds the compressed blocks held in memory before they are written.
+constexpr size_t k_encodeBatch = 64;
+}// namespace
+
 void PackWriter::addFile(const std::filesystem::path& iSourceFile, const std::string& iPackPath,
 						 const AssetType iType) {
 	std::ifstream file(iSourceFile, std::ios::binary | std::ios::ate);
@@ -34,8 +43,29 @@ void PackWriter::addData(const std::vector<uint8_t>& iData, const std::string& i
 	m_entries.push_back({iPackPath, iData, iType});
 }
 
+auto PackWriter::encodeBlock(const std::vector<uint8_t>& iRawData, const uint32_t iEntryIndex, const bool iCompress,
+							 const bool iObfuscate) const -> std::optional<EncodedBlock> {
+	EncodedBlock block;
+	if (!iCompress) {
+		block.data = iRawData;
+	} else if (m_frameSize > 0 && iRawData.size() > m_frameSize) {
+		// Large entries become independent frames so readers can decode any range on its own.
+		block.data = compressFrames(iRawData, m_frameSize, block.frameOffsets);
+		block.frameSize = m_frameSize;
+	} else {
+		block.data = compressBuffer(iRawData);
+	}
+	if (iCompress && block.data.empty() && !iRawData.empty())
+		return std::nullopt;
+	if (iObfuscate)
+		obfuscateBuffer(block.data, iEntryIndex);
+	return block;
+}
+
 auto PackWriter::write(const std::filesystem::path& iOutputFile, const PackFlags iFlags,
 					   const ProgressCallback& iProgress, const CancelCheck& iCancelCheck) const -> bool {
+	OWL_PROFILE_FUNCTION()
+
 	std::ofstream file(iOutputFile, std::ios::binary);
 	if (!file.is_open()) {
 		OWL_CORE_ERROR("Pack: cannot open '{}' for writing.", iOutputFile.string())
@@ -45,45 +75,116 @@ auto PackWriter::write(const std::filesystem::path& iOutputFile, const PackFlags
 	const bool compress = hasFlag(iFlags, PackFlags::Compressed);
 	const bool obfuscate = hasFlag(iFlags, PackFlags::Obfuscated);
 
+	core::task::Scheduler* scheduler = mp_scheduler;
+	if (scheduler == nullptr && app::Application::instanced())
+		scheduler = &app::Application::get().getTaskScheduler();
+	const auto forEachIndex = [scheduler](const size_t iBegin, const size_t iEnd, const auto& iFunc) -> void {
+		if (scheduler != nullptr && iEnd - iBegin > 1)
+			core::task::parallelForIndex(*scheduler, iBegin, iEnd, size_t{1}, iFunc);
+		else
+			for (size_t i = iBegin; i < iEnd; ++i) iFunc(i);
+	};
+
+	// Find duplicated contents: every entry points to the first entry holding the same bytes.
+	const size_t count = m_entries.size();
+	std::vector<uint64_t> contentHashes(count);
+	forEachIndex(0, count, [this, &contentHashes](const size_t iIndex) -> void {
+		contentHashes[iIndex] = hashContent(m_entries[iIndex].rawData);
+	});
+	std::vector<size_t> owners(count);
+	std::unordered_map<uint64_t, std::vector<size_t>> blobsByHash;
+	for (size_t idx = 0; idx < count; ++idx) {
+		owners[idx] = idx;
+		if (m_entries[idx].rawData.empty())
+			continue;
+		auto& candidates = blobsByHash[contentHashes[idx]];
+		for (const auto candidate: candidates) {
+			if (m_entries[candidate].rawData == m_entries[idx].rawData) {
+				owners[idx] = candidate;
+				break;
+			}
+		}
+		if (owners[idx] == idx)
+			candidates.push_back(idx);
+	}
+
 	// Write placeholder header (will be updated at the end).
 	PackHeader header;
 	header.flags = static_cast<uint16_t>(iFlags);
-	header.entryCount = static_cast<uint32_t>(m_entries.size());
+	header.entryCount = static_cast<uint32_t>(count);
 	file.write(reinterpret_cast<const char*>(&header), sizeof(PackHeader));
 
 	// Write data blocks and build TOC entries.
 	std::vector<TocEntry> tocEntries;
-	tocEntries.reserve(m_entries.size());
+	tocEntries.reserve(count);
 
-	const auto totalEntries = static_cast<uint32_t>(m_entries.size());
-	for (uint32_t idx = 0; idx < totalEntries; ++idx) {
+	const auto totalEntries = static_cast<uint32_t>(count);
+	for (size_t batchBegin = 0; batchBegin < count; batchBegin += k_encodeBatch) {
 		if (iCancelCheck && iCancelCheck())
 			return false;
-		if (iProgress)
-			iProgress(idx, totalEntries);
-
-		const auto& entry = m_entries[idx];
-
-		TocEntry tocEntry;
-		tocEntry.pathHash = hashPath(entry.packPath);
-		tocEntry.path = entry.packPath;
-		tocEntry.originalSize = entry.rawData.size();
-		tocEntry.assetType = entry.assetType;
-		tocEntry.dataOffset = static_cast<uint64_t>(file.tellp());
-
-		auto block = compress ? compressBuffer(entry.rawData) : entry.rawData;
-		if (compress && block.empty() && !entry.rawData.empty()) {
-			OWL_CORE_ERROR("Pack: compression failed on entry '{}' ({} bytes).", entry.packPath, entry.rawData.size())
-			return false;
+		const size_t batchEnd = std::min(count, batchBegin + k_encodeBatch);
+
+		// Encode the unique blobs of the batch in parallel; each block only depends on its own entry.
+		std::vector<std::optional<EncodedBlock>> blocks(batchEnd - batchBegin);
+		if (compress || obfuscate) {
+			forEachIndex(batchBegin, batchEnd,
+						 [this, &blocks, &owners, batchBegin, compress, obfuscate](const size_t iIndex) -> void {
+							 if (owners[iIndex] == iIndex)
+								 blocks[iIndex - batchBegin] =
+										 encodeBlock(m_entries[iIndex].rawData, static_cast<uint32_t>(iIndex),
+													 compress, obfuscate);
+						 });
 		}
 
-		if (obfuscate)
-			obfuscateBuffer(block, idx);
-
-		tocEntry.dataSize = block.size();
-		file.write(reinterpret_cast<const char*>(block.data()), static_cast<std::streamsize>(block.size()));
-
-		tocEntries.push_back(std::move(tocEntry));
+		// Then write them sequentially, so the output only depends on the entry order.
+		for (size_t idx = batchBegin; idx < batchEnd; ++idx) {
+			if (iCancelCheck && iCancelCheck())
+				return false;
+			if (iProgress)
+				iProgress(static_cast<uint32_t>(idx), totalEntries);
+
+			const auto& entry = m_entries[idx];
+
+			TocEntry tocEntry;
+			tocEntry.pathHash = hashPath(entry.packPath);
+			tocEntry.path = entry.packPath;
+			tocEntry.originalSize = entry.rawData.size();
+			tocEntry.assetType = entry.assetType;
+
+			if (owners[idx] != idx) {
+				// Duplicate: share the blob already written for the first occurrence.
+				const auto& owner = tocEntries[owners[idx]];
+				tocEntry.dataOffset = owner.dataOffset;
+				tocEntry.dataSize = owner.dataSize;
+				tocEntry.frameSize = owner.frameSize;
+				tocEntry.frameOffsets = owner.frameOffsets;
+				tocEntries.push_back(std::move(tocEntry));
+				continue;
+			}
+
+			tocEntry.dataOffset = static_cast<uint64_t>(file.tellp());
+			if (!compress && !obfuscate) {
+				tocEntry.dataSize = entry.rawData.size();
+				file.write(reinterpret_cast<const char*>(entry.rawData.data()),
+						   static_cast<std::streamsize>(entry.rawData.size()));
+			} else {
+				auto& block = blocks[idx - batchBegin];
+				if (!block.has_value()) {
+					OWL_CORE_ERROR("Pack: compression failed on entry '{}' ({} bytes).", entry.packPath,
+								   entry.rawData.size())
+					return false;
+				}
+				tocEntry.dataSize = block->data.size();
+				tocEntry.frameSize = block->frameSize;
+				tocEntry.frameOffsets = std::move(block->frameOffsets);
+				file.write(reinterpret_cast<const char*>(block->data.data()),
+						   static_cast<std::streamsize>(block->data.size()));
+				// Release the block as soon as it is on disk.
+				block.reset();
+			}
+
+			tocEntries.push_back(std::move(tocEntry));
+		}
 	}
 
 	// Write TOC.
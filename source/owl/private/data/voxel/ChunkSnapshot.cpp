@@ -0,0 +1,83 @@
+/**
+ * @file ChunkSnapshot.cpp
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright (c) 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "owlpch.h"
+
+#include "data/voxel/ChunkSnapshot.h"
+
+#include <array>
+
+namespace owl::data::voxel {
+
+namespace {
+constexpr int32_t k_Size = static_cast<int32_t>(g_ChunkSize);
+constexpr int32_t k_Padded = k_Size + 2;
+
+/// Index of a local coordinate in `[-1, g_ChunkSize]` inside the padded apron.
+constexpr auto apronIndex(const int32_t iX, const int32_t iY, const int32_t iZ) -> size_t {
+	return static_cast<size_t>(((iY + 1) * k_Padded + (iZ + 1)) * k_Padded + (iX + 1));
+}
+
+/// Which of the 3 neighbour slots (-1, 0, +1) a padded local coordinate falls in.
+constexpr auto neighborSlot(const int32_t iLocal) -> int32_t { return iLocal < 0 ? 0 : (iLocal >= k_Size ? 2 : 1); }
+}// namespace
+
+auto ChunkSnapshot::capture(const VoxelWorld& iWorld, const math::vec3i& iCoord) -> ChunkSnapshot {
+	ChunkSnapshot snapshot;
+	if (const auto chunk = iWorld.getChunk(iCoord))
+		snapshot.m_chunk = *chunk;
+	else
+		snapshot.m_chunk = Chunk{iCoord};
+	snapshot.m_chunk.setCoord(iCoord);
+	snapshot.m_apron.assign(static_cast<size_t>(k_Padded) * k_Padded * k_Padded, g_AirBlock);
+
+	// Resolve the 26 neighbours once; the shell fill then indexes them directly.
+	std::array<shared<Chunk>, 27> neighbors;
+	for (int32_t dy = -1; dy <= 1; ++dy)
+		for (int32_t dz = -1; dz <= 1; ++dz)
+			for (int32_t dx = -1; dx <= 1; ++dx) {
+				if (dx == 0 && dy == 0 && dz == 0)
+					continue;
+				neighbors[static_cast<size_t>(((dy + 1) * 3 + (dz + 1)) * 3 + (dx + 1))] =
+						iWorld.getChunk(math::vec3i{iCoord.x() + dx, iCoord.y() + dy, iCoord.z() + dz});
+			}
+	const auto wrap = [](const int32_t iLocal) -> int32_t { return (iLocal + k_Size) % k_Size; };
+	for (int32_t y = -1; y <= k_Size; ++y)
+		for (int32_t z = -1; z <= k_Size; ++z)
+			for (int32_t x = -1; x <= k_Size; ++x) {
+				const int32_t sx = neighborSlot(x);
+				const int32_t sy = neighborSlot(y);
+				const int32_t sz = neighborSlot(z);
+				if (sx == 1 && sy == 1 && sz == 1) {
+					x = k_Size - 1;// skip the interior run of this row
+					continue;
+				}
+				const auto& neighbor = neighbors[static_cast<size_t>((sy * 3 + sz) * 3 + sx)];
+				if (neighbor)
+					snapshot.m_apron[apronIndex(x, y, z)] = neighbor->getBlock(wrap(x), wrap(y), wrap(z));
+			}
+	return snapshot;
+}
+
+auto ChunkSnapshot::getBlock(const int32_t iX, const int32_t iY, const int32_t iZ) const -> BlockId {
+	if (iX < -1 || iY < -1 || iZ < -1 || iX > k_Size || iY > k_Size || iZ > k_Size)
+		return g_AirBlock;
+	if (iX >= 0 && iY >= 0 && iZ >= 0 && iX < k_Size && iY < k_Size && iZ < k_Size)
+		return m_chunk.getBlock(iX, iY, iZ);
+	if (m_apron.empty())
+		return g_AirBlock;
+	return m_apron[apronIndex(iX, iY, iZ)];
+}
+
+auto ChunkSnapshot::meshByKind(const BlockRegistry& iRegistry, const bool iAmbientOcclusion) const -> ChunkMeshSet {
+	return ChunkMesher::meshByKind(
+			m_chunk, iRegistry,
+			[this](const int32_t iX, const int32_t iY, const int32_t iZ) -> BlockId { return getBlock(iX, iY, iZ); },
+			iAmbientOcclusion);
+}
+
+}// namespace owl::data::voxel
@@ -0,0 +1,91 @@
+/**
+ * @file ChunkStreamPlanner.cpp
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright (c) 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "owlpch.h"
+
+#include "data/voxel/ChunkStreamPlanner.h"
+
+namespace owl::data::voxel {
+
+namespace {
+/// Missing candidates gathered per requested chunk before the view re-ranking (wider window = stronger view bias).
+constexpr size_t k_CandidateFactor = 4;
+
+auto distanceSq(const math::vec3i& iOffset) -> int32_t {
+	return iOffset.x() * iOffset.x() + iOffset.y() * iOffset.y() + iOffset.z() * iOffset.z();
+}
+
+/// Priority of an offset: squared distance scaled down when it faces the view direction (lower is better).
+auto viewScore(const math::vec3i& iOffset, const math::vec3& iViewDirection) -> float {
+	const auto dist = static_cast<float>(distanceSq(iOffset));
+	if (dist <= 0.f)
+		return 0.f;
+	const math::vec3 dir{static_cast<float>(iOffset.x()), static_cast<float>(iOffset.y()),
+						 static_cast<float>(iOffset.z())};
+	const float facing = (dir * iViewDirection) / std::sqrt(dist);
+	// facing in [-1, 1] maps to a weight in [1.5, 0.5]: chunks ahead count as twice closer than chunks behind.
+	return dist * (1.f - 0.5f * facing);
+}
+}// namespace
+
+void ChunkStreamPlanner::configure(const int32_t iRadius, const int32_t iHeight) {
+	const int32_t radius = std::max(0, iRadius);
+	const int32_t height = std::max(0, iHeight);
+	if (radius == m_radius && height == m_height)
+		return;
+	m_radius = radius;
+	m_height = height;
+	m_offsets.clear();
+	m_offsets.reserve(static_cast<size_t>(2 * radius + 1) * static_cast<size_t>(2 * radius + 1) *
+					  static_cast<size_t>(2 * height + 1));
+	for (int32_t dy = -height; dy <= height; ++dy)
+		for (int32_t dz = -radius; dz <= radius; ++dz)
+			for (int32_t dx = -radius; dx <= radius; ++dx) m_offsets.emplace_back(dx, dy, dz);
+	// Stable sort keeps the deterministic y/z/x order inside each ring.
+	std::ranges::stable_sort(m_offsets, [](const math::vec3i& iA, const math::vec3i& iB) -> bool {
+		return distanceSq(iA) < distanceSq(iB);
+	});
+	m_cursor = 0;
+}
+
+auto ChunkStreamPlanner::plan(const math::vec3i& iCenter, const math::vec3& iViewDirection, const size_t iBudget,
+							  const KnownPredicate& iIsKnown) -> std::vector<math::vec3i> {
+	std::vector<math::vec3i> result;
+	if (m_center != iCenter) {
+		m_center = iCenter;
+		m_cursor = 0;
+	}
+	const auto absolute = [this](const math::vec3i& iOffset) -> math::vec3i {
+		return math::vec3i{m_center.x() + iOffset.x(), m_center.y() + iOffset.y(), m_center.z() + iOffset.z()};
+	};
+	// Skip the leading run of known chunks: it only grows until the centre moves.
+	while (m_cursor < m_offsets.size() && iIsKnown(absolute(m_offsets[m_cursor]))) ++m_cursor;
+	if (iBudget == 0 || m_cursor == m_offsets.size())
+		return result;
+
+	// Gather the nearest missing candidates, then favour the ones the camera is looking at.
+	const size_t window = iBudget * k_CandidateFactor;
+	std::vector<math::vec3i> candidates;
+	candidates.reserve(std::min(window, m_offsets.size() - m_cursor));
+	for (size_t i = m_cursor; i < m_offsets.size() && candidates.size() < window; ++i) {
+		if (!iIsKnown(absolute(m_offsets[i])))
+			candidates.push_back(m_offsets[i]);
+	}
+	const size_t count = std::min(iBudget, candidates.size());
+	const auto scoreOf = [&iViewDirection](const math::vec3i& iOffset) -> float {
+		return viewScore(iOffset, iViewDirection);
+	};
+	std::ranges::partial_sort(candidates, candidates.begin() + static_cast<std::ptrdiff_t>(count),
+							  [&scoreOf](const math::vec3i& iA, const math::vec3i& iB) -> bool {
+								  return scoreOf(iA) < scoreOf(iB);
+							  });
+	result.reserve(count);
+	for (size_t i = 0; i < count; ++i) result.push_back(absolute(candidates[i]));
+	return result;
+}
+
+}// namespace owl::data::voxel
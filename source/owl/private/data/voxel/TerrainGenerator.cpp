@@ -9,23 +9,36 @@
 
 #include "data/voxel/TerrainGenerator.h"
 
+#include <array>
 #include <cmath>
 
 namespace owl::data::voxel {
 
+namespace {
+constexpr auto k_Size = static_cast<int32_t>(g_ChunkSize);
+constexpr size_t k_Columns = static_cast<size_t>(g_ChunkSize) * g_ChunkSize;
+
+/// Scaled world coordinates of a chunk's columns, laid out `lz * g_ChunkSize + lx` (the `heightAt` inputs).
+void fillColumnCoords(const int32_t iBaseX, const int32_t iBaseZ, const float iFrequency,
+					  std::array<float, k_Columns>& oXs, std::array<float, k_Columns>& oZs) {
+	for (int32_t lz = 0; lz < k_Size; ++lz)
+		for (int32_t lx = 0; lx < k_Size; ++lx) {
+			const auto index = static_cast<size_t>(lz * k_Size + lx);
+			oXs[index] = static_cast<float>(iBaseX + lx) * iFrequency;
+			oZs[index] = static_cast<float>(iBaseZ + lz) * iFrequency;
+		}
+}
+}// namespace
+
 TerrainGenerator::TerrainGenerator(const TerrainParams& iParams)
 	: m_params{iParams}, m_height{iParams.seed}, m_cave{iParams.seed + 1U}, m_biome{iParams.seed + 2U} {}
 
-auto TerrainGenerator::surfaceBlock(const int32_t iWorldX, const int32_t iWorldZ) const -> BlockId {
-	if (!m_params.biomes)
-		return m_params.grass;
-	const float b = m_biome.fbm(static_cast<float>(iWorldX) * m_params.biomeFrequency,
-								static_cast<float>(iWorldZ) * m_params.biomeFrequency, 3U, 2.f, 0.5f);
-	if (b < -0.4f)
+auto TerrainGenerator::surfaceBlock(const float iBiome) const -> BlockId {
+	if (iBiome < -0.4f)
 		return m_params.sand;// desert
-	if (b < 0.2f)
+	if (iBiome < 0.2f)
 		return m_params.grass;// plains
-	if (b < 0.6f)
+	if (iBiome < 0.6f)
 		return m_params.snow != g_AirBlock ? m_params.snow : m_params.grass;// snowy
 	return m_params.stone;// rocky mountain top
 }
@@ -37,21 +50,47 @@ auto TerrainGenerator::heightAt(const int32_t iWorldX, const int32_t iWorldZ) co
 	return m_params.baseHeight + static_cast<int32_t>(std::lround(n * static_cast<float>(m_params.amplitude)));
 }
 
+void TerrainGenerator::chunkHeights(const int32_t iBaseX, const int32_t iBaseZ,
+								   const std::span<int32_t> oHeights) const {
+	OWL_CORE_ASSERT(oHeights.size() == k_Columns, "TerrainGenerator: heightmap must hold one chunk footprint")
+	std::array<float, k_Columns> xs{};
+	std::array<float, k_Columns> zs{};
+	fillColumnCoords(iBaseX, iBaseZ, m_params.frequency, xs, zs);
+	std::array<float, k_Columns> noise{};
+	m_height.fbm(xs, zs, noise, m_params.octaves, m_params.lacunarity, m_params.persistence);
+	for (size_t i = 0; i < k_Columns; ++i)
+		oHeights[i] = m_params.baseHeight +
+					  static_cast<int32_t>(std::lround(noise[i] * static_cast<float>(m_params.amplitude)));
+}
+
 void TerrainGenerator::generateChunk(Chunk& ioChunk) const { generateChunk(ioChunk, ioChunk.getCoord()); }
 
 void TerrainGenerator::generateChunk(Chunk& ioChunk, const math::vec3i& iChunkCoord) const {
-	const auto size = static_cast<int32_t>(g_ChunkSize);
-	const int32_t baseX = iChunkCoord.x() * size;
-	const int32_t baseY = iChunkCoord.y() * size;
-	const int32_t baseZ = iChunkCoord.z() * size;
+	const int32_t baseX = iChunkCoord.x() * k_Size;
+	const int32_t baseY = iChunkCoord.y() * k_Size;
+	const int32_t baseZ = iChunkCoord.z() * k_Size;
 	const bool caves = m_params.caveThreshold < 1.f;
 	ioChunk.fill(g_AirBlock);
-	for (int32_t lz = 0; lz < size; ++lz) {
-		for (int32_t lx = 0; lx < size; ++lx) {
+	// The whole heightmap in one batched noise call instead of one fBm per column.
+	std::array<int32_t, k_Columns> heights{};
+	chunkHeights(baseX, baseZ, heights);
+	// Biome values are only needed when a column surface above the sea falls inside this chunk.
+	std::array<float, k_Columns> biomes{};
+	if (m_params.biomes && std::ranges::any_of(heights, [&](const int32_t iHeight) -> bool {
+			return iHeight >= baseY && iHeight < baseY + k_Size && iHeight >= m_params.seaLevel;
+		})) {
+		std::array<float, k_Columns> xs{};
+		std::array<float, k_Columns> zs{};
+		fillColumnCoords(baseX, baseZ, m_params.biomeFrequency, xs, zs);
+		m_biome.fbm(xs, zs, biomes, 3U, 2.f, 0.5f);
+	}
+	for (int32_t lz = 0; lz < k_Size; ++lz) {
+		for (int32_t lx = 0; lx < k_Size; ++lx) {
 			const int32_t worldX = baseX + lx;
 			const int32_t worldZ = baseZ + lz;
-			const int32_t height = heightAt(worldX, worldZ);
-			for (int32_t ly = 0; ly < size; ++ly) {
+			const auto column = static_cast<size_t>(lz * k_Size + lx);
+			const int32_t height = heights[column];
+			for (int32_t ly = 0; ly < k_Size; ++ly) {
 				const int32_t worldY = baseY + ly;
 				if (worldY > height) {
 					if (m_params.water != g_AirBlock && worldY <= m_params.seaLevel)
@@ -61,7 +100,9 @@ void TerrainGenerator::generateChunk(Chunk& ioChunk, const math::vec3i& iChunkCo
 				const int32_t depth = height - worldY;
 				BlockId block = m_params.stone;
 				if (depth == 0)
-					block = worldY < m_params.seaLevel ? m_params.sand : surfaceBlock(worldX, worldZ);
+					block = worldY < m_params.seaLevel
+									? m_params.sand
+									: (m_params.biomes ? surfaceBlock(biomes[column]) : m_params.grass);
 				else if (depth <= m_params.dirtDepth)
 					block = m_params.dirt;
 				// Carve caves below the immediate surface only, so the ground crust stays intact.
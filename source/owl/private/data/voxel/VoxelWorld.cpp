@@ -75,6 +75,13 @@ auto VoxelWorld::getOrCreateChunk(const math::vec3i& iCoord) -> shared<Chunk> {
 	return chunk;
 }
 
+void VoxelWorld::insertChunk(shared<Chunk> iChunk) {
+	if (!iChunk)
+		return;
+	const uint64_t key = packChunkKey(iChunk->getCoord());
+	m_chunks.insert_or_assign(key, std::move(iChunk));
+}
+
 auto VoxelWorld::hasChunk(const math::vec3i& iCoord) const -> bool { return m_chunks.contains(packChunkKey(iCoord)); }
 
 auto VoxelWorld::removeChunk(const math::vec3i& iCoord) -> bool { return m_chunks.erase(packChunkKey(iCoord)) > 0; }
@@ -9,15 +9,228 @@
 
 #include "debug/Profiler.h"
 
+#include <condition_variable>
+#include <cstring>
 #include <mutex>
+#include <unordered_set>
 
 namespace owl::debug {
 
+namespace {
+/// Magic bytes and version of binary session files.
+constexpr std::array<char, 8> g_binaryMagic = {'O', 'W', 'L', 'P', 'R', 'O', 'F', 1};
+/// Events buffered per thread (power of two).
+constexpr size_t g_ringCapacity = size_t{1} << 14;
+/// Period of the background drain.
+constexpr auto g_drainPeriod = std::chrono::milliseconds(10);
+
+/// Record tags of binary session files.
+enum struct RecordTag : uint8_t {
+	Name = 'N',///< `u32 id, u16 length, chars`: first use of a scope name.
+	Event = 'E',///< `u32 name id, u32 thread index, i64 start ns, i64 duration ns`.
+	Dropped = 'D',///< `u64 count`: events lost to full rings, written at the end of the session.
+};
+
+/// One finished scope, as stored in a ring.
+struct BinaryEvent {
+	const char* name;
+	int64_t startNs;
+	int64_t durationNs;
+};
+
+/**
+ * @brief
+ *  Single-producer single-consumer ring of events owned by one thread.
+ */
+struct EventRing {
+	std::array<BinaryEvent, g_ringCapacity> events{};
+	/// Next slot written by the owner thread.
+	alignas(64) std::atomic<size_t> head{0};
+	/// Owner's last view of `tail`, refreshed only when the ring looks full (avoids sharing the drain's line).
+	size_t cachedTail = 0;
+	/// Events that did not fit (written by the owner thread only).
+	std::atomic<uint64_t> dropped{0};
+	/// Next slot read by the drain.
+	alignas(64) std::atomic<size_t> tail{0};
+	/// Stable index of the owner thread (the `tid` of the trace).
+	uint32_t threadIndex = 0;
+	/// Value of `dropped` when the current session started.
+	uint64_t droppedAtStart = 0;
+	/// Set when the owner thread exits: no more events will come.
+	std::atomic<bool> retired{false};
+
+	void push(const BinaryEvent& iEvent) {
+		const size_t slot = head.load(std::memory_order_relaxed);
+		if (slot - cachedTail >= g_ringCapacity) {
+			cachedTail = tail.load(std::memory_order_acquire);
+			if (slot - cachedTail >= g_ringCapacity) {
+				dropped.store(dropped.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+				return;
+			}
+		}
+		events[slot & (g_ringCapacity - 1)] = iEvent;
+		head.store(slot + 1, std::memory_order_release);
+	}
+
+	template<typename Func>
+	void drain(Func&& iFunc) {
+		size_t slot = tail.load(std::memory_order_relaxed);
+		const size_t end = head.load(std::memory_order_acquire);
+		for (; slot != end; ++slot) iFunc(events[slot & (g_ringCapacity - 1)]);
+		tail.store(slot, std::memory_order_release);
+	}
+
+	void discard() { tail.store(head.load(std::memory_order_acquire), std::memory_order_release); }
+};
+
+/**
+ * @brief
+ *  The rings in use; a ring outlives its thread until the drain has emptied it.
+ */
+struct RingRegistry {
+	std::mutex mutex;
+	std::vector<shared<EventRing>> rings;
+	/// Index given to the next thread.
+	uint32_t nextThreadIndex = 0;
+
+	static auto get() -> RingRegistry& {
+		static RingRegistry instance;
+		return instance;
+	}
+};
+
+/**
+ * @brief
+ *  Thread's handle on its ring, retiring it when the thread exits.
+ */
+struct ThreadRing {
+	shared<EventRing> ring;
+
+	ThreadRing() : ring{mkShared<EventRing>()} {
+		auto& registry = RingRegistry::get();
+		const std::lock_guard lock(registry.mutex);
+		ring->threadIndex = registry.nextThreadIndex++;
+		registry.rings.push_back(ring);
+	}
+	~ThreadRing() { ring->retired.store(true, std::memory_order_release); }
+	ThreadRing(const ThreadRing&) = delete;
+	ThreadRing(ThreadRing&&) = delete;
+	auto operator=(const ThreadRing&) -> ThreadRing& = delete;
+	auto operator=(ThreadRing&&) -> ThreadRing& = delete;
+};
+
+/// Ring of the calling thread, registered on first use.
+auto threadRing() -> EventRing& {
+	thread_local ThreadRing handle;
+	return *handle.ring;
+}
+
+template<typename T>
+void writePod(std::ostream& ioStream, const T& iValue) {
+	ioStream.write(reinterpret_cast<const char*>(&iValue), sizeof(T));
+}
+
+template<typename T>
+auto readPod(std::istream& ioStream, T& oValue) -> bool {
+	ioStream.read(reinterpret_cast<char*>(&oValue), sizeof(T));
+	return ioStream.good();
+}
+
+auto nanoseconds(const std::chrono::steady_clock::time_point iTime) -> int64_t {
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(iTime.time_since_epoch()).count();
+}
+}// namespace
+
+/**
+ * @brief
+ *  State of a running binary session.
+ */
+struct Profiler::BinaryCapture {
+	/**
+	 * @brief
+	 *  Constructor.
+	 * @param[in,out] ioDropped Counter receiving the events dropped during the session.
+	 */
+	explicit BinaryCapture(std::atomic<uint64_t>& ioDropped) : dropped{ioDropped} {}
+
+	/// Session file.
+	std::ofstream output;
+	/// Ids of the scope names already written.
+	std::unordered_map<const char*, uint32_t> nameIds;
+	/// Events dropped during the session by the rings already retired.
+	uint64_t retiredDropped = 0;
+	/// Events dropped during the session (the profiler's counter).
+	std::atomic<uint64_t>& dropped;
+	/// Wakes the drain thread early on shutdown.
+	std::condition_variable wake;
+	/// Protects the stop request.
+	std::mutex wakeMutex;
+	/// Stop request for the drain thread.
+	bool stopRequested = false;
+	/// Background drain thread.
+	std::thread drainThread;
+
+	void drainAll() {
+		auto& registry = RingRegistry::get();
+		std::vector<shared<EventRing>> rings;
+		{
+			const std::lock_guard lock(registry.mutex);
+			rings = registry.rings;
+		}
+		std::vector<EventRing*> emptied;
+		uint64_t droppedTotal = retiredDropped;
+		for (const auto& ring: rings) {
+			// Checked before draining: a retired ring gets no more events, so once drained it is done.
+			const bool retired = ring->retired.load(std::memory_order_acquire);
+			ring->drain([this, &ring](const BinaryEvent& iEvent) -> void { writeEvent(ring->threadIndex, iEvent); });
+			const uint64_t lost = ring->dropped.load(std::memory_order_relaxed) - ring->droppedAtStart;
+			droppedTotal += lost;
+			if (retired) {
+				retiredDropped += lost;
+				emptied.push_back(ring.get());
+			}
+		}
+		dropped.store(droppedTotal, std::memory_order_relaxed);
+		if (!emptied.empty()) {
+			const std::lock_guard lock(registry.mutex);
+			std::erase_if(registry.rings, [&emptied](const shared<EventRing>& iRing) -> bool {
+				return std::ranges::find(emptied, iRing.get()) != emptied.end();
+			});
+		}
+	}
+
+	void writeEvent(const uint32_t iThreadIndex, const BinaryEvent& iEvent) {
+		auto [it, inserted] = nameIds.try_emplace(iEvent.name, static_cast<uint32_t>(nameIds.size()));
+		if (inserted) {
+			const auto length = static_cast<uint16_t>(std::min<size_t>(std::strlen(iEvent.name), UINT16_MAX));
+			writePod(output, RecordTag::Name);
+			writePod(output, it->second);
+			writePod(output, length);
+			output.write(iEvent.name, length);
+		}
+		writePod(output, RecordTag::Event);
+		writePod(output, it->second);
+		writePod(output, iThreadIndex);
+		writePod(output, iEvent.startNs);
+		writePod(output, iEvent.durationNs);
+	}
+
+	void run() {
+		std::unique_lock lock(wakeMutex);
+		while (!stopRequested) {
+			wake.wait_for(lock, g_drainPeriod, [this] -> bool { return stopRequested; });
+			lock.unlock();
+			drainAll();
+			lock.lock();
+		}
+	}
+};
+
 Profiler::Profiler() = default;
 
 Profiler::~Profiler() { endSession(); }
 
-void Profiler::beginSession(const std::string& iName, const std::string& iFilepath) {
+void Profiler::beginSession(const std::string& iName, const std::string& iFilepath, const ProfileFormat iFormat) {
 	const std::lock_guard<std::mutex> lock(m_profilerMutex);
 	if (m_currentSession) {
 
@@ -27,6 +240,39 @@ void Profiler::beginSession(const std::string& iName, const std::string& iFilepa
 		}
 		internalEndSession();
 	}
+	if (iFormat == ProfileFormat::Binary) {
+		m_droppedEvents.store(0, std::memory_order_relaxed);
+		auto capture = mkUniq<BinaryCapture>(m_droppedEvents);
+		capture->output.open(iFilepath, std::ios::binary);
+		if (capture->output.is_open()) {
+			capture->output.write(g_binaryMagic.data(), g_binaryMagic.size());
+			const auto nameLength = static_cast<uint16_t>(std::min<size_t>(iName.size(), UINT16_MAX));
+			writePod(capture->output, nameLength);
+			capture->output.write(iName.data(), nameLength);
+			// Forget whatever was pushed after the previous session ended.
+			auto& registry = RingRegistry::get();
+			{
+				const std::lock_guard registryLock(registry.mutex);
+				// Rings of threads gone since the previous session have nothing left to give.
+				std::erase_if(registry.rings, [](const shared<EventRing>& iRing) -> bool {
+					return iRing->retired.load(std::memory_order_acquire);
+				});
+				for (const auto& ring: registry.rings) {
+					ring->discard();
+					ring->droppedAtStart = ring->dropped.load(std::memory_order_relaxed);
+				}
+			}
+			m_currentSession = mkUniq<ProfileSession>(iName);
+			m_binaryCapture = std::move(capture);
+			m_binaryCapture->drainThread = std::thread([captured = m_binaryCapture.get()] -> void { captured->run(); });
+			m_binaryActive.store(true, std::memory_order_release);
+			return;
+		}
+		if (core::Log::initiated()) {
+			OWL_CORE_ERROR("Instrumentor could not open results file '{}'.", iFilepath)
+		}
+		return;
+	}
 	m_outputStream.open(iFilepath);
 
 	if (m_outputStream.is_open()) {
@@ -44,6 +290,100 @@ void Profiler::endSession() {
 	internalEndSession();
 }
 
+void Profiler::recordScope(const char* iName, const std::chrono::steady_clock::time_point iStart,
+						   const std::chrono::steady_clock::time_point iEnd) {
+	if (m_binaryActive.load(std::memory_order_acquire)) {
+		const int64_t start = nanoseconds(iStart);
+		threadRing().push({.name = iName, .startNs = start, .durationNs = nanoseconds(iEnd) - start});
+		return;
+	}
+	const auto highResStart = FloatingPointMicroseconds{iStart.time_since_epoch()};
+	const auto elapsedTime = std::chrono::time_point_cast<std::chrono::microseconds>(iEnd).time_since_epoch() -
+							 std::chrono::time_point_cast<std::chrono::microseconds>(iStart).time_since_epoch();
+	writeProfile({.name = iName,
+				  .start = highResStart,
+				  .elapsedTime = elapsedTime,
+				  .threadId = std::this_thread::get_id()});
+}
+
+auto Profiler::internName(const std::string_view iName) -> const char* {
+	static std::mutex mutex;
+	// Node-based: the stored strings never move.
+	static std::unordered_set<std::string> names;
+	const std::lock_guard lock(mutex);
+	return names.emplace(iName).first->c_str();
+}
+
+auto Profiler::getThreadBufferCount() -> size_t {
+	auto& registry = RingRegistry::get();
+	const std::lock_guard lock(registry.mutex);
+	return registry.rings.size();
+}
+
+auto Profiler::getDroppedEvents() const -> uint64_t { return m_droppedEvents.load(std::memory_order_relaxed); }
+
+auto Profiler::convertToChromeTrace(const std::filesystem::path& iBinaryFile, const std::filesystem::path& iJsonFile)
+		-> bool {
+	std::ifstream input(iBinaryFile, std::ios::binary);
+	std::array<char, g_binaryMagic.size()> magic{};
+	if (!input.read(magic.data(), magic.size()) || magic != g_binaryMagic)
+		return false;
+	uint16_t nameLength = 0;
+	if (!readPod(input, nameLength))
+		return false;
+	if (input.ignore(nameLength).gcount() != nameLength)
+		return false;
+
+	std::ofstream output(iJsonFile);
+	if (!output.is_open())
+		return false;
+	output << std::setprecision(3) << std::fixed;
+	output << R"({"otherData": {},"traceEvents":[{})";
+
+	std::vector<std::string> names;
+	RecordTag tag{};
+	while (readPod(input, tag)) {
+		if (tag == RecordTag::Name) {
+			uint32_t id = 0;
+			uint16_t length = 0;
+			if (!readPod(input, id) || !readPod(input, length))
+				return false;
+			std::string name(length, '\0');
+			if (!input.read(name.data(), length))
+				return false;
+			std::ranges::replace(name, '"', '\'');
+			if (names.size() <= id)
+				names.resize(id + 1);
+			names[id] = std::move(name);
+		} else if (tag == RecordTag::Event) {
+			uint32_t id = 0;
+			uint32_t thread = 0;
+			int64_t start = 0;
+			int64_t duration = 0;
+			if (!readPod(input, id) || !readPod(input, thread) || !readPod(input, start) || !readPod(input, duration) ||
+				id >= names.size())
+				return false;
+			output << ",{";
+			output << R"("cat":"function",)";
+			output << "\"dur\":" << static_cast<double>(duration) / 1000.0 << ',';
+			output << R"("name":")" << names[id] << "\",";
+			output << R"("ph":"X",)";
+			output << "\"pid\":0,";
+			output << "\"tid\":" << thread << ",";
+			output << "\"ts\":" << static_cast<double>(start) / 1000.0;
+			output << "}";
+		} else if (tag == RecordTag::Dropped) {
+			uint64_t dropped = 0;
+			if (!readPod(input, dropped))
+				return false;
+		} else {
+			return false;
+		}
+	}
+	output << "]}";
+	return output.good();
+}
+
 void Profiler::writeProfile(const ProfileResult& iResult) {
 	std::stringstream json;
 
@@ -76,6 +416,22 @@ void Profiler::writeFooter() {
 }
 
 void Profiler::internalEndSession() {
+	if (m_binaryCapture) {
+		m_binaryActive.store(false, std::memory_order_release);
+		{
+			const std::lock_guard wakeLock(m_binaryCapture->wakeMutex);
+			m_binaryCapture->stopRequested = true;
+		}
+		m_binaryCapture->wake.notify_one();
+		m_binaryCapture->drainThread.join();
+		m_binaryCapture->drainAll();
+		writePod(m_binaryCapture->output, RecordTag::Dropped);
+		writePod(m_binaryCapture->output, m_droppedEvents.load(std::memory_order_relaxed));
+		m_binaryCapture->output.close();
+		m_binaryCapture.reset();
+		m_currentSession.reset();
+		return;
+	}
 	if (m_currentSession) {
 		writeFooter();
 		m_outputStream.close();
@@ -84,7 +440,11 @@ void Profiler::internalEndSession() {
 	}
 }
 
-ProfileTimer::ProfileTimer(const char* iName) : m_name(iName), m_startTimePoint{std::chrono::steady_clock::now()} {}
+ProfileTimer::ProfileTimer(const std::string_view iName)
+	: m_name(Profiler::internName(iName)), m_startTimePoint{std::chrono::steady_clock::now()} {}
+
+ProfileTimer::ProfileTimer(const StaticName iName)
+	: m_name(iName.name), m_startTimePoint{std::chrono::steady_clock::now()} {}
 
 ProfileTimer::~ProfileTimer() {
 	if (!m_stopped)
@@ -92,17 +452,7 @@ ProfileTimer::~ProfileTimer() {
 }
 
 void ProfileTimer::stop() {
-	const auto endTimePoint = std::chrono::steady_clock::now();
-	const auto highResStart = FloatingPointMicroseconds{m_startTimePoint.time_since_epoch()};
-	const auto elapsedTime =
-			std::chrono::time_point_cast<std::chrono::microseconds>(endTimePoint).time_since_epoch() -
-			std::chrono::time_point_cast<std::chrono::microseconds>(m_startTimePoint).time_since_epoch();
-
-	Profiler::get().writeProfile({.name = m_name,
-								  .start = highResStart,
-								  .elapsedTime = elapsedTime,
-								  .threadId = std::this_thread::get_id()});
-
+	Profiler::get().recordScope(m_name, m_startTimePoint, std::chrono::steady_clock::now());
 	m_stopped = true;
 }
 
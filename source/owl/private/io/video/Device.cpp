@@ -9,132 +9,201 @@
 
 #include "io/video/Device.h"
 
-#include <cstring>
-#include <stb_image.h>
+#include "app/Application.h"
+#include "io/video/LatestFrameSlot.h"
+#include "io/video/PixelConversion.h"
+
+#include <thread>
 
 namespace owl::io::video {
 
 namespace {
+/// Waiting time of a synchronous grab.
+constexpr std::chrono::milliseconds g_syncTimeout{100};
+/// Waiting time of one grab-thread poll, bounding the reaction to a stop request.
+constexpr std::chrono::milliseconds g_grabTimeout{50};
 
-OWL_DIAG_PUSH
-OWL_DIAG_DISABLE_CLANG16("-Wunsafe-buffer-usage")
-// NOLINTBEGIN(*-magic-numbers)
-void convertNv12ToRgb24(const uint8_t* iNv12Buffer, const math::vec2ui& iSize, uint8_t* oRgb24Buffer) {
-	// Each component Y occupy width * height bytes.
-	const uint32_t ySize = iSize.surface();
-
-	// Pointers to component Y, U and V in buffer NV12
-	const uint8_t* yComponent = iNv12Buffer;
-	const uint8_t* uvComponent = iNv12Buffer + ySize;
-
-	for (uint32_t i = 0; i < iSize.y(); i++) {
-		for (uint32_t j = 0; j < iSize.x(); j++) {
-			// index in buffer NV12
-			const uint32_t yIndex = i * iSize.x() + j;
-			const uint32_t uvIndex = (i / 2ul * iSize.x()) + (j & ~1ul);
-			// index in buffer RGB24
-			const uint32_t rgbIndex = ((i + 1) * iSize.x() - j - 1) * 3;
-			// Convert YUV to RGB
-			const int32_t c = yComponent[yIndex] - 16;
-			const int32_t d = uvComponent[uvIndex] - 128;
-			const int32_t e = uvComponent[uvIndex + 1] - 128;
-			// Compute RGB component, limit values in range [0, 255]
-			oRgb24Buffer[rgbIndex] = static_cast<uint8_t>(math::clamp((298 * c + 409 * e + 128) >> 8, 0, 255));
-			oRgb24Buffer[rgbIndex + 1] =
-					static_cast<uint8_t>(math::clamp((298 * c - 100 * d - 208 * e + 128) >> 8, 0, 255));
-			oRgb24Buffer[rgbIndex + 2] = static_cast<uint8_t>(math::clamp((298 * c + 516 * d + 128) >> 8, 0, 255));
-		}
-	}
+auto conversionScheduler() -> core::task::Scheduler* {
+	return app::Application::instanced() ? &app::Application::get().getTaskScheduler() : nullptr;
 }
 
-void convertYuYvToRgb24(const uint8_t* iYuYvBuffer, const math::vec2ui& iSize, uint8_t* oRgb24Buffer) {
-	// Each component YUV takes 2 bytes in YUYV format.
-	const uint32_t yuyvSize = iSize.surface() * 2;
-
-	for (uint32_t i = 0; i < yuyvSize; i += 4) {
-		// Convert YUV to RGB for first pixel
-		const int32_t c0 = iYuYvBuffer[i] - 16;
-		const int32_t d0 = iYuYvBuffer[i + 1] - 128;
-		const int32_t e0 = iYuYvBuffer[i + 3] - 128;
-		// Convert YUV to RGB for second pixel
-		const int32_t c1 = iYuYvBuffer[i + 2] - 16;
-		// Indices dans le tampon RGB24
-		const uint32_t rgbIndex = i * 3 / 2;
-
-		// Store RGB component in RGB24 buffer for the 2 pixels.
-		oRgb24Buffer[rgbIndex] = static_cast<uint8_t>(math::clamp((298 * c0 + 409 * e0 + 128) >> 8, 0, 255));
-		oRgb24Buffer[rgbIndex + 1] =
-				static_cast<uint8_t>(math::clamp((298 * c0 - 100 * d0 - 208 * e0 + 128) >> 8, 0, 255));
-		oRgb24Buffer[rgbIndex + 2] = static_cast<uint8_t>(math::clamp((298 * c0 + 516 * d0 + 128) >> 8, 0, 255));
-
-		oRgb24Buffer[rgbIndex + 3] = static_cast<uint8_t>(math::clamp((298 * c1 + 409 * e0 + 128) >> 8, 0, 255));
-		oRgb24Buffer[rgbIndex + 4] =
-				static_cast<uint8_t>(math::clamp((298 * c1 - 100 * d0 - 208 * e0 + 128) >> 8, 0, 255));
-		oRgb24Buffer[rgbIndex + 5] = static_cast<uint8_t>(math::clamp((298 * c1 + 516 * d0 + 128) >> 8, 0, 255));
-	}
+/// Devices whose grab thread runs, stopped together before the application goes away.
+struct CaptureRegistry {
+	std::mutex mutex;
+	std::unordered_set<Device*> devices;
+};
+
+auto captureRegistry() -> CaptureRegistry& {
+	static CaptureRegistry registry;
+	return registry;
 }
+}// namespace
+
+struct Device::Capture {
+	/// Latest converted frame.
+	LatestFrameSlot<Frame> slot;
+	/// Stop request for the grab thread.
+	std::atomic<bool> stopRequested = false;
+	/// Frames converted by the grab thread.
+	std::atomic<uint64_t> grabbed = 0;
+	/// Frames taken by the consumer.
+	std::atomic<uint64_t> delivered = 0;
+	/// Frames lost.
+	std::atomic<uint64_t> dropped = 0;
+	/// Failed grabs or conversions.
+	std::atomic<uint64_t> failed = 0;
+	/// Scheduler of the conversions, resolved when the capture starts.
+	core::task::Scheduler* scheduler = nullptr;
+	/// The grab thread.
+	std::thread thread;
+};
+
+Device::Device(std::string iName) : m_name(std::move(iName)) {}
+
+Device::~Device() { stopCapture(); }
 
-void convertMJpegToRgb24(const uint8_t* iJpegBuffer, const int32_t iJpegSize, const math::vec2ui& iSize,
-						 uint8_t* oRgb24Buffer) {
-	int comp = 0;
-	int width = 0;
-	int height = 0;
-	stbi_set_flip_vertically_on_load(0);
-	uint8_t* buffer = stbi_load_from_memory(iJpegBuffer, iJpegSize, &width, &height, &comp, 3);
-	if (buffer == nullptr) {
-		OWL_CORE_WARN("Jpeg decoding: nullptr result.")
+void Device::fillFrame(shared<renderer::gpu::Texture>& ioFrame) {
+	OWL_PROFILE_FUNCTION()
+
+	if (!isOpened())
 		return;
-	}
-	if (iSize != math::vec2ui{static_cast<uint32_t>(width), static_cast<uint32_t>(height)}) {
-		OWL_CORE_WARN("Jpeg decoding: size mismatch ({} {}) expecting {} {}.", width, height, iSize.x(), iSize.y())
-		stbi_image_free(buffer);
+	if (isCapturing()) {
+		Frame* frame = acquireLatestFrame();
+		if (frame == nullptr || frame->size.surface() == 0)
+			return;
+		if (!ioFrame || ioFrame->getSize() != frame->size)
+			ioFrame = renderer::gpu::Texture2D::create({frame->size, renderer::gpu::ImageFormat::Rgb8});
+		ioFrame->setData(frame->pixels.data(), static_cast<uint32_t>(frame->pixels.size()));
 		return;
 	}
-	if (comp != 3) {
-		OWL_CORE_WARN("Jpeg decoding: wrong number of channels: {} expecting 3.", comp)
-		stbi_image_free(buffer);
+	if (!ioFrame || ioFrame->getSize() != m_size)
+		ioFrame = renderer::gpu::Texture2D::create({m_size, renderer::gpu::ImageFormat::Rgb8});
+	RawFrame raw;
+	if (!acquireRaw(raw, g_syncTimeout))
+		return;
+	const auto converted = getRgbBuffer(raw.data, static_cast<int32_t>(raw.size));
+	// the converted frame is owned by the device: give the raw one back before the upload.
+	releaseRaw();
+	if (!converted.empty())
+		ioFrame->setData(converted.data(), static_cast<uint32_t>(converted.size()));
+}
+
+void Device::startCapture() {
+	if (isCapturing())
 		return;
+	if (!isOpened()) {
+		OWL_CORE_WARN("Device ({}): cannot capture from a closed device.", m_name)
+		return;
+	}
+	if (mp_capture != nullptr && mp_capture->thread.joinable())
+		mp_capture->thread.join();
+	mp_capture = mkUniq<Capture>();
+	// resolved here: the grab thread must not reach the application, which may be torn down meanwhile.
+	mp_capture->scheduler = conversionScheduler();
+	{
+		auto& registry = captureRegistry();
+		const std::scoped_lock lock(registry.mutex);
+		registry.devices.insert(this);
 	}
-	for (int i = 0; i < height; ++i) {
-		for (int j = 0; j < width; ++j) {
-			const int sourceIndex = (i * width + j) * 3;
-			const int destinationIndex = ((i + 1) * width - j - 1) * 3;// Horizontal inversion
-			memcpy(oRgb24Buffer + destinationIndex, buffer + sourceIndex, 3);
+	mp_capture->thread = std::thread([this, capture = mp_capture.get()] -> void {
+		uint64_t sequence = 0;
+		while (!capture->stopRequested.load(std::memory_order_relaxed)) {
+			RawFrame raw;
+			if (!acquireRaw(raw, g_grabTimeout))
+				continue;
+			Frame& frame = capture->slot.back();
+			const bool converted = convertToRgb({raw.data, raw.size}, frame.pixels, capture->scheduler);
+			releaseRaw();
+			capture->dropped.fetch_add(raw.skipped, std::memory_order_relaxed);
+			if (!converted) {
+				capture->failed.fetch_add(1, std::memory_order_relaxed);
+				continue;
+			}
+			frame.size = m_size;
+			frame.timestamp = raw.timestamp;
+			frame.sequence = ++sequence;
+			capture->grabbed.fetch_add(1, std::memory_order_relaxed);
+			if (capture->slot.publish())
+				capture->dropped.fetch_add(1, std::memory_order_relaxed);
 		}
+	});
+}
+
+void Device::stopCapture() {
+	if (mp_capture == nullptr || !mp_capture->thread.joinable())
+		return;
+	mp_capture->stopRequested.store(true, std::memory_order_relaxed);
+	mp_capture->thread.join();
+	auto& registry = captureRegistry();
+	const std::scoped_lock lock(registry.mutex);
+	registry.devices.erase(this);
+}
+
+void Device::stopAllCaptures() {
+	std::vector<Device*> devices;
+	{
+		auto& registry = captureRegistry();
+		const std::scoped_lock lock(registry.mutex);
+		devices.assign(registry.devices.begin(), registry.devices.end());
 	}
-	stbi_image_free(buffer);
+	for (Device* device: devices) device->stopCapture();
 }
-OWL_DIAG_POP
-// NOLINTEND(*-magic-numbers)
 
-}// namespace
+auto Device::isCapturing() const -> bool { return mp_capture != nullptr && mp_capture->thread.joinable(); }
 
-Device::Device(std::string iName) : m_name(std::move(iName)) {}
+auto Device::acquireLatestFrame() -> Frame* {
+	if (mp_capture == nullptr)
+		return nullptr;
+	Frame* frame = mp_capture->slot.consume();
+	if (frame != nullptr)
+		mp_capture->delivered.fetch_add(1, std::memory_order_relaxed);
+	return frame;
+}
 
-Device::~Device() = default;
-
-auto Device::getRgbBuffer(const uint8_t* iInputBuffer, const int32_t iBufferSize) const -> std::vector<uint8_t> {
-	std::vector<uint8_t> output;
-	if (m_pixFormat == PixelFormat::Nv12) {
-		output.resize(3ull * m_size.surface());
-		convertNv12ToRgb24(iInputBuffer, m_size, output.data());
-	} else if (m_pixFormat == PixelFormat::Rgb24) {
-		output.resize(3ull * m_size.surface());
-
-		OWL_DIAG_PUSH
-		OWL_DIAG_DISABLE_CLANG20("-Wunsafe-buffer-usage-in-libc-call")
-		memcpy(output.data(), iInputBuffer, output.size());
-		OWL_DIAG_POP
-	} else if (m_pixFormat == PixelFormat::YuYv) {
-		output.resize(3ull * m_size.surface());
-		convertYuYvToRgb24(iInputBuffer, m_size, output.data());
-	} else if (m_pixFormat == PixelFormat::MJpeg) {
-		output.resize(3ull * m_size.surface());
-		convertMJpegToRgb24(iInputBuffer, iBufferSize, m_size, output.data());
-	} else {
+auto Device::getCaptureStats() const -> CaptureStats {
+	if (mp_capture == nullptr)
+		return {};
+	return {.grabbed = mp_capture->grabbed.load(std::memory_order_relaxed),
+			.delivered = mp_capture->delivered.load(std::memory_order_relaxed),
+			.dropped = mp_capture->dropped.load(std::memory_order_relaxed),
+			.failed = mp_capture->failed.load(std::memory_order_relaxed)};
+}
+
+auto Device::getRgbBuffer(const uint8_t* iInputBuffer, const int32_t iBufferSize) -> std::span<uint8_t> {
+	if (m_pixFormat == PixelFormat::Unknown) {
 		OWL_CORE_WARN("Unknown or unsupported pixel format, empty output buffer.")
+		return {};
+	}
+	const std::span input{iInputBuffer, static_cast<size_t>(std::max(iBufferSize, 0))};
+	if (!convertToRgb(input, m_rgbBuffer, conversionScheduler())) {
+		OWL_CORE_WARN("Unable to convert the frame ({} bytes).", iBufferSize)
+		return {};
 	}
-	return output;
+	return m_rgbBuffer;
+}
+
+auto Device::convertToRgb(const std::span<const uint8_t> iInput, std::vector<uint8_t>& oRgb24,
+						  core::task::Scheduler* ioScheduler) const -> bool {
+	OWL_PROFILE_FUNCTION()
+
+	oRgb24.resize(3ull * m_size.surface());
+	// NV12 and MJPEG frames are mirrored, as they always were.
+	switch (m_pixFormat) {
+		case PixelFormat::Nv12:
+			return conversion::nv12ToRgb24(iInput, m_size, oRgb24, true, ioScheduler);
+		case PixelFormat::Rgb24:
+			if (iInput.size() < oRgb24.size())
+				return false;
+			std::copy_n(iInput.begin(), oRgb24.size(), oRgb24.begin());
+			return true;
+		case PixelFormat::YuYv:
+			return conversion::yuyvToRgb24(iInput, m_size, oRgb24, false, ioScheduler);
+		case PixelFormat::MJpeg:
+			return conversion::mjpegToRgb24(iInput, m_size, oRgb24, true, ioScheduler);
+		case PixelFormat::Unknown:
+			break;
+	}
+	return false;
 }
 
 auto Device::isPixelFormatSupported(const PixelFormat& iPixFormat) -> bool {
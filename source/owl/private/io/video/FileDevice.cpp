@@ -0,0 +1,109 @@
+/**
+ * @file FileDevice.cpp
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright (c) 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "owlpch.h"
+
+#include "io/video/FileDevice.h"
+
+#include <fstream>
+#include <thread>
+
+namespace owl::io::video {
+
+FileDevice::FileDevice(std::filesystem::path iFile, const PixelFormat iPixelFormat, const math::vec2ui& iSize,
+					   const float iFrameRate)
+	: Device{iFile.stem().string()}, m_file{std::move(iFile)}, m_recordSize{iSize}, m_recordFormat{iPixelFormat} {
+	m_busInfo = std::format("file:{}", m_file.string());
+	if (iFrameRate > 0.f)
+		m_period = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+				std::chrono::duration<float>{1.f / iFrameRate});
+}
+
+FileDevice::~FileDevice() { close(); }
+
+auto FileDevice::getFrameBytes(const PixelFormat iPixelFormat, const math::vec2ui& iSize) -> size_t {
+	const size_t surface = iSize.surface();
+	switch (iPixelFormat) {
+		case PixelFormat::Rgb24:
+			return surface * 3;
+		case PixelFormat::Nv12:
+			return surface * 3 / 2;
+		case PixelFormat::YuYv:
+			return surface * 2;
+		case PixelFormat::MJpeg:
+		case PixelFormat::Unknown:
+			break;
+	}
+	return 0;
+}
+
+auto FileDevice::isValid() const -> bool {
+	return getFrameBytes(m_recordFormat, m_recordSize) > 0 && exists(m_file) && is_regular_file(m_file);
+}
+
+void FileDevice::open() {
+	OWL_CORE_INFO("Opening device ({}): {}.", m_file.string(), m_name)
+	close();
+	if (!isValid()) {
+		OWL_CORE_WARN("({}) Unable to replay this recording.", m_file.string())
+		return;
+	}
+	const size_t frameBytes = getFrameBytes(m_recordFormat, m_recordSize);
+	const size_t frameCount = file_size(m_file) / frameBytes;
+	if (frameCount == 0) {
+		OWL_CORE_WARN("({}) Recording shorter than one frame.", m_file.string())
+		return;
+	}
+	std::ifstream file(m_file, std::ios::binary);
+	m_frames.resize(frameCount * frameBytes);
+	if (!file.read(reinterpret_cast<char*>(m_frames.data()), static_cast<std::streamsize>(m_frames.size()))) {
+		OWL_CORE_WARN("({}) Unable to read the recording.", m_file.string())
+		m_frames.clear();
+		return;
+	}
+	m_pixFormat = m_recordFormat;
+	m_size = m_recordSize;
+	m_cursor = 0;
+	m_nextFrame = std::chrono::steady_clock::now();
+	m_frameCount = frameCount;
+}
+
+void FileDevice::close() {
+	if (!isOpened())
+		return;
+	stopCapture();
+	m_frames.clear();
+	m_frames.shrink_to_fit();
+	m_frameCount = 0;
+	m_pixFormat = PixelFormat::Unknown;
+	m_size = {1, 1};
+}
+
+auto FileDevice::acquireRaw(RawFrame& oFrame, const std::chrono::milliseconds iTimeout) -> bool {
+	if (!isOpened())
+		return false;
+	auto now = std::chrono::steady_clock::now();
+	if (m_period.count() > 0) {
+		if (m_nextFrame > now + iTimeout) {
+			std::this_thread::sleep_for(iTimeout);
+			return false;
+		}
+		std::this_thread::sleep_until(m_nextFrame);
+		now = std::chrono::steady_clock::now();
+		// A late consumer resumes the pace from now instead of bursting the missed frames.
+		m_nextFrame = std::max(m_nextFrame + m_period, now);
+	}
+	const size_t frameBytes = getFrameBytes(m_pixFormat, m_size);
+	oFrame.data = std::span{m_frames}.subspan(m_cursor * frameBytes, frameBytes).data();
+	oFrame.size = frameBytes;
+	oFrame.timestamp = now;
+	oFrame.skipped = 0;
+	m_cursor = (m_cursor + 1) % m_frameCount;
+	return true;
+}
+
+}// namespace owl::io::video
@@ -0,0 +1,86 @@
+/**
+ * @file LatestFrameSlot.h
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright (c) 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+
+namespace owl::io::video {
+
+/**
+ * @brief
+ *  Lock-free single-producer single-consumer slot holding the latest item (triple buffer).
+ *
+ * The producer fills `back()` and publishes it; the consumer takes the most
+ * recent published item with `consume()` and may use it until its next
+ * `consume()`. Neither side ever waits or copies: publishing swaps the back
+ * item with the shared middle one, consuming swaps the front item with it.
+ * An item published over one that was never consumed counts as dropped.
+ * @tparam T Type of the items, reused from publication to publication.
+ */
+template<typename T>
+class LatestFrameSlot final {
+public:
+	/**
+	 * @brief
+	 *  Item being written by the producer.
+	 * @return The back item.
+	 */
+	auto back() -> T& { return m_items[m_back]; }
+
+	/**
+	 * @brief
+	 *  Publish the back item and get a new one to write.
+	 * @return True if the previously published item was never consumed (it is dropped).
+	 */
+	auto publish() -> bool {
+		const uint8_t previous =
+				m_middle.exchange(static_cast<uint8_t>(m_back | g_freshBit), std::memory_order_acq_rel);
+		m_back = previous & g_indexMask;
+		return (previous & g_freshBit) != 0;
+	}
+
+	/**
+	 * @brief
+	 *  Take the latest published item.
+	 * @return The item, owned by the consumer until the next call, or nullptr if nothing was published since.
+	 */
+	auto consume() -> T* {
+		if ((m_middle.load(std::memory_order_relaxed) & g_freshBit) == 0)
+			return nullptr;
+		const uint8_t previous = m_middle.exchange(m_front, std::memory_order_acq_rel);
+		m_front = previous & g_indexMask;
+		return &m_items[m_front];
+	}
+
+	/**
+	 * @brief
+	 *  Check for a published item not consumed yet.
+	 * @return True if `consume()` would return an item.
+	 */
+	[[nodiscard]] auto hasFresh() const -> bool {
+		return (m_middle.load(std::memory_order_relaxed) & g_freshBit) != 0;
+	}
+
+private:
+	/// Bits of the middle index.
+	static constexpr uint8_t g_indexMask = 3;
+	/// Set in the middle state while its item is unconsumed.
+	static constexpr uint8_t g_freshBit = 4;
+	/// The three items.
+	std::array<T, 3> m_items{};
+	/// Index of the shared item, with the fresh bit.
+	std::atomic<uint8_t> m_middle{1};
+	/// Index of the producer item.
+	uint8_t m_back = 0;
+	/// Index of the consumer item.
+	uint8_t m_front = 2;
+};
+
+}// namespace owl::io::video
@@ -0,0 +1,425 @@
+/**
+ * @file PixelConversion.cpp
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright (c) 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "owlpch.h"
+
+#include "PixelConversion.h"
+
+#include "core/task/ParallelUtils.h"
+#include "core/task/Scheduler.h"
+
+#include <cstring>
+#include <stb_image.h>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define OWL_CONVERSION_X64
+#include <immintrin.h>
+#endif
+
+namespace owl::io::video::conversion {
+
+namespace {
+
+OWL_DIAG_PUSH
+OWL_DIAG_DISABLE_CLANG16("-Wunsafe-buffer-usage")
+// NOLINTBEGIN(*-magic-numbers)
+
+/// Pixels converted by one SIMD step.
+constexpr uint32_t g_simdPixels = 16;
+
+/// Converts pixels `[iFirst, iWidth)` of a row; chroma is read for the pair of each pixel.
+using RowKernel = void (*)(const uint8_t* iLuma, const uint8_t* iChroma, uint32_t iWidth, uint8_t* oRgb, bool iMirror);
+
+void storeRgb(const int32_t iC, const int32_t iD, const int32_t iE, uint8_t* oRgb) {
+	oRgb[0] = static_cast<uint8_t>(math::clamp((298 * iC + 409 * iE + 128) >> 8, 0, 255));
+	oRgb[1] = static_cast<uint8_t>(math::clamp((298 * iC - 100 * iD - 208 * iE + 128) >> 8, 0, 255));
+	oRgb[2] = static_cast<uint8_t>(math::clamp((298 * iC + 516 * iD + 128) >> 8, 0, 255));
+}
+
+auto pixelOffset(const uint32_t iPixel, const uint32_t iWidth, const bool iMirror) -> size_t {
+	return static_cast<size_t>(iMirror ? iWidth - 1 - iPixel : iPixel) * 3;
+}
+
+// NV12: `iLuma` is the Y row, `iChroma` the shared UV row (U at even bytes, V at odd bytes).
+void nv12Pixels(const uint8_t* iLuma, const uint8_t* iChroma, const uint32_t iFirst, const uint32_t iWidth,
+				uint8_t* oRgb, const bool iMirror) {
+	for (uint32_t j = iFirst; j < iWidth; ++j) {
+		const uint32_t uv = j & ~1u;
+		storeRgb(iLuma[j] - 16, iChroma[uv] - 128, iChroma[uv + 1] - 128, oRgb + pixelOffset(j, iWidth, iMirror));
+	}
+}
+
+// YUYV: `iLuma` is the packed row (Y0 U Y1 V per pixel pair), `iChroma` is unused.
+void yuyvPixels(const uint8_t* iLuma, const uint32_t iFirst, const uint32_t iWidth, uint8_t* oRgb,
+				const bool iMirror) {
+	for (uint32_t j = iFirst; j < iWidth; ++j) {
+		const uint32_t pair = (j & ~1u) * 2;
+		storeRgb(iLuma[2 * j] - 16, iLuma[pair + 1] - 128, iLuma[pair + 3] - 128,
+				 oRgb + pixelOffset(j, iWidth, iMirror));
+	}
+}
+
+void nv12RowScalar(const uint8_t* iLuma, const uint8_t* iChroma, const uint32_t iWidth, uint8_t* oRgb,
+				   const bool iMirror) {
+	nv12Pixels(iLuma, iChroma, 0, iWidth, oRgb, iMirror);
+}
+
+void yuyvRowScalar(const uint8_t* iLuma, const uint8_t*, const uint32_t iWidth, uint8_t* oRgb, const bool iMirror) {
+	yuyvPixels(iLuma, 0, iWidth, oRgb, iMirror);
+}
+
+#ifdef OWL_CONVERSION_X64
+// The SIMD kernels evaluate the scalar formula in 32-bit lanes (the products overflow 16 bits) and clamp through
+// saturating packs, so each output byte is bit-identical to `storeRgb`.
+
+/// Byte shuffle mask; negative entries write zero.
+using ShuffleMask = std::array<int8_t, 16>;
+
+/**
+ * @brief
+ *  Masks scattering 16 R, G or B bytes into one of the three 16-byte chunks of 48 interleaved RGB bytes.
+ *
+ * Indexed by `(mirror * 3 + chunk) * 3 + channel`. Mirrored masks also reverse the pixel order.
+ */
+constexpr auto makeInterleaveMasks() -> std::array<ShuffleMask, 18> {
+	std::array<ShuffleMask, 18> masks{};
+	for (uint32_t mirror = 0; mirror < 2; ++mirror) {
+		for (uint32_t chunk = 0; chunk < 3; ++chunk) {
+			for (uint32_t channel = 0; channel < 3; ++channel) {
+				auto& mask = masks[(mirror * 3 + chunk) * 3 + channel];
+				for (uint32_t byte = 0; byte < 16; ++byte) {
+					const uint32_t position = chunk * 16 + byte;
+					const uint32_t pixel = position / 3;
+					const uint32_t lane = mirror != 0 ? 15 - pixel : pixel;
+					mask[byte] = position % 3 == channel ? static_cast<int8_t>(lane) : int8_t{-128};
+				}
+			}
+		}
+	}
+	return masks;
+}
+alignas(16) constexpr std::array<ShuffleMask, 18> g_interleaveMasks = makeInterleaveMasks();
+
+// NV12 chroma: duplicate U (even bytes) or V (odd bytes) for each pixel of the pair.
+alignas(16) constexpr ShuffleMask g_nv12U{0, 0, 2, 2, 4, 4, 6, 6, 8, 8, 10, 10, 12, 12, 14, 14};
+alignas(16) constexpr ShuffleMask g_nv12V{1, 1, 3, 3, 5, 5, 7, 7, 9, 9, 11, 11, 13, 13, 15, 15};
+// YUYV: extract 8 pixels of one 16-byte half into the low (first) or high (second) half of the result.
+constexpr int8_t g_z = -128;
+alignas(16) constexpr ShuffleMask g_yuyvYLow{0, 2, 4, 6, 8, 10, 12, 14, g_z, g_z, g_z, g_z, g_z, g_z, g_z, g_z};
+alignas(16) constexpr ShuffleMask g_yuyvYHigh{g_z, g_z, g_z, g_z, g_z, g_z, g_z, g_z, 0, 2, 4, 6, 8, 10, 12, 14};
+alignas(16) constexpr ShuffleMask g_yuyvULow{1, 1, 5, 5, 9, 9, 13, 13, g_z, g_z, g_z, g_z, g_z, g_z, g_z, g_z};
+alignas(16) constexpr ShuffleMask g_yuyvUHigh{g_z, g_z, g_z, g_z, g_z, g_z, g_z, g_z, 1, 1, 5, 5, 9, 9, 13, 13};
+alignas(16) constexpr ShuffleMask g_yuyvVLow{3, 3, 7, 7, 11, 11, 15, 15, g_z, g_z, g_z, g_z, g_z, g_z, g_z, g_z};
+alignas(16) constexpr ShuffleMask g_yuyvVHigh{g_z, g_z, g_z, g_z, g_z, g_z, g_z, g_z, 3, 3, 7, 7, 11, 11, 15, 15};
+
+__attribute__((target("sse4.1"))) auto loadMask(const ShuffleMask& iMask) -> __m128i {
+	return _mm_load_si128(reinterpret_cast<const __m128i*>(iMask.data()));
+}
+
+__attribute__((target("sse4.1"))) auto loadBytes(const uint8_t* iData) -> __m128i {
+	return _mm_loadu_si128(reinterpret_cast<const __m128i*>(iData));
+}
+
+/// The three channels of 16 pixels.
+struct Channels {
+	/// Red bytes.
+	__m128i r;
+	/// Green bytes.
+	__m128i g;
+	/// Blue bytes.
+	__m128i b;
+};
+
+// Interleave 16 pixels and write them as 48 bytes.
+__attribute__((target("sse4.1"))) void storeChannels(const Channels& iChannels, uint8_t* oRgb, const bool iMirror) {
+	const size_t base = iMirror ? 9 : 0;
+	for (size_t chunk = 0; chunk < 3; ++chunk) {
+		const size_t mask = base + chunk * 3;
+		const __m128i out =
+				_mm_or_si128(_mm_or_si128(_mm_shuffle_epi8(iChannels.r, loadMask(g_interleaveMasks[mask])),
+										  _mm_shuffle_epi8(iChannels.g, loadMask(g_interleaveMasks[mask + 1]))),
+							 _mm_shuffle_epi8(iChannels.b, loadMask(g_interleaveMasks[mask + 2])));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(oRgb + chunk * 16), out);
+	}
+}
+
+/// The three channels of 4 pixels, as 32-bit lanes.
+struct Quad {
+	/// Red lanes.
+	__m128i r;
+	/// Green lanes.
+	__m128i g;
+	/// Blue lanes.
+	__m128i b;
+};
+
+/// The three channels of 8 pixels, as 32-bit lanes.
+struct Oct {
+	/// Red lanes.
+	__m256i r;
+	/// Green lanes.
+	__m256i g;
+	/// Blue lanes.
+	__m256i b;
+};
+
+// Channels of 4 pixels from their zero-extended Y, U and V.
+__attribute__((target("sse4.1"))) auto quadSse41(const __m128i iY, const __m128i iU, const __m128i iV) -> Quad {
+	const __m128i d = _mm_sub_epi32(iU, _mm_set1_epi32(128));
+	const __m128i e = _mm_sub_epi32(iV, _mm_set1_epi32(128));
+	const __m128i base = _mm_add_epi32(_mm_mullo_epi32(_mm_sub_epi32(iY, _mm_set1_epi32(16)), _mm_set1_epi32(298)),
+									   _mm_set1_epi32(128));
+	const __m128i dg = _mm_add_epi32(_mm_mullo_epi32(d, _mm_set1_epi32(100)), _mm_mullo_epi32(e, _mm_set1_epi32(208)));
+	return {.r = _mm_srai_epi32(_mm_add_epi32(base, _mm_mullo_epi32(e, _mm_set1_epi32(409))), 8),
+			.g = _mm_srai_epi32(_mm_sub_epi32(base, dg), 8),
+			.b = _mm_srai_epi32(_mm_add_epi32(base, _mm_mullo_epi32(d, _mm_set1_epi32(516))), 8)};
+}
+
+// Saturate four quads to 16 bytes.
+__attribute__((target("sse4.1"))) auto packSse41(const __m128i iQ0, const __m128i iQ1, const __m128i iQ2,
+												 const __m128i iQ3) -> __m128i {
+	return _mm_packus_epi16(_mm_packs_epi32(iQ0, iQ1), _mm_packs_epi32(iQ2, iQ3));
+}
+
+__attribute__((target("sse4.1"))) auto convertSse41(const __m128i iY, const __m128i iU, const __m128i iV) -> Channels {
+	const auto q0 = quadSse41(_mm_cvtepu8_epi32(iY), _mm_cvtepu8_epi32(iU), _mm_cvtepu8_epi32(iV));
+	const auto q1 = quadSse41(_mm_cvtepu8_epi32(_mm_srli_si128(iY, 4)), _mm_cvtepu8_epi32(_mm_srli_si128(iU, 4)),
+							  _mm_cvtepu8_epi32(_mm_srli_si128(iV, 4)));
+	const auto q2 = quadSse41(_mm_cvtepu8_epi32(_mm_srli_si128(iY, 8)), _mm_cvtepu8_epi32(_mm_srli_si128(iU, 8)),
+							  _mm_cvtepu8_epi32(_mm_srli_si128(iV, 8)));
+	const auto q3 = quadSse41(_mm_cvtepu8_epi32(_mm_srli_si128(iY, 12)), _mm_cvtepu8_epi32(_mm_srli_si128(iU, 12)),
+							  _mm_cvtepu8_epi32(_mm_srli_si128(iV, 12)));
+	return {.r = packSse41(q0.r, q1.r, q2.r, q3.r),
+			.g = packSse41(q0.g, q1.g, q2.g, q3.g),
+			.b = packSse41(q0.b, q1.b, q2.b, q3.b)};
+}
+
+// Channels of 8 pixels from their zero-extended Y, U and V.
+__attribute__((target("avx2"))) auto octAvx2(const __m256i iY, const __m256i iU, const __m256i iV) -> Oct {
+	const __m256i d = _mm256_sub_epi32(iU, _mm256_set1_epi32(128));
+	const __m256i e = _mm256_sub_epi32(iV, _mm256_set1_epi32(128));
+	const __m256i base = _mm256_add_epi32(
+			_mm256_mullo_epi32(_mm256_sub_epi32(iY, _mm256_set1_epi32(16)), _mm256_set1_epi32(298)),
+			_mm256_set1_epi32(128));
+	const __m256i dg = _mm256_add_epi32(_mm256_mullo_epi32(d, _mm256_set1_epi32(100)),
+										_mm256_mullo_epi32(e, _mm256_set1_epi32(208)));
+	return {.r = _mm256_srai_epi32(_mm256_add_epi32(base, _mm256_mullo_epi32(e, _mm256_set1_epi32(409))), 8),
+			.g = _mm256_srai_epi32(_mm256_sub_epi32(base, dg), 8),
+			.b = _mm256_srai_epi32(_mm256_add_epi32(base, _mm256_mullo_epi32(d, _mm256_set1_epi32(516))), 8)};
+}
+
+// Saturate two octs to 16 bytes in pixel order.
+__attribute__((target("avx2"))) auto packAvx2(const __m256i iLow, const __m256i iHigh) -> __m128i {
+	// The packs work per 128-bit lane: reorder the 64-bit quarters back to pixel order before narrowing.
+	const __m256i words = _mm256_permute4x64_epi64(_mm256_packs_epi32(iLow, iHigh), 0xD8);
+	return _mm_packus_epi16(_mm256_castsi256_si128(words), _mm256_extracti128_si256(words, 1));
+}
+
+__attribute__((target("avx2"))) auto convertAvx2(const __m128i iY, const __m128i iU, const __m128i iV) -> Channels {
+	const auto o0 = octAvx2(_mm256_cvtepu8_epi32(iY), _mm256_cvtepu8_epi32(iU), _mm256_cvtepu8_epi32(iV));
+	const auto o1 = octAvx2(_mm256_cvtepu8_epi32(_mm_srli_si128(iY, 8)), _mm256_cvtepu8_epi32(_mm_srli_si128(iU, 8)),
+							_mm256_cvtepu8_epi32(_mm_srli_si128(iV, 8)));
+	return {.r = packAvx2(o0.r, o1.r), .g = packAvx2(o0.g, o1.g), .b = packAvx2(o0.b, o1.b)};
+}
+
+// Destination of the 16-pixel block starting at `iPixel`.
+auto blockOffset(const uint32_t iPixel, const uint32_t iWidth, const bool iMirror) -> size_t {
+	return static_cast<size_t>(iMirror ? iWidth - iPixel - g_simdPixels : iPixel) * 3;
+}
+
+__attribute__((target("sse4.1"))) void nv12RowSse41(const uint8_t* iLuma, const uint8_t* iChroma,
+													const uint32_t iWidth, uint8_t* oRgb, const bool iMirror) {
+	uint32_t j = 0;
+	for (; j + g_simdPixels <= iWidth; j += g_simdPixels) {
+		const __m128i uv = loadBytes(iChroma + j);
+		storeChannels(convertSse41(loadBytes(iLuma + j), _mm_shuffle_epi8(uv, loadMask(g_nv12U)),
+								   _mm_shuffle_epi8(uv, loadMask(g_nv12V))),
+					  oRgb + blockOffset(j, iWidth, iMirror), iMirror);
+	}
+	nv12Pixels(iLuma, iChroma, j, iWidth, oRgb, iMirror);
+}
+
+__attribute__((target("avx2"))) void nv12RowAvx2(const uint8_t* iLuma, const uint8_t* iChroma, const uint32_t iWidth,
+												 uint8_t* oRgb, const bool iMirror) {
+	uint32_t j = 0;
+	for (; j + g_simdPixels <= iWidth; j += g_simdPixels) {
+		const __m128i uv = loadBytes(iChroma + j);
+		storeChannels(convertAvx2(loadBytes(iLuma + j), _mm_shuffle_epi8(uv, loadMask(g_nv12U)),
+								  _mm_shuffle_epi8(uv, loadMask(g_nv12V))),
+					  oRgb + blockOffset(j, iWidth, iMirror), iMirror);
+	}
+	nv12Pixels(iLuma, iChroma, j, iWidth, oRgb, iMirror);
+}
+
+// Gather bytes from the two halves of 16 YUYV pixels.
+__attribute__((target("sse4.1"))) auto gatherYuyv(const __m128i iLow, const __m128i iHigh, const ShuffleMask& iLowMask,
+												  const ShuffleMask& iHighMask) -> __m128i {
+	return _mm_or_si128(_mm_shuffle_epi8(iLow, loadMask(iLowMask)), _mm_shuffle_epi8(iHigh, loadMask(iHighMask)));
+}
+
+// Split 16 YUYV pixels (32 bytes) into their Y, U and V bytes.
+__attribute__((target("sse4.1"))) void splitYuyv(const uint8_t* iPixels, __m128i& oY, __m128i& oU, __m128i& oV) {
+	const __m128i low = loadBytes(iPixels);
+	const __m128i high = loadBytes(iPixels + 16);
+	oY = gatherYuyv(low, high, g_yuyvYLow, g_yuyvYHigh);
+	oU = gatherYuyv(low, high, g_yuyvULow, g_yuyvUHigh);
+	oV = gatherYuyv(low, high, g_yuyvVLow, g_yuyvVHigh);
+}
+
+__attribute__((target("sse4.1"))) void yuyvRowSse41(const uint8_t* iLuma, const uint8_t*, const uint32_t iWidth,
+													uint8_t* oRgb, const bool iMirror) {
+	uint32_t j = 0;
+	for (; j + g_simdPixels <= iWidth; j += g_simdPixels) {
+		__m128i y;
+		__m128i u;
+		__m128i v;
+		splitYuyv(iLuma + 2 * static_cast<size_t>(j), y, u, v);
+		storeChannels(convertSse41(y, u, v), oRgb + blockOffset(j, iWidth, iMirror), iMirror);
+	}
+	yuyvPixels(iLuma, j, iWidth, oRgb, iMirror);
+}
+
+__attribute__((target("avx2"))) void yuyvRowAvx2(const uint8_t* iLuma, const uint8_t*, const uint32_t iWidth,
+												 uint8_t* oRgb, const bool iMirror) {
+	uint32_t j = 0;
+	for (; j + g_simdPixels <= iWidth; j += g_simdPixels) {
+		__m128i y;
+		__m128i u;
+		__m128i v;
+		splitYuyv(iLuma + 2 * static_cast<size_t>(j), y, u, v);
+		storeChannels(convertAvx2(y, u, v), oRgb + blockOffset(j, iWidth, iMirror), iMirror);
+	}
+	yuyvPixels(iLuma, j, iWidth, oRgb, iMirror);
+}
+#endif
+
+auto selectKernel(const SimdLevel iLevel, const RowKernel iScalar, [[maybe_unused]] const RowKernel iSse41,
+				  [[maybe_unused]] const RowKernel iAvx2) -> RowKernel {
+#ifdef OWL_CONVERSION_X64
+	switch (std::min(iLevel, getSimdLevel())) {
+		case SimdLevel::Avx2:
+			return iAvx2;
+		case SimdLevel::Sse41:
+			return iSse41;
+		case SimdLevel::Scalar:
+			break;
+	}
+#endif
+	return iScalar;
+}
+
+/**
+ * @brief
+ *  Call a row function for every row, by blocks of `g_rowBlock` on the scheduler when there is more than one block.
+ * @param[in] iRows Number of rows.
+ * @param[in,out] ioScheduler The scheduler or nullptr.
+ * @param[in] iRowFunc Called with the row index.
+ */
+template<typename RowFunc>
+void forEachRow(const uint32_t iRows, core::task::Scheduler* ioScheduler, const RowFunc& iRowFunc) {
+	const uint32_t blockCount = (iRows + g_rowBlock - 1) / g_rowBlock;
+	const auto runBlock = [&](const uint32_t iBlock) -> void {
+		const uint32_t end = std::min(iRows, (iBlock + 1) * g_rowBlock);
+		for (uint32_t row = iBlock * g_rowBlock; row < end; ++row) iRowFunc(row);
+	};
+	if (ioScheduler != nullptr && blockCount > 1)
+		core::task::parallelForIndex(*ioScheduler, uint32_t{0}, blockCount, uint32_t{1}, runBlock);
+	else
+		for (uint32_t block = 0; block < blockCount; ++block) runBlock(block);
+}
+
+auto rgbBytes(const math::vec2ui& iSize) -> size_t { return static_cast<size_t>(iSize.surface()) * 3; }
+
+// NOLINTEND(*-magic-numbers)
+OWL_DIAG_POP
+
+}// namespace
+
+OWL_DIAG_PUSH
+OWL_DIAG_DISABLE_CLANG16("-Wunsafe-buffer-usage")
+auto nv12ToRgb24(const std::span<const uint8_t> iNv12, const math::vec2ui& iSize, const std::span<uint8_t> oRgb24,
+				 const bool iMirror, core::task::Scheduler* ioScheduler, const SimdLevel iLevel) -> bool {
+	OWL_PROFILE_FUNCTION()
+
+	const size_t lumaBytes = iSize.surface();
+	// One chroma row per pair of luma rows, the last one shared by a lone row when the height is odd.
+	const size_t chromaBytes = static_cast<size_t>(iSize.x()) * ((iSize.y() + 1) / 2);
+	if (iNv12.size() < lumaBytes + chromaBytes || oRgb24.size() < rgbBytes(iSize))
+		return false;
+#ifdef OWL_CONVERSION_X64
+	const RowKernel kernel = selectKernel(iLevel, nv12RowScalar, nv12RowSse41, nv12RowAvx2);
+#else
+	const RowKernel kernel = selectKernel(iLevel, nv12RowScalar, nullptr, nullptr);
+#endif
+	const size_t width = iSize.x();
+	forEachRow(iSize.y(), ioScheduler, [&](const uint32_t iRow) -> void {
+		kernel(iNv12.data() + iRow * width, iNv12.data() + lumaBytes + (iRow / 2) * width, iSize.x(),
+			   oRgb24.data() + iRow * width * 3, iMirror);
+	});
+	return true;
+}
+
+auto yuyvToRgb24(const std::span<const uint8_t> iYuYv, const math::vec2ui& iSize, const std::span<uint8_t> oRgb24,
+				 const bool iMirror, core::task::Scheduler* ioScheduler, const SimdLevel iLevel) -> bool {
+	OWL_PROFILE_FUNCTION()
+
+	if (iYuYv.size() < static_cast<size_t>(iSize.surface()) * 2 || oRgb24.size() < rgbBytes(iSize))
+		return false;
+#ifdef OWL_CONVERSION_X64
+	const RowKernel kernel = selectKernel(iLevel, yuyvRowScalar, yuyvRowSse41, yuyvRowAvx2);
+#else
+	const RowKernel kernel = selectKernel(iLevel, yuyvRowScalar, nullptr, nullptr);
+#endif
+	const size_t width = iSize.x();
+	forEachRow(iSize.y(), ioScheduler, [&](const uint32_t iRow) -> void {
+		kernel(iYuYv.data() + iRow * width * 2, nullptr, iSize.x(), oRgb24.data() + iRow * width * 3, iMirror);
+	});
+	return true;
+}
+
+auto mjpegToRgb24(const std::span<const uint8_t> iJpeg, const math::vec2ui& iSize, const std::span<uint8_t> oRgb24,
+				  const bool iMirror, core::task::Scheduler* ioScheduler) -> bool {
+	OWL_PROFILE_FUNCTION()
+
+	if (oRgb24.size() < rgbBytes(iSize))
+		return false;
+	int comp = 0;
+	int width = 0;
+	int height = 0;
+	// Per-thread flip state: frames may be decoded while workers load textures.
+	stbi_set_flip_vertically_on_load_thread(0);
+	uint8_t* buffer = stbi_load_from_memory(iJpeg.data(), static_cast<int>(iJpeg.size()), &width, &height, &comp, 3);
+	if (buffer == nullptr) {
+		OWL_CORE_WARN("Jpeg decoding: nullptr result.")
+		return false;
+	}
+	if (iSize != math::vec2ui{static_cast<uint32_t>(width), static_cast<uint32_t>(height)}) {
+		OWL_CORE_WARN("Jpeg decoding: size mismatch ({} {}) expecting {} {}.", width, height, iSize.x(), iSize.y())
+		stbi_image_free(buffer);
+		return false;
+	}
+	if (!iMirror) {
+		std::memcpy(oRgb24.data(), buffer, rgbBytes(iSize));
+	} else {
+		const size_t rowBytes = static_cast<size_t>(iSize.x()) * 3;
+		forEachRow(iSize.y(), ioScheduler, [&](const uint32_t iRow) -> void {
+			const uint8_t* src = buffer + iRow * rowBytes;
+			uint8_t* dst = oRgb24.data() + iRow * rowBytes + rowBytes;
+			for (uint32_t j = 0; j < iSize.x(); ++j, src += 3) {
+				dst -= 3;
+				dst[0] = src[0];
+				dst[1] = src[1];
+				dst[2] = src[2];
+			}
+		});
+	}
+	stbi_image_free(buffer);
+	return true;
+}
+OWL_DIAG_POP
+
+}// namespace owl::io::video::conversion
@@ -0,0 +1,83 @@
+/**
+ * @file PixelConversion.h
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright (c) 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+
+#include "core/CpuFeatures.h"
+#include "math/vectors.h"
+
+#include <span>
+
+namespace owl::core::task {
+class Scheduler;
+}// namespace owl::core::task
+
+/**
+ * @brief
+ *  Conversion of raw camera frames to tightly packed RGB24.
+ *
+ * The YUV converters use the BT.601 limited-range integer formula of the
+ * original per-pixel loops, so every SIMD level produces bit-identical output.
+ * Rows are converted by blocks of `g_rowBlock` on the given scheduler (when
+ * any), each block writing only its own rows of the output, which may be any
+ * caller-owned memory (a pooled frame buffer, a staging area...).
+ *
+ * Widths are assumed even (chroma is shared by pixel pairs in both formats).
+ * A mirrored conversion flips each row horizontally.
+ */
+namespace owl::io::video::conversion {
+
+/// Rows converted by one job.
+constexpr uint32_t g_rowBlock = 32;
+
+/// Instruction set used by the YUV converters: 16 pixels per step with SSE4.1, 8-wide arithmetic with AVX2.
+using core::SimdLevel;
+using core::getSimdLevel;
+
+/**
+ * @brief
+ *  Convert a NV12 frame (full Y plane followed by the interleaved UV plane).
+ * @param[in] iNv12 The input frame, at least `width * (height + ceil(height / 2))` bytes.
+ * @param[in] iSize The frame size.
+ * @param[out] oRgb24 The output, at least `3 * width * height` bytes.
+ * @param[in] iMirror If the rows are flipped horizontally.
+ * @param[in,out] ioScheduler Scheduler running the row blocks, nullptr for the calling thread only.
+ * @param[in] iLevel Requested instruction set (capped to the supported one).
+ * @return False if a buffer is too small (nothing written).
+ */
+auto nv12ToRgb24(std::span<const uint8_t> iNv12, const math::vec2ui& iSize, std::span<uint8_t> oRgb24, bool iMirror,
+				 core::task::Scheduler* ioScheduler = nullptr, SimdLevel iLevel = getSimdLevel()) -> bool;
+
+/**
+ * @brief
+ *  Convert a YUYV (YUY2) frame.
+ * @param[in] iYuYv The input frame, at least `2 * width * height` bytes.
+ * @param[in] iSize The frame size.
+ * @param[out] oRgb24 The output, at least `3 * width * height` bytes.
+ * @param[in] iMirror If the rows are flipped horizontally.
+ * @param[in,out] ioScheduler Scheduler running the row blocks, nullptr for the calling thread only.
+ * @param[in] iLevel Requested instruction set (capped to the supported one).
+ * @return False if a buffer is too small (nothing written).
+ */
+auto yuyvToRgb24(std::span<const uint8_t> iYuYv, const math::vec2ui& iSize, std::span<uint8_t> oRgb24, bool iMirror,
+				 core::task::Scheduler* ioScheduler = nullptr, SimdLevel iLevel = getSimdLevel()) -> bool;
+
+/**
+ * @brief
+ *  Decode a MJPEG frame.
+ * @param[in] iJpeg The compressed frame.
+ * @param[in] iSize The expected frame size.
+ * @param[out] oRgb24 The output, at least `3 * width * height` bytes.
+ * @param[in] iMirror If the rows are flipped horizontally.
+ * @param[in,out] ioScheduler Scheduler running the row copies, nullptr for the calling thread only.
+ * @return False if decoding failed or the sizes mismatch.
+ */
+auto mjpegToRgb24(std::span<const uint8_t> iJpeg, const math::vec2ui& iSize, std::span<uint8_t> oRgb24, bool iMirror,
+				  core::task::Scheduler* ioScheduler = nullptr) -> bool;
+
+}// namespace owl::io::video::conversion
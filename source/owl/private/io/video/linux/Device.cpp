@@ -12,11 +12,13 @@
 #if defined(OWL_PLATFORM_LINUX)
 #include "io/video/Manager.h"
 
+#include <cerrno>
 #include <cstring>
 #include <fcntl.h>
 #include <filesystem>
 #include <linux/media.h>
 #include <linux/videodev2.h>
+#include <poll.h>
 #include <sys/ioctl.h>
 #include <sys/mman.h>
 #include <unistd.h>
@@ -188,7 +190,7 @@ Device::~Device() { close(); }
 void Device::open() {
 	OWL_CORE_INFO("Opening device ({}): {}.", m_file, m_name)
 	close();
-	m_fileHandler = ::open(m_file.c_str(), O_RDWR | O_CLOEXEC);
+	m_fileHandler = ::open(m_file.c_str(), O_RDWR | O_NONBLOCK | O_CLOEXEC);
 	if (m_fileHandler <= 0) {
 		OWL_CORE_WARN("({}) Unable to open the device.", m_file)
 		return;
@@ -228,50 +230,51 @@ void Device::open() {
 		m_pixFormat = getDevicePixelFormat(fmt.fmt.pix.pixelformat);
 		m_size = {fmt.fmt.pix.width, fmt.fmt.pix.height};
 	}
-	// request buffer from device.
+	// request buffers from device.
+	uint32_t bufferCount = m_bufferCount;
 	{
 		v4l2_requestbuffers requestBuffers{};
-		requestBuffers.count = 1;// only one buffer requested.
+		requestBuffers.count = bufferCount;
 		requestBuffers.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
 		requestBuffers.memory = V4L2_MEMORY_MMAP;
-		if (ioctl(m_fileHandler, VIDIOC_REQBUFS, &requestBuffers) < 0) {
+		if (ioctl(m_fileHandler, VIDIOC_REQBUFS, &requestBuffers) < 0 || requestBuffers.count == 0) {
 			OWL_CORE_WARN("({}) Unable to request buffer.", m_file)
 			close();
 			return;
 		}
+		// The driver may grant another count.
+		bufferCount = requestBuffers.count;
 	}
-	// define the bufferInfo
-	{
-
-		OWL_DIAG_PUSH
-		OWL_DIAG_DISABLE_CLANG20("-Wunsafe-buffer-usage-in-libc-call")
-		memset(&m_bufferInfo, 0, sizeof(m_bufferInfo));
-		OWL_DIAG_POP
-
-		m_bufferInfo.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
-		m_bufferInfo.memory = V4L2_MEMORY_MMAP;
-		m_bufferInfo.index = 0;
-	}
-	// query buffer from device
-	{
-		if (ioctl(m_fileHandler, VIDIOC_QUERYBUF, &m_bufferInfo) < 0) {
-			OWL_CORE_WARN("({}) Unable to query buffer.", m_file)
+	// query, map and queue the buffers
+	m_buffers.reserve(bufferCount);
+	for (uint32_t index = 0; index < bufferCount; ++index) {
+		v4l2_buffer bufferInfo{};
+		bufferInfo.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+		bufferInfo.memory = V4L2_MEMORY_MMAP;
+		bufferInfo.index = index;
+		if (ioctl(m_fileHandler, VIDIOC_QUERYBUF, &bufferInfo) < 0) {
+			OWL_CORE_WARN("({}) Unable to query buffer {}.", m_file, index)
 			close();
 			return;
 		}
-
-		OWL_CORE_INFO("({}) Buffer info, length {} , offset {}.", m_file, m_bufferInfo.length, m_bufferInfo.m.offset)
-		mp_buffer = mmap(nullptr, m_bufferInfo.length, PROT_READ | PROT_WRITE, MAP_SHARED, m_fileHandler,
-						 m_bufferInfo.m.offset);
-		if (mp_buffer == MAP_FAILED) {
-			OWL_CORE_ERROR("({}) Unable to map the device buffer.", m_file)
+		void* data = mmap(nullptr, bufferInfo.length, PROT_READ | PROT_WRITE, MAP_SHARED, m_fileHandler,
+						  bufferInfo.m.offset);
+		if (data == MAP_FAILED) {
+			OWL_CORE_ERROR("({}) Unable to map the device buffer {}.", m_file, index)
+			close();
+			return;
+		}
+		m_buffers.push_back({.data = data, .length = bufferInfo.length});
+		if (ioctl(m_fileHandler, VIDIOC_QBUF, &bufferInfo) < 0) {
+			OWL_CORE_WARN("Device ({}) unable to queue the buffer {}.", m_file, index)
 			close();
 			return;
 		}
 	}
+	OWL_CORE_INFO("({}) {} buffers of {} bytes.", m_file, bufferCount, m_buffers.front().length)
 	//Activate the streaming
 	{
-		uint32_t type = m_bufferInfo.type;
+		uint32_t type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
 		if (ioctl(m_fileHandler, VIDIOC_STREAMON, &type) < 0) {
 			OWL_CORE_WARN("({}) Unable to start the streaming.", m_file)
 			close();
@@ -279,57 +282,72 @@ void Device::open() {
 		}
 		m_streaming = true;
 	}
-	// queue the buffer
-	if (ioctl(m_fileHandler, VIDIOC_QBUF, &m_bufferInfo) < 0) {
-		OWL_CORE_WARN("Device ({}) unable to queue the buffer.", m_file)
-		close();
-	}
 }
 
 void Device::close() {
 	if (!isOpened())
 		return;
-	if (mp_buffer != nullptr)
-		munmap(mp_buffer, m_bufferInfo.length);
+	stopCapture();
 	if (m_streaming) {
-		if (ioctl(m_fileHandler, VIDIOC_STREAMOFF, &m_bufferInfo) < 0) {
+		uint32_t type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+		if (ioctl(m_fileHandler, VIDIOC_STREAMOFF, &type) < 0) {
 			OWL_CORE_WARN("({}) Unable to close the streaming.", m_file)
 		}
 	}
+	for (const auto& buffer: m_buffers) munmap(buffer.data, buffer.length);
+	m_buffers.clear();
 	::close(m_fileHandler);
 	m_fileHandler = 0;
 	m_size = {1, 1};
-	mp_buffer = nullptr;
 	m_streaming = false;
+	m_dequeued = false;
 }
 
 auto Device::isOpened() const -> bool { return m_fileHandler != 0; }
 
-void Device::fillFrame(shared<renderer::gpu::Texture>& ioFrame) {
+auto Device::acquireRaw(RawFrame& oFrame, const std::chrono::milliseconds iTimeout) -> bool {
 	if (!m_streaming)
-		return;// need to be open and ready!
-	// recreate the frame if not the right size.
-	if (!ioFrame || ioFrame->getSize() != m_size) {
-		ioFrame = renderer::gpu::Texture2D::create({m_size, renderer::gpu::ImageFormat::Rgb8});
-	}
-	// dequeue the buffer
-	if (ioctl(m_fileHandler, VIDIOC_DQBUF, &m_bufferInfo) < 0) {
-		OWL_CORE_WARN("Device ({}) unable to dequeue the buffer.", m_file)
-		return;
+		return false;// need to be open and ready!
+	pollfd pfd{.fd = m_fileHandler, .events = POLLIN, .revents = 0};
+	if (poll(&pfd, 1, static_cast<int>(iTimeout.count())) <= 0)
+		return false;
+	v4l2_buffer bufferInfo{};
+	bufferInfo.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+	bufferInfo.memory = V4L2_MEMORY_MMAP;
+	if (ioctl(m_fileHandler, VIDIOC_DQBUF, &bufferInfo) < 0) {
+		if (errno != EAGAIN)
+			OWL_CORE_WARN("Device ({}) unable to dequeue the buffer.", m_file)
+		return false;
 	}
-
-	std::vector<uint8_t> convertedBuffer =
-			getRgbBuffer(static_cast<const uint8_t*>(mp_buffer), static_cast<int32_t>(m_bufferInfo.bytesused));
-	// frames are written after dequeue the buffer
-	if (!convertedBuffer.empty()) {
-		if (static_cast<size_t>(m_size.surface()) * 3ull != convertedBuffer.size()) {
-			OWL_CORE_WARN("Device ({}) buffer size mismatch: {}, expecting {}.", m_file, m_bufferInfo.bytesused,
-						  m_size.surface() * 3)
-		} else {
-			ioFrame->setData(convertedBuffer.data(), static_cast<uint32_t>(convertedBuffer.size()));
+	// Keep only the newest filled buffer: older ones go straight back to the driver.
+	uint32_t skipped = 0;
+	v4l2_buffer newer = bufferInfo;
+	while (ioctl(m_fileHandler, VIDIOC_DQBUF, &newer) == 0) {
+		if (ioctl(m_fileHandler, VIDIOC_QBUF, &bufferInfo) < 0) {
+			OWL_CORE_WARN("Device ({}) unable to queue the buffer.", m_file)
 		}
+		bufferInfo = newer;
+		++skipped;
 	}
-	// queue the buffer
+	m_bufferInfo = bufferInfo;
+	m_dequeued = true;
+	oFrame.data = static_cast<const uint8_t*>(m_buffers[bufferInfo.index].data);
+	oFrame.size = bufferInfo.bytesused;
+	oFrame.skipped = skipped;
+	// Monotonic driver timestamps share the clock of std::chrono::steady_clock.
+	if ((bufferInfo.flags & V4L2_BUF_FLAG_TIMESTAMP_MASK) == V4L2_BUF_FLAG_TIMESTAMP_MONOTONIC)
+		oFrame.timestamp =
+				std::chrono::steady_clock::time_point{std::chrono::seconds{bufferInfo.timestamp.tv_sec} +
+													  std::chrono::microseconds{bufferInfo.timestamp.tv_usec}};
+	else
+		oFrame.timestamp = std::chrono::steady_clock::now();
+	return true;
+}
+
+void Device::releaseRaw() {
+	if (!m_dequeued)
+		return;
+	m_dequeued = false;
 	if (ioctl(m_fileHandler, VIDIOC_QBUF, &m_bufferInfo) < 0) {
 		OWL_CORE_WARN("Device ({}) unable to queue the buffer.", m_file)
 	}
@@ -79,27 +79,45 @@ public:
 
 	/**
 	 * @brief
-	 *  Retrieve a frame.
-	 * @param[in,out] ioFrame The frame to update.
+	 *  Check if this device is valid.
+	 * @return True if this device is valid.
 	 */
-	void fillFrame(shared<renderer::gpu::Texture>& ioFrame) override;
+	[[nodiscard]] auto isValid() const -> bool override;
 
+protected:
 	/**
 	 * @brief
-	 *  Check if this device is valid.
-	 * @return True if this device is valid.
+	 *  Wait for the next filled buffer, re-queueing the older ones.
+	 * @param[out] oFrame The frame.
+	 * @param[in] iTimeout Maximal waiting time.
+	 * @return False if no frame is available.
 	 */
-	[[nodiscard]] auto isValid() const -> bool override;
+	auto acquireRaw(RawFrame& oFrame, std::chrono::milliseconds iTimeout) -> bool override;
+
+	/**
+	 * @brief
+	 *  Queue the last acquired buffer again.
+	 */
+	void releaseRaw() override;
 
 private:
+	/// A buffer mapped from the device.
+	struct MappedBuffer {
+		/// Mapped memory.
+		void* data = nullptr;
+		/// Mapped length.
+		size_t length = 0;
+	};
 	/// The file representation of the device.
 	std::string m_file;
 	/// The file handler.
 	int m_fileHandler = 0;
-	/// buffer map to the device.
-	void* mp_buffer = nullptr;
-	/// Buffer info.
+	/// Buffers mapped to the device, by buffer index.
+	std::vector<MappedBuffer> m_buffers;
+	/// Info of the dequeued buffer.
 	v4l2_buffer m_bufferInfo{};
+	/// If a buffer is dequeued.
+	bool m_dequeued = false;
 	/// if the streaming is started.
 	bool m_streaming = false;
 
@@ -312,6 +312,7 @@ void Device::open() {
 }
 
 void Device::close() {
+	stopCapture();
 	if (m_sourceReader) {
 		m_sourceReader.release();
 	}
@@ -324,18 +325,10 @@ void Device::close() {
 
 auto Device::isOpened() const -> bool { return m_size.surface() > 1; }
 
-void Device::fillFrame(shared<renderer::gpu::Texture>& iFrame) {
-	if (!isOpened())
-		return;
-	// Resizing the frame.
-	if (m_size.surface() == 0)
-		return;
-	if (!iFrame || iFrame->getSize() != m_size) {
-		if (iFrame)
-			iFrame.reset();
-		iFrame = renderer::gpu::Texture2D::create({m_size, renderer::gpu::ImageFormat::Rgb8});
-	}
-	// For now only fill with black
+auto Device::acquireRaw(RawFrame& oFrame, std::chrono::milliseconds) -> bool {
+	if (!isOpened() || !m_sourceReader)
+		return false;
+	// The synchronous source reader waits for the next sample by itself.
 	WPointer<IMFSample> sample;
 	int64_t timestamp = 0;
 	u_long actualIndex = 0;
@@ -345,30 +338,38 @@ void Device::fillFrame(shared<renderer::gpu::Texture>& iFrame) {
 														  &sampleFlags, &timestamp, sample.addr());
 			FAILED(hr)) {
 			OWL_CORE_WARN("Device ({}): Unable to read sample from device.", m_name)
-			return;
+			return false;
 		}
 	}
+	if (!sample)
+		return false;
 	u_long count = 0;
 	if (FAILED(sample->GetBufferCount(&count)) || count == 0) {
 		OWL_CORE_WARN("Device ({}): No  buffer found in the sample from device.", m_name)
-		return;
+		return false;
 	}
-	WPointer<IMFMediaBuffer> buffer;
-	if (FAILED(sample->ConvertToContiguousBuffer(buffer.addr()))) {
+	if (FAILED(sample->ConvertToContiguousBuffer(m_lockedBuffer.addr()))) {
 		OWL_CORE_WARN("Device ({}): Unable to Convert buffer.", m_name)
-		return;
+		return false;
 	}
 	byte* byteBuffer = nullptr;
 	u_long bCurLen = 0;
-	buffer->Lock(&byteBuffer, nullptr, &bCurLen);
-	std::vector<byte> convertedBuffer = getRgbBuffer(byteBuffer, static_cast<int32_t>(bCurLen));
-	if (m_size.surface() * 3ull != convertedBuffer.size()) {
-		OWL_CORE_WARN("Frame size mismatch {} buffer: {}.", m_size.surface() * 3ull, convertedBuffer.size())
-		buffer->Unlock();
-		return;
+	if (FAILED(m_lockedBuffer->Lock(&byteBuffer, nullptr, &bCurLen))) {
+		m_lockedBuffer.release();
+		return false;
 	}
-	iFrame->setData(convertedBuffer.data(), static_cast<uint32_t>(convertedBuffer.size()));
-	buffer->Unlock();
+	oFrame.data = byteBuffer;
+	oFrame.size = bCurLen;
+	oFrame.timestamp = std::chrono::steady_clock::now();
+	oFrame.skipped = 0;
+	return true;
+}
+
+void Device::releaseRaw() {
+	if (!m_lockedBuffer)
+		return;
+	m_lockedBuffer->Unlock();
+	m_lockedBuffer.release();
 }
 
 auto Device::isValid() const -> bool { return !m_name.empty() && !m_busInfo.empty(); }
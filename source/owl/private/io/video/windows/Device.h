@@ -75,19 +75,30 @@ public:
 
 	/**
 	 * @brief
-	 *  Retrieve a frame.
-	 * @param[in] iFrame The frame to update.
+	 *  Check the validity of the device.
+	 * @return True if valid.
 	 */
-	void fillFrame(shared<renderer::gpu::Texture>& iFrame) override;
+	[[nodiscard]] auto isValid() const -> bool override;
 
+protected:
 	/**
 	 * @brief
-	 *  Check the validity of the device.
-	 * @return True if valid.
+	 *  Read the next sample and lock its buffer.
+	 * @param[out] oFrame The frame.
+	 * @param[in] iTimeout Unused: the source reader blocks until the next sample.
+	 * @return False if no frame is available.
 	 */
-	[[nodiscard]] auto isValid() const -> bool override;
+	auto acquireRaw(RawFrame& oFrame, std::chrono::milliseconds iTimeout) -> bool override;
+
+	/**
+	 * @brief
+	 *  Unlock the buffer of the last sample.
+	 */
+	void releaseRaw() override;
 
 private:
+	/// Buffer of the last sample, locked until `releaseRaw()`.
+	WPointer<IMFMediaBuffer> m_lockedBuffer;
 	/// Pointer to a media source
 	WPointer<IMFMediaSource> m_mediaSource;
 	/// Pointer to a media source
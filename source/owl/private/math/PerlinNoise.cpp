@@ -13,6 +13,11 @@
 #include <numeric>
 #include <random>
 
+#if defined(__x86_64__) || defined(_M_X64)
+#define OWL_NOISE_X64
+#include <immintrin.h>
+#endif
+
 namespace owl::math {
 
 namespace {
@@ -22,13 +27,14 @@ auto fade(const float iT) -> float { return iT * iT * iT * (iT * (iT * 6.f - 15.
 
 auto lerp(const float iT, const float iA, const float iB) -> float { return iA + iT * (iB - iA); }
 
+/// Gradient components of `grad2`, split per axis so SIMD paths can look them up by lane.
+constexpr float g_Diag = 0.70710678f;
+constexpr std::array<float, 8> g_Grad2X{1.f, -1.f, 0.f, 0.f, g_Diag, -g_Diag, g_Diag, -g_Diag};
+constexpr std::array<float, 8> g_Grad2Y{0.f, 0.f, 1.f, -1.f, g_Diag, g_Diag, -g_Diag, -g_Diag};
+
 auto grad2(const uint8_t iHash, const float iX, const float iY) -> float {
 	// Eight gradient directions (axis-aligned + normalized diagonals) keep the output near [-1, 1].
-	constexpr float d = 0.70710678f;
-	constexpr std::array<std::array<float, 2>, 8> grads{
-			{{1.f, 0.f}, {-1.f, 0.f}, {0.f, 1.f}, {0.f, -1.f}, {d, d}, {-d, d}, {d, -d}, {-d, -d}}};
-	const auto& g = grads[iHash & 7U];
-	return g[0] * iX + g[1] * iY;
+	return g_Grad2X[iHash & 7U] * iX + g_Grad2Y[iHash & 7U] * iY;
 }
 
 auto grad3(const uint8_t iHash, const float iX, const float iY, const float iZ) -> float {
@@ -41,6 +47,130 @@ auto grad3(const uint8_t iHash, const float iX, const float iY, const float iZ)
 		v = iX;
 	return ((h & 1U) == 0U ? u : -u) + ((h & 2U) == 0U ? v : -v);
 }
+
+#ifdef OWL_NOISE_X64
+// The SIMD kernels mirror `PerlinNoise::noise(x, y)` operation for operation (no FMA contraction: the
+// target attributes enable neither FMA nor fast-math), so every lane is bit-identical to the scalar sampler.
+
+__attribute__((target("sse4.1"))) auto fadeSse(const __m128 iT) -> __m128 {
+	const __m128 inner = _mm_add_ps(
+			_mm_mul_ps(iT, _mm_sub_ps(_mm_mul_ps(iT, _mm_set1_ps(6.f)), _mm_set1_ps(15.f))), _mm_set1_ps(10.f));
+	return _mm_mul_ps(_mm_mul_ps(_mm_mul_ps(iT, iT), iT), inner);
+}
+
+__attribute__((target("sse4.1"))) auto lerpSse(const __m128 iT, const __m128 iA, const __m128 iB) -> __m128 {
+	return _mm_add_ps(iA, _mm_mul_ps(iT, _mm_sub_ps(iB, iA)));
+}
+
+__attribute__((target("sse4.1"))) auto grad2Sse(const std::array<int32_t, 4>& iHash, const __m128 iX,
+												const __m128 iY) -> __m128 {
+	const __m128 gx =
+			_mm_setr_ps(g_Grad2X[static_cast<size_t>(iHash[0] & 7)], g_Grad2X[static_cast<size_t>(iHash[1] & 7)],
+						g_Grad2X[static_cast<size_t>(iHash[2] & 7)], g_Grad2X[static_cast<size_t>(iHash[3] & 7)]);
+	const __m128 gy =
+			_mm_setr_ps(g_Grad2Y[static_cast<size_t>(iHash[0] & 7)], g_Grad2Y[static_cast<size_t>(iHash[1] & 7)],
+						g_Grad2Y[static_cast<size_t>(iHash[2] & 7)], g_Grad2Y[static_cast<size_t>(iHash[3] & 7)]);
+	return _mm_add_ps(_mm_mul_ps(gx, iX), _mm_mul_ps(gy, iY));
+}
+
+// SSE4.1 has no gather: floors, fades and gradients are vectorised, the permutation hashing stays per lane.
+__attribute__((target("sse4.1"))) void accumulateSse41(const std::array<uint8_t, 512>& iPerm, const float* iXs,
+													   const float* iYs, float* ioOut, const size_t iCount,
+													   const float iFrequency, const float iAmplitude) {
+	const __m128 freq = _mm_set1_ps(iFrequency);
+	const __m128 amp = _mm_set1_ps(iAmplitude);
+	const __m128 one = _mm_set1_ps(1.f);
+	for (size_t i = 0; i + 4 <= iCount; i += 4) {
+		const __m128 x = _mm_mul_ps(_mm_loadu_ps(iXs + i), freq);
+		const __m128 y = _mm_mul_ps(_mm_loadu_ps(iYs + i), freq);
+		const __m128 fx = _mm_floor_ps(x);
+		const __m128 fy = _mm_floor_ps(y);
+		const __m128 xf = _mm_sub_ps(x, fx);
+		const __m128 yf = _mm_sub_ps(y, fy);
+		const __m128i xiv = _mm_cvttps_epi32(fx);
+		const __m128i yiv = _mm_cvttps_epi32(fy);
+		const std::array<int32_t, 4> xi{_mm_extract_epi32(xiv, 0), _mm_extract_epi32(xiv, 1), _mm_extract_epi32(xiv, 2),
+										_mm_extract_epi32(xiv, 3)};
+		const std::array<int32_t, 4> yi{_mm_extract_epi32(yiv, 0), _mm_extract_epi32(yiv, 1), _mm_extract_epi32(yiv, 2),
+										_mm_extract_epi32(yiv, 3)};
+		std::array<int32_t, 4> aa{};
+		std::array<int32_t, 4> ba{};
+		std::array<int32_t, 4> ab{};
+		std::array<int32_t, 4> bb{};
+		for (size_t lane = 0; lane < 4; ++lane) {
+			const auto gx = static_cast<size_t>(xi[lane] & 255);
+			const auto gy = static_cast<size_t>(yi[lane] & 255);
+			aa[lane] = iPerm[iPerm[gx] + gy];
+			ba[lane] = iPerm[iPerm[gx + 1] + gy];
+			ab[lane] = iPerm[iPerm[gx] + gy + 1];
+			bb[lane] = iPerm[iPerm[gx + 1] + gy + 1];
+		}
+		const __m128 u = fadeSse(xf);
+		const __m128 v = fadeSse(yf);
+		const __m128 xm1 = _mm_sub_ps(xf, one);
+		const __m128 ym1 = _mm_sub_ps(yf, one);
+		const __m128 x1 = lerpSse(u, grad2Sse(aa, xf, yf), grad2Sse(ba, xm1, yf));
+		const __m128 x2 = lerpSse(u, grad2Sse(ab, xf, ym1), grad2Sse(bb, xm1, ym1));
+		const __m128 n = lerpSse(v, x1, x2);
+		_mm_storeu_ps(ioOut + i, _mm_add_ps(_mm_loadu_ps(ioOut + i), _mm_mul_ps(amp, n)));
+	}
+}
+
+__attribute__((target("avx2"))) auto fadeAvx(const __m256 iT) -> __m256 {
+	const __m256 inner = _mm256_add_ps(
+			_mm256_mul_ps(iT, _mm256_sub_ps(_mm256_mul_ps(iT, _mm256_set1_ps(6.f)), _mm256_set1_ps(15.f))),
+			_mm256_set1_ps(10.f));
+	return _mm256_mul_ps(_mm256_mul_ps(_mm256_mul_ps(iT, iT), iT), inner);
+}
+
+__attribute__((target("avx2"))) auto lerpAvx(const __m256 iT, const __m256 iA, const __m256 iB) -> __m256 {
+	return _mm256_add_ps(iA, _mm256_mul_ps(iT, _mm256_sub_ps(iB, iA)));
+}
+
+// The 8 gradients fit one register per axis, so a lane-wise permute replaces the table lookup.
+__attribute__((target("avx2"))) auto grad2Avx(const __m256i iHash, const __m256 iX, const __m256 iY) -> __m256 {
+	const __m256i index = _mm256_and_si256(iHash, _mm256_set1_epi32(7));
+	const __m256 gx = _mm256_permutevar8x32_ps(_mm256_loadu_ps(g_Grad2X.data()), index);
+	const __m256 gy = _mm256_permutevar8x32_ps(_mm256_loadu_ps(g_Grad2Y.data()), index);
+	return _mm256_add_ps(_mm256_mul_ps(gx, iX), _mm256_mul_ps(gy, iY));
+}
+
+__attribute__((target("avx2"))) void accumulateAvx2(const std::array<int32_t, 512>& iPerm, const float* iXs,
+													const float* iYs, float* ioOut, const size_t iCount,
+													const float iFrequency, const float iAmplitude) {
+	const __m256 freq = _mm256_set1_ps(iFrequency);
+	const __m256 amp = _mm256_set1_ps(iAmplitude);
+	const __m256 one = _mm256_set1_ps(1.f);
+	const __m256i mask = _mm256_set1_epi32(255);
+	const __m256i oneI = _mm256_set1_epi32(1);
+	const int* perm = iPerm.data();
+	for (size_t i = 0; i + 8 <= iCount; i += 8) {
+		const __m256 x = _mm256_mul_ps(_mm256_loadu_ps(iXs + i), freq);
+		const __m256 y = _mm256_mul_ps(_mm256_loadu_ps(iYs + i), freq);
+		const __m256 fx = _mm256_floor_ps(x);
+		const __m256 fy = _mm256_floor_ps(y);
+		const __m256 xf = _mm256_sub_ps(x, fx);
+		const __m256 yf = _mm256_sub_ps(y, fy);
+		const __m256i gx = _mm256_and_si256(_mm256_cvttps_epi32(fx), mask);
+		const __m256i gy = _mm256_and_si256(_mm256_cvttps_epi32(fy), mask);
+		const __m256i pa = _mm256_add_epi32(_mm256_i32gather_epi32(perm, gx, 4), gy);
+		const __m256i pb = _mm256_add_epi32(_mm256_i32gather_epi32(perm, _mm256_add_epi32(gx, oneI), 4), gy);
+		const __m256i aa = _mm256_i32gather_epi32(perm, pa, 4);
+		const __m256i ba = _mm256_i32gather_epi32(perm, pb, 4);
+		const __m256i ab = _mm256_i32gather_epi32(perm, _mm256_add_epi32(pa, oneI), 4);
+		const __m256i bb = _mm256_i32gather_epi32(perm, _mm256_add_epi32(pb, oneI), 4);
+		const __m256 u = fadeAvx(xf);
+		const __m256 v = fadeAvx(yf);
+		const __m256 xm1 = _mm256_sub_ps(xf, one);
+		const __m256 ym1 = _mm256_sub_ps(yf, one);
+		const __m256 x1 = lerpAvx(u, grad2Avx(aa, xf, yf), grad2Avx(ba, xm1, yf));
+		const __m256 x2 = lerpAvx(u, grad2Avx(ab, xf, ym1), grad2Avx(bb, xm1, ym1));
+		const __m256 n = lerpAvx(v, x1, x2);
+		_mm256_storeu_ps(ioOut + i, _mm256_add_ps(_mm256_loadu_ps(ioOut + i), _mm256_mul_ps(amp, n)));
+	}
+}
+#endif
+
 }// namespace
 
 PerlinNoise::PerlinNoise() { reseed(g_DefaultSeed); }
@@ -55,6 +185,7 @@ void PerlinNoise::reseed(const uint32_t iSeed) {
 		m_perm[i] = base[i];
 		m_perm[i + 256] = base[i];
 	}
+	std::ranges::copy(m_perm, m_permWide.begin());
 }
 
 auto PerlinNoise::noise(const float iX, const float iY) const -> float {
@@ -135,4 +266,51 @@ auto PerlinNoise::fbm(const float iX, const float iY, const float iZ, const uint
 	return norm > 0.f ? total / norm : 0.f;
 }
 
+auto PerlinNoise::getSimdLevel() -> SimdLevel { return core::getSimdLevel(); }
+
+void PerlinNoise::accumulateOctave(const std::span<const float> iXs, const std::span<const float> iYs,
+								   const std::span<float> ioOut, const float iFrequency, const float iAmplitude,
+								   const SimdLevel iLevel) const {
+	const size_t count = ioOut.size();
+	size_t done = 0;
+#ifdef OWL_NOISE_X64
+	if (iLevel == SimdLevel::Avx2) {
+		accumulateAvx2(m_permWide, iXs.data(), iYs.data(), ioOut.data(), count, iFrequency, iAmplitude);
+		done = count - count % 8;
+	} else if (iLevel == SimdLevel::Sse41) {
+		accumulateSse41(m_perm, iXs.data(), iYs.data(), ioOut.data(), count, iFrequency, iAmplitude);
+		done = count - count % 4;
+	}
+#else
+	static_cast<void>(iLevel);
+#endif
+	// Scalar path and SIMD tail.
+	for (size_t i = done; i < count; ++i) ioOut[i] += iAmplitude * noise(iXs[i] * iFrequency, iYs[i] * iFrequency);
+}
+
+void PerlinNoise::noise(const std::span<const float> iXs, const std::span<const float> iYs, const std::span<float> oOut,
+						const SimdLevel iLevel) const {
+	OWL_CORE_ASSERT(iXs.size() == oOut.size() && iYs.size() == oOut.size(), "PerlinNoise: batch size mismatch")
+	std::ranges::fill(oOut, 0.f);
+	accumulateOctave(iXs, iYs, oOut, 1.f, 1.f, std::min(iLevel, getSimdLevel()));
+}
+
+void PerlinNoise::fbm(const std::span<const float> iXs, const std::span<const float> iYs, const std::span<float> oOut,
+					  const uint32_t iOctaves, const float iLacunarity, const float iPersistence,
+					  const SimdLevel iLevel) const {
+	OWL_CORE_ASSERT(iXs.size() == oOut.size() && iYs.size() == oOut.size(), "PerlinNoise: batch size mismatch")
+	const SimdLevel level = std::min(iLevel, getSimdLevel());
+	std::ranges::fill(oOut, 0.f);
+	float amplitude = 1.f;
+	float frequency = 1.f;
+	float norm = 0.f;
+	for (uint32_t octave = 0; octave < std::max(1U, iOctaves); ++octave) {
+		accumulateOctave(iXs, iYs, oOut, frequency, amplitude, level);
+		norm += amplitude;
+		amplitude *= iPersistence;
+		frequency *= iLacunarity;
+	}
+	for (auto& value: oOut) value = norm > 0.f ? value / norm : 0.f;
+}
+
 }// namespace owl::math
@@ -8,11 +8,16 @@
 #include "owlpch.h"
 
 #include "physics/PhysicCommand.h"
+
+#include "app/Application.h"
+#include "core/task/SchedulerImpl.h"
 #include "scene/Entity.h"
 #include "scene/TilemapAsset.h"
 #include "scene/Tileset.h"
 #include "scene/component/components.h"
+#include <bit>
 #include <box2d/box2d.h>
+#include <deque>
 
 namespace owl::physics {
 
@@ -24,6 +29,9 @@ inline void logNotInitialized(const char* iFunc) {
 
 inline void logNullEntity(const char* iFunc) { OWL_CORE_WARN("Physic: {} called with null entity; ignoring.", iFunc) }
 
+/// Maximum number of Box2D workers (B2_MAX_WORKERS), also the width of the worker mask.
+constexpr uint32_t g_maxWorkers = 64;
+
 }// namespace
 
 class PhysicCommand::Impl {
@@ -40,16 +48,145 @@ public:
 
 	auto operator=(Impl&&) -> Impl& = delete;
 
+	/// A Box2D task, split in chunks over the executor.
+	struct StepTask {
+		/// The Box2D task function.
+		b2TaskCallback* callback = nullptr;
+		/// The Box2D task context.
+		void* context = nullptr;
+		/// Chunks not finished yet.
+		std::atomic<int> remaining = 0;
+	};
+
+	/**
+	 * @brief
+	 *  Box2D callback: start a task on the executor.
+	 * @param[in] iTask The task function.
+	 * @param[in] iItemCount Number of items.
+	 * @param[in] iMinRange Minimum number of items per chunk.
+	 * @param[in] iTaskContext The task context.
+	 * @param[in] iUserContext The implementation.
+	 * @return The task handle for `finishTask`.
+	 */
+	static auto enqueueTask(b2TaskCallback* iTask, int iItemCount, int iMinRange, void* iTaskContext,
+							void* iUserContext) -> void*;
+
+	/**
+	 * @brief
+	 *  Box2D callback: wait for a task to finish.
+	 * @param[in] iUserTask The task handle.
+	 * @param[in] iUserContext The implementation.
+	 */
+	static void finishTask(void* iUserTask, void* iUserContext);
+
+	/**
+	 * @brief
+	 *  Reserve a Box2D worker index for the calling thread.
+	 * @return The index.
+	 */
+	auto acquireWorker() -> uint32_t;
+
+	/**
+	 * @brief
+	 *  Give back a Box2D worker index.
+	 * @param[in] iWorker The index.
+	 */
+	void releaseWorker(uint32_t iWorker);
+
 	b2WorldId worldId{0, 0};
 	uint64_t nextId = 1;
 	std::unordered_map<uint64_t, b2BodyId> bodies;
+	/// Scheduler running the Box2D tasks, nullptr for a single-threaded world.
+	core::task::Scheduler* scheduler = nullptr;
+	/// Number of Box2D workers.
+	uint32_t workerCount = 1;
+	/// Worker indices in use, one bit each: two chunks running at once never share an index.
+	std::atomic<uint64_t> busyWorkers = 0;
+	/// Task records, reused every step (a deque keeps them in place).
+	std::deque<StepTask> stepTasks;
+	/// Number of task records used by the current step.
+	size_t stepTaskCount = 0;
+	/// Timings of the last frame.
+	StepStats stats;
+	/// Time not yet simulated in fixed-step mode, in seconds.
+	float accumulator = 0.f;
+	/// Body transforms before the last fixed step, for the interpolation; a body missing is not interpolated.
+	std::unordered_map<uint64_t, b2Transform> previous;
 };
 shared<PhysicCommand::Impl> PhysicCommand::m_impl = nullptr;
 scene::Scene* PhysicCommand::m_scene = nullptr;
+uint32_t PhysicCommand::m_workerCount = 0;
+PhysicCommand::StepSettings PhysicCommand::m_stepSettings{};
+
+auto PhysicCommand::Impl::enqueueTask(b2TaskCallback* iTask, const int iItemCount, const int iMinRange,
+									  void* iTaskContext, void* iUserContext) -> void* {
+	// Box2D enqueues from the stepping thread only, and finishes every task before the step returns.
+	auto& impl = *static_cast<Impl*>(iUserContext);
+	if (impl.stepTaskCount == impl.stepTasks.size())
+		impl.stepTasks.emplace_back();
+	auto& task = impl.stepTasks[impl.stepTaskCount++];
+	task.callback = iTask;
+	task.context = iTaskContext;
+	// Always on the executor, even a single chunk: the solver workers spin on each other, never inline.
+	const int chunkCount =
+			std::clamp(iItemCount / std::max(iMinRange, 1), 1, static_cast<int>(impl.workerCount));
+	task.remaining.store(chunkCount, std::memory_order_relaxed);
+	auto& executor = impl.scheduler->getImpl().executor;
+	for (int chunk = 0; chunk < chunkCount; ++chunk) {
+		const int begin = iItemCount * chunk / chunkCount;
+		const int end = iItemCount * (chunk + 1) / chunkCount;
+		executor.silent_async([&impl, &task, begin, end]() -> void {
+			const uint32_t worker = impl.acquireWorker();
+			task.callback(begin, end, worker, task.context);
+			impl.releaseWorker(worker);
+			if (task.remaining.fetch_sub(1, std::memory_order_acq_rel) == 1)
+				task.remaining.notify_all();
+		});
+	}
+	return &task;
+}
+
+void PhysicCommand::Impl::finishTask(void* iUserTask, void* /*iUserContext*/) {
+	auto& task = *static_cast<StepTask*>(iUserTask);
+	for (int left = task.remaining.load(std::memory_order_acquire); left != 0;
+		 left = task.remaining.load(std::memory_order_acquire))
+		task.remaining.wait(left, std::memory_order_acquire);
+}
+
+auto PhysicCommand::Impl::acquireWorker() -> uint32_t {
+	const uint64_t all = workerCount >= g_maxWorkers ? ~uint64_t{0} : (uint64_t{1} << workerCount) - 1;
+	uint64_t busy = busyWorkers.load(std::memory_order_relaxed);
+	while (true) {
+		const uint64_t free = ~busy & all;
+		if (free == 0) {
+			// More chunks than workers in flight (e.g. the tree rebuild next to the solver): sleep until one is given
+			// back. Only a release changes a full mask, and each one wakes a waiter.
+			busyWorkers.wait(busy, std::memory_order_relaxed);
+			busy = busyWorkers.load(std::memory_order_relaxed);
+			continue;
+		}
+		const uint64_t bit = free & (~free + 1);
+		if (busyWorkers.compare_exchange_weak(busy, busy | bit, std::memory_order_acquire, std::memory_order_relaxed))
+			return static_cast<uint32_t>(std::countr_zero(bit));
+	}
+}
+
+void PhysicCommand::Impl::releaseWorker(const uint32_t iWorker) {
+	busyWorkers.fetch_and(~(uint64_t{1} << iWorker), std::memory_order_release);
+	busyWorkers.notify_one();
+}
 
 PhysicCommand::PhysicCommand() = default;
 
 void PhysicCommand::init(scene::Scene* iScene) {
+	createWorld(iScene, app::Application::instanced() ? &app::Application::get().getTaskScheduler() : nullptr);
+}
+
+void PhysicCommand::init(scene::Scene* iScene, core::task::Scheduler& ioScheduler) {
+	createWorld(iScene, &ioScheduler);
+}
+
+void PhysicCommand::createWorld(scene::Scene* iScene, core::task::Scheduler* ioScheduler) {
 	if (iScene == nullptr) {
 		OWL_CORE_ERROR("Physic: init() called with null scene; physics not initialised.")
 		return;
@@ -60,6 +197,20 @@ void PhysicCommand::init(scene::Scene* iScene) {
 	m_scene = iScene;
 	b2WorldDef def = b2DefaultWorldDef();
 	def.gravity = {.x = 0.0f, .y = -9.81f};
+	if (ioScheduler != nullptr) {
+		const auto available =
+				std::min(static_cast<uint32_t>(ioScheduler->getImpl().executor.num_workers()), g_maxWorkers);
+		// By default one executor worker stays out of the step, so that the other tasks keep going while it runs.
+		const uint32_t defaultCount = std::max(available, 2u) - 1;
+		m_impl->workerCount = std::clamp(m_workerCount == 0 ? defaultCount : m_workerCount, 1u, available);
+	}
+	if (m_impl->workerCount > 1) {
+		m_impl->scheduler = ioScheduler;
+		def.workerCount = static_cast<int>(m_impl->workerCount);
+		def.enqueueTask = &Impl::enqueueTask;
+		def.finishTask = &Impl::finishTask;
+		def.userTaskContext = m_impl.get();
+	}
 	m_impl->worldId = b2CreateWorld(&def);
 
 	OWL_INFO("PhysicCommand::init(), world created ({} {}).", m_impl->worldId.index1, m_impl->worldId.generation)
@@ -225,14 +376,48 @@ void PhysicCommand::frame(const core::Timestep& iTimestep) {
 		return;
 	}
 	// Update the physical world
-	b2World_Step(m_impl->worldId, iTimestep.getSeconds(), 4);
+	const auto& settings = m_stepSettings;
+	uint32_t stepCount = 1;
+	float delta = iTimestep.getSeconds();
+	float alpha = 1.f;
+	if (settings.fixedStep) {
+		m_impl->accumulator += delta;
+		stepCount = std::min(static_cast<uint32_t>(m_impl->accumulator / settings.fixedDelta),
+							 settings.maxStepsPerFrame);
+		m_impl->accumulator -= static_cast<float>(stepCount) * settings.fixedDelta;
+		// Drop what the catch-up could not simulate, or the next frames would only get longer.
+		if (m_impl->accumulator >= settings.fixedDelta)
+			m_impl->accumulator = std::fmod(m_impl->accumulator, settings.fixedDelta);
+		delta = settings.fixedDelta;
+		if (settings.interpolate)
+			alpha = m_impl->accumulator / settings.fixedDelta;
+	}
+	const bool interpolate = settings.fixedStep && settings.interpolate;
+	m_impl->stats = {.workerCount = m_impl->workerCount, .stepCount = stepCount, .interpolation = alpha};
+	for (uint32_t step = 0; step < stepCount; ++step) {
+		if (interpolate && step + 1 == stepCount) {
+			m_impl->previous.clear();
+			for (const auto& [id, body]: m_impl->bodies) m_impl->previous.emplace(id, b2Body_GetTransform(body));
+		}
+		m_impl->stepTaskCount = 0;
+		b2World_Step(m_impl->worldId, delta, static_cast<int>(settings.subSteps));
+		const b2Profile profile = b2World_GetProfile(m_impl->worldId);
+		m_impl->stats.stepMs += profile.step;
+		m_impl->stats.collideMs += profile.collide;
+		m_impl->stats.solveMs += profile.solve;
+	}
 
 	// apply to the entities
 	for (const auto view = m_scene->registry.view<scene::component::Transform, scene::component::PhysicBody>();
 		 const auto entity: view) {
 		auto&& [transform, physic] = view.get<scene::component::Transform, scene::component::PhysicBody>(entity);
-		const auto [x, y] = b2Body_GetPosition(m_impl->bodies[physic.body.bodyId]);
-		const float angle = b2Rot_GetAngle(b2Body_GetRotation(m_impl->bodies[physic.body.bodyId]));
+		b2Transform current = b2Body_GetTransform(m_impl->bodies[physic.body.bodyId]);
+		if (interpolate) {
+			if (const auto it = m_impl->previous.find(physic.body.bodyId); it != m_impl->previous.end())
+				current = {.p = b2Lerp(it->second.p, current.p, alpha), .q = b2NLerp(it->second.q, current.q, alpha)};
+		}
+		const auto [x, y] = current.p;
+		const float angle = b2Rot_GetAngle(current.q);
 		// Convert world position from Box2D back to local space.
 		const scene::Entity ent{entity, m_scene};
 		const auto& hierarchy = ent.getComponent<scene::component::Hierarchy>();
@@ -258,6 +443,23 @@ void PhysicCommand::frame(const core::Timestep& iTimestep) {
 	}
 }
 
+auto PhysicCommand::getStepStats() -> StepStats {
+	if (!isInitialized())
+		return {};
+	return m_impl->stats;
+}
+
+void PhysicCommand::setStepSettings(const StepSettings& iSettings) {
+	m_stepSettings = iSettings;
+	m_stepSettings.fixedDelta = std::max(m_stepSettings.fixedDelta, 1e-4f);
+	m_stepSettings.maxStepsPerFrame = std::max(m_stepSettings.maxStepsPerFrame, 1u);
+	m_stepSettings.subSteps = std::max(m_stepSettings.subSteps, 1u);
+	if (isInitialized()) {
+		m_impl->accumulator = 0.f;
+		m_impl->previous.clear();
+	}
+}
+
 void PhysicCommand::impulse(const scene::Entity& iEntity, const math::vec2f& iImpulse) {
 	if (!isInitialized()) {
 		logNotInitialized("impulse");
@@ -308,6 +510,8 @@ void PhysicCommand::setTransform(const scene::Entity& iEntity, const math::vec2f
 	if (iEntity.hasComponent<scene::component::PhysicBody>()) {
 		auto& [body] = iEntity.getComponent<scene::component::PhysicBody>();
 		b2Body_SetTransform(m_impl->bodies[body.bodyId], {iPosition.x(), iPosition.y()}, b2MakeRot(iRotation));
+		// A teleport: no interpolation from the old place.
+		m_impl->previous.erase(body.bodyId);
 		return;
 	}
 	// Otherwise fall back to the auto-created kinematic body for raycast doors / pushwalls.
@@ -18,6 +18,7 @@
 #include "renderer/RendererTilemap.h"
 #include "renderer/RendererVoxel.h"
 #include "renderer/RendererVoxelLayer.h"
+#include "renderer/utils/TextureUploadQueue.h"
 
 namespace owl::renderer {
 
@@ -94,6 +95,7 @@ void Renderer::reset() {
 	m_sceneData.reset();
 	m_shaderLibrary.reset();
 	m_textureLibrary.reset();
+	utils::TextureUploadQueue::get().clear();
 	m_renderStack = RenderStack{};
 }
 
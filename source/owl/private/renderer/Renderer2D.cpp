@@ -10,6 +10,7 @@
 #include "renderer/Renderer2D.h"
 
 #include "app/Application.h"
+#include "core/FrameArena.h"
 #include "renderer/BackgroundRenderer.h"
 #include "renderer/RendererTilemap.h"
 #include "renderer/gpu/DrawData.h"
@@ -17,6 +18,7 @@
 #include "renderer/gpu/RendererDescriptors.h"
 #include "renderer/gpu/StorageBuffer.h"
 #include "renderer/gpu/UniformBuffer.h"
+#include "renderer/utils/TextureResidency.h"
 
 namespace owl::renderer {
 
@@ -105,6 +107,11 @@ struct InternalData {
 	shared<gpu::UniformBuffer> cameraUniformBuffer;
 	std::vector<shared<gpu::Texture2D>> textureSlots;
 	uint32_t textureSlotIndex = 1;
+	TextureResidency residency;
+	/// Batch stamp of each texture handle in the one-slot-per-texture model, for the avoided-break count.
+	std::vector<uint32_t> sourceBatch;
+	uint32_t sourceBatchId = 1;
+	uint32_t sourceSlotIndex = 1;
 	shared<gpu::StorageBuffer> sceneWorlds;
 	shared<gpu::StorageBuffer> sceneWorldsFallback;
 	std::vector<math::mat4> transientWorlds;
@@ -126,6 +133,44 @@ auto resolveWorldIndex(const int32_t iRequested, const math::Transform& iTransfo
 	return -(slot + 1);
 }
 
+/// Slot of a texture in the current batch, starting a new batch when the slots are exhausted.
+auto bindTextureSlot(const shared<gpu::Texture>& iTexture, const uint32_t iHandle) -> uint32_t {
+	if (const uint32_t slot = g_Data->residency.findSlot(iHandle); slot != utils::TextureResidency::g_noSlot)
+		return slot;
+	if (g_Data->textureSlotIndex >= utils::g_MaxTextureSlots) {
+		++g_Data->stats.textureBatchBreaks;
+		Renderer2D::nextBatch();
+	}
+	const uint32_t slot = g_Data->textureSlotIndex++;
+	g_Data->textureSlots[slot] = std::static_pointer_cast<gpu::Texture2D>(iTexture);
+	g_Data->residency.setSlot(iHandle, slot);
+	return slot;
+}
+
+/// Replay the slot usage of one slot per source texture, counting the batch breaks it would have needed.
+void trackSourceTexture(const uint32_t iHandle) {
+	if (iHandle >= g_Data->sourceBatch.size())
+		g_Data->sourceBatch.resize(static_cast<size_t>(iHandle) + 1, 0);
+	if (g_Data->sourceBatch[iHandle] == g_Data->sourceBatchId)
+		return;
+	if (g_Data->sourceSlotIndex >= utils::g_MaxTextureSlots) {
+		++g_Data->stats.batchBreaksAvoided;
+		++g_Data->sourceBatchId;
+		g_Data->sourceSlotIndex = 1;
+	}
+	g_Data->sourceBatch[iHandle] = g_Data->sourceBatchId;
+	++g_Data->sourceSlotIndex;
+}
+
+/// Check if a quad samples its texture only inside [0,1], so the texture may come from an atlas page.
+auto fitsAtlas(const Quad2DData& iQuadData) -> bool {
+	if (iQuadData.tilingFactor.x() != 1.f || iQuadData.tilingFactor.y() != 1.f)
+		return false;
+	return std::ranges::all_of(iQuadData.textureCoords, [](const math::vec2& iUv) -> bool {
+		return iUv.x() >= 0.f && iUv.x() <= 1.f && iUv.y() >= 0.f && iUv.y() <= 1.f;
+	});
+}
+
 auto allocateTransientWorld(const math::mat4& iMatrix) -> int32_t {
 	if (g_Data->transientWorlds.size() >= utils::g_maxTransientWorldsPerBatch)
 		Renderer2D::nextBatch();
@@ -134,13 +179,15 @@ auto allocateTransientWorld(const math::mat4& iMatrix) -> int32_t {
 	return -(slot + 1);
 }
 
-auto utf8ToLatin1(const std::string& iText) -> std::string {
-	std::string out;
-	out.reserve(iText.size());
+/// Convert to the Latin-1 font encoding, the result lives in the frame arena.
+auto utf8ToLatin1(const std::string& iText) -> std::string_view {
+	// Latin-1 never needs more bytes than UTF-8.
+	const auto out = core::FrameArena::frame().allocateSpan<char>(iText.size());
+	size_t size = 0;
 	for (size_t i = 0; i < iText.size(); ++i) {
 		const auto byte = static_cast<unsigned char>(iText[i]);
 		if (byte < 0x80) {
-			out.push_back(static_cast<char>(byte));
+			out[size++] = static_cast<char>(byte);
 			continue;
 		}
 		if ((byte & 0xE0) == 0xC0 && i + 1 < iText.size()) {
@@ -148,13 +195,13 @@ auto utf8ToLatin1(const std::string& iText) -> std::string {
 				const uint32_t codepoint =
 						static_cast<uint32_t>(byte & 0x1Fu) << 6 | static_cast<uint32_t>(next & 0x3Fu);
 				if (codepoint <= 0xFFu) {
-					out.push_back(static_cast<char>(codepoint));
+					out[size++] = static_cast<char>(codepoint);
 					++i;
 					continue;
 				}
 			}
 		}
-		out.push_back('?');
+		out[size++] = '?';
 		while (i + 1 < iText.size()) {
 			if (const auto next = static_cast<unsigned char>(iText[i + 1]); (next & 0xC0) == 0x80)
 				++i;
@@ -162,7 +209,7 @@ auto utf8ToLatin1(const std::string& iText) -> std::string {
 				break;
 		}
 	}
-	return out;
+	return {out.data(), size};
 }
 }// namespace
 
@@ -271,6 +318,7 @@ void Renderer2D::shutdown() {
 
 	g_Data->cameraUniformBuffer.reset();
 	g_Data->whiteTexture.reset();
+	g_Data->residency.clear();
 	for (auto& text: g_Data->textureSlots) {
 		if (text == nullptr)
 			continue;
@@ -297,6 +345,11 @@ void Renderer2D::beginScene(const Camera& iCamera) {
 		g_Data->cameraBuffer.viewProjection = iCamera.getViewProjection();
 		g_Data->cameraUniformBuffer->setData(&g_Data->cameraBuffer, sizeof(utils::InternalData::CameraData), 0);
 	}
+	// Atlas pages only change between scenes, never under a batch that samples them; sources decode on the workers.
+	if (g_Data->residency.hasPending()) {
+		auto* scheduler = app::Application::instanced() ? &app::Application::get().getTaskScheduler() : nullptr;
+		g_Data->residency.update(scheduler);
+	}
 	startBatch();
 	RendererTilemap::beginScene(iCamera);
 }
@@ -305,6 +358,9 @@ void Renderer2D::endScene() {
 	OWL_PROFILE_FUNCTION()
 
 	flush();
+	// Nothing else rewinds the frame arena without a frame loop: the scene's scratch data is no longer needed.
+	if (auto& arena = core::FrameArena::frame(); !arena.hasFrameLoop())
+		arena.reset();
 }
 
 void Renderer2D::flush() {
@@ -381,6 +437,10 @@ void Renderer2D::startBatch() {
 	utils::resetBatch(g_Data->line, utils::g_maxLinesPerBatch);
 	utils::resetBatch(g_Data->text, utils::g_maxTextGlyphsPerBatch);
 	g_Data->textureSlotIndex = 1;
+	g_Data->residency.beginBatch();
+	g_Data->residency.setSlot(g_Data->residency.acquire(g_Data->whiteTexture), 0);
+	++g_Data->sourceBatchId;
+	g_Data->sourceSlotIndex = 1;
 	g_Data->transientWorlds.clear();
 	g_Data->transientWorlds.reserve(utils::g_maxTransientWorldsPerBatch);
 }
@@ -411,13 +471,13 @@ void Renderer2D::drawLine(const LineData& iLineData) {
 
 void Renderer2D::drawRect(const RectData& iRectData) {
 	const math::mat4 trans = iRectData.transform();
-	std::vector<math::vec3> points;
-	static const std::vector<std::pair<uint8_t, uint8_t>> idx = {{0, 1}, {1, 2}, {2, 3}, {3, 0}};
-	points.reserve(utils::g_quadVertexPositions.size());
-	for (const auto& vtx: utils::g_quadVertexPositions) points.emplace_back(trans * vtx);
-	for (const auto& [p1, p2]: idx)
-		drawLine(
-				{.point1 = points[p1], .point2 = points[p2], .color = iRectData.color, .entityId = iRectData.entityId});
+	std::array<math::vec3, 4> points;
+	for (size_t i = 0; i < points.size(); ++i) points[i] = trans * utils::g_quadVertexPositions[i];
+	for (size_t i = 0; i < points.size(); ++i)
+		drawLine({.point1 = points[i],
+				  .point2 = points[(i + 1) % points.size()],
+				  .color = iRectData.color,
+				  .entityId = iRectData.entityId});
 }
 
 void Renderer2D::drawPolyLine(const PolyLineData& iLineData) {
@@ -426,20 +486,17 @@ void Renderer2D::drawPolyLine(const PolyLineData& iLineData) {
 		return;
 	}
 	const math::mat4 trans = iLineData.transform();
-	std::vector<math::vec3> points;
-	std::vector<std::pair<uint32_t, uint32_t>> link;
-	uint32_t i = 0;
-	for (const auto& vtx: iLineData.points) {
-		points.emplace_back(trans * math::vec4{vtx.x(), vtx.y(), vtx.z(), 1.f});
-		if (i < iLineData.points.size() - 1)
-			link.emplace_back(i, i + 1);
-		++i;
+	const auto points = core::FrameArena::frame().allocateSpan<math::vec3>(iLineData.points.size());
+	for (size_t i = 0; i < points.size(); ++i) {
+		const auto& vtx = iLineData.points[i];
+		points[i] = trans * math::vec4{vtx.x(), vtx.y(), vtx.z(), 1.f};
 	}
-	if (iLineData.closed)
-		link.emplace_back(iLineData.points.size() - 1, 0);
-	for (const auto& [p1, p2]: link)
-		drawLine(
-				{.point1 = points[p1], .point2 = points[p2], .color = iLineData.color, .entityId = iLineData.entityId});
+	const size_t linkCount = iLineData.closed ? points.size() : points.size() - 1;
+	for (size_t i = 0; i < linkCount; ++i)
+		drawLine({.point1 = points[i],
+				  .point2 = points[(i + 1) % points.size()],
+				  .color = iLineData.color,
+				  .entityId = iLineData.entityId});
 }
 
 void Renderer2D::drawCircle(const CircleData& iCircleData) {
@@ -461,30 +518,32 @@ void Renderer2D::drawCircle(const CircleData& iCircleData) {
 void Renderer2D::drawQuad(const Quad2DData& iQuadData) {
 	OWL_PROFILE_FUNCTION()
 
-	if (g_Data->quad.instances.size() >= utils::g_maxQuadsPerBatch)
+	// Break before binding the texture: a break afterwards would invalidate its slot.
+	if (g_Data->quad.instances.size() >= utils::g_maxQuadsPerBatch ||
+		(iQuadData.worldIndex < 0 && g_Data->transientWorlds.size() >= utils::g_maxTransientWorldsPerBatch))
 		nextBatch();
 	uint32_t textureIndex = 0;
+	std::array<math::vec2, 4> uv = iQuadData.textureCoords;
 	if (iQuadData.texture != nullptr) {
-		for (uint32_t i = 1; i < g_Data->textureSlotIndex; i++) {
-			if (*g_Data->textureSlots[i] == *iQuadData.texture) {
-				textureIndex = i;
-				break;
-			}
-		}
-		if (textureIndex == 0) {
-			if (g_Data->textureSlotIndex >= utils::g_MaxTextureSlots)
-				nextBatch();
-			textureIndex = g_Data->textureSlotIndex;
-			g_Data->textureSlots[g_Data->textureSlotIndex] =
-					std::static_pointer_cast<gpu::Texture2D>(iQuadData.texture);
-			g_Data->textureSlotIndex++;
+		auto& residency = g_Data->residency;
+		const uint32_t handle = residency.acquire(iQuadData.texture);
+		if (const auto* region = fitsAtlas(iQuadData) ? residency.findAtlasRegion(handle) : nullptr;
+			region != nullptr) {
+			textureIndex =
+					bindTextureSlot(residency.getPageTexture(region->page), residency.getPageHandle(region->page));
+			for (auto& coord: uv)
+				coord = math::vec2{region->offset.x() + coord.x() * region->scale.x(),
+								   region->offset.y() + coord.y() * region->scale.y()};
+		} else {
+			textureIndex = bindTextureSlot(iQuadData.texture, handle);
 		}
+		trackSourceTexture(handle);
 	}
 	const int32_t worldIndex = resolveWorldIndex(iQuadData.worldIndex, iQuadData.transform);
 	g_Data->quad.instances.push_back(utils::QuadInstance{.worldIndex = worldIndex,
 														 ._pad0 = {0u, 0u, 0u},
 														 .color = iQuadData.color,
-														 .uv = iQuadData.textureCoords,
+														 .uv = uv,
 														 .texIndex = textureIndex,
 														 .entityId = iQuadData.entityId,
 														 .tilingFactor = iQuadData.tilingFactor});
@@ -497,22 +556,9 @@ void Renderer2D::drawString(const StringData& iStringData) {
 		return;
 	}
 
-	const std::string text = utf8ToLatin1(iStringData.text);
+	const std::string_view text = utf8ToLatin1(iStringData.text);
 	const shared<gpu::Texture2D> fontAtlas = iStringData.font->getAtlasTexture();
-	uint32_t textureIndex = 0;
-	for (uint32_t i = 1; i < g_Data->textureSlotIndex; i++) {
-		if (*g_Data->textureSlots[i] == *fontAtlas) {
-			textureIndex = i;
-			break;
-		}
-	}
-	if (textureIndex == 0) {
-		if (g_Data->textureSlotIndex >= utils::g_MaxTextureSlots)
-			nextBatch();
-		textureIndex = g_Data->textureSlotIndex;
-		g_Data->textureSlots[g_Data->textureSlotIndex] = fontAtlas;
-		g_Data->textureSlotIndex++;
-	}
+	const uint32_t fontHandle = g_Data->residency.acquire(fontAtlas);
 	math::box2f extents;
 	{
 		math::vec2 cursor{0.f, 0.f};
@@ -561,8 +607,11 @@ void Renderer2D::drawString(const StringData& iStringData) {
 		quad.translate(cursor + offset);
 		quad.scale(scale);
 
-		if (g_Data->text.instances.size() >= utils::g_maxTextGlyphsPerBatch)
+		if (g_Data->text.instances.size() >= utils::g_maxTextGlyphsPerBatch ||
+			g_Data->transientWorlds.size() >= utils::g_maxTransientWorldsPerBatch)
 			nextBatch();
+		const uint32_t textureIndex = bindTextureSlot(fontAtlas, fontHandle);
+		trackSourceTexture(fontHandle);
 
 		const math::vec2 glyphCenter = (quad.min() + quad.max()) * 0.5f;
 		const math::vec2 glyphSize = quad.max() - quad.min();
@@ -597,6 +646,8 @@ void Renderer2D::resetStats() {
 	g_Data->stats.drawCalls = 0;
 	g_Data->stats.quadCount = 0;
 	g_Data->stats.lineCount = 0;
+	g_Data->stats.textureBatchBreaks = 0;
+	g_Data->stats.batchBreaksAvoided = 0;
 }
 
 auto Renderer2D::getStats() -> Statistics { return g_Data->stats; }
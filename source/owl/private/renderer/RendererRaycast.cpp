@@ -9,6 +9,10 @@
 
 #include "renderer/RendererRaycast.h"
 
+#include "app/Application.h"
+#include "core/FrameArena.h"
+#include "core/task/ParallelUtils.h"
+#include "core/task/Scheduler.h"
 #include "math/Transform.h"
 #include "math/trigonometry.h"
 #include "renderer/CameraOrtho.h"
@@ -20,6 +24,7 @@
 #include "renderer/gpu/Texture.h"
 #include "renderer/gpu/UniformBuffer.h"
 #include "renderer/utils/RaycastDDAPass.h"
+#include "renderer/utils/RaycastSpriteBatch.h"
 #include "scene/TilemapAsset.h"
 #include "scene/Tileset.h"
 #include "scene/component/Tilemap.h"
@@ -29,6 +34,11 @@
 #include <limits>
 #include <ranges>
 
+#if defined(__x86_64__) || defined(_M_X64)
+#define OWL_RAYCAST_SSE
+#include <emmintrin.h>
+#endif
+
 namespace owl::renderer {
 
 namespace {
@@ -43,6 +53,38 @@ struct StripeParamsUbo {
 };
 static_assert(sizeof(StripeParamsUbo) == 96, "StripeParamsUbo must match shader UBO layout");
 
+// std140 layout — must match `SpriteParams` in `raycast_sprite.slang`.
+struct SpriteParamsUbo {
+	math::mat4 viewProjection;
+	math::vec4 floats;// (stripePxWidth, unused, unused, unused)
+	uint32_t numRays;
+	uint32_t _pad[3];
+};
+static_assert(sizeof(SpriteParamsUbo) == 96, "SpriteParamsUbo must match shader UBO layout");
+
+// One textured 1-column stripe, recorded by a column job and submitted to `Renderer2D` on the calling thread.
+struct StripeQuad {
+	float x;
+	float y;
+	float width;
+	float height;
+	math::vec4 tint;
+	float u;
+	float vBottom;
+	float vTop;
+	int entityId;
+	// Points into the caller's payload (tileset atlas, wall / door / sprite texture), alive for the whole draw call.
+	const shared<gpu::Texture>* texture;
+};
+
+// Output of one block of screen columns: stripes in emission order and the counters they account for.
+struct ColumnBlock {
+	std::vector<StripeQuad> stripes;
+	RendererRaycast::Statistics stats;
+	// One flag per input item (pushwall, door, sprite) that emitted at least one stripe in the block.
+	std::vector<uint8_t> contributed;
+};
+
 // Per-pass state shared between `beginScene`, the `drawTilemap*` calls, and `endScene`.
 struct State {
 	// Camera world position (XY plane).
@@ -78,10 +120,28 @@ struct State {
 	size_t cachedLayerIdx = 0;
 	// True once the `RendererRaycast` descriptor block has been declared.
 	bool descriptorBlockReady = false;
+	// Sprite pipeline (GPU path) — UBO + sprite / zBuffer SSBOs + dedicated DrawData.
+	shared<gpu::UniformBuffer> spriteParams;
+	shared<gpu::StorageBuffer> spriteSsbo;
+	shared<gpu::StorageBuffer> spriteZBufferSsbo;
+	// Columns the zBuffer SSBO can hold (grown with the ray count).
+	uint32_t spriteZBufferCapacity = 0;
+	shared<gpu::DrawData> spriteDrawData;
+	// Records and texture slots of the sprite batch being built.
+	utils::RaycastSpriteBatch spriteBatch;
+	// True once the `RendererRaycastSprite` descriptor block has been declared.
+	bool spriteBlockReady = false;
+	// Per-block stripe buffers of the CPU column paths (capacity kept across frames).
+	std::vector<ColumnBlock> columnBlocks;
+	// Merged per-item contribution flags of the last column pass.
+	std::vector<uint8_t> contributed;
 };
 
 shared<State> g_state;
 
+// Scheduler set by `RendererRaycast::setScheduler` (nullptr = the application's one).
+core::task::Scheduler* g_scheduler = nullptr;
+
 // Side darkening factor applied to walls hit on a Y-cell-edge (gives a cheap "lighting" cue).
 constexpr float g_YSideDarken = 0.7f;
 
@@ -91,6 +151,99 @@ constexpr float g_MinPerpDist = 1e-4f;
 // Squared-length floor used when picking a fallback for degenerate camera vectors.
 constexpr float g_DirEpsilonSq = 1e-8f;
 
+// Screen columns per CPU job. A multiple of `g_RayPacket`, so only the last block walks rays one by one.
+constexpr uint32_t g_ColumnBlock = 64;
+
+// Rays stepped together by the packet DDA.
+constexpr uint32_t g_RayPacket = 4;
+
+// Maximum stack of hits per column (transparent cells plus the closing opaque one) — same as `raycast_dda.slang`.
+constexpr size_t g_MaxColumnHits = 8;
+
+auto columnScheduler() -> core::task::Scheduler* {
+	if (g_scheduler != nullptr)
+		return g_scheduler;
+	if (app::Application::instanced())
+		return &app::Application::get().getTaskScheduler();
+	return nullptr;
+}
+
+// Camera-space direction of the ray through the centre of a screen column.
+auto columnRayDir(const math::vec2& iDir, const math::vec2& iPlane, const uint32_t iCol, const uint32_t iNumRays)
+		-> math::vec2 {
+	const float cameraX = 2.f * (static_cast<float>(iCol) + 0.5f) / static_cast<float>(iNumRays) - 1.f;
+	return {iDir.x() + iPlane.x() * cameraX, iDir.y() + iPlane.y() * cameraX};
+}
+
+void submitStripe(const StripeQuad& iStripe) {
+	math::Transform stripeTr;
+	stripeTr.translation() = math::vec3{iStripe.x, iStripe.y, 0.f};
+	stripeTr.scale() = math::vec3{iStripe.width, iStripe.height, 1.f};
+	const std::array<math::vec2, 4> stripeUv{
+			math::vec2{iStripe.u, iStripe.vBottom},
+			math::vec2{iStripe.u, iStripe.vBottom},
+			math::vec2{iStripe.u, iStripe.vTop},
+			math::vec2{iStripe.u, iStripe.vTop},
+	};
+	Renderer2D::drawQuad({.transform = stripeTr,
+						  .color = iStripe.tint,
+						  .texture = *iStripe.texture,
+						  .textureCoords = stripeUv,
+						  .entityId = iStripe.entityId});
+}
+
+/**
+ * @brief
+ *  Run a per-column pass over blocks of `g_ColumnBlock` columns, then submit the recorded stripes.
+ *
+ * Blocks run on the task scheduler when one is available, each one writing
+ * only its own `ColumnBlock` and its own zBuffer columns. Their stripes are
+ * then submitted block after block on the calling thread, so the output is
+ * the same as a serial walk. Only the column counters of the statistics are
+ * merged; per-item counters are derived from the returned count.
+ * @param[in] iNumRays Number of screen columns.
+ * @param[in] iItemCount Number of input items tracked in `ColumnBlock::contributed`.
+ * @param[in] iBlockFunc Called as `(block, firstColumn, endColumn)`.
+ * @return The number of items that emitted at least one stripe.
+ */
+template<typename BlockFunc>
+auto runColumnBlocks(const uint32_t iNumRays, const size_t iItemCount, const BlockFunc& iBlockFunc) -> uint32_t {
+	const uint32_t blockCount = (iNumRays + g_ColumnBlock - 1) / g_ColumnBlock;
+	auto& blocks = g_state->columnBlocks;
+	if (blocks.size() < blockCount)
+		blocks.resize(blockCount);
+	for (uint32_t b = 0; b < blockCount; ++b) {
+		blocks[b].stripes.clear();
+		blocks[b].stats = RendererRaycast::Statistics{};
+		blocks[b].contributed.assign(iItemCount, 0);
+	}
+	const auto runBlock = [&](const uint32_t iBlock) -> void {
+		const uint32_t first = iBlock * g_ColumnBlock;
+		iBlockFunc(blocks[iBlock], first, std::min(iNumRays, first + g_ColumnBlock));
+	};
+	if (auto* scheduler = columnScheduler(); scheduler != nullptr && blockCount > 1)
+		core::task::parallelForIndex(*scheduler, uint32_t{0}, blockCount, uint32_t{1}, runBlock);
+	else
+		for (uint32_t b = 0; b < blockCount; ++b) runBlock(b);
+
+	auto& stats = g_state->stats;
+	auto& contributed = g_state->contributed;
+	contributed.assign(iItemCount, 0);
+	for (uint32_t b = 0; b < blockCount; ++b) {
+		const auto& block = blocks[b];
+		for (const auto& stripe: block.stripes) submitStripe(stripe);
+		stats.stripeCount += block.stats.stripeCount;
+		stats.hitCount += block.stats.hitCount;
+		stats.missCount += block.stats.missCount;
+		stats.spriteStripeCount += block.stats.spriteStripeCount;
+		stats.spriteOccludedCount += block.stats.spriteOccludedCount;
+		stats.dynamicWallStripeCount += block.stats.dynamicWallStripeCount;
+		stats.doorStripeCount += block.stats.doorStripeCount;
+		for (size_t i = 0; i < iItemCount; ++i) contributed[i] |= block.contributed[i];
+	}
+	return static_cast<uint32_t>(std::ranges::count(contributed, uint8_t{1}));
+}
+
 auto pickActiveLayerIndex(const scene::TilemapAsset& iTilemap) -> size_t {
 	for (size_t i = 0; i < iTilemap.layers.size(); ++i) {
 		const auto& layer = iTilemap.layers[i];
@@ -129,72 +282,158 @@ struct CpuColumnHit {
 	bool transparent;
 };
 
-// One-column CPU DDA — mirrors the GPU `raycast_dda.slang` algorithm so the Null-backend fallback matches.
-auto cpuWalkColumn(const WallStripeContext& iCtx, const uint32_t iCol, std::vector<CpuColumnHit>& ioHits) -> void {
-	constexpr size_t kMaxTransparentHits = 8;
-	const float cameraX = 2.f * (static_cast<float>(iCol) + 0.5f) / static_cast<float>(iCtx.numRays) - 1.f;
-	const math::vec2 rayDir{iCtx.camCellDir.x() + iCtx.camCellPlane.x() * cameraX,
-							iCtx.camCellDir.y() + iCtx.camCellPlane.y() * cameraX};
+// Hit stack of one column, nearest first.
+struct CpuColumnHits {
+	std::array<CpuColumnHit, g_MaxColumnHits> hits{};
+	size_t count = 0;
+};
+
+// DDA state of one ray right before its first step.
+struct CpuRay {
+	math::vec2 rayDir;
+	float deltaX;
+	float deltaY;
+	int stepX;
+	int stepY;
+	float sideDistX;
+	float sideDistY;
+};
+
+auto cpuSetupRay(const WallStripeContext& iCtx, const uint32_t iCol) -> CpuRay {
+	const math::vec2 rayDir = columnRayDir(iCtx.camCellDir, iCtx.camCellPlane, iCol, iCtx.numRays);
 	const float deltaX = (std::abs(rayDir.x()) < 1e-6f) ? 1e30f : std::abs(1.f / rayDir.x());
 	const float deltaY = (std::abs(rayDir.y()) < 1e-6f) ? 1e30f : std::abs(1.f / rayDir.y());
+	const float mapX = std::floor(iCtx.camCellPos.x());
+	const float mapY = std::floor(iCtx.camCellPos.y());
+	return {.rayDir = rayDir,
+			.deltaX = deltaX,
+			.deltaY = deltaY,
+			.stepX = (rayDir.x() < 0.f) ? -1 : 1,
+			.stepY = (rayDir.y() < 0.f) ? -1 : 1,
+			.sideDistX = (rayDir.x() < 0.f) ? (iCtx.camCellPos.x() - mapX) * deltaX
+											: (mapX + 1.f - iCtx.camCellPos.x()) * deltaX,
+			.sideDistY = (rayDir.y() < 0.f) ? (iCtx.camCellPos.y() - mapY) * deltaY
+											: (mapY + 1.f - iCtx.camCellPos.y()) * deltaY};
+}
+
+// Test the cell a ray just stepped into. Returns false once the ray stops (opaque cell or full hit stack).
+auto cpuTestCell(const WallStripeContext& iCtx, const math::vec2& iRayDir, const int iMapX, const int iMapY,
+				 const int iSide, const float iPerpDist, CpuColumnHits& ioHits) -> bool {
+	const int32_t cell = iCtx.tilemap.getTile(static_cast<uint32_t>(iCtx.layerIdx), static_cast<uint32_t>(iMapX),
+											  static_cast<uint32_t>(iMapY));
+	if (cell < 0)
+		return true;
+	const auto& meta = iCtx.tileset.getTileMeta(static_cast<uint32_t>(cell));
+	const float perpDistSafe = std::max(iPerpDist, g_MinPerpDist);
+	float wallX = (iSide == 0) ? (iCtx.camCellPos.y() + perpDistSafe * iRayDir.y())
+							   : (iCtx.camCellPos.x() + perpDistSafe * iRayDir.x());
+	wallX -= std::floor(wallX);
+	if (iSide == 0 && iRayDir.x() > 0.f)
+		wallX = 1.f - wallX;
+	if (iSide == 1 && iRayDir.y() < 0.f)
+		wallX = 1.f - wallX;
+	ioHits.hits[ioHits.count++] = {.tileIndex = cell,
+								   .perpDist = perpDistSafe,
+								   .wallX = wallX,
+								   .wallHeight = std::max(0.f, meta.wallHeight),
+								   .side = iSide,
+								   .transparent = meta.transparent};
+	return meta.transparent && ioHits.count < g_MaxColumnHits;
+}
+
+// One-column CPU DDA — mirrors the GPU `raycast_dda.slang` algorithm so the Null-backend fallback matches.
+auto cpuWalkColumn(const WallStripeContext& iCtx, const uint32_t iCol, CpuColumnHits& oHits) -> void {
+	CpuRay ray = cpuSetupRay(iCtx, iCol);
 	int mapX = static_cast<int>(std::floor(iCtx.camCellPos.x()));
 	int mapY = static_cast<int>(std::floor(iCtx.camCellPos.y()));
-	const int stepX = (rayDir.x() < 0.f) ? -1 : 1;
-	const int stepY = (rayDir.y() < 0.f) ? -1 : 1;
-	float sideDistX = (rayDir.x() < 0.f) ? (iCtx.camCellPos.x() - static_cast<float>(mapX)) * deltaX
-										 : (static_cast<float>(mapX + 1) - iCtx.camCellPos.x()) * deltaX;
-	float sideDistY = (rayDir.y() < 0.f) ? (iCtx.camCellPos.y() - static_cast<float>(mapY)) * deltaY
-										 : (static_cast<float>(mapY + 1) - iCtx.camCellPos.y()) * deltaY;
-	ioHits.clear();
-	int side = 0;
+	oHits.count = 0;
 	for (int step = 0; step < iCtx.maxSteps; ++step) {
-		if (sideDistX < sideDistY) {
-			sideDistX += deltaX;
-			mapX += stepX;
-			side = 0;
+		int side = 0;
+		if (ray.sideDistX < ray.sideDistY) {
+			ray.sideDistX += ray.deltaX;
+			mapX += ray.stepX;
 		} else {
-			sideDistY += deltaY;
-			mapY += stepY;
+			ray.sideDistY += ray.deltaY;
+			mapY += ray.stepY;
 			side = 1;
 		}
-		const auto layerId = static_cast<uint32_t>(iCtx.layerIdx);
-		const auto cellX = static_cast<uint32_t>(mapX);
-		const auto cellY = static_cast<uint32_t>(mapY);
-		const int32_t cell = iCtx.tilemap.getTile(layerId, cellX, cellY);
-		if (cell < 0)
-			continue;
-		const auto& meta = iCtx.tileset.getTileMeta(static_cast<uint32_t>(cell));
-		const float perpDistCells = (side == 0) ? (sideDistX - deltaX) : (sideDistY - deltaY);
-		const float perpDistSafe = std::max(perpDistCells, g_MinPerpDist);
-		float wallX = (side == 0) ? (iCtx.camCellPos.y() + perpDistSafe * rayDir.y())
-								  : (iCtx.camCellPos.x() + perpDistSafe * rayDir.x());
-		wallX -= std::floor(wallX);
-		if (side == 0 && rayDir.x() > 0.f)
-			wallX = 1.f - wallX;
-		if (side == 1 && rayDir.y() < 0.f)
-			wallX = 1.f - wallX;
-		ioHits.push_back({.tileIndex = cell,
-						  .perpDist = perpDistSafe,
-						  .wallX = wallX,
-						  .wallHeight = std::max(0.f, meta.wallHeight),
-						  .side = side,
-						  .transparent = meta.transparent});
-		if (!meta.transparent)
-			break;
-		if (ioHits.size() >= kMaxTransparentHits)
+		const float perpDist = (side == 0) ? (ray.sideDistX - ray.deltaX) : (ray.sideDistY - ray.deltaY);
+		if (!cpuTestCell(iCtx, ray.rayDir, mapX, mapY, side, perpDist, oHits))
 			break;
 	}
 }
 
-// Emit one column's CPU-walked stripe stack as Renderer2D drawcalls. Updates stats + the renderer zBuffer.
-auto cpuEmitColumn(const WallStripeContext& iCtx, const uint32_t iCol, const std::vector<CpuColumnHit>& iHits) -> void {
-	g_state->stats.stripeCount++;
-	if (iHits.empty()) {
-		g_state->stats.missCount++;
+// Packet DDA over `g_RayPacket` consecutive columns. The side choice and the advance of every lane are computed
+// branch-free with SSE2 (plain adds and selects, so each lane is bit-identical to `cpuWalkColumn`); only the cell
+// tests stay per lane.
+auto cpuWalkPacket(const WallStripeContext& iCtx, const uint32_t iCol, std::array<CpuColumnHits, g_RayPacket>& oHits)
+		-> void {
+#ifdef OWL_RAYCAST_SSE
+	std::array<CpuRay, g_RayPacket> rays{};
+	alignas(16) std::array<float, g_RayPacket> sideDistX{};
+	alignas(16) std::array<float, g_RayPacket> sideDistY{};
+	alignas(16) std::array<float, g_RayPacket> deltaX{};
+	alignas(16) std::array<float, g_RayPacket> deltaY{};
+	alignas(16) std::array<int32_t, g_RayPacket> stepX{};
+	alignas(16) std::array<int32_t, g_RayPacket> stepY{};
+	for (uint32_t lane = 0; lane < g_RayPacket; ++lane) {
+		rays[lane] = cpuSetupRay(iCtx, iCol + lane);
+		sideDistX[lane] = rays[lane].sideDistX;
+		sideDistY[lane] = rays[lane].sideDistY;
+		deltaX[lane] = rays[lane].deltaX;
+		deltaY[lane] = rays[lane].deltaY;
+		stepX[lane] = rays[lane].stepX;
+		stepY[lane] = rays[lane].stepY;
+		oHits[lane].count = 0;
+	}
+	__m128 sdx = _mm_load_ps(sideDistX.data());
+	__m128 sdy = _mm_load_ps(sideDistY.data());
+	const __m128 dx = _mm_load_ps(deltaX.data());
+	const __m128 dy = _mm_load_ps(deltaY.data());
+	const __m128i sx = _mm_load_si128(reinterpret_cast<const __m128i*>(stepX.data()));
+	const __m128i sy = _mm_load_si128(reinterpret_cast<const __m128i*>(stepY.data()));
+	__m128i mx = _mm_set1_epi32(static_cast<int32_t>(std::floor(iCtx.camCellPos.x())));
+	__m128i my = _mm_set1_epi32(static_cast<int32_t>(std::floor(iCtx.camCellPos.y())));
+	alignas(16) std::array<int32_t, g_RayPacket> mapX{};
+	alignas(16) std::array<int32_t, g_RayPacket> mapY{};
+	uint32_t active = (1u << g_RayPacket) - 1u;
+	for (int step = 0; step < iCtx.maxSteps && active != 0; ++step) {
+		const __m128 alongX = _mm_cmplt_ps(sdx, sdy);
+		const __m128i alongXi = _mm_castps_si128(alongX);
+		sdx = _mm_add_ps(sdx, _mm_and_ps(alongX, dx));
+		sdy = _mm_add_ps(sdy, _mm_andnot_ps(alongX, dy));
+		mx = _mm_add_epi32(mx, _mm_and_si128(alongXi, sx));
+		my = _mm_add_epi32(my, _mm_andnot_si128(alongXi, sy));
+		_mm_store_ps(sideDistX.data(), sdx);
+		_mm_store_ps(sideDistY.data(), sdy);
+		_mm_store_si128(reinterpret_cast<__m128i*>(mapX.data()), mx);
+		_mm_store_si128(reinterpret_cast<__m128i*>(mapY.data()), my);
+		const auto xMask = static_cast<uint32_t>(_mm_movemask_ps(alongX));
+		for (uint32_t lane = 0; lane < g_RayPacket; ++lane) {
+			if ((active & (1u << lane)) == 0)
+				continue;
+			const int side = (xMask & (1u << lane)) != 0 ? 0 : 1;
+			const float perpDist = (side == 0) ? (sideDistX[lane] - deltaX[lane]) : (sideDistY[lane] - deltaY[lane]);
+			if (!cpuTestCell(iCtx, rays[lane].rayDir, mapX[lane], mapY[lane], side, perpDist, oHits[lane]))
+				active &= ~(1u << lane);
+		}
+	}
+#else
+	for (uint32_t lane = 0; lane < g_RayPacket; ++lane) cpuWalkColumn(iCtx, iCol + lane, oHits[lane]);
+#endif
+}
+
+// Record one column's CPU-walked stripe stack. Updates the block counters + the renderer zBuffer.
+auto cpuEmitColumn(const WallStripeContext& iCtx, const uint32_t iCol, const CpuColumnHits& iHits,
+				   ColumnBlock& ioBlock) -> void {
+	ioBlock.stats.stripeCount++;
+	if (iHits.count == 0) {
+		ioBlock.stats.missCount++;
 		return;
 	}
+	const std::span<const CpuColumnHit> hits{iHits.hits.data(), iHits.count};
 	float opaqueDepth = std::numeric_limits<float>::infinity();
-	for (const auto& hit: iHits) {
+	for (const auto& hit: hits) {
 		if (!hit.transparent) {
 			opaqueDepth = hit.perpDist;
 			break;
@@ -204,43 +443,42 @@ auto cpuEmitColumn(const WallStripeContext& iCtx, const uint32_t iCol, const std
 		g_state->zBufferPerColumn[iCol] = opaqueDepth;
 
 	const float stripeX = (static_cast<float>(iCol) + 0.5f) * iCtx.stripePxWidth;
-	for (const auto& wallHit: std::ranges::reverse_view(iHits)) {
-		g_state->stats.hitCount++;
+	for (const auto& wallHit: std::ranges::reverse_view(hits)) {
+		ioBlock.stats.hitCount++;
 		const float lineHeightUnit = std::floor((iCtx.viewport.y() / wallHit.perpDist) * 0.5f) * 2.f;
 		const float lineHeight = lineHeightUnit * wallHit.wallHeight;
 		const float screenCenterY = iCtx.horizonY + lineHeightUnit * (wallHit.wallHeight - 1.f) * 0.5f;
 		const auto tileUv = iCtx.tileset.getTileUv(static_cast<uint32_t>(wallHit.tileIndex));
 		const float uvLeft = tileUv[0].x();
 		const float uvRight = tileUv[1].x();
-		const float uvBottom = tileUv[0].y();
-		const float uvTop = tileUv[3].y();
-		const float uHit = uvLeft + wallHit.wallX * (uvRight - uvLeft);
-		math::Transform stripeTr;
-		stripeTr.translation() = math::vec3{stripeX, screenCenterY, 0.f};
-		stripeTr.scale() = math::vec3{iCtx.stripePxWidth, lineHeight, 1.f};
-		const math::vec4 tint = (wallHit.side == 1) ? math::vec4{g_YSideDarken, g_YSideDarken, g_YSideDarken, 1.f}
-													: math::vec4{1.f, 1.f, 1.f, 1.f};
-		const std::array<math::vec2, 4> stripeUv{
-				math::vec2{uHit, uvBottom},
-				math::vec2{uHit, uvBottom},
-				math::vec2{uHit, uvTop},
-				math::vec2{uHit, uvTop},
-		};
-		Renderer2D::drawQuad({.transform = stripeTr,
-							  .color = tint,
-							  .texture = iCtx.atlas,
-							  .textureCoords = stripeUv,
-							  .entityId = iCtx.entityId});
+		const float shade = (wallHit.side == 1) ? g_YSideDarken : 1.f;
+		ioBlock.stripes.push_back({.x = stripeX,
+								   .y = screenCenterY,
+								   .width = iCtx.stripePxWidth,
+								   .height = lineHeight,
+								   .tint = math::vec4{shade, shade, shade, 1.f},
+								   .u = uvLeft + wallHit.wallX * (uvRight - uvLeft),
+								   .vBottom = tileUv[0].y(),
+								   .vTop = tileUv[3].y(),
+								   .entityId = iCtx.entityId,
+								   .texture = &iCtx.atlas});
 	}
 }
 
-// CPU-side fallback that drives `Renderer2D::drawQuad` emission for every visible column.
+// CPU-side fallback: walks the columns block by block (packets of `g_RayPacket` rays) and submits the stripes.
 void emitWallStripesCpu(const WallStripeContext& iCtx) {
-	thread_local std::vector<CpuColumnHit> hits;
-	for (uint32_t col = 0; col < iCtx.numRays; ++col) {
-		cpuWalkColumn(iCtx, col, hits);
-		cpuEmitColumn(iCtx, col, hits);
-	}
+	runColumnBlocks(iCtx.numRays, 0, [&iCtx](ColumnBlock& ioBlock, const uint32_t iFirst, const uint32_t iEnd) -> void {
+		std::array<CpuColumnHits, g_RayPacket> hits;
+		uint32_t col = iFirst;
+		for (; col + g_RayPacket <= iEnd; col += g_RayPacket) {
+			cpuWalkPacket(iCtx, col, hits);
+			for (uint32_t lane = 0; lane < g_RayPacket; ++lane) cpuEmitColumn(iCtx, col + lane, hits[lane], ioBlock);
+		}
+		for (; col < iEnd; ++col) {
+			cpuWalkColumn(iCtx, col, hits[0]);
+			cpuEmitColumn(iCtx, col, hits[0], ioBlock);
+		}
+	});
 }
 
 // GPU stripe-emission path — consumes `RaycastDDAPass` output via the `raycast_stripe` shader. Returns false on failure.
@@ -352,6 +590,44 @@ void RendererRaycast::init() {
 		constexpr std::array<int32_t, 4> corners{0, 1, 2, 3};
 		g_state->stripeDrawData->setVertexData(corners.data(), static_cast<uint32_t>(corners.size() * sizeof(int32_t)));
 	}
+
+	{
+		const std::array<gpu::BindingDecl, 4> bindings{
+				gpu::BindingDecl{.binding = 0,
+								 .type = gpu::BindingType::UniformBuffer,
+								 .count = 1,
+								 .stages = gpu::ShaderStage::Vertex},
+				gpu::BindingDecl{.binding = 1,
+								 .type = gpu::BindingType::CombinedImageSampler,
+								 .count = utils::RaycastSpriteBatch::g_maxTextures,
+								 .stages = gpu::ShaderStage::Fragment},
+				gpu::BindingDecl{.binding = 2,
+								 .type = gpu::BindingType::StorageBuffer,
+								 .count = 1,
+								 .stages = gpu::ShaderStage::Vertex},
+				gpu::BindingDecl{.binding = 3,
+								 .type = gpu::BindingType::StorageBuffer,
+								 .count = 1,
+								 .stages = gpu::ShaderStage::Fragment},
+		};
+		gpu::RendererDescriptors::declare("RendererRaycastSprite", bindings);
+		g_state->spriteBlockReady = true;
+	}
+
+	const gpu::RendererDescriptors::ScopedActive spriteScoped{"RendererRaycastSprite"};
+	g_state->spriteParams =
+			gpu::UniformBuffer::create(static_cast<uint32_t>(sizeof(SpriteParamsUbo)), 0, "RendererRaycastSprite");
+	constexpr auto spriteRecordSize = static_cast<uint32_t>(sizeof(utils::RaycastSpriteBatch::Instance));
+	g_state->spriteSsbo = gpu::StorageBuffer::create(utils::RaycastSpriteBatch::g_maxSprites * spriteRecordSize, 2,
+													 "RendererRaycastSprite");
+	g_state->spriteDrawData = gpu::DrawData::create();
+	{
+		std::vector<uint32_t> indices = {0, 1, 2, 2, 3, 0};
+		g_state->spriteDrawData->init({{"i_CornerIndex", gpu::ShaderDataType::Int}}, "raycast_sprite", indices,
+									  "raycast_sprite");
+		constexpr std::array<int32_t, 4> corners{0, 1, 2, 3};
+		g_state->spriteDrawData->setVertexData(corners.data(), static_cast<uint32_t>(corners.size() * sizeof(int32_t)));
+	}
 }
 
 void RendererRaycast::shutdown() {
@@ -364,12 +640,21 @@ void RendererRaycast::shutdown() {
 	g_state->stripeDrawData.reset();
 	g_state->tileUvRectsCpu.clear();
 	g_state->tileUvRectsCpu.shrink_to_fit();
+	g_state->spriteParams.reset();
+	g_state->spriteSsbo.reset();
+	g_state->spriteZBufferSsbo.reset();
+	g_state->spriteDrawData.reset();
 	const bool wasReady = g_state->descriptorBlockReady;
+	const bool spriteWasReady = g_state->spriteBlockReady;
 	g_state.reset();
 	if (wasReady)
 		gpu::RendererDescriptors::release("RendererRaycast");
+	if (spriteWasReady)
+		gpu::RendererDescriptors::release("RendererRaycastSprite");
 }
 
+void RendererRaycast::setScheduler(core::task::Scheduler* ioScheduler) { g_scheduler = ioScheduler; }
+
 void RendererRaycast::beginScene(const Camera& iCamera, const math::vec2ui& iViewport, const RaycastConfig& iConfig) {
 	OWL_PROFILE_FUNCTION()
 
@@ -725,9 +1010,11 @@ auto castRayAabb(const math::vec2& iRayDir, float iMinX, float iMaxX, float iMin
 	return {.perpDist = perpDist, .side = side, .wallU = wallU, .valid = true};
 }
 
-void emitStripe(uint32_t iCol, float iStripeX, float iStripePxWidth, float iHorizonY, const math::vec2& iVp,
-				float iPerpDist, int iSide, float iWallU, float iWallHeight, const shared<gpu::Texture>& iTexture,
-				const math::vec4& iUvRect, const math::vec4& iTint, int iEntityId) {
+// Record one pushwall / door stripe and latch its depth in the zBuffer column.
+void emitStripe(ColumnBlock& ioBlock, uint32_t iCol, float iStripeX, float iStripePxWidth, float iHorizonY,
+				const math::vec2& iVp, float iPerpDist, int iSide, float iWallU, float iWallHeight,
+				const shared<gpu::Texture>& iTexture, const math::vec4& iUvRect, const math::vec4& iTint,
+				int iEntityId) {
 	const float lineHeightUnit = std::floor((iVp.y() / iPerpDist) * 0.5f) * 2.f;
 	const float lineHeight = lineHeightUnit * iWallHeight;
 	const float screenCenterY = iHorizonY + lineHeightUnit * (iWallHeight - 1.f) * 0.5f;
@@ -739,30 +1026,22 @@ void emitStripe(uint32_t iCol, float iStripeX, float iStripePxWidth, float iHori
 	const float subVMin = iUvRect.y() + halfV;
 	const float subVMax = iUvRect.w() - halfV;
 	const float clampedLocalU = std::clamp(iWallU, 0.f, 1.f);
-	const float uHit = subUMin + clampedLocalU * (subUMax - subUMin);
-	const float vBottom = subVMin;
-	const float vTop = subVMax;
-	math::Transform stripeTr;
-	stripeTr.translation() = math::vec3{iStripeX, screenCenterY, 0.f};
-	stripeTr.scale() = math::vec3{iStripePxWidth, lineHeight, 1.f};
 	math::vec4 tint = iTint;
 	if (iSide == 1) {
 		tint.x() *= g_YSideDarken;
 		tint.y() *= g_YSideDarken;
 		tint.z() *= g_YSideDarken;
 	}
-	tint = applyFog(tint, computeFogFactor(iPerpDist));
-	const std::array<math::vec2, 4> stripeUv{
-			math::vec2{uHit, vBottom},
-			math::vec2{uHit, vBottom},
-			math::vec2{uHit, vTop},
-			math::vec2{uHit, vTop},
-	};
-	Renderer2D::drawQuad({.transform = stripeTr,
-						  .color = tint,
-						  .texture = iTexture,
-						  .textureCoords = stripeUv,
-						  .entityId = iEntityId});
+	ioBlock.stripes.push_back({.x = iStripeX,
+							   .y = screenCenterY,
+							   .width = iStripePxWidth,
+							   .height = lineHeight,
+							   .tint = applyFog(tint, computeFogFactor(iPerpDist)),
+							   .u = subUMin + clampedLocalU * (subUMax - subUMin),
+							   .vBottom = subVMin,
+							   .vTop = subVMax,
+							   .entityId = iEntityId,
+							   .texture = &iTexture});
 	if (iCol < g_state->zBufferPerColumn.size())
 		g_state->zBufferPerColumn[iCol] = iPerpDist;
 }
@@ -790,38 +1069,42 @@ void RendererRaycast::drawDynamicWalls(std::span<const RaycastDynamicWallData> i
 	const math::vec2& dir = g_state->cameraDir2D;
 	const math::vec2& plane = g_state->cameraPlane2D;
 
-	for (const auto& wall: iWalls) {
-		if (!wall.texture)
-			continue;
-		const float halfX = std::max(1e-4f, wall.halfExtent.x());
-		const float halfY = std::max(1e-4f, wall.halfExtent.y());
-		const float minX = wall.worldCenter.x() - halfX;
-		const float maxX = wall.worldCenter.x() + halfX;
-		const float minY = wall.worldCenter.y() - halfY;
-		const float maxY = wall.worldCenter.y() + halfY;
-		const float wallHeightScale = std::max(0.f, wall.wallHeight);
-		bool wallEmittedAny = false;
-		for (uint32_t col = 0; col < numRays; ++col) {
-			const float cameraX = 2.f * (static_cast<float>(col) + 0.5f) / static_cast<float>(numRays) - 1.f;
-			const math::vec2 rayDir{dir.x() + plane.x() * cameraX, dir.y() + plane.y() * cameraX};
-			const auto hit = castRayAabb(rayDir, minX, maxX, minY, maxY);
-			if (!hit.valid)
-				continue;
-			if (hit.perpDist > maxDistance)
-				continue;
-			const float currentZ = (col < g_state->zBufferPerColumn.size()) ? g_state->zBufferPerColumn[col]
-																			: std::numeric_limits<float>::infinity();
-			if (hit.perpDist >= currentZ)
-				continue;
-			const float stripeX = (static_cast<float>(col) + 0.5f) * stripePxWidth;
-			emitStripe(col, stripeX, stripePxWidth, horizonY, vp, hit.perpDist, hit.side, hit.wallU, wallHeightScale,
-					   wall.texture, wall.uvRect, wall.tint, wall.entityId);
-			g_state->stats.dynamicWallStripeCount++;
-			wallEmittedAny = true;
-		}
-		if (wallEmittedAny)
-			g_state->stats.dynamicWallCount++;
-	}
+	const uint32_t contributing = runColumnBlocks(
+			numRays, iWalls.size(), [&](ColumnBlock& ioBlock, const uint32_t iFirst, const uint32_t iEnd) -> void {
+				std::array<math::vec2, g_ColumnBlock> rayDirs;
+				for (uint32_t col = iFirst; col < iEnd; ++col)
+					rayDirs[col - iFirst] = columnRayDir(dir, plane, col, numRays);
+				for (size_t w = 0; w < iWalls.size(); ++w) {
+					const auto& wall = iWalls[w];
+					if (!wall.texture)
+						continue;
+					const float halfX = std::max(1e-4f, wall.halfExtent.x());
+					const float halfY = std::max(1e-4f, wall.halfExtent.y());
+					const float minX = wall.worldCenter.x() - halfX;
+					const float maxX = wall.worldCenter.x() + halfX;
+					const float minY = wall.worldCenter.y() - halfY;
+					const float maxY = wall.worldCenter.y() + halfY;
+					const float wallHeightScale = std::max(0.f, wall.wallHeight);
+					for (uint32_t col = iFirst; col < iEnd; ++col) {
+						const auto hit = castRayAabb(rayDirs[col - iFirst], minX, maxX, minY, maxY);
+						if (!hit.valid)
+							continue;
+						if (hit.perpDist > maxDistance)
+							continue;
+						const float currentZ = (col < g_state->zBufferPerColumn.size())
+													   ? g_state->zBufferPerColumn[col]
+													   : std::numeric_limits<float>::infinity();
+						if (hit.perpDist >= currentZ)
+							continue;
+						const float stripeX = (static_cast<float>(col) + 0.5f) * stripePxWidth;
+						emitStripe(ioBlock, col, stripeX, stripePxWidth, horizonY, vp, hit.perpDist, hit.side,
+								   hit.wallU, wallHeightScale, wall.texture, wall.uvRect, wall.tint, wall.entityId);
+						ioBlock.stats.dynamicWallStripeCount++;
+						ioBlock.contributed[w] = 1;
+					}
+				}
+			});
+	g_state->stats.dynamicWallCount += contributing;
 }
 
 namespace {
@@ -947,9 +1230,9 @@ struct DoorColumnCtx {
 	float maxDistance;
 };
 
-auto renderDoorColumn(uint32_t iCol, float iStripeX, float iStripePxWidth, float iHorizonY, const math::vec2& iVp,
-					  float iWallHeightScale, const DoorGeom& iGeom, const PlateHit& iPlate, const LateralHit& iLateral,
-					  const DoorColumnCtx& iCtx, const RaycastDoorData& iDoor) -> bool {
+auto renderDoorColumn(ColumnBlock& ioBlock, uint32_t iCol, float iStripeX, float iStripePxWidth, float iHorizonY,
+					  const math::vec2& iVp, float iWallHeightScale, const DoorGeom& iGeom, const PlateHit& iPlate,
+					  const LateralHit& iLateral, const DoorColumnCtx& iCtx, const RaycastDoorData& iDoor) -> bool {
 	float bestT = std::numeric_limits<float>::infinity();
 	float bestU = 0.f;
 	int bestSide = 0;
@@ -974,8 +1257,8 @@ auto renderDoorColumn(uint32_t iCol, float iStripeX, float iStripePxWidth, float
 	}
 	if (bestTex == nullptr || !*bestTex || bestUvRect == nullptr)
 		return false;
-	emitStripe(iCol, iStripeX, iStripePxWidth, iHorizonY, iVp, bestT, bestSide, bestU, iWallHeightScale, *bestTex,
-			   *bestUvRect, iDoor.tint, iDoor.entityId);
+	emitStripe(ioBlock, iCol, iStripeX, iStripePxWidth, iHorizonY, iVp, bestT, bestSide, bestU, iWallHeightScale,
+			   *bestTex, *bestUvRect, iDoor.tint, iDoor.entityId);
 	return true;
 }
 
@@ -1016,35 +1299,99 @@ void RendererRaycast::drawDoors(std::span<const RaycastDoorData> iDoors) {
 	const math::vec2& dir = g_state->cameraDir2D;
 	const math::vec2& plane = g_state->cameraPlane2D;
 
-	for (const auto& door: iDoors) {
-		if (!door.faceTexture && !door.lateralTexture)
-			continue;
-		const DoorGeom geom = buildDoorGeom(door);
-		const float wallHeightScale = std::max(0.f, door.wallHeight);
-		bool doorEmittedAny = false;
-		for (uint32_t col = 0; col < numRays; ++col) {
-			const float cameraX = 2.f * (static_cast<float>(col) + 0.5f) / static_cast<float>(numRays) - 1.f;
-			const math::vec2 rayDir{dir.x() + plane.x() * cameraX, dir.y() + plane.y() * cameraX};
-			const CubeHit cube = castCubeAabb(rayDir, geom);
-			if (!cube.valid)
-				continue;
-			const PlateHit plate = tryPlateHit(rayDir, geom, cube, door);
-			const LateralHit lateral = tryLateralHit(rayDir, geom, cube, door);
-			const float currentZ = (col < g_state->zBufferPerColumn.size()) ? g_state->zBufferPerColumn[col]
-																			: std::numeric_limits<float>::infinity();
-			const DoorColumnCtx ctx{.rayDir = rayDir, .currentZ = currentZ, .maxDistance = maxDistance};
-			const float stripeX = (static_cast<float>(col) + 0.5f) * stripePxWidth;
-			if (renderDoorColumn(col, stripeX, stripePxWidth, horizonY, vp, wallHeightScale, geom, plate, lateral, ctx,
-								 door)) {
-				g_state->stats.doorStripeCount++;
-				doorEmittedAny = true;
-			}
-		}
-		if (doorEmittedAny)
-			g_state->stats.doorCount++;
+	const uint32_t contributing = runColumnBlocks(
+			numRays, iDoors.size(), [&](ColumnBlock& ioBlock, const uint32_t iFirst, const uint32_t iEnd) -> void {
+				std::array<math::vec2, g_ColumnBlock> rayDirs;
+				for (uint32_t col = iFirst; col < iEnd; ++col)
+					rayDirs[col - iFirst] = columnRayDir(dir, plane, col, numRays);
+				for (size_t d = 0; d < iDoors.size(); ++d) {
+					const auto& door = iDoors[d];
+					if (!door.faceTexture && !door.lateralTexture)
+						continue;
+					const DoorGeom geom = buildDoorGeom(door);
+					const float wallHeightScale = std::max(0.f, door.wallHeight);
+					for (uint32_t col = iFirst; col < iEnd; ++col) {
+						const math::vec2& rayDir = rayDirs[col - iFirst];
+						const CubeHit cube = castCubeAabb(rayDir, geom);
+						if (!cube.valid)
+							continue;
+						const PlateHit plate = tryPlateHit(rayDir, geom, cube, door);
+						const LateralHit lateral = tryLateralHit(rayDir, geom, cube, door);
+						const float currentZ = (col < g_state->zBufferPerColumn.size())
+													   ? g_state->zBufferPerColumn[col]
+													   : std::numeric_limits<float>::infinity();
+						const DoorColumnCtx ctx{.rayDir = rayDir, .currentZ = currentZ, .maxDistance = maxDistance};
+						const float stripeX = (static_cast<float>(col) + 0.5f) * stripePxWidth;
+						if (renderDoorColumn(ioBlock, col, stripeX, stripePxWidth, horizonY, vp, wallHeightScale, geom,
+											 plate, lateral, ctx, door)) {
+							ioBlock.stats.doorStripeCount++;
+							ioBlock.contributed[d] = 1;
+						}
+					}
+				}
+			});
+	g_state->stats.doorCount += contributing;
+}
+
+namespace {
+
+// Screen footprint of a visible sprite, computed once before the column pass.
+using SpriteFootprint = utils::RaycastSpriteBatch::Footprint;
+
+// Upload the zBuffer of the frame for the sprite fragment stage, growing the SSBO with the ray count.
+void uploadSpriteZBuffer(const uint32_t iNumRays) {
+	if (!g_state->spriteZBufferSsbo || g_state->spriteZBufferCapacity < iNumRays) {
+		g_state->spriteZBufferCapacity = std::max(iNumRays, 2048u);
+		g_state->spriteZBufferSsbo = gpu::StorageBuffer::create(
+				g_state->spriteZBufferCapacity * static_cast<uint32_t>(sizeof(float)), 3, "RendererRaycastSprite");
 	}
+	auto& zBuffer = g_state->zBufferPerColumn;
+	zBuffer.resize(iNumRays, std::numeric_limits<float>::infinity());
+	g_state->spriteZBufferSsbo->setData(zBuffer.data(), iNumRays * static_cast<uint32_t>(sizeof(float)), 0);
+	g_state->spriteZBufferSsbo->bind(/*iBinding=*/3u);
+}
+
+// Draw one batch of sprite records in one instanced call.
+void drawSpriteBatch(const utils::RaycastSpriteBatch& iBatch) {
+	const auto instances = iBatch.getInstances();
+	const auto textures = iBatch.getTextures();
+	const auto count = static_cast<uint32_t>(instances.size());
+	g_state->spriteSsbo->setData(instances.data(),
+								 count * static_cast<uint32_t>(sizeof(utils::RaycastSpriteBatch::Instance)), 0);
+	g_state->spriteSsbo->bind(/*iBinding=*/2u);
+	gpu::RenderCommand::beginBatch();
+	gpu::RenderCommand::beginTextureLoad();
+	for (uint32_t slot = 0; slot < textures.size(); ++slot) (*textures[slot])->bind(slot);
+	gpu::RenderCommand::endTextureLoad();
+	gpu::RenderCommand::drawDataInstanced(g_state->spriteDrawData, /*iIndexCount=*/6u, count);
+	gpu::RenderCommand::endBatch();
+}
+
+// GPU sprite path — one record per visible sprite, occlusion resolved per fragment against the zBuffer, one instanced
+// draw per 32 distinct textures. Statistics are counted on the CPU from the same zBuffer. Returns false on failure.
+auto emitSpritesGpu(const std::span<const RaycastSpriteData> iSprites,
+					const std::span<const SpriteFootprint> iFootprints, const float iStripePxWidth,
+					const uint32_t iNumRays) -> bool {
+	if (!g_state->spriteDrawData || !g_state->spriteParams || !g_state->spriteSsbo)
+		return false;
+
+	Renderer2D::nextBatch();
+
+	const gpu::RendererDescriptors::ScopedActive scoped{"RendererRaycastSprite"};
+	SpriteParamsUbo ubo{};
+	ubo.viewProjection = g_state->viewProjection;
+	ubo.floats = math::vec4{iStripePxWidth, 0.f, 0.f, 0.f};
+	ubo.numRays = iNumRays;
+	g_state->spriteParams->setData(&ubo, static_cast<uint32_t>(sizeof(SpriteParamsUbo)), 0);
+	g_state->spriteParams->bind();
+	uploadSpriteZBuffer(iNumRays);
+
+	g_state->spriteBatch.build(iSprites, iFootprints, g_state->zBufferPerColumn, g_state->stats, &drawSpriteBatch);
+	return true;
 }
 
+}// namespace
+
 void RendererRaycast::drawSprites(std::span<const RaycastSpriteData> iSprites) {
 	OWL_PROFILE_FUNCTION()
 
@@ -1103,6 +1450,9 @@ void RendererRaycast::drawSprites(std::span<const RaycastSpriteData> iSprites) {
 	const float horizonY = computeHorizonY();
 	const auto& zBuffer = g_state->zBufferPerColumn;
 
+	// Screen footprint of every visible sprite, in painter's order.
+	std::pmr::vector<SpriteFootprint> footprints{&core::FrameArena::frame()};
+	footprints.reserve(visible.size());
 	for (const auto& projected: visible) {
 		const auto& sprite = iSprites[projected.spriteIdx];
 		const float invTy = 1.f / projected.transformY;
@@ -1111,7 +1461,6 @@ void RendererRaycast::drawSprites(std::span<const RaycastSpriteData> iSprites) {
 		if (spriteH < 1.f || spriteW < 1.f)
 			continue;
 		const float screenCenterX = vp.x() * 0.5f * (1.f + projected.transformX * invTy);
-		const float screenCenterY = horizonY + sprite.worldZOffset * vp.y() * invTy;
 		const float screenLeft = screenCenterX - spriteW * 0.5f;
 		const float screenRight = screenCenterX + spriteW * 0.5f;
 		const int colStart = std::max(0, static_cast<int>(std::floor(screenLeft / stripePxWidth)));
@@ -1123,46 +1472,62 @@ void RendererRaycast::drawSprites(std::span<const RaycastSpriteData> iSprites) {
 		const auto texSize = sprite.texture->getSize();
 		const float halfU = texSize.x() > 0 ? 0.5f / static_cast<float>(texSize.x()) : 0.f;
 		const float halfV = texSize.y() > 0 ? 0.5f / static_cast<float>(texSize.y()) : 0.f;
-		const float uvLeft = tc[0].x() + halfU;
-		const float uvRight = tc[1].x() - halfU;
-		const float uvBottom = tc[0].y() + halfV;
-		const float uvTop = tc[3].y() - halfV;
-		bool spriteEmittedAny = false;
-		for (int col = colStart; col < colEnd; ++col) {
-			const float wallDepth = (static_cast<size_t>(col) < zBuffer.size())
-											? zBuffer[static_cast<size_t>(col)]
-											: std::numeric_limits<float>::infinity();
-			if (projected.transformY >= wallDepth) {
-				g_state->stats.spriteOccludedCount++;
-				continue;
-			}
-			const float colCenterX = (static_cast<float>(col) + 0.5f) * stripePxWidth;
-			const float localX = colCenterX - screenLeft;
-			const float u = std::clamp(localX / spriteW, 0.f, 1.f);
-			const float uHit = uvLeft + u * (uvRight - uvLeft);
-
-			math::Transform stripeTr;
-			stripeTr.translation() = math::vec3{colCenterX, screenCenterY, 0.f};
-			stripeTr.scale() = math::vec3{stripePxWidth, spriteH, 1.f};
-			const std::array<math::vec2, 4> stripeUv{
-					math::vec2{uHit, uvBottom},
-					math::vec2{uHit, uvBottom},
-					math::vec2{uHit, uvTop},
-					math::vec2{uHit, uvTop},
-			};
-			// Sprites take the same fog tint as the walls / backdrop at their depth.
-			const math::vec4 spriteTint = applyFog(sprite.tint, computeFogFactor(projected.transformY));
-			Renderer2D::drawQuad({.transform = stripeTr,
-								  .color = spriteTint,
-								  .texture = sprite.texture,
-								  .textureCoords = stripeUv,
-								  .entityId = sprite.entityId});
-			g_state->stats.spriteStripeCount++;
-			spriteEmittedAny = true;
-		}
-		if (spriteEmittedAny)
-			g_state->stats.spriteCount++;
+		// Sprites take the same fog tint as the walls / backdrop at their depth.
+		footprints.push_back({.spriteIdx = projected.spriteIdx,
+							  .depth = projected.transformY,
+							  .screenLeft = screenLeft,
+							  .spriteW = spriteW,
+							  .spriteH = spriteH,
+							  .screenCenterY = horizonY + sprite.worldZOffset * vp.y() * invTy,
+							  .colStart = static_cast<uint32_t>(colStart),
+							  .colEnd = static_cast<uint32_t>(colEnd),
+							  .uvLeft = tc[0].x() + halfU,
+							  .uvRight = tc[1].x() - halfU,
+							  .uvBottom = tc[0].y() + halfV,
+							  .uvTop = tc[3].y() - halfV,
+							  .tint = applyFog(sprite.tint, computeFogFactor(projected.transformY))});
 	}
+	if (footprints.empty())
+		return;
+
+	const bool isNullBackend = (gpu::RenderCommand::getApi() == gpu::RenderAPI::Type::Null);
+	if (!isNullBackend && emitSpritesGpu(iSprites, footprints, stripePxWidth, numRays))
+		return;
+
+	// CPU fallback: one stripe per visible column, the column blocks only walk their overlap with each sprite.
+	const std::span<const SpriteFootprint> spans{footprints};
+	const uint32_t contributing = runColumnBlocks(
+			numRays, spans.size(), [&](ColumnBlock& ioBlock, const uint32_t iFirst, const uint32_t iEnd) -> void {
+				for (size_t f = 0; f < spans.size(); ++f) {
+					const auto& footprint = spans[f];
+					const auto& sprite = iSprites[footprint.spriteIdx];
+					const uint32_t first = std::max(iFirst, footprint.colStart);
+					const uint32_t end = std::min(iEnd, footprint.colEnd);
+					for (uint32_t col = first; col < end; ++col) {
+						const float wallDepth =
+								(col < zBuffer.size()) ? zBuffer[col] : std::numeric_limits<float>::infinity();
+						if (footprint.depth >= wallDepth) {
+							ioBlock.stats.spriteOccludedCount++;
+							continue;
+						}
+						const float colCenterX = (static_cast<float>(col) + 0.5f) * stripePxWidth;
+						const float u = std::clamp((colCenterX - footprint.screenLeft) / footprint.spriteW, 0.f, 1.f);
+						ioBlock.stripes.push_back({.x = colCenterX,
+												   .y = footprint.screenCenterY,
+												   .width = stripePxWidth,
+												   .height = footprint.spriteH,
+												   .tint = footprint.tint,
+												   .u = footprint.uvLeft + u * (footprint.uvRight - footprint.uvLeft),
+												   .vBottom = footprint.uvBottom,
+												   .vTop = footprint.uvTop,
+												   .entityId = sprite.entityId,
+												   .texture = &sprite.texture});
+						ioBlock.stats.spriteStripeCount++;
+						ioBlock.contributed[f] = 1;
+					}
+				}
+			});
+	g_state->stats.spriteCount += contributing;
 }
 
 void RendererRaycast::endScene() {
@@ -10,19 +10,26 @@
 
 #include "renderer/RendererTilemap.h"
 
+#include "core/FrameArena.h"
 #include "renderer/Renderer.h"
 #include "renderer/gpu/DrawData.h"
 #include "renderer/gpu/RenderCommand.h"
 #include "renderer/gpu/RendererDescriptors.h"
 #include "renderer/gpu/UniformBuffer.h"
+#include "renderer/utils/FrustumCullingPass.h"
 #include "scene/TilemapAsset.h"
 #include "scene/Tileset.h"
 
+#include <bit>
+
 namespace owl::renderer {
 
 namespace {
 
 constexpr uint32_t kMaxInstancesPerDraw = 1u << 14u;
+constexpr uint32_t kChunkSize = scene::TilemapAsset::g_chunkSize;
+/// Flushes a chunk may stay off screen before its cached cells are released.
+constexpr uint64_t kChunkRetention = 300;
 
 struct CameraUbo {
 	math::mat4 viewProjection;
@@ -46,18 +53,93 @@ struct PendingTilemap {
 	int entityId = -1;
 };
 
+struct CellParams {
+	float originX = 0.f;
+	float originY = 0.f;
+	int entityId = -1;
+	float layerZ = 0.f;
+	int atlasColumns = 1;
+	int atlasRows = 1;
+	math::vec2 halfTexel{0.f, 0.f};
+	int textureSlot = 0;
+
+	auto operator==(const CellParams&) const -> bool = default;
+};
+
+/// Expanded instances of one chunk of one layer.
+struct ChunkCache {
+	/// Asset chunk revision the cells were built from (0: never built).
+	uint64_t revision = 0;
+	/// Painter's-order depth the cells were built with.
+	float layerZ = 0.f;
+	/// Last flush the chunk was visible in.
+	uint64_t lastVisible = 0;
+	/// The non-empty cells.
+	std::vector<CellInstance> cells;
+};
+
+/// Chunk caches of one queued tilemap entity.
+struct TilemapCache {
+	/// Parameters the chunks were built with (`layerZ` of the first layer).
+	CellParams params;
+	/// Grid shape the chunks were built for.
+	uint32_t width = 0;
+	uint32_t height = 0;
+	size_t layerCount = 0;
+	float cellSize = 0.f;
+	/// Chunks, layer-major then row-major.
+	std::vector<ChunkCache> chunks;
+	/// Unique id of this set of chunks.
+	uint64_t buildId = 0;
+	/// Last flush the tilemap was queued in.
+	uint64_t lastUsed = 0;
+};
+
 struct InternalState {
 	bool initialized = false;
-	shared<gpu::DrawData> drawData;
+	/// One draw data per `kMaxInstancesPerDraw` cells, each keeping its own instance buffer.
+	std::vector<shared<gpu::DrawData>> drawData;
 	shared<gpu::UniformBuffer> cameraUbo;
 	CameraUbo cameraBuffer;
+	std::array<math::vec4, 6> frustumPlanes{};
+	bool hasFrustum = false;
 	std::vector<CellInstance> instanceScratch;
 	std::vector<PendingTilemap> pending;
+	std::map<std::pair<const scene::TilemapAsset*, int>, TilemapCache> caches;
+	std::vector<const ChunkCache*> visibleChunks;
+	/// Signature of the chunk list uploaded by the previous flush.
+	uint64_t uploadedSignature = 0;
+	uint32_t uploadedCount = 0;
+	uint64_t flushIndex = 0;
+	uint64_t nextBuildId = 0;
 	RendererTilemap::Statistics stats;
 };
 
 shared<InternalState> g_state;
 
+auto createDrawData() -> shared<gpu::DrawData> {
+	const gpu::BufferLayout vertexLayout{
+			{"i_CornerIndex", gpu::ShaderDataType::Int},
+	};
+	const gpu::BufferLayout instanceLayout{
+			{"i_CellWorld", gpu::ShaderDataType::Float2}, {"i_TileIndex", gpu::ShaderDataType::Int},
+			{"i_EntityID", gpu::ShaderDataType::Int},     {"i_LayerZ", gpu::ShaderDataType::Float},
+			{"i_CellSize", gpu::ShaderDataType::Float},   {"i_AtlasColumns", gpu::ShaderDataType::Int},
+			{"i_AtlasRows", gpu::ShaderDataType::Int},    {"i_HalfTexel", gpu::ShaderDataType::Float2},
+			{"i_TextureSlot", gpu::ShaderDataType::Int},
+	};
+
+	std::vector<uint32_t> quadIndices = {0, 1, 2, 2, 3, 0};
+
+	auto drawData = gpu::DrawData::create();
+	drawData->initInstanced(vertexLayout, instanceLayout, /*iVertexCapacity=*/4u, kMaxInstancesPerDraw,
+							"tilemap_instanced", quadIndices, "tilemap_instanced");
+
+	constexpr std::array<int32_t, 4> cornerIndices{0, 1, 2, 3};
+	drawData->setVertexData(cornerIndices.data(), static_cast<uint32_t>(cornerIndices.size() * sizeof(int32_t)));
+	return drawData;
+}
+
 }// namespace
 
 void RendererTilemap::init() {
@@ -79,26 +161,7 @@ void RendererTilemap::init() {
 
 	const gpu::RendererDescriptors::ScopedActive scoped{"tilemap_instanced"};
 
-	const gpu::BufferLayout vertexLayout{
-			{"i_CornerIndex", gpu::ShaderDataType::Int},
-	};
-	const gpu::BufferLayout instanceLayout{
-			{"i_CellWorld", gpu::ShaderDataType::Float2}, {"i_TileIndex", gpu::ShaderDataType::Int},
-			{"i_EntityID", gpu::ShaderDataType::Int},     {"i_LayerZ", gpu::ShaderDataType::Float},
-			{"i_CellSize", gpu::ShaderDataType::Float},   {"i_AtlasColumns", gpu::ShaderDataType::Int},
-			{"i_AtlasRows", gpu::ShaderDataType::Int},    {"i_HalfTexel", gpu::ShaderDataType::Float2},
-			{"i_TextureSlot", gpu::ShaderDataType::Int},
-	};
-
-	std::vector<uint32_t> quadIndices = {0, 1, 2, 2, 3, 0};
-
-	g_state->drawData = gpu::DrawData::create();
-	g_state->drawData->initInstanced(vertexLayout, instanceLayout, /*iVertexCapacity=*/4u, kMaxInstancesPerDraw,
-									 "tilemap_instanced", quadIndices, "tilemap_instanced");
-
-	constexpr std::array<int32_t, 4> cornerIndices{0, 1, 2, 3};
-	g_state->drawData->setVertexData(cornerIndices.data(),
-									 static_cast<uint32_t>(cornerIndices.size() * sizeof(int32_t)));
+	g_state->drawData.push_back(createDrawData());
 
 	g_state->cameraUbo = gpu::UniformBuffer::create(sizeof(CameraUbo), 0, "tilemap_instanced");
 	g_state->initialized = true;
@@ -120,6 +183,8 @@ void RendererTilemap::beginScene(const Camera& iCamera) {
 	const gpu::RendererDescriptors::ScopedActive scoped{"tilemap_instanced"};
 	g_state->cameraBuffer.viewProjection = iCamera.getViewProjection();
 	g_state->cameraUbo->setData(&g_state->cameraBuffer, sizeof(CameraUbo), 0);
+	g_state->frustumPlanes = utils::FrustumCullingPass::extractFrustumPlanes(g_state->cameraBuffer.viewProjection);
+	g_state->hasFrustum = true;
 }
 
 void RendererTilemap::endScene() {
@@ -128,46 +193,102 @@ void RendererTilemap::endScene() {
 
 namespace {
 
-struct CellParams {
-	float originX = 0.f;
-	float originY = 0.f;
-	int entityId = -1;
-	float layerZ = 0.f;
-	int atlasColumns = 1;
-	int atlasRows = 1;
-	math::vec2 halfTexel{0.f, 0.f};
-	int textureSlot = 0;
-};
-
-void appendLayer(const scene::TilemapAsset& iAsset, const scene::component::TilemapLayer& iLayer,
-				 const CellParams& iParams, std::vector<CellInstance>& ioScratch) {
+void buildChunk(const scene::TilemapAsset& iAsset, const scene::component::TilemapLayer& iLayer,
+				const CellParams& iParams, const uint32_t iChunkX, const uint32_t iChunkY, ChunkCache& ioChunk) {
+	ioChunk.cells.clear();
 	const float cellSize = iAsset.cellSize;
 	const size_t layerCellCount = iLayer.tiles.size();
 	const uint32_t width = iAsset.width;
-	const uint32_t height = iAsset.height;
-	for (uint32_t y = 0; y < height; ++y) {
+	const uint32_t xEnd = std::min(width, (iChunkX + 1) * kChunkSize);
+	const uint32_t yEnd = std::min(iAsset.height, (iChunkY + 1) * kChunkSize);
+	for (uint32_t y = iChunkY * kChunkSize; y < yEnd; ++y) {
 		const float cellY = iParams.originY - static_cast<float>(y) * cellSize;
 		const size_t rowOffset = static_cast<size_t>(y) * width;
-		for (uint32_t x = 0; x < width; ++x) {
+		for (uint32_t x = iChunkX * kChunkSize; x < xEnd; ++x) {
 			const size_t flat = rowOffset + x;
 			if (flat >= layerCellCount)
 				continue;
 			const int32_t tileIdx = iLayer.tiles[flat];
 			if (tileIdx < 0)
 				continue;
-			ioScratch.push_back({.cellWorld = {iParams.originX + static_cast<float>(x) * cellSize, cellY},
-								 .tileIndex = tileIdx,
-								 .entityId = iParams.entityId,
-								 .layerZ = iParams.layerZ,
-								 .cellSize = cellSize,
-								 .atlasColumns = iParams.atlasColumns,
-								 .atlasRows = iParams.atlasRows,
-								 .halfTexel = iParams.halfTexel,
-								 .textureSlot = iParams.textureSlot});
+			ioChunk.cells.push_back({.cellWorld = {iParams.originX + static_cast<float>(x) * cellSize, cellY},
+									 .tileIndex = tileIdx,
+									 .entityId = iParams.entityId,
+									 .layerZ = iParams.layerZ,
+									 .cellSize = cellSize,
+									 .atlasColumns = iParams.atlasColumns,
+									 .atlasRows = iParams.atlasRows,
+									 .halfTexel = iParams.halfTexel,
+									 .textureSlot = iParams.textureSlot});
 		}
 	}
 }
 
+/// FNV-1a step, used to recognise an unchanged chunk list.
+auto hashCombine(const uint64_t iHash, const uint64_t iValue) -> uint64_t {
+	return (iHash ^ iValue) * 0x100000001b3ull;
+}
+
+/**
+ * @brief
+ *  Queue the visible chunks of one tilemap, rebuilding the stale ones.
+ * @return The signature updated with every queued chunk.
+ */
+auto collectChunks(const scene::TilemapAsset& iAsset, TilemapCache& ioCache, uint64_t ioSignature) -> uint64_t {
+	auto& state = *g_state;
+	const float cellSize = iAsset.cellSize;
+	const uint32_t chunkColumns = (iAsset.width + kChunkSize - 1) / kChunkSize;
+	const uint32_t chunkRows = (iAsset.height + kChunkSize - 1) / kChunkSize;
+	CellParams params = ioCache.params;
+	for (size_t layerIndex = 0; layerIndex < iAsset.layers.size(); ++layerIndex) {
+		const auto& layer = iAsset.layers[layerIndex];
+		++state.stats.layerCount;
+		if (!layer.visible)
+			continue;
+		const auto layerIdx = static_cast<uint32_t>(layerIndex);
+		for (uint32_t chunkY = 0; chunkY < chunkRows; ++chunkY) {
+			const uint32_t yFirst = chunkY * kChunkSize;
+			const uint32_t yLast = std::min(iAsset.height, yFirst + kChunkSize) - 1;
+			for (uint32_t chunkX = 0; chunkX < chunkColumns; ++chunkX) {
+				const size_t chunkIndex = (layerIndex * chunkRows + chunkY) * chunkColumns + chunkX;
+				auto& chunk = ioCache.chunks[chunkIndex];
+				const uint32_t xFirst = chunkX * kChunkSize;
+				const uint32_t xLast = std::min(iAsset.width, xFirst + kChunkSize) - 1;
+				// Cell centres span [first, last]; a full cell of margin covers the quads whatever their anchoring.
+				const math::vec3 boxMin{params.originX + (static_cast<float>(xFirst) - 1.f) * cellSize,
+										params.originY - (static_cast<float>(yLast) + 1.f) * cellSize, params.layerZ};
+				const math::vec3 boxMax{params.originX + (static_cast<float>(xLast) + 1.f) * cellSize,
+										params.originY - (static_cast<float>(yFirst) - 1.f) * cellSize, params.layerZ};
+				if (state.hasFrustum &&
+					!utils::FrustumCullingPass::isAabbVisible(state.frustumPlanes, boxMin, boxMax)) {
+					++state.stats.culledChunkCount;
+					if (!chunk.cells.empty() && chunk.lastVisible + kChunkRetention < state.flushIndex)
+						chunk = ChunkCache{};
+					continue;
+				}
+				chunk.lastVisible = state.flushIndex;
+				const uint64_t revision = iAsset.getChunkRevision(layerIdx, chunkX, chunkY);
+				if (chunk.revision != revision || chunk.layerZ != params.layerZ) {
+					buildChunk(iAsset, layer, params, chunkX, chunkY, chunk);
+					chunk.revision = revision;
+					chunk.layerZ = params.layerZ;
+					++state.stats.rebuiltChunkCount;
+				}
+				if (chunk.cells.empty())
+					continue;
+				++state.stats.chunkCount;
+				state.visibleChunks.push_back(&chunk);
+				ioSignature = hashCombine(ioSignature, ioCache.buildId);
+				ioSignature = hashCombine(ioSignature, chunkIndex);
+				ioSignature = hashCombine(ioSignature, revision);
+				ioSignature = hashCombine(ioSignature, std::bit_cast<uint32_t>(params.layerZ));
+			}
+		}
+		params.layerZ += 1e-4f;
+	}
+	return ioSignature;
+}
+
 }// namespace
 
 void RendererTilemap::drawTilemap(const scene::TilemapAsset& iAsset, const math::Transform& iWorldTransform,
@@ -188,7 +309,8 @@ void RendererTilemap::flushPending() {
 	const gpu::RendererDescriptors::ScopedActive scoped{"tilemap_instanced"};
 
 	constexpr size_t kMaxTextureSlots = 32;
-	std::vector<const scene::Tileset*> slots;
+	std::pmr::vector<const scene::Tileset*> slots{&core::FrameArena::frame()};
+	slots.reserve(kMaxTextureSlots);
 	const auto slotFor = [&slots](const scene::Tileset* iTileset) -> int {
 		for (size_t i = 0; i < slots.size(); ++i) {
 			if (slots[i] == iTileset)
@@ -200,9 +322,12 @@ void RendererTilemap::flushPending() {
 		return static_cast<int>(slots.size() - 1);
 	};
 
-	// Combine all queued tilemaps (every entity + layer) into one instance buffer; each cell carries its own params.
-	g_state->instanceScratch.clear();
-	for (const auto& [asset, transform, entityId]: g_state->pending) {
+	// Every queued tilemap (every entity + layer) shares the instance buffers; each cell carries its own params.
+	auto& state = *g_state;
+	++state.flushIndex;
+	state.visibleChunks.clear();
+	uint64_t signature = 0xcbf29ce484222325ull;
+	for (const auto& [asset, transform, entityId]: state.pending) {
 		const auto& assetRef = *asset;
 		const auto& tileset = *assetRef.tileset;
 		const int textureSlot = slotFor(&tileset);
@@ -223,40 +348,68 @@ void RendererTilemap::flushPending() {
 		params.atlasRows = static_cast<int>(std::max(1u, tileset.rows));
 		params.halfTexel = {0.5f / std::max(1.f, atlasW), 0.5f / std::max(1.f, atlasH)};
 		params.textureSlot = textureSlot;
-
 		params.layerZ = transform.translation().z();
-		for (const auto& layer: assetRef.layers) {
-			++g_state->stats.layerCount;
-			if (!layer.visible)
-				continue;
-			appendLayer(assetRef, layer, params, g_state->instanceScratch);
-			params.layerZ += 1e-4f;
+
+		auto& cache = state.caches[{asset, entityId}];
+		const size_t chunkTotal = assetRef.layers.size() * ((assetRef.width + kChunkSize - 1) / kChunkSize) *
+								  ((assetRef.height + kChunkSize - 1) / kChunkSize);
+		if (cache.params != params || cache.width != assetRef.width || cache.height != assetRef.height ||
+			cache.layerCount != assetRef.layers.size() || cache.cellSize != cellSize) {
+			// Moved, re-slotted or reshaped: every chunk is rebuilt.
+			cache = TilemapCache{.params = params,
+								 .width = assetRef.width,
+								 .height = assetRef.height,
+								 .layerCount = assetRef.layers.size(),
+								 .cellSize = cellSize,
+								 .chunks = std::vector<ChunkCache>(chunkTotal),
+								 .buildId = ++state.nextBuildId,
+								 .lastUsed = 0};
 		}
+		cache.lastUsed = state.flushIndex;
+		signature = collectChunks(assetRef, cache, signature);
 	}
-
-	const auto instanceCount = static_cast<uint32_t>(g_state->instanceScratch.size());
-	if (instanceCount == 0) {
-		g_state->pending.clear();
+	std::erase_if(state.caches, [&state](const auto& iEntry) -> bool {
+		return iEntry.second.lastUsed + kChunkRetention < state.flushIndex;
+	});
+
+	size_t instanceTotal = 0;
+	for (const auto* chunk: state.visibleChunks) instanceTotal += chunk->cells.size();
+	state.pending.clear();
+	if (instanceTotal == 0)
 		return;
+	const auto instanceCount = static_cast<uint32_t>(instanceTotal);
+	const uint32_t drawCount = (instanceCount + kMaxInstancesPerDraw - 1) / kMaxInstancesPerDraw;
+	while (state.drawData.size() < drawCount) state.drawData.push_back(createDrawData());
+
+	// The instance buffers keep their content between frames: a static map in a still camera uploads nothing.
+	if (signature != state.uploadedSignature || instanceCount != state.uploadedCount) {
+		state.instanceScratch.clear();
+		state.instanceScratch.reserve(instanceTotal);
+		for (const auto* chunk: state.visibleChunks)
+			state.instanceScratch.insert(state.instanceScratch.end(), chunk->cells.begin(), chunk->cells.end());
+		for (uint32_t draw = 0; draw < drawCount; ++draw) {
+			const uint32_t first = draw * kMaxInstancesPerDraw;
+			const uint32_t count = std::min(kMaxInstancesPerDraw, instanceCount - first);
+			state.drawData[draw]->setInstanceData(state.instanceScratch.data() + first,
+												  static_cast<uint32_t>(count * sizeof(CellInstance)));
+		}
+		state.uploadedSignature = signature;
+		state.uploadedCount = instanceCount;
+		++state.stats.uploadCount;
 	}
-	if (instanceCount > kMaxInstancesPerDraw) {
-		OWL_CORE_WARN("RendererTilemap: {} cells > capacity {}; truncating.", instanceCount, kMaxInstancesPerDraw)
-	}
-	const uint32_t drawn = std::min(instanceCount, kMaxInstancesPerDraw);
 
 	gpu::RenderCommand::beginTextureLoad();
 	for (size_t i = 0; i < slots.size(); ++i) slots[i]->texture->bind(static_cast<uint32_t>(i));
 	gpu::RenderCommand::endTextureLoad();
 
-	g_state->drawData->setInstanceData(g_state->instanceScratch.data(),
-									   static_cast<uint32_t>(drawn * sizeof(CellInstance)));
 	// Re-assert our camera UBO: siblings share OpenGL uniform binding 0, last-bound wins (no-op on Vulkan).
-	g_state->cameraUbo->bind();
-	gpu::RenderCommand::drawDataInstanced(g_state->drawData, /*iIndexCount=*/6u, drawn);
-	++g_state->stats.drawCallCount;
-	g_state->stats.instanceCount += drawn;
-
-	g_state->pending.clear();
+	state.cameraUbo->bind();
+	for (uint32_t draw = 0; draw < drawCount; ++draw) {
+		const uint32_t count = std::min(kMaxInstancesPerDraw, instanceCount - draw * kMaxInstancesPerDraw);
+		gpu::RenderCommand::drawDataInstanced(state.drawData[draw], /*iIndexCount=*/6u, count);
+		++state.stats.drawCallCount;
+	}
+	state.stats.instanceCount += instanceCount;
 }
 
 auto RendererTilemap::getStatistics() -> Statistics {
@@ -9,13 +9,18 @@
 
 #include "renderer/RendererVoxel.h"
 
+#include "app/Application.h"
+#include "core/task/Scheduler.h"
 #include "data/voxel/ChunkMesher.h"
+#include "data/voxel/ChunkSnapshot.h"
 #include "math/matrixCreation.h"
 #include "renderer/Renderer3D.h"
 #include "renderer/utils/FrustumCullingPass.h"
 
 #include <array>
+#include <atomic>
 #include <iterator>
+#include <mutex>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -30,14 +35,39 @@ struct ChunkMeshes {
 	Renderer3D::MeshHandle transparent;
 };
 
+// CPU geometry meshed on a worker, waiting for its GPU upload on the main thread.
+struct MeshResult {
+	uint64_t key;
+	math::vec3i coord;
+	uint64_t generation;
+	data::voxel::ChunkMeshSet meshes;
+};
+
+// Per-entity result sink: workers push under the mutex, `prepareWorld` drains.
+struct MeshSink {
+	std::mutex mutex;
+	std::vector<MeshResult> results;
+};
+
+// Latest requested generation of a chunk's mesh; a job whose generation no longer matches is stale (0 = cancelled).
+using MeshTicket = shared<std::atomic<uint64_t>>;
+
 struct EntityMeshes {
+	/// Front buffer: the uploaded meshes drawn this frame (kept until a newer mesh is uploaded).
 	std::unordered_map<uint64_t, ChunkMeshes> chunks;
+	/// Chunks with a meshing job in flight.
+	std::unordered_map<uint64_t, MeshTicket> jobs;
+	/// Back buffer: meshed geometry awaiting upload.
+	shared<MeshSink> sink = mkShared<MeshSink>();
+	/// Generation counter for this entity's mesh jobs.
+	uint64_t nextGeneration = 1;
 };
 
 struct InternalData {
 	std::unordered_map<int, EntityMeshes> entities;
 	math::vec3 cameraPosition{0.f, 0.f, 0.f};
 	math::mat4 viewProjection = math::identity<float, 4>();
+	uint32_t uploadBudget = 8;
 };
 
 shared<InternalData> g_Data;
@@ -55,6 +85,13 @@ auto packKey(const math::vec3i& iCoord) -> uint64_t {
 	return enc(iCoord.x()) | (enc(iCoord.y()) << 21) | (enc(iCoord.z()) << 42);
 }
 
+auto chunkCenter(const math::vec3i& iCoord) -> math::vec3 {
+	const float half = static_cast<float>(k_ChunkSize) * 0.5f;
+	return math::vec3{static_cast<float>(iCoord.x() * k_ChunkSize) + half,
+					  static_cast<float>(iCoord.y() * k_ChunkSize) + half,
+					  static_cast<float>(iCoord.z() * k_ChunkSize) + half};
+}
+
 // Atlas cell rect inset by half a texel each side so the shader's frac(uv) tiling never bleeds the neighbour cell.
 auto tileRectFor(const scene::Tileset& iTileset, const uint16_t iTileIndex) -> math::vec4 {
 	const uint32_t cols = std::max(1u, iTileset.columns);
@@ -86,6 +123,15 @@ auto uploadMesh(const data::voxel::ChunkMesh& iMesh, const math::vec3& iOrigin,
 	return Renderer3D::createMesh(vertices, iMesh.indices, "voxel");
 }
 
+auto uploadChunkMeshes(const data::voxel::ChunkMeshSet& iSet, const math::vec3i& iCoord,
+					   const scene::Tileset& iTileset) -> ChunkMeshes {
+	// Bake chunk origin into vertices so chunks share one model (avoids per-draw UBO last-write-wins on Vulkan).
+	const math::vec3 origin{static_cast<float>(iCoord.x() * k_ChunkSize), static_cast<float>(iCoord.y() * k_ChunkSize),
+							static_cast<float>(iCoord.z() * k_ChunkSize)};
+	return ChunkMeshes{.opaque = uploadMesh(iSet.opaque, origin, iTileset),
+					   .transparent = uploadMesh(iSet.transparent, origin, iTileset)};
+}
+
 auto buildChunkMeshes(const data::voxel::Chunk& iChunk, const data::voxel::BlockRegistry& iRegistry,
 					  const data::voxel::VoxelWorld& iWorld, const math::vec3i& iCoord, const scene::Tileset& iTileset,
 					  const bool iAmbientOcclusion) -> ChunkMeshes {
@@ -94,21 +140,88 @@ auto buildChunkMeshes(const data::voxel::Chunk& iChunk, const data::voxel::Block
 		return iWorld.getBlock(math::vec3i{iCoord.x() * k_ChunkSize + iX, iCoord.y() * k_ChunkSize + iY,
 										   iCoord.z() * k_ChunkSize + iZ});
 	};
-	const data::voxel::ChunkMeshSet set =
-			data::voxel::ChunkMesher::meshByKind(iChunk, iRegistry, neighbor, iAmbientOcclusion);
-	// Bake chunk origin into vertices so chunks share one model (avoids per-draw UBO last-write-wins on Vulkan).
-	const math::vec3 origin{static_cast<float>(iCoord.x() * k_ChunkSize), static_cast<float>(iCoord.y() * k_ChunkSize),
-							static_cast<float>(iCoord.z() * k_ChunkSize)};
-	return ChunkMeshes{.opaque = uploadMesh(set.opaque, origin, iTileset),
-					   .transparent = uploadMesh(set.transparent, origin, iTileset)};
+	return uploadChunkMeshes(data::voxel::ChunkMesher::meshByKind(iChunk, iRegistry, neighbor, iAmbientOcclusion),
+							 iCoord, iTileset);
 }
 
-auto chunkCenter(const math::vec3i& iCoord) -> math::vec3 {
-	const float half = static_cast<float>(k_ChunkSize) * 0.5f;
-	return math::vec3{static_cast<float>(iCoord.x() * k_ChunkSize) + half,
-					  static_cast<float>(iCoord.y() * k_ChunkSize) + half,
-					  static_cast<float>(iCoord.z() * k_ChunkSize) + half};
+// Mesh the dirty chunks on the task scheduler: the main thread only captures snapshots and uploads finished meshes.
+void scheduleMeshJobs(scene::component::VoxelWorld& ioComponent, EntityMeshes& ioCache,
+					  const std::vector<shared<data::voxel::Chunk>>& iDirty, core::task::Scheduler& ioScheduler) {
+	if (iDirty.empty())
+		return;
+	// One registry copy shared by every job of the frame; the component's palette may be edited meanwhile.
+	const auto registry = mkShared<const data::voxel::BlockRegistry>(ioComponent.registry);
+	const bool ambientOcclusion = ioComponent.ambientOcclusion;
+	for (const auto& chunk: iDirty) {
+		const math::vec3i coord = chunk->getCoord();
+		const uint64_t key = packKey(coord);
+		const uint64_t generation = ioCache.nextGeneration++;
+		auto& ticket = ioCache.jobs[key];
+		if (ticket)
+			ticket->store(generation, std::memory_order_release);// supersedes (cancels) the older job
+		else
+			ticket = mkShared<std::atomic<uint64_t>>(generation);
+		auto snapshot = mkShared<const data::voxel::ChunkSnapshot>(
+				data::voxel::ChunkSnapshot::capture(ioComponent.world, coord));
+		chunk->markClean();
+		core::task::Task job{
+				[snapshot, registry, ambientOcclusion, ticket, generation, sink = ioCache.sink, key]() -> void {
+					// Cooperative cancellation: the chunk was re-dirtied, unloaded or the cache cleared meanwhile.
+					if (ticket->load(std::memory_order_acquire) != generation)
+						return;
+					MeshResult result{.key = key,
+									  .coord = snapshot->getCoord(),
+									  .generation = generation,
+									  .meshes = snapshot->meshByKind(*registry, ambientOcclusion)};
+					const std::lock_guard<std::mutex> lock{sink->mutex};
+					sink->results.push_back(std::move(result));
+				}};
+		job.setPriority(core::task::Task::Priority::Streaming);
+		ioScheduler.pushTask(std::move(job));
+	}
+}
+
+// Swap finished meshes into the front buffer, nearest chunks first, within the per-frame upload budget.
+void uploadMeshResults(EntityMeshes& ioCache, const scene::Tileset& iTileset, const math::vec3& iCameraPos,
+					   const uint32_t iBudget) {
+	std::vector<MeshResult> results;
+	{
+		const std::lock_guard<std::mutex> lock{ioCache.sink->mutex};
+		results.swap(ioCache.sink->results);
+	}
+	std::erase_if(results, [&ioCache](const MeshResult& iResult) -> bool {
+		const auto it = ioCache.jobs.find(iResult.key);
+		return it == ioCache.jobs.end() || it->second->load(std::memory_order_acquire) != iResult.generation;
+	});
+	if (results.empty())
+		return;
+	const auto distanceSq = [&iCameraPos](const math::vec3i& iCoord) -> float {
+		const math::vec3 delta = chunkCenter(iCoord) - iCameraPos;
+		return delta * delta;
+	};
+	std::ranges::sort(results, [&distanceSq](const MeshResult& iA, const MeshResult& iB) -> bool {
+		return distanceSq(iA.coord) < distanceSq(iB.coord);
+	});
+	const size_t count = std::min(results.size(), static_cast<size_t>(std::max(1u, iBudget)));
+	for (size_t i = 0; i < count; ++i) {
+		auto& result = results[i];
+		ioCache.chunks[result.key] = uploadChunkMeshes(result.meshes, result.coord, iTileset);
+		ioCache.jobs.erase(result.key);
+	}
+	if (count == results.size())
+		return;
+	// Over budget: hand the remainder back for the next frames.
+	const std::lock_guard<std::mutex> lock{ioCache.sink->mutex};
+	std::move(results.begin() + static_cast<std::ptrdiff_t>(count), results.end(),
+			  std::back_inserter(ioCache.sink->results));
+}
+
+// Invalidate every in-flight job of an entity so workers skip them and late results are dropped.
+void cancelJobs(EntityMeshes& ioCache) {
+	for (const auto& ticket: ioCache.jobs | std::views::values) ticket->store(0, std::memory_order_release);
+	ioCache.jobs.clear();
 }
+
 }// namespace
 
 void RendererVoxel::init() {
@@ -124,8 +237,23 @@ void RendererVoxel::shutdown() {
 }
 
 void RendererVoxel::clearCache() {
+	if (!g_Data)
+		return;
+	for (auto& cache: g_Data->entities | std::views::values) cancelJobs(cache);
+	g_Data->entities.clear();
+}
+
+void RendererVoxel::setMeshUploadBudget(const uint32_t iChunksPerFrame) {
 	if (g_Data)
-		g_Data->entities.clear();
+		g_Data->uploadBudget = std::max(1u, iChunksPerFrame);
+}
+
+auto RendererVoxel::getPendingMeshJobs() -> size_t {
+	if (!g_Data)
+		return 0;
+	size_t pending = 0;
+	for (const auto& cache: g_Data->entities | std::views::values) pending += cache.jobs.size();
+	return pending;
 }
 
 void RendererVoxel::beginScene(const Camera& iCamera, const VoxelConfig& iConfig) {
@@ -157,22 +285,42 @@ void RendererVoxel::prepareWorld(scene::component::VoxelWorld& ioComponent, cons
 	ioComponent.tileset->texture->setFilterMode(gpu::FilterMode::Nearest);
 
 	auto& cache = g_Data->entities[iEntityId];
+	// Without an application (tools, tests) there is no scheduler: mesh synchronously as before.
+	const bool async = app::Application::instanced();
 	std::unordered_set<uint64_t> live;
+	std::vector<shared<data::voxel::Chunk>> dirty;
 	for (const auto& coord: ioComponent.world.chunkCoordinates()) {
 		const auto chunk = ioComponent.world.getChunk(coord);
 		if (!chunk || chunk->isEmpty())
 			continue;
 		const uint64_t key = packKey(coord);
 		live.insert(key);
-		if (const auto it = cache.chunks.find(key); it == cache.chunks.end() || chunk->isDirty()) {
+		const bool cached = cache.chunks.contains(key);
+		if (cached && !chunk->isDirty())
+			continue;
+		if (!async) {
 			cache.chunks[key] = buildChunkMeshes(*chunk, ioComponent.registry, ioComponent.world, coord,
 												 *ioComponent.tileset, ioComponent.ambientOcclusion);
 			chunk->markClean();
+		} else if (chunk->isDirty() || !cache.jobs.contains(key)) {
+			dirty.push_back(chunk);
 		}
 	}
-	// Drop cached meshes for chunks that were streamed out, so memory stays bounded as the camera moves.
+	// Drop cached meshes (and cancel jobs) for chunks that were streamed out, so memory stays bounded.
 	for (auto it = cache.chunks.begin(); it != cache.chunks.end();)
 		it = live.contains(it->first) ? std::next(it) : cache.chunks.erase(it);
+	for (auto it = cache.jobs.begin(); it != cache.jobs.end();) {
+		if (live.contains(it->first)) {
+			++it;
+			continue;
+		}
+		it->second->store(0, std::memory_order_release);
+		it = cache.jobs.erase(it);
+	}
+	if (!async)
+		return;
+	uploadMeshResults(cache, *ioComponent.tileset, g_Data->cameraPosition, g_Data->uploadBudget);
+	scheduleMeshJobs(ioComponent, cache, dirty, app::Application::get().getTaskScheduler());
 }
 
 void RendererVoxel::drawVoxelWorld(scene::component::VoxelWorld& ioComponent, const math::Transform& iWorldTransform,
@@ -11,6 +11,8 @@
 
 #include <stb_image.h>
 
+#include <bit>
+
 namespace owl::renderer {
 
 namespace {
@@ -81,4 +83,45 @@ auto decodeImageFile(const std::filesystem::path& iPath, int iDesiredChannels) -
 	return makeDecodedImage(data, width, height, effectiveChannels);
 }
 
+auto getMipLevelCount(const math::vec2ui& iSize) -> uint32_t {
+	const uint32_t side = std::max(iSize.x(), iSize.y());
+	return side == 0 ? 0 : static_cast<uint32_t>(std::bit_width(side));
+}
+
+OWL_DIAG_PUSH
+OWL_DIAG_DISABLE_CLANG19("-Wunsafe-buffer-usage")
+void generateMipChain(DecodedImage& ioImage, const uint32_t iLevelCount) {
+	OWL_PROFILE_FUNCTION()
+
+	ioImage.mips.clear();
+	if (!ioImage.valid)
+		return;
+	const size_t channels = ioImage.format == gpu::ImageFormat::Rgba8 ? 4 : 3;
+	const uint32_t levelCount = std::min(iLevelCount, getMipLevelCount(ioImage.size));
+	if (levelCount > 1)
+		ioImage.mips.reserve(levelCount - 1);
+	for (uint32_t level = 1; level < levelCount; ++level) {
+		const auto& srcSize = level == 1 ? ioImage.size : ioImage.mips.back().size;
+		const uint8_t* src = level == 1 ? ioImage.pixels.data() : ioImage.mips.back().pixels.data();
+		MipLevel mip{.size = {std::max(srcSize.x() / 2, 1u), std::max(srcSize.y() / 2, 1u)}, .pixels = {}};
+		mip.pixels.resize(static_cast<size_t>(mip.size.x()) * mip.size.y() * channels);
+		uint8_t* dst = mip.pixels.data();
+		const size_t srcStride = srcSize.x() * channels;
+		for (uint32_t y = 0; y < mip.size.y(); ++y) {
+			const uint8_t* row0 = src + std::min(2 * y, srcSize.y() - 1) * srcStride;
+			const uint8_t* row1 = src + std::min(2 * y + 1, srcSize.y() - 1) * srcStride;
+			for (uint32_t x = 0; x < mip.size.x(); ++x) {
+				const size_t x0 = std::min(2 * x, srcSize.x() - 1) * channels;
+				const size_t x1 = std::min(2 * x + 1, srcSize.x() - 1) * channels;
+				for (size_t c = 0; c < channels; ++c) {
+					const uint32_t sum = 2u + row0[x0 + c] + row0[x1 + c] + row1[x0 + c] + row1[x1 + c];
+					*dst++ = static_cast<uint8_t>(sum / 4);
+				}
+			}
+		}
+		ioImage.mips.push_back(std::move(mip));
+	}
+}
+OWL_DIAG_POP
+
 }// namespace owl::renderer
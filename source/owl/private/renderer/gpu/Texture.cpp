@@ -15,6 +15,7 @@
 #include "opengl/Texture.h"
 #include "renderer/Renderer.h"
 #include "renderer/TextureDecoder.h"
+#include "renderer/utils/TextureUploadQueue.h"
 #include "vulkan/Texture.h"
 
 #include <fstream>
@@ -250,7 +251,11 @@ auto Texture2D::createFromSerializedAsync(const std::string& iTextureSerializedN
 		return createFromSerialized(iTextureSerializedName);
 	}
 
-	auto texture = create(Specification{.size = *peeked, .format = ImageFormat::Rgba8, .generateMips = false});
+	auto texture = create(Specification{.size = *peeked,
+										.format = ImageFormat::Rgba8,
+										.generateMips = false,
+										.filterMode = FilterMode::Linear,
+										.mipLevels = renderer::getMipLevelCount(*peeked)});
 	if (!texture) {
 		return nullptr;
 	}
@@ -262,33 +267,47 @@ auto Texture2D::createFromSerializedAsync(const std::string& iTextureSerializedN
 	}
 	texture->m_loadState = LoadState::Pending;
 
-	// Fill the GPU placeholder with opaque white (W * H * 4 bytes = 0xFF).
-	const auto byteCount = static_cast<size_t>(peeked->x()) * static_cast<size_t>(peeked->y()) * 4u;
-	std::vector<uint8_t> whiteBuffer(byteCount, 0xFFu);
-	texture->setData(whiteBuffer.data(), static_cast<uint32_t>(whiteBuffer.size()));
+	// Until the decode lands, sample a single white texel: the smallest level of the chain. Backends without
+	// mip storage get it in their only level, which also creates the image and clears it to the same white.
+	const uint32_t levelCount = texture->getMipLevelCount();
+	constexpr uint32_t white = 0xFFFFFFFFu;
+	texture->setMipData(levelCount - 1, {0, 0}, {1, 1}, &white);
+	if (levelCount > 1)
+		texture->setBaseMipLevel(levelCount - 1);
 
-	// Hand off decode work to a worker; termination callback uploads the real pixels on the main thread.
+	// Decode and build the mip chain on a worker; the termination callback queues the upload on the main thread.
 	auto sharedBytes = mkShared<std::vector<uint8_t>>(std::move(source.bytes));
 	auto sharedDecoded = mkShared<DecodedImage>();
 	const weak<Texture2D> weakTex = texture;
 
-	ioScheduler.pushTask(core::task::Task{
-			[sharedBytes, sharedDecoded]() -> void {
+	core::task::Task decode{
+			[sharedBytes, sharedDecoded, levelCount, weakTex]() -> void {
+				if (weakTex.expired())
+					return;// released before a worker took the job: skip the decode
 				*sharedDecoded = decodeImageBytes(std::span<const uint8_t>(*sharedBytes), 4);
+				sharedBytes->clear();
+				sharedBytes->shrink_to_fit();
+				generateMipChain(*sharedDecoded, levelCount);
 			},
 			[weakTex, sharedDecoded]() -> void {
 				const auto tex = weakTex.lock();
 				if (!tex) {
 					return;// texture handle was released while the worker ran
 				}
-				if (!sharedDecoded->valid) {
+				if (!sharedDecoded->valid || sharedDecoded->size != tex->getSize()) {
 					tex->m_loadState = LoadState::Failed;
 					return;
 				}
-				tex->setData(sharedDecoded->pixels.data(), static_cast<uint32_t>(sharedDecoded->pixels.size()));
-				tex->m_loadState = LoadState::Ready;
+				// Small levels are uploaded now, the others over the next frames within the upload budget.
+				utils::TextureUploadQueue::get().push(tex, sharedDecoded,
+													  [weakTex]() -> void {
+														  if (const auto done = weakTex.lock(); done)
+															  done->m_loadState = LoadState::Ready;
+													  });
 			},
-	});
+	};
+	decode.setPriority(core::task::Task::Priority::Streaming);
+	ioScheduler.pushTask(std::move(decode));
 
 	return texture;
 }
@@ -114,6 +114,6 @@ public:
 	 *  Get the maximum number of texture slots.
 	 * @return Number of texture slots.
 	 */
-	[[nodiscard]] auto getMaxTextureSlots() const -> uint32_t override { return 16; }
+	[[nodiscard]] auto getMaxTextureSlots() const -> uint32_t override { return 32; }
 };
 }// namespace owl::renderer::gpu::null
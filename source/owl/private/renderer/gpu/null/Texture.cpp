@@ -8,15 +8,28 @@
 #include "owlpch.h"
 
 #include "Texture.h"
+#include "renderer/TextureDecoder.h"
+
+#include <atomic>
 
 namespace owl::renderer::gpu::null {
 
-Texture2D::Texture2D(std::filesystem::path iPath) : renderer::gpu::Texture2D{std::move(iPath)} {
+namespace {
+/// Distinct ids, like the real backends, so texture identity behaves the same in tests.
+auto nextRendererId() -> uint64_t {
+	static std::atomic<uint64_t> counter{0};
+	return ++counter;
+}
+}// namespace
+
+Texture2D::Texture2D(std::filesystem::path iPath)
+	: renderer::gpu::Texture2D{std::move(iPath)}, m_rendererId{nextRendererId()} {
 	if (exists(m_path))
 		m_specification.size = {1, 1};
 }
 
-Texture2D::Texture2D(const Specification& iSpecs) : renderer::gpu::Texture2D{iSpecs} {}
+Texture2D::Texture2D(const Specification& iSpecs)
+	: renderer::gpu::Texture2D{iSpecs}, m_rendererId{nextRendererId()} {}
 
 Texture2D::~Texture2D() = default;
 
@@ -24,4 +37,12 @@ void Texture2D::bind(uint32_t) const {}
 
 void Texture2D::setData(void*, uint32_t) {}
 
+void Texture2D::setMipData(uint32_t, const math::vec2ui&, const math::vec2ui&, const void*) {}
+
+auto Texture2D::getMipLevelCount() const -> uint32_t {
+	if (m_specification.filterMode == FilterMode::Nearest)
+		return 1;
+	return std::clamp(m_specification.mipLevels, 1u, std::max(renderer::getMipLevelCount(m_specification.size), 1u));
+}
+
 }// namespace owl::renderer::gpu::null
@@ -77,6 +77,24 @@ public:
 	 */
 	void setData(void* iData, uint32_t iSize) override;
 
+	/**
+	 * @brief
+	 *  Upload a rectangle of one mip level.
+	 * @param[in] iLevel The mip level.
+	 * @param[in] iOffset Origin of the rectangle in the level.
+	 * @param[in] iSize Size of the rectangle.
+	 * @param[in] iData Tightly packed pixels of the rectangle.
+	 */
+	void setMipData(uint32_t iLevel, const math::vec2ui& iOffset, const math::vec2ui& iSize,
+					const void* iData) override;
+
+	/**
+	 * @brief
+	 *  Number of mip levels the storage holds, as requested by the specification.
+	 * @return The level count.
+	 */
+	[[nodiscard]] auto getMipLevelCount() const -> uint32_t override;
+
 private:
 	/// OpenGL binding.
 	uint64_t m_rendererId = 0;
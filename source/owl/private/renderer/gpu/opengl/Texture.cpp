@@ -46,12 +46,12 @@ auto glInternalDataFormat(const ImageFormat& iFormat) -> GLenum {
 	return GL_NONE;
 }
 
-void applySamplerFilter(const GLuint iTexture, const FilterMode iMode) {
+void applySamplerFilter(const GLuint iTexture, const FilterMode iMode, const uint32_t iLevelCount) {
 	if (iMode == FilterMode::Nearest) {
 		glTextureParameteri(iTexture, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
 		glTextureParameteri(iTexture, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
 	} else {
-		glTextureParameteri(iTexture, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+		glTextureParameteri(iTexture, GL_TEXTURE_MIN_FILTER, iLevelCount > 1 ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
 		glTextureParameteri(iTexture, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
 	}
 	glTextureParameteri(iTexture, GL_TEXTURE_WRAP_S, GL_REPEAT);
@@ -76,7 +76,7 @@ Texture2D::Texture2D(std::filesystem::path iPath) : renderer::gpu::Texture2D{std
 	glTextureStorage2D(m_textureId, 1, glInternalDataFormat(m_specification.format),
 					   static_cast<GLsizei>(m_specification.size.x()), static_cast<GLsizei>(m_specification.size.y()));
 
-	applySamplerFilter(m_textureId, m_specification.filterMode);
+	applySamplerFilter(m_textureId, m_specification.filterMode, m_levelCount);
 
 	setData(const_cast<uint8_t*>(decoded.pixels.data()), static_cast<uint32_t>(decoded.pixels.size()));
 }
@@ -85,12 +85,17 @@ Texture2D::Texture2D(const Specification& iSpecs) : renderer::gpu::Texture2D{iSp
 
 	OWL_PROFILE_FUNCTION()
 
+	// Explicit mip storage is only allocated on request: nothing fills the levels otherwise.
+	if (m_specification.filterMode == FilterMode::Linear)
+		m_levelCount = std::clamp(m_specification.mipLevels, 1u,
+								  std::max(renderer::getMipLevelCount(m_specification.size), 1u));
+
 	glCreateTextures(GL_TEXTURE_2D, 1, &m_textureId);
 
-	glTextureStorage2D(m_textureId, 1, glInternalDataFormat(m_specification.format),
+	glTextureStorage2D(m_textureId, static_cast<GLsizei>(m_levelCount), glInternalDataFormat(m_specification.format),
 					   static_cast<GLsizei>(m_specification.size.x()), static_cast<GLsizei>(m_specification.size.y()));
 
-	applySamplerFilter(m_textureId, m_specification.filterMode);
+	applySamplerFilter(m_textureId, m_specification.filterMode, m_levelCount);
 }
 
 Texture2D::~Texture2D() {
@@ -110,7 +115,7 @@ void Texture2D::setFilterMode(const FilterMode iMode) {
 
 	m_specification.filterMode = iMode;
 	if (m_textureId != 0)
-		applySamplerFilter(m_textureId, iMode);
+		applySamplerFilter(m_textureId, iMode, m_levelCount);
 }
 
 void Texture2D::setData(void* iData, [[maybe_unused]] const uint32_t iSize) {
@@ -123,4 +128,21 @@ void Texture2D::setData(void* iData, [[maybe_unused]] const uint32_t iSize) {
 						GL_UNSIGNED_BYTE, iData);
 }
 
+void Texture2D::setMipData(const uint32_t iLevel, const math::vec2ui& iOffset, const math::vec2ui& iSize,
+						   const void* iData) {
+	OWL_PROFILE_FUNCTION()
+
+	OWL_CORE_ASSERT(iLevel < m_levelCount, "Mip level out of the texture storage!")
+	glTextureSubImage2D(m_textureId, static_cast<GLint>(iLevel), static_cast<GLint>(iOffset.x()),
+						static_cast<GLint>(iOffset.y()), static_cast<GLsizei>(iSize.x()),
+						static_cast<GLsizei>(iSize.y()), glDataFormat(m_specification.format), GL_UNSIGNED_BYTE,
+						iData);
+}
+
+void Texture2D::setBaseMipLevel(const uint32_t iLevel) {
+	OWL_PROFILE_FUNCTION()
+
+	glTextureParameteri(m_textureId, GL_TEXTURE_BASE_LEVEL, static_cast<GLint>(std::min(iLevel, m_levelCount - 1)));
+}
+
 }// namespace owl::renderer::gpu::opengl
@@ -77,6 +77,31 @@ public:
 	 */
 	void setData(void* iData, uint32_t iSize) override;
 
+	/**
+	 * @brief
+	 *  Upload a rectangle of one mip level.
+	 * @param[in] iLevel The mip level.
+	 * @param[in] iOffset Origin of the rectangle in the level.
+	 * @param[in] iSize Size of the rectangle.
+	 * @param[in] iData Tightly packed pixels of the rectangle.
+	 */
+	void setMipData(uint32_t iLevel, const math::vec2ui& iOffset, const math::vec2ui& iSize,
+					const void* iData) override;
+
+	/**
+	 * @brief
+	 *  Number of mip levels of the GL storage.
+	 * @return The level count.
+	 */
+	[[nodiscard]] auto getMipLevelCount() const -> uint32_t override { return m_levelCount; }
+
+	/**
+	 * @brief
+	 *  Move GL_TEXTURE_BASE_LEVEL, so only the uploaded levels get sampled.
+	 * @param[in] iLevel The largest level holding valid pixels.
+	 */
+	void setBaseMipLevel(uint32_t iLevel) override;
+
 	/**
 	 * @brief
 	 *  Re-apply the GL sampler parameters for the requested filter mode.
@@ -87,5 +112,7 @@ public:
 private:
 	/// OpenGL binding.
 	uint32_t m_textureId = 0;
+	/// Number of levels of the storage.
+	uint32_t m_levelCount = 1;
 };
 }// namespace owl::renderer::gpu::opengl
@@ -92,19 +92,8 @@ void Texture2D::setData(void* iData, const uint32_t iSize) {
 		return;
 	}
 	vkUnmapMemory(vkc.getLogicalDevice(), stagingBufferMemory);
-	auto& vkd = internal::Descriptors::get();
-	if (!vkd.isTextureRegistered(m_textureId)) {
-		m_textureId = vkd.registerNewTexture();
-		auto& texData = vkd.getTextureData(m_textureId);
-		if (!getName().empty())
-			texData.debugName = getName();
-		else if (!getPath().empty())
-			texData.debugName = getPath().filename().string();
-		else
-			texData.debugName = "anon";
-		createImage(m_textureId, m_specification.size);
-	}
-	auto& data = vkd.getTextureData(m_textureId);
+	ensureImage();
+	auto& data = internal::Descriptors::get().getTextureData(m_textureId);
 	internal::transitionImageLayout(data.textureImage, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
 	internal::copyBufferToImage(stagingBuffer, data.textureImage, m_specification.size);
 	internal::transitionImageLayout(data.textureImage, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
@@ -116,10 +105,97 @@ void Texture2D::setData(void* iData, const uint32_t iSize) {
 	if (data.textureSampler == nullptr)
 		data.createSampler();
 }
+
+void Texture2D::setMipData(const uint32_t iLevel, const math::vec2ui& iOffset, const math::vec2ui& iSize,
+						   const void* iData) {
+	// Smaller levels only serve as placeholders on backends with mip storage.
+	if (iLevel > 0)
+		return;
+	if (m_specification.format != ImageFormat::Rgba8) {
+		OWL_CORE_ERROR("Vulkan Texture, partial upload of format {} not supported.",
+					   magic_enum::enum_name(m_specification.format))
+		return;
+	}
+	const auto& vkc = internal::VulkanCore::get();
+	VkBuffer stagingBuffer = nullptr;
+	VkDeviceMemory stagingBufferMemory = nullptr;
+	const VkDeviceSize regionSize = iSize.surface() * 4ull;
+	internal::createBuffer(regionSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+						   VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, stagingBuffer,
+						   stagingBufferMemory);
+	void* dataPixel = nullptr;
+	vkMapMemory(vkc.getLogicalDevice(), stagingBufferMemory, 0, regionSize, 0, &dataPixel);
+	memcpy(dataPixel, iData, regionSize);
+	vkUnmapMemory(vkc.getLogicalDevice(), stagingBufferMemory);
+
+	const bool created = ensureImage();
+	auto& data = internal::Descriptors::get().getTextureData(m_textureId);
+	const VkCommandBuffer commandBuffer = vkc.beginSingleTimeCommands();
+	if (created) {
+		// The rows not uploaded yet show white, like the single texel placeholder of the other backends.
+		internal::transitionImageLayout(commandBuffer, data.textureImage, VK_IMAGE_LAYOUT_UNDEFINED,
+										VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+		constexpr VkClearColorValue white{.float32 = {1.f, 1.f, 1.f, 1.f}};
+		constexpr VkImageSubresourceRange range{.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
+												.baseMipLevel = 0,
+												.levelCount = 1,
+												.baseArrayLayer = 0,
+												.layerCount = 1};
+		vkCmdClearColorImage(commandBuffer, data.textureImage, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, &white, 1, &range);
+		// Orders the clear before the copy.
+		internal::transitionImageLayout(commandBuffer, data.textureImage, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+										VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+	} else {
+		// Keep the rows already uploaded.
+		internal::transitionImageLayout(commandBuffer, data.textureImage, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+										VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+	}
+	const VkBufferImageCopy region{.bufferOffset = 0,
+								   .bufferRowLength = 0,
+								   .bufferImageHeight = 0,
+								   .imageSubresource = {.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
+														.mipLevel = 0,
+														.baseArrayLayer = 0,
+														.layerCount = 1},
+								   .imageOffset = {.x = static_cast<int32_t>(iOffset.x()),
+												   .y = static_cast<int32_t>(iOffset.y()),
+												   .z = 0},
+								   .imageExtent = {iSize.x(), iSize.y(), 1}};
+	vkCmdCopyBufferToImage(commandBuffer, stagingBuffer, data.textureImage, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1,
+						   &region);
+	internal::transitionImageLayout(commandBuffer, data.textureImage, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+									VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+	vkc.endSingleTimeCommands(commandBuffer);
+
+	internal::freeBuffer(vkc.getLogicalDevice(), stagingBuffer, stagingBufferMemory);
+	if (data.textureImageView == nullptr)
+		data.createView();
+	if (data.textureSampler == nullptr)
+		data.createSampler();
+}
 OWL_DIAG_POP
 
+auto Texture2D::ensureImage() -> bool {
+	auto& vkd = internal::Descriptors::get();
+	if (vkd.isTextureRegistered(m_textureId))
+		return false;
+	m_textureId = vkd.registerNewTexture();
+	auto& texData = vkd.getTextureData(m_textureId);
+	if (!getName().empty())
+		texData.debugName = getName();
+	else if (!getPath().empty())
+		texData.debugName = getPath().filename().string();
+	else
+		texData.debugName = "anon";
+	createImage(m_textureId, m_specification.size);
+	return true;
+}
+
 auto Texture2D::getRendererId() const -> uint64_t {
 	auto& desc = internal::Descriptors::get();
+	// No image yet: nothing to show.
+	if (!desc.isTextureRegistered(m_textureId))
+		return 0;
 	auto& texData = desc.getTextureData(m_textureId);
 	if (texData.textureDescriptorSet == nullptr)
 		texData.createDescriptorSet();
@@ -57,7 +57,7 @@ public:
 	/**
 	 * @brief
 	 *  Get renderer id.
-	 * @return The renderer ID.
+	 * @return The renderer ID, 0 while the image is not created.
 	 */
 	[[nodiscard]] auto getRendererId() const -> uint64_t override;
 
@@ -76,7 +76,24 @@ public:
 	 */
 	void setData(void* iData, uint32_t iSize) override;
 
+	/**
+	 * @brief
+	 *  Upload a rectangle of the image; the image holds a single level, so other levels are skipped.
+	 * @param[in] iLevel The mip level.
+	 * @param[in] iOffset Origin of the rectangle in the level.
+	 * @param[in] iSize Size of the rectangle.
+	 * @param[in] iData Tightly packed Rgba8 pixels of the rectangle.
+	 */
+	void setMipData(uint32_t iLevel, const math::vec2ui& iOffset, const math::vec2ui& iSize,
+					const void* iData) override;
+
 private:
+	/**
+	 * @brief
+	 *  Register the texture and create its image on first use.
+	 * @return True if the image was just created, with undefined content.
+	 */
+	auto ensureImage() -> bool;
 	/// Vulkan-side texture identifier (registered with the descriptor pool / bindless table).
 	uint32_t m_textureId = 0;
 };
@@ -0,0 +1,77 @@
+/**
+ * @file RaycastSpriteBatch.cpp
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright (c) 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#include "owlpch.h"
+
+#include "RaycastSpriteBatch.h"
+
+namespace owl::renderer::utils {
+
+void RaycastSpriteBatch::build(const std::span<const RaycastSpriteData> iSprites,
+							   const std::span<const Footprint> iFootprints, const std::span<const float> iZBuffer,
+							   RendererRaycast::Statistics& ioStats, const FlushFunction& iFlush) {
+	m_instances.clear();
+	m_textures.clear();
+	m_instances.reserve(g_maxSprites);
+	m_textures.reserve(g_maxTextures);
+	for (const auto& footprint: iFootprints) {
+		// Trim the columns hidden at both ends; fully hidden sprites are not submitted at all.
+		uint32_t first = footprint.colEnd;
+		uint32_t last = footprint.colStart;
+		uint32_t visibleColumns = 0;
+		for (uint32_t col = footprint.colStart; col < footprint.colEnd; ++col) {
+			if (col < iZBuffer.size() && footprint.depth >= iZBuffer[col])
+				continue;
+			first = std::min(first, col);
+			last = col;
+			++visibleColumns;
+		}
+		ioStats.spriteOccludedCount += footprint.colEnd - footprint.colStart - visibleColumns;
+		if (visibleColumns == 0)
+			continue;
+		ioStats.spriteStripeCount += visibleColumns;
+		ioStats.spriteCount++;
+
+		const auto& sprite = iSprites[footprint.spriteIdx];
+		auto slot = static_cast<uint32_t>(
+				std::ranges::find_if(m_textures, [&sprite](const shared<gpu::Texture>* iTexture) -> bool {
+					return iTexture->get() == sprite.texture.get();
+				}) -
+				m_textures.begin());
+		if (slot == m_textures.size() && m_textures.size() >= g_maxTextures) {
+			flush(iFlush);
+			slot = 0;
+		}
+		if (slot == m_textures.size())
+			m_textures.push_back(&sprite.texture);
+		m_instances.push_back(
+				{.rect = math::vec4{footprint.screenCenterY, footprint.spriteH, footprint.screenLeft,
+									footprint.spriteW},
+				 .uvRect = math::vec4{footprint.uvLeft, footprint.uvBottom, footprint.uvRight, footprint.uvTop},
+				 .tint = footprint.tint,
+				 .depth = footprint.depth,
+				 .colStart = first,
+				 .colEnd = last + 1,
+				 .texIndex = slot,
+				 .entityId = sprite.entityId,
+				 ._pad = {0, 0, 0}});
+		if (m_instances.size() >= g_maxSprites)
+			flush(iFlush);
+	}
+	flush(iFlush);
+}
+
+void RaycastSpriteBatch::flush(const FlushFunction& iFlush) {
+	if (m_instances.empty())
+		return;
+	iFlush(*this);
+	m_instances.clear();
+	m_textures.clear();
+}
+
+}// namespace owl::renderer::utils
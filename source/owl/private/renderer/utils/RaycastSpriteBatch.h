@@ -0,0 +1,133 @@
+/**
+ * @file RaycastSpriteBatch.h
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright (c) 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+
+#include "renderer/RendererRaycast.h"
+
+#include <functional>
+#include <span>
+#include <vector>
+
+namespace owl::renderer::utils {
+
+/**
+ * @brief
+ *  Records of the instanced sprite draws of the raycaster (GPU path).
+ *
+ * Each visible sprite becomes one record, its column range trimmed to the
+ * first and last columns in front of the walls; fully hidden sprites get no
+ * record. The records keep the painter's order and share a table of texture
+ * slots: a batch is handed to the flush callback before a texture would not
+ * fit in the table, once full, and at the end of the build.
+ */
+class RaycastSpriteBatch final {
+public:
+	/// Maximum number of records of a batch.
+	static constexpr uint32_t g_maxSprites = 4096;
+	/// Texture slots of the sprite shader (`gTextures[32]`).
+	static constexpr uint32_t g_maxTextures = 32;
+
+	/// One sprite record, std430 layout: must match `SpriteInstance` in `raycast_sprite.slang`.
+	struct Instance {
+		/// Screen rectangle: (screenCenterY, height, screenLeft, width).
+		math::vec4 rect;
+		/// Texture rectangle: (uLeft, vBottom, uRight, vTop).
+		math::vec4 uvRect;
+		/// Fogged tint.
+		math::vec4 tint;
+		/// Camera-space depth.
+		float depth;
+		/// First visible column.
+		uint32_t colStart;
+		/// Past the last visible column.
+		uint32_t colEnd;
+		/// Texture slot in the batch.
+		uint32_t texIndex;
+		/// Entity id for picking.
+		int32_t entityId;
+		/// Padding to the std430 stride.
+		uint32_t _pad[3];
+	};
+
+	/// Screen footprint of a visible sprite.
+	struct Footprint {
+		/// Index of the sprite in the draw call.
+		size_t spriteIdx;
+		/// Camera-space depth.
+		float depth;
+		/// Left edge on screen, in pixels.
+		float screenLeft;
+		/// Width on screen, in pixels.
+		float spriteW;
+		/// Height on screen, in pixels.
+		float spriteH;
+		/// Vertical centre on screen, in pixels.
+		float screenCenterY;
+		/// First covered column.
+		uint32_t colStart;
+		/// Past the last covered column.
+		uint32_t colEnd;
+		/// Left texture coordinate.
+		float uvLeft;
+		/// Right texture coordinate.
+		float uvRight;
+		/// Bottom texture coordinate.
+		float uvBottom;
+		/// Top texture coordinate.
+		float uvTop;
+		/// Fogged tint.
+		math::vec4 tint;
+	};
+
+	/// Called with each complete batch.
+	using FlushFunction = std::function<void(const RaycastSpriteBatch&)>;
+
+	/**
+	 * @brief
+	 *  Build the records of the footprints and flush them batch by batch.
+	 * @param[in] iSprites The sprites of the draw call.
+	 * @param[in] iFootprints The footprints, in painter's order.
+	 * @param[in] iZBuffer Wall depth per column.
+	 * @param[in,out] ioStats Sprite counters to increment.
+	 * @param[in] iFlush Called with each batch, never with an empty one.
+	 */
+	void build(std::span<const RaycastSpriteData> iSprites, std::span<const Footprint> iFootprints,
+			   std::span<const float> iZBuffer, RendererRaycast::Statistics& ioStats, const FlushFunction& iFlush);
+
+	/**
+	 * @brief
+	 *  Records of the current batch.
+	 * @return The records.
+	 */
+	[[nodiscard]] auto getInstances() const -> std::span<const Instance> { return m_instances; }
+
+	/**
+	 * @brief
+	 *  Textures of the current batch, by slot.
+	 * @return The textures.
+	 */
+	[[nodiscard]] auto getTextures() const -> std::span<const shared<gpu::Texture>* const> { return m_textures; }
+
+private:
+	/**
+	 * @brief
+	 *  Hand the current batch to the callback and start a new one.
+	 * @param[in] iFlush The callback.
+	 */
+	void flush(const FlushFunction& iFlush);
+
+	/// Records of the current batch.
+	std::vector<Instance> m_instances;
+	/// Textures of the current batch, pointing into the sprites of the draw call.
+	std::vector<const shared<gpu::Texture>*> m_textures;
+};
+
+static_assert(sizeof(RaycastSpriteBatch::Instance) == 80, "Instance must match shader std430 layout");
+
+}// namespace owl::renderer::utils
@@ -0,0 +1,263 @@
+/**
+ * @file TextureResidency.cpp
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright (c) 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#include "owlpch.h"
+
+#include "TextureResidency.h"
+
+#include "core/task/Scheduler.h"
+
+namespace owl::renderer::utils {
+
+namespace {
+/// Clamped border around each packed texture, against bilinear bleed.
+constexpr uint32_t g_gutter = 1;
+/// Bytes per atlas texel.
+constexpr uint32_t g_texelBytes = 4;
+}// namespace
+
+auto TextureResidency::acquire(const shared<gpu::Texture>& iTexture) -> uint32_t {
+	if (iTexture == nullptr)
+		return g_invalidHandle;
+	const auto [it, inserted] =
+			m_handles.try_emplace(iTexture->getRendererId(), static_cast<uint32_t>(m_entries.size()));
+	if (inserted) {
+		m_entries.emplace_back();
+		track(m_entries.back(), it->second, iTexture);
+	} else if (auto& entry = m_entries[it->second]; entry.texture.expired()) {
+		// The renderer id was recycled by a new texture.
+		track(entry, it->second, iTexture);
+	} else if (entry.atlas == AtlasState::Loading) {
+		evaluate(entry, it->second, *iTexture);
+	}
+	return it->second;
+}
+
+void TextureResidency::track(Entry& ioEntry, const uint32_t iHandle, const shared<gpu::Texture>& iTexture) {
+	if (ioEntry.atlas == AtlasState::Packed)
+		--m_packedCount;
+	ioEntry.rendererId = iTexture->getRendererId();
+	ioEntry.texture = iTexture;
+	++ioEntry.serial;
+	ioEntry.slotGeneration = 0;
+	ioEntry.slot = g_noSlot;
+	evaluate(ioEntry, iHandle, *iTexture);
+}
+
+void TextureResidency::evaluate(Entry& ioEntry, const uint32_t iHandle, const gpu::Texture& iTexture) {
+	const auto& specs = iTexture.getSpecification();
+	const bool eligible = !iTexture.getPath().empty() &&
+						  (specs.format == gpu::ImageFormat::Rgba8 || specs.format == gpu::ImageFormat::Rgb8) &&
+						  specs.size.x() <= g_maxAtlasSprite && specs.size.y() <= g_maxAtlasSprite;
+	if (!eligible) {
+		ioEntry.atlas = AtlasState::Rejected;
+		return;
+	}
+	// A texture still streaming in is looked at again by the next acquire.
+	switch (iTexture.getLoadState()) {
+		case gpu::LoadState::Pending:
+			ioEntry.atlas = AtlasState::Loading;
+			return;
+		case gpu::LoadState::Failed:
+			ioEntry.atlas = AtlasState::Rejected;
+			return;
+		case gpu::LoadState::Ready:
+			break;
+	}
+	ioEntry.atlas = AtlasState::Pending;
+	m_pending.push_back(iHandle);
+}
+
+auto TextureResidency::findAtlasRegion(const uint32_t iHandle) const -> const AtlasRegion* {
+	if (iHandle >= m_entries.size() || m_entries[iHandle].atlas != AtlasState::Packed)
+		return nullptr;
+	return &m_entries[iHandle].region;
+}
+
+auto TextureResidency::update(core::task::Scheduler* ioScheduler) -> uint32_t {
+	OWL_PROFILE_FUNCTION()
+
+	// Hand the sources to decode over to the workers.
+	size_t consumed = 0;
+	for (; consumed < m_pending.size() && m_decoding < g_maxDecodesInFlight; ++consumed) {
+		const uint32_t handle = m_pending[consumed];
+		auto& entry = m_entries[handle];
+		if (entry.atlas != AtlasState::Pending)
+			continue;
+		const auto texture = entry.texture.lock();
+		if (texture == nullptr) {
+			entry.atlas = AtlasState::Rejected;
+			continue;
+		}
+		entry.atlas = AtlasState::Decoding;
+		++m_decoding;
+		auto decode = [inbox = mp_inbox, handle, serial = entry.serial, path = texture->getPath()] -> void {
+			auto image = decodeImageFile(path, static_cast<int>(g_texelBytes));
+			const std::scoped_lock lock{inbox->mutex};
+			inbox->decoded.push_back({.handle = handle, .serial = serial, .image = std::move(image)});
+		};
+		if (ioScheduler == nullptr) {
+			decode();
+			continue;
+		}
+		core::task::Task task{std::move(decode)};
+		task.setPriority(core::task::Task::Priority::Streaming);
+		ioScheduler->pushTask(std::move(task));
+	}
+	m_pending.erase(m_pending.begin(), m_pending.begin() + static_cast<std::ptrdiff_t>(consumed));
+
+	// Copy the decoded ones into their pages.
+	{
+		const std::scoped_lock lock{mp_inbox->mutex};
+		m_decoded.swap(mp_inbox->decoded);
+	}
+	uint32_t packed = 0;
+	for (const auto& decoded: m_decoded) {
+		--m_decoding;
+		// Opening a page registers its texture, so entries are looked up again after packing.
+		if (const auto& entry = m_entries[decoded.handle];
+			entry.serial != decoded.serial || entry.atlas != AtlasState::Decoding)
+			continue;// the texture behind the handle changed meanwhile
+		const bool success = pack(decoded.handle, decoded.image);
+		m_entries[decoded.handle].atlas = success ? AtlasState::Packed : AtlasState::Rejected;
+		if (success)
+			++packed;
+	}
+	m_decoded.clear();
+	m_packedCount += packed;
+	uploadDirtyRegions();
+	return packed;
+}
+
+auto TextureResidency::pack(const uint32_t iHandle, const DecodedImage& iDecoded) -> bool {
+	const auto texture = m_entries[iHandle].texture.lock();
+	if (texture == nullptr)
+		return false;
+	if (!iDecoded.valid || iDecoded.size.x() == 0 || iDecoded.size.y() == 0 || iDecoded.size.x() > g_maxAtlasSprite ||
+		iDecoded.size.y() > g_maxAtlasSprite)
+		return false;
+	const uint32_t width = iDecoded.size.x();
+	const uint32_t height = iDecoded.size.y();
+	uint32_t x = 0;
+	uint32_t y = 0;
+	const uint32_t pageIndex =
+			allocate(width + 2 * g_gutter, height + 2 * g_gutter, texture->getFilterMode(), x, y);
+	if (pageIndex >= g_maxPages)
+		return false;
+	auto& page = m_pages[pageIndex];
+	// Copy with the border texels repeated into the gutter, as a clamp-to-edge sampler would.
+	for (uint32_t row = 0; row < height + 2 * g_gutter; ++row) {
+		const uint32_t srcRow = std::min(row > g_gutter ? row - g_gutter : 0, height - 1);
+		const uint8_t* src = iDecoded.pixels.data() + static_cast<size_t>(srcRow) * width * g_texelBytes;
+		uint8_t* dst = page.pixels.data() + (static_cast<size_t>(y + row) * g_pageSize + x) * g_texelBytes;
+		std::memcpy(dst, src, g_gutter * g_texelBytes);
+		std::memcpy(dst + g_gutter * g_texelBytes, src, static_cast<size_t>(width) * g_texelBytes);
+		std::memcpy(dst + static_cast<size_t>(g_gutter + width) * g_texelBytes,
+					src + static_cast<size_t>(width - 1) * g_texelBytes, g_gutter * g_texelBytes);
+	}
+	page.dirtyMin = {std::min(page.dirtyMin.x(), x), std::min(page.dirtyMin.y(), y)};
+	page.dirtyMax = {std::max(page.dirtyMax.x(), x + width + 2 * g_gutter),
+					 std::max(page.dirtyMax.y(), y + height + 2 * g_gutter)};
+	constexpr float invSize = 1.f / static_cast<float>(g_pageSize);
+	m_entries[iHandle].region = {
+			.page = pageIndex,
+			.offset = {static_cast<float>(x + g_gutter) * invSize, static_cast<float>(y + g_gutter) * invSize},
+			.scale = {static_cast<float>(width) * invSize, static_cast<float>(height) * invSize}};
+	return true;
+}
+
+void TextureResidency::uploadDirtyRegions() {
+	for (auto& page: m_pages) {
+		if (page.dirtyMax.x() <= page.dirtyMin.x() || page.dirtyMax.y() <= page.dirtyMin.y())
+			continue;
+		// The bounding box of the packs since the last upload, tightly packed for the backend.
+		const math::vec2ui size = page.dirtyMax - page.dirtyMin;
+		const size_t rowBytes = static_cast<size_t>(size.x()) * g_texelBytes;
+		m_staging.resize(rowBytes * size.y());
+		for (uint32_t row = 0; row < size.y(); ++row)
+			std::memcpy(m_staging.data() + row * rowBytes,
+						page.pixels.data() +
+								(static_cast<size_t>(page.dirtyMin.y() + row) * g_pageSize + page.dirtyMin.x()) *
+										g_texelBytes,
+						rowBytes);
+		page.texture->setMipData(0, page.dirtyMin, size, m_staging.data());
+		page.dirtyMin = {g_pageSize, g_pageSize};
+		page.dirtyMax = {0, 0};
+	}
+}
+
+auto TextureResidency::allocate(const uint32_t iWidth, const uint32_t iHeight, const gpu::FilterMode iFilterMode,
+								uint32_t& oX, uint32_t& oY) -> uint32_t {
+	for (uint32_t index = 0; index < m_pages.size(); ++index) {
+		auto& page = m_pages[index];
+		if (page.filterMode != iFilterMode)
+			continue;
+		if (page.cursorX + iWidth > g_pageSize) {
+			// Open the next shelf.
+			page.shelfY += page.shelfHeight;
+			page.shelfHeight = 0;
+			page.cursorX = 0;
+		}
+		if (page.shelfY + iHeight > g_pageSize)
+			continue;
+		oX = page.cursorX;
+		oY = page.shelfY;
+		page.cursorX += iWidth;
+		page.shelfHeight = std::max(page.shelfHeight, iHeight);
+		return index;
+	}
+	if (m_pages.size() >= g_maxPages)
+		return g_maxPages;
+	auto& page = m_pages.emplace_back();
+	page.texture = gpu::Texture2D::create(gpu::Texture2D::Specification{.size = {g_pageSize, g_pageSize},
+																		.format = gpu::ImageFormat::Rgba8,
+																		.generateMips = false,
+																		.filterMode = iFilterMode});
+	page.filterMode = iFilterMode;
+	page.pixels.assign(static_cast<size_t>(g_pageSize) * g_pageSize * g_texelBytes, 0);
+	page.handle = acquire(page.texture);
+	oX = 0;
+	oY = 0;
+	page.cursorX = iWidth;
+	page.shelfHeight = iHeight;
+	return static_cast<uint32_t>(m_pages.size() - 1);
+}
+
+void TextureResidency::beginBatch() {
+	if (++m_generation != 0)
+		return;
+	for (auto& entry: m_entries) entry.slotGeneration = 0;
+	m_generation = 1;
+}
+
+auto TextureResidency::findSlot(const uint32_t iHandle) const -> uint32_t {
+	if (iHandle >= m_entries.size() || m_entries[iHandle].slotGeneration != m_generation)
+		return g_noSlot;
+	return m_entries[iHandle].slot;
+}
+
+void TextureResidency::setSlot(const uint32_t iHandle, const uint32_t iSlot) {
+	if (iHandle >= m_entries.size())
+		return;
+	m_entries[iHandle].slotGeneration = m_generation;
+	m_entries[iHandle].slot = iSlot;
+}
+
+void TextureResidency::clear() {
+	m_handles.clear();
+	m_entries.clear();
+	m_pending.clear();
+	m_pages.clear();
+	// Decodes still in flight deliver to the old inbox.
+	mp_inbox = mkShared<DecodeInbox>();
+	m_decoding = 0;
+	m_generation = 1;
+	m_packedCount = 0;
+}
+
+}// namespace owl::renderer::utils
@@ -0,0 +1,297 @@
+/**
+ * @file TextureResidency.h
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright (c) 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+
+#include "math/vectors.h"
+#include "renderer/TextureDecoder.h"
+#include "renderer/gpu/Texture.h"
+
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace owl::core::task {
+class Scheduler;
+}// namespace owl::core::task
+
+namespace owl::renderer::utils {
+
+/**
+ * @brief
+ *  Texture residency for the 2D batcher: stable handles, batch slots and runtime atlases.
+ *
+ * Every texture seen by the batcher gets a stable integer handle keyed by its
+ * renderer id (the same identity `Texture::operator==` uses). The handle gives
+ * an O(1) lookup of the texture slot assigned in the current batch: slots are
+ * generation-stamped, so starting a batch costs one increment.
+ *
+ * Small file-backed sprites are also packed into shared atlas pages. The
+ * backends expose neither texture copies nor readback, so a page is built on
+ * the CPU from the decoded source file (with a one-texel clamped gutter against
+ * filtering bleed). Packing is requested on the first use of a loaded texture;
+ * `update()` hands the decodes to the task scheduler and, at the start of a
+ * later scene, copies the decoded ones into their pages and uploads only the
+ * changed part. Pages thus never change while a batch references them; until
+ * then the texture keeps its own slot.
+ */
+class TextureResidency final {
+public:
+	/// Handle of no texture.
+	static constexpr uint32_t g_invalidHandle = std::numeric_limits<uint32_t>::max();
+	/// Slot returned for textures without a slot in the current batch.
+	static constexpr uint32_t g_noSlot = std::numeric_limits<uint32_t>::max();
+	/// Side of an atlas page in texels.
+	static constexpr uint32_t g_pageSize = 2048;
+	/// Largest side of a texture accepted in an atlas page.
+	static constexpr uint32_t g_maxAtlasSprite = 256;
+	/// Maximum number of atlas pages.
+	static constexpr uint32_t g_maxPages = 4;
+	/// Maximum number of source decodes in flight.
+	static constexpr uint32_t g_maxDecodesInFlight = 32;
+
+	/// Location of a packed texture: `atlasUv = offset + uv * scale`.
+	struct AtlasRegion {
+		/// Atlas page.
+		uint32_t page = 0;
+		/// UV of the texture origin in the page.
+		math::vec2 offset{0.f, 0.f};
+		/// UV extent of the texture in the page.
+		math::vec2 scale{1.f, 1.f};
+	};
+
+	/**
+	 * @brief
+	 *  Get the handle of a texture, registering it on first use.
+	 * @param[in] iTexture The texture.
+	 * @return The stable handle.
+	 */
+	auto acquire(const shared<gpu::Texture>& iTexture) -> uint32_t;
+
+	/**
+	 * @brief
+	 *  Atlas location of a texture.
+	 * @param[in] iHandle The texture handle.
+	 * @return The region or nullptr if the texture is not packed.
+	 */
+	[[nodiscard]] auto findAtlasRegion(uint32_t iHandle) const -> const AtlasRegion*;
+
+	/**
+	 * @brief
+	 *  Start the decodes of the pending textures, pack the decoded ones and upload the modified regions.
+	 *
+	 * Must not run while a batch references the pages.
+	 * @param[in,out] ioScheduler Scheduler running the decodes, nullptr to decode on the calling thread.
+	 * @return Number of textures newly packed.
+	 */
+	auto update(core::task::Scheduler* ioScheduler = nullptr) -> uint32_t;
+
+	/**
+	 * @brief
+	 *  Check for textures waiting to be packed.
+	 * @return True if `update()` has work to do.
+	 */
+	[[nodiscard]] auto hasPending() const -> bool { return !m_pending.empty() || m_decoding > 0; }
+
+	/**
+	 * @brief
+	 *  Texture of an atlas page.
+	 * @param[in] iPage The page index.
+	 * @return The page texture.
+	 */
+	[[nodiscard]] auto getPageTexture(const uint32_t iPage) const -> const shared<gpu::Texture2D>& {
+		return m_pages[iPage].texture;
+	}
+
+	/**
+	 * @brief
+	 *  Handle of an atlas page.
+	 * @param[in] iPage The page index.
+	 * @return The page texture handle.
+	 */
+	[[nodiscard]] auto getPageHandle(const uint32_t iPage) const -> uint32_t { return m_pages[iPage].handle; }
+
+	/**
+	 * @brief
+	 *  Number of atlas pages.
+	 * @return The page count.
+	 */
+	[[nodiscard]] auto getPageCount() const -> uint32_t { return static_cast<uint32_t>(m_pages.size()); }
+
+	/**
+	 * @brief
+	 *  Number of textures living in an atlas page.
+	 * @return The packed count.
+	 */
+	[[nodiscard]] auto getPackedCount() const -> uint32_t { return m_packedCount; }
+
+	/**
+	 * @brief
+	 *  Forget every slot assignment.
+	 */
+	void beginBatch();
+
+	/**
+	 * @brief
+	 *  Slot of a texture in the current batch.
+	 * @param[in] iHandle The texture handle.
+	 * @return The slot or `g_noSlot`.
+	 */
+	[[nodiscard]] auto findSlot(uint32_t iHandle) const -> uint32_t;
+
+	/**
+	 * @brief
+	 *  Record the slot of a texture in the current batch.
+	 * @param[in] iHandle The texture handle.
+	 * @param[in] iSlot The slot.
+	 */
+	void setSlot(uint32_t iHandle, uint32_t iSlot);
+
+	/**
+	 * @brief
+	 *  Drop every handle and page.
+	 */
+	void clear();
+
+private:
+	/// Atlas status of a texture.
+	enum struct AtlasState : uint8_t {
+		Loading,///< Eligible once its asynchronous load is done.
+		Pending,///< Waiting for `update()`.
+		Decoding,///< Source decode in flight.
+		Packed,///< Living in a page.
+		Rejected,///< Not eligible or no room left.
+	};
+
+	/// A registered texture.
+	struct Entry {
+		/// Renderer id of the texture.
+		uint64_t rendererId = 0;
+		/// The texture, not owned.
+		std::weak_ptr<gpu::Texture> texture;
+		/// Atlas status.
+		AtlasState atlas = AtlasState::Rejected;
+		/// Incremented each time the entry tracks a new texture, to drop the decodes of the previous one.
+		uint32_t serial = 0;
+		/// Atlas location when packed.
+		AtlasRegion region;
+		/// Batch generation of the slot.
+		uint32_t slotGeneration = 0;
+		/// Slot in the batch of `slotGeneration`.
+		uint32_t slot = g_noSlot;
+	};
+
+	/// An atlas page with its CPU copy and shelf packer state.
+	struct Page {
+		/// GPU texture.
+		shared<gpu::Texture2D> texture;
+		/// Handle of the page texture.
+		uint32_t handle = g_invalidHandle;
+		/// Filtering shared by all the page content.
+		gpu::FilterMode filterMode = gpu::FilterMode::Linear;
+		/// RGBA8 texels.
+		std::vector<uint8_t> pixels;
+		/// Bottom of the current shelf.
+		uint32_t shelfY = 0;
+		/// Height of the current shelf.
+		uint32_t shelfHeight = 0;
+		/// Next free column in the current shelf.
+		uint32_t cursorX = 0;
+		/// Lower corner of the texels changed since the last upload.
+		math::vec2ui dirtyMin{g_pageSize, g_pageSize};
+		/// Upper corner (excluded) of the texels changed since the last upload.
+		math::vec2ui dirtyMax{0, 0};
+	};
+
+	/// A decoded source, waiting for the main thread.
+	struct Decoded {
+		/// Handle of the texture.
+		uint32_t handle = g_invalidHandle;
+		/// Serial of the entry when the decode started.
+		uint32_t serial = 0;
+		/// The decoded texels.
+		DecodedImage image;
+	};
+
+	/// Decodes finished by the workers; shared with the tasks, so that `clear()` can walk away from them.
+	struct DecodeInbox {
+		/// Lock of the list.
+		std::mutex mutex;
+		/// The decoded sources.
+		std::vector<Decoded> decoded;
+	};
+
+	/**
+	 * @brief
+	 *  Reset an entry for a (new) texture and decide whether it may be packed.
+	 * @param[in,out] ioEntry The entry.
+	 * @param[in] iHandle Handle of the entry.
+	 * @param[in] iTexture The texture.
+	 */
+	void track(Entry& ioEntry, uint32_t iHandle, const shared<gpu::Texture>& iTexture);
+
+	/**
+	 * @brief
+	 *  Decide whether a texture may be packed, now that it may be loaded.
+	 * @param[in,out] ioEntry The entry.
+	 * @param[in] iHandle Handle of the entry.
+	 * @param[in] iTexture The texture.
+	 */
+	void evaluate(Entry& ioEntry, uint32_t iHandle, const gpu::Texture& iTexture);
+
+	/**
+	 * @brief
+	 *  Copy a decoded texture source into a page.
+	 * @param[in] iHandle Handle of the texture to pack.
+	 * @param[in] iDecoded The decoded source.
+	 * @return True if packed.
+	 */
+	auto pack(uint32_t iHandle, const DecodedImage& iDecoded) -> bool;
+
+	/**
+	 * @brief
+	 *  Upload the changed part of the pages.
+	 */
+	void uploadDirtyRegions();
+
+	/**
+	 * @brief
+	 *  Reserve a padded rectangle in a page, opening a page if needed.
+	 * @param[in] iWidth Padded width.
+	 * @param[in] iHeight Padded height.
+	 * @param[in] iFilterMode Filtering of the texture.
+	 * @param[out] oX Left of the rectangle.
+	 * @param[out] oY Bottom of the rectangle.
+	 * @return The page index or `g_maxPages` if there is no room.
+	 */
+	auto allocate(uint32_t iWidth, uint32_t iHeight, gpu::FilterMode iFilterMode, uint32_t& oX, uint32_t& oY)
+			-> uint32_t;
+
+	/// Handle by renderer id.
+	std::unordered_map<uint64_t, uint32_t> m_handles;
+	/// Entries by handle.
+	std::vector<Entry> m_entries;
+	/// Handles waiting to be packed.
+	std::vector<uint32_t> m_pending;
+	/// Where the decode tasks deliver.
+	shared<DecodeInbox> mp_inbox = mkShared<DecodeInbox>();
+	/// Decodes taken from the inbox, reused from update to update.
+	std::vector<Decoded> m_decoded;
+	/// Tightly packed texels of a region to upload, reused from upload to upload.
+	std::vector<uint8_t> m_staging;
+	/// Number of decodes in flight.
+	uint32_t m_decoding = 0;
+	/// Atlas pages.
+	std::vector<Page> m_pages;
+	/// Current batch generation (0 is never current).
+	uint32_t m_generation = 1;
+	/// Number of packed textures.
+	uint32_t m_packedCount = 0;
+};
+
+}// namespace owl::renderer::utils
@@ -0,0 +1,142 @@
+/**
+ * @file TextureUploadQueue.cpp
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright (c) 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#include "owlpch.h"
+
+#include "TextureUploadQueue.h"
+
+namespace owl::renderer::utils {
+
+namespace {
+/// Pixels of one level of a decoded image.
+struct LevelView {
+	/// Level size.
+	math::vec2ui size;
+	/// Level pixels.
+	const uint8_t* pixels = nullptr;
+};
+
+auto levelView(const DecodedImage& iImage, const uint32_t iLevel) -> LevelView {
+	if (iLevel == 0)
+		return {.size = iImage.size, .pixels = iImage.pixels.data()};
+	const auto& mip = iImage.mips[iLevel - 1];
+	return {.size = mip.size, .pixels = mip.pixels.data()};
+}
+
+auto pixelBytes(const DecodedImage& iImage) -> size_t { return iImage.format == gpu::ImageFormat::Rgba8 ? 4 : 3; }
+
+auto rowBytes(const DecodedImage& iImage, const uint32_t iLevel) -> size_t {
+	return levelView(iImage, iLevel).size.x() * pixelBytes(iImage);
+}
+
+auto levelBytes(const DecodedImage& iImage, const uint32_t iLevel) -> size_t {
+	return rowBytes(iImage, iLevel) * levelView(iImage, iLevel).size.y();
+}
+
+}// namespace
+
+auto TextureUploadQueue::get() -> TextureUploadQueue& {
+	static TextureUploadQueue queue;
+	return queue;
+}
+
+void TextureUploadQueue::push(const shared<gpu::Texture>& iTexture, shared<DecodedImage> iImage,
+							  std::function<void()> iOnComplete) {
+	OWL_PROFILE_FUNCTION()
+
+	if (iTexture == nullptr || iImage == nullptr || !iImage->valid)
+		return;
+	const auto levelCount =
+			std::max(std::min(iTexture->getMipLevelCount(), static_cast<uint32_t>(iImage->mips.size() + 1)), 1u);
+	Entry entry{.texture = iTexture,
+				.image = std::move(iImage),
+				.onComplete = std::move(iOnComplete),
+				.level = levelCount - 1,
+				.row = 0};
+	// The small levels make the placeholder: upload them right away.
+	while (true) {
+		const auto size = levelView(*entry.image, entry.level).size;
+		if (std::max(size.x(), size.y()) > g_placeholderSide)
+			break;
+		const uint32_t level = entry.level;
+		uploadBand(entry, *iTexture, std::numeric_limits<size_t>::max());
+		if (level == 0) {
+			if (entry.onComplete)
+				entry.onComplete();
+			return;
+		}
+	}
+	m_entries.push_back(std::move(entry));
+}
+
+auto TextureUploadQueue::process(const size_t iBudget) -> size_t {
+	OWL_PROFILE_FUNCTION()
+
+	std::erase_if(m_entries, [](const Entry& iEntry) -> bool { return iEntry.texture.expired(); });
+	size_t spent = 0;
+	while (spent < iBudget && !m_entries.empty()) {
+		// Smallest pending level first, across all the textures.
+		const auto it = std::ranges::min_element(m_entries, {}, [](const Entry& iEntry) -> size_t {
+			return levelBytes(*iEntry.image, iEntry.level);
+		});
+		const size_t remaining = iBudget - spent;
+		if (spent > 0 && remaining < rowBytes(*it->image, it->level))
+			break;
+		const auto texture = it->texture.lock();
+		const uint32_t level = it->level;
+		spent += uploadBand(*it, *texture, remaining);
+		if (level == 0 && it->row == it->image->size.y()) {
+			auto onComplete = std::move(it->onComplete);
+			m_entries.erase(it);
+			if (onComplete)
+				onComplete();
+		}
+	}
+	return spent;
+}
+
+void TextureUploadQueue::flush() {
+	while (!m_entries.empty()) process(std::numeric_limits<size_t>::max());
+}
+
+void TextureUploadQueue::clear() { m_entries.clear(); }
+
+auto TextureUploadQueue::getPendingBytes() const -> size_t {
+	size_t bytes = 0;
+	for (const auto& entry: m_entries) {
+		if (entry.texture.expired())
+			continue;
+		bytes += levelBytes(*entry.image, entry.level) - entry.row * rowBytes(*entry.image, entry.level);
+		for (uint32_t level = 0; level < entry.level; ++level) bytes += levelBytes(*entry.image, level);
+	}
+	return bytes;
+}
+
+OWL_DIAG_PUSH
+OWL_DIAG_DISABLE_CLANG19("-Wunsafe-buffer-usage")
+auto TextureUploadQueue::uploadBand(Entry& ioEntry, gpu::Texture& iTexture, const size_t iMaxBytes) -> size_t {
+	const auto [size, pixels] = levelView(*ioEntry.image, ioEntry.level);
+	const size_t stride = rowBytes(*ioEntry.image, ioEntry.level);
+	const auto rows = static_cast<uint32_t>(
+			std::clamp<size_t>(iMaxBytes / stride, 1, static_cast<size_t>(size.y() - ioEntry.row)));
+	iTexture.setMipData(ioEntry.level, {0, ioEntry.row}, {size.x(), rows}, pixels + ioEntry.row * stride);
+	ioEntry.row += rows;
+	if (ioEntry.row == size.y()) {
+		iTexture.setBaseMipLevel(ioEntry.level);
+		if (ioEntry.level > 0) {
+			// Uploaded: the CPU copy is no longer needed.
+			ioEntry.image->mips[ioEntry.level - 1].pixels = {};
+			--ioEntry.level;
+			ioEntry.row = 0;
+		}
+	}
+	return rows * stride;
+}
+OWL_DIAG_POP
+
+}// namespace owl::renderer::utils
@@ -0,0 +1,151 @@
+/**
+ * @file TextureUploadQueue.h
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright (c) 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+
+#include "renderer/TextureDecoder.h"
+#include "renderer/gpu/Texture.h"
+
+#include <functional>
+#include <vector>
+
+namespace owl::renderer::utils {
+
+/**
+ * @brief
+ *  Streams decoded textures to the GPU, smallest mip levels first, under a per-frame byte budget.
+ *
+ * When a texture is pushed, its levels no larger than `g_placeholderSide` are
+ * uploaded at once: they are a few kilobytes and give a blurry but correct
+ * placeholder. The larger levels are uploaded by `process()`, called once per
+ * frame, in bands of whole rows until the frame budget is spent. Across all the
+ * queued textures the smallest pending level always goes first, so every texture
+ * sharpens before any single one reaches full resolution. After each completed
+ * level, sampling is extended to it with `Texture::setBaseMipLevel`.
+ *
+ * Main thread only, like every GPU upload.
+ */
+class TextureUploadQueue final {
+public:
+	/// Default upload budget per frame.
+	static constexpr size_t g_defaultBudget = 8ull * 1024ull * 1024ull;
+	/// Levels whose largest side does not exceed this are uploaded on push, outside the budget.
+	static constexpr uint32_t g_placeholderSide = 64;
+
+	/**
+	 * @brief
+	 *  Access to the queue fed by the async texture loads.
+	 * @return The queue.
+	 */
+	static auto get() -> TextureUploadQueue&;
+
+	/**
+	 * @brief
+	 *  Start streaming a decoded image into a texture.
+	 * @param[in] iTexture The texture, sized like the image, with Rgba8 or Rgb8 format matching it.
+	 * @param[in] iImage The decoded image and its mip chain; levels the texture cannot hold are ignored.
+	 * @param[in] iOnComplete Called once the full level is uploaded; not called if the texture dies first.
+	 */
+	void push(const shared<gpu::Texture>& iTexture, shared<DecodedImage> iImage, std::function<void()> iOnComplete);
+
+	/**
+	 * @brief
+	 *  Upload pending levels within the budget set by `setBudget`.
+	 * @return The number of bytes uploaded.
+	 */
+	auto process() -> size_t { return process(m_budget); }
+
+	/**
+	 * @brief
+	 *  Upload pending levels within the given budget.
+	 *
+	 * A band holds at least one row, so a single row larger than the budget still progresses.
+	 * @param[in] iBudget The byte budget.
+	 * @return The number of bytes uploaded.
+	 */
+	auto process(size_t iBudget) -> size_t;
+
+	/**
+	 * @brief
+	 *  Upload everything pending, regardless of the budget.
+	 */
+	void flush();
+
+	/**
+	 * @brief
+	 *  Drop every pending upload, without completing the textures.
+	 */
+	void clear();
+
+	/**
+	 * @brief
+	 *  Change the per-frame budget.
+	 * @param[in] iBudget The byte budget.
+	 */
+	void setBudget(const size_t iBudget) { m_budget = iBudget; }
+
+	/**
+	 * @brief
+	 *  Access to the per-frame budget.
+	 * @return The byte budget.
+	 */
+	[[nodiscard]] auto getBudget() const -> size_t { return m_budget; }
+
+	/**
+	 * @brief
+	 *  Number of textures still streaming.
+	 * @return The texture count.
+	 */
+	[[nodiscard]] auto size() const -> size_t { return m_entries.size(); }
+
+	/**
+	 * @brief
+	 *  Check for pending uploads.
+	 * @return True if nothing is pending.
+	 */
+	[[nodiscard]] auto empty() const -> bool { return m_entries.empty(); }
+
+	/**
+	 * @brief
+	 *  Bytes still to upload.
+	 * @return The byte count.
+	 */
+	[[nodiscard]] auto getPendingBytes() const -> size_t;
+
+private:
+	/// A texture being streamed.
+	struct Entry {
+		/// The texture; the entry is dropped when it dies.
+		weak<gpu::Texture> texture;
+		/// The pixels.
+		shared<DecodedImage> image;
+		/// Completion callback.
+		std::function<void()> onComplete;
+		/// Level being uploaded.
+		uint32_t level = 0;
+		/// Next row to upload in the level.
+		uint32_t row = 0;
+	};
+
+	/**
+	 * @brief
+	 *  Upload the next band of an entry.
+	 * @param[in,out] ioEntry The entry.
+	 * @param[in] iTexture The locked texture.
+	 * @param[in] iMaxBytes The bytes the band may use; at least one row is uploaded.
+	 * @return Bytes uploaded.
+	 */
+	static auto uploadBand(Entry& ioEntry, gpu::Texture& iTexture, size_t iMaxBytes) -> size_t;
+
+	/// Textures being streamed.
+	std::vector<Entry> m_entries;
+	/// Per-frame budget.
+	size_t m_budget = g_defaultBudget;
+};
+
+}// namespace owl::renderer::utils
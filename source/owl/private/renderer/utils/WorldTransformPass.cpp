@@ -47,43 +47,62 @@ void WorldTransformPass::shutdown() {
 }
 
 void WorldTransformPass::compute(std::span<const Entry> iEntries) {
+	m_localsHost.resize(iEntries.size());
+	m_parentsHost.resize(iEntries.size());
+	for (size_t i = 0; i < iEntries.size(); ++i) {
+		m_localsHost[i] = iEntries[i].local;
+		m_parentsHost[i] = iEntries[i].parentIdx;
+	}
+	compute(m_localsHost, m_parentsHost, {}, true);
+}
+
+void WorldTransformPass::compute(std::span<const math::mat4> iLocals, std::span<const int32_t> iParents,
+								 std::span<const Range> iDirty, const bool iStructureChanged) {
 	if (!m_ready)
 		return;
-	m_entryCount = static_cast<uint32_t>(iEntries.size());
+	const auto count = static_cast<uint32_t>(iLocals.size());
+	bool fullUpload = iStructureChanged || count != m_entryCount;
+	m_entryCount = count;
 	if (m_entryCount == 0)
 		return;
 
 	const uint32_t paddedCount = ((m_entryCount + kWorkgroupSize - 1) / kWorkgroupSize) * kWorkgroupSize;
+	constexpr auto matBytes = static_cast<uint32_t>(sizeof(math::mat4));
+	constexpr auto indexBytes = static_cast<uint32_t>(sizeof(int32_t));
 
 	if (paddedCount > m_paddedCapacity) {
-		const uint32_t localsBytes = paddedCount * static_cast<uint32_t>(sizeof(math::mat4));
-		const uint32_t parentsBytes = paddedCount * static_cast<uint32_t>(sizeof(int32_t));
-		m_localsBuffer = gpu::StorageBuffer::create(localsBytes, kBindingLocals, kRenderer);
-		m_parentsBuffer = gpu::StorageBuffer::create(parentsBytes, kBindingParents, kRenderer);
-		m_worldBuffer = gpu::StorageBuffer::create(localsBytes, kBindingWorlds, kRenderer);
+		m_localsBuffer = gpu::StorageBuffer::create(paddedCount * matBytes, kBindingLocals, kRenderer);
+		m_parentsBuffer = gpu::StorageBuffer::create(paddedCount * indexBytes, kBindingParents, kRenderer);
+		m_worldBuffer = gpu::StorageBuffer::create(paddedCount * matBytes, kBindingWorlds, kRenderer);
 		m_paddedCapacity = paddedCount;
+		fullUpload = true;
 	}
 
-	thread_local std::vector<math::mat4> localsHost;
-	thread_local std::vector<int32_t> parentsHost;
-	localsHost.resize(paddedCount);
-	parentsHost.resize(paddedCount);
-	for (uint32_t i = 0; i < m_entryCount; ++i) {
-		localsHost[i] = iEntries[i].local;
-		parentsHost[i] = iEntries[i].parentIdx;
-	}
-	for (uint32_t i = m_entryCount; i < paddedCount; ++i) {
-		localsHost[i] = math::identity<float, 4>();
-		parentsHost[i] = -1;
-	}
-
-	m_localsBuffer->setData(localsHost.data(), m_entryCount * static_cast<uint32_t>(sizeof(math::mat4)), 0);
-	if (paddedCount > m_entryCount) {
-		const uint32_t tailOffset = m_entryCount * static_cast<uint32_t>(sizeof(math::mat4));
-		const uint32_t tailBytes = (paddedCount - m_entryCount) * static_cast<uint32_t>(sizeof(math::mat4));
-		m_localsBuffer->setData(localsHost.data() + m_entryCount, tailBytes, tailOffset);
+	if (fullUpload) {
+		m_localsBuffer->setData(iLocals.data(), m_entryCount * matBytes, 0);
+		m_parentsBuffer->setData(iParents.data(), m_entryCount * indexBytes, 0);
+		if (paddedCount > m_entryCount) {
+			// Padded threads compute an identity world that no graphics pass reads.
+			static const auto s_identities = [] -> std::array<math::mat4, kWorkgroupSize> {
+				std::array<math::mat4, kWorkgroupSize> identities;
+				identities.fill(math::identity<float, 4>());
+				return identities;
+			}();
+			static const auto s_roots = [] -> std::array<int32_t, kWorkgroupSize> {
+				std::array<int32_t, kWorkgroupSize> roots;
+				roots.fill(-1);
+				return roots;
+			}();
+			const uint32_t tail = paddedCount - m_entryCount;
+			m_localsBuffer->setData(s_identities.data(), tail * matBytes, m_entryCount * matBytes);
+			m_parentsBuffer->setData(s_roots.data(), tail * indexBytes, m_entryCount * indexBytes);
+		}
+	} else {
+		if (iDirty.empty())
+			return;
+		for (const auto& [first, size]: iDirty)
+			m_localsBuffer->setData(iLocals.data() + first, size * matBytes, first * matBytes);
 	}
-	m_parentsBuffer->setData(parentsHost.data(), paddedCount * static_cast<uint32_t>(sizeof(int32_t)), 0);
 
 	m_shader->bindStorageBuffer(kBindingLocals, m_localsBuffer);
 	m_shader->bindStorageBuffer(kBindingParents, m_parentsBuffer);
@@ -54,6 +54,17 @@ public:
 		int32_t parentIdx = -1;
 	};
 
+	/**
+	 * @brief
+	 *  Range of entries whose local matrix changed since the previous dispatch.
+	 */
+	struct Range {
+		/// First entry of the range.
+		uint32_t first = 0;
+		/// Number of entries.
+		uint32_t count = 0;
+	};
+
 	WorldTransformPass() = default;
 
 	WorldTransformPass(const WorldTransformPass&) = delete;
@@ -95,6 +106,22 @@ public:
 	 */
 	OWL_API void compute(std::span<const Entry> iEntries);
 
+	/**
+	 * @brief
+	 *  Dispatch from struct-of-arrays input, uploading only what changed.
+	 *  When `iStructureChanged` is set or the entry count differs from the
+	 *  previous call, both arrays are uploaded in full; otherwise only the
+	 *  `iDirty` ranges of `iLocals` are, and the dispatch is skipped when
+	 *  nothing changed since `getWorldBuffer()` is still up to date.
+	 * @param[in] iLocals Topologically-sorted local matrices.
+	 * @param[in] iParents Parent index of each entry (-1 for roots).
+	 * @param[in] iDirty Ranges of `iLocals` changed since the previous call.
+	 * @param[in] iStructureChanged True if entries were added, removed or
+	 *  reordered since the previous call.
+	 */
+	OWL_API void compute(std::span<const math::mat4> iLocals, std::span<const int32_t> iParents,
+						 std::span<const Range> iDirty, bool iStructureChanged);
+
 	/**
 	 * @brief
 	 *  Output SSBO of world matrices, indexed by entry index. Read-only
@@ -130,6 +157,10 @@ private:
 	uint32_t m_paddedCapacity = 0;
 	/// Number of valid entries in the last `compute()` call.
 	uint32_t m_entryCount = 0;
+	/// Staging of the local matrices for the `Entry` overload.
+	std::vector<math::mat4> m_localsHost;
+	/// Staging of the parent indices for the `Entry` overload.
+	std::vector<int32_t> m_parentsHost;
 	/// True once `init()` has run successfully.
 	bool m_ready = false;
 };
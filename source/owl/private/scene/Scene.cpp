@@ -24,11 +24,14 @@
 #include "scene/Entity.h"
 #include "scene/TilemapAsset.h"
 #include "scene/Tileset.h"
+#include "scene/TransformHierarchy.h"
 
 #include "app/Application.h"
+#include "core/task/ParallelUtils.h"
 #include "core/task/Scheduler.h"
 #include "core/task/Task.h"
 #include "data/voxel/Chunk.h"
+#include "data/voxel/ChunkStreamPlanner.h"
 #include "data/voxel/VoxelCollision.h"
 #include "data/voxel/VoxelRaycast.h"
 #include "input/Input.h"
@@ -39,11 +42,14 @@
 #include "script/ScriptEngine.h"
 #include "script/ScriptInstance.h"
 #include "sound/SoundCommand.h"
+#include "sound/SoundHelper.h"
 #include "sound/SoundSystem.h"
 #include "window/Window.h"
 
+#include <atomic>
 #include <limits>
 #include <mutex>
+#include <thread>
 
 namespace owl::scene {
 
@@ -54,10 +60,59 @@ struct CompletedVoxelChunk {
 	shared<data::voxel::Chunk> chunk;
 };
 
+// One chunk the streaming batch must generate.
+struct VoxelChunkRequest {
+	int entityId;
+	math::vec3i coord;
+	data::voxel::TerrainParams params;
+};
+
 // Async voxel generation sink: workers push completed chunks under the mutex, the main thread drains them.
 struct VoxelStreamState {
 	std::mutex mutex;
 	std::vector<CompletedVoxelChunk> completed;
+	/// Moving average of the per-chunk generation cost measured by the workers (ms; 0 until measured).
+	double averageChunkMs = 0.0;
+	/// True while a generation batch runs; only one batch is in flight so its timing drives the next budget.
+	std::atomic<bool> batchInFlight = false;
+	/// Per-world ring planners (main thread only), keyed by entity id.
+	std::unordered_map<int, data::voxel::ChunkStreamPlanner> planners;
+	/// Token of the batch in flight (main thread only).
+	std::optional<core::task::CancellationToken> batchToken;
+	/// Camera chunk of each world when the batch in flight was planned (main thread only).
+	std::unordered_map<int, math::vec3i> batchCenters;
+};
+
+// The generation batch in flight, shared by its task. However the batch ends (done, cancelled by its token or
+// dropped by the scheduler), its destruction gives the chunks it did not deliver back to the planners.
+struct VoxelBatch {
+	VoxelBatch(shared<VoxelStreamState> iSink, std::vector<VoxelChunkRequest> iRequests,
+			   core::task::CancellationToken iToken)
+		: sink(std::move(iSink)), requests(std::move(iRequests)), token(std::move(iToken)) {}
+	VoxelBatch(const VoxelBatch&) = delete;
+	VoxelBatch(VoxelBatch&&) = delete;
+	auto operator=(const VoxelBatch&) -> VoxelBatch& = delete;
+	auto operator=(VoxelBatch&&) -> VoxelBatch& = delete;
+	~VoxelBatch() {
+		if (delivered)
+			return;
+		{
+			// Null chunks only release the pending keys.
+			const std::lock_guard<std::mutex> lock{sink->mutex};
+			for (const auto& request: requests)
+				sink->completed.push_back(
+						CompletedVoxelChunk{.entityId = request.entityId, .coord = request.coord, .chunk = nullptr});
+		}
+		sink->batchInFlight.store(false, std::memory_order_release);
+	}
+	/// Where the chunks go.
+	shared<VoxelStreamState> sink;
+	/// The chunks to generate.
+	std::vector<VoxelChunkRequest> requests;
+	/// Cancelled when the camera leaves the area the batch was planned for.
+	core::task::CancellationToken token;
+	/// If the action pushed its chunks.
+	bool delivered = false;
 };
 
 namespace {
@@ -268,9 +323,28 @@ void updateAnimatedSprite(component::AnimatedSpriteRenderer& ioAnim, const core:
 
 }// namespace
 
-Scene::Scene() = default;
+Scene::Scene() {
+	registry.on_construct<component::ID>().connect<&Scene::onIdConstruct>(*this);
+	registry.on_update<component::ID>().connect<&Scene::onIdConstruct>(*this);
+	registry.on_destroy<component::ID>().connect<&Scene::onIdDestroy>(*this);
+}
 
-Scene::~Scene() = default;
+Scene::~Scene() {
+	// The index is destroyed before the registry: stop listening first.
+	registry.on_construct<component::ID>().disconnect(*this);
+	registry.on_update<component::ID>().disconnect(*this);
+	registry.on_destroy<component::ID>().disconnect(*this);
+}
+
+void Scene::onIdConstruct(entt::registry& iRegistry, const entt::entity iEntity) {
+	m_uuidIndex.insert_or_assign(iRegistry.get<component::ID>(iEntity).id, iEntity);
+}
+
+void Scene::onIdDestroy(entt::registry& iRegistry, const entt::entity iEntity) {
+	if (const auto it = m_uuidIndex.find(iRegistry.get<component::ID>(iEntity).id);
+		it != m_uuidIndex.end() && it->second == iEntity)
+		m_uuidIndex.erase(it);
+}
 
 auto Scene::copy(const shared<Scene>& iOther) -> shared<Scene> {
 	shared<Scene> newScene = mkShared<Scene>();
@@ -302,13 +376,12 @@ auto Scene::createEntity(const std::string& iName) -> Entity { return createEnti
 auto Scene::createEntityWithUUID(const core::UUID iUuid, const std::string& iName) -> Entity {
 	Entity entity = {registry.create(), this};
 	entity.addComponent<component::Transform>();
-	auto& [id] = entity.addComponent<component::ID>();
-	id = iUuid;
+	// Constructed with its final UUID so the index signal records the right key.
+	entity.addComponent<component::ID>(iUuid);
 	auto& [tag] = entity.addComponent<component::Tag>();
 	tag = iName.empty() ? "Entity" : iName;
 	entity.addComponent<component::Visibility>();
 	entity.addComponent<component::Hierarchy>();
-	m_uuidIndex.insert_or_assign(iUuid, entity.m_entityHandle);
 	return entity;
 }
 
@@ -337,7 +410,6 @@ void Scene::destroyEntity(Entity& ioEntity) {
 	}
 	if (m_primaryPlayerCache == ioEntity.m_entityHandle)
 		m_primaryPlayerCache = entt::null;
-	m_uuidIndex.erase(ioEntity.getUUID());
 	registry.destroy(ioEntity.m_entityHandle);
 	ioEntity.m_entityHandle = entt::null;
 }
@@ -387,6 +459,8 @@ void Scene::onStartRuntime() {
 	if (sound::SoundSystem::getState() == sound::SoundSystem::State::Running ||
 
 		sound::SoundSystem::getState() == sound::SoundSystem::State::Error) {
+		// Decode every sound of the scene in parallel; the ones still loading start playing when ready.
+		sound::SoundHelper::prefetchSceneSounds(*this);
 		auto& soundLibrary = sound::SoundSystem::getSoundLibrary();
 		for (const auto view = registry.view<component::Transform, component::SoundSource>(); const auto entity: view) {
 			auto& [soundComp] = view.get<component::SoundSource>(entity);
@@ -512,8 +586,7 @@ void Scene::onUpdateRuntime(const core::Timestep& iTimeStep, const bool iRender)
 
 	m_toastTimer = std::max(0.f, m_toastTimer - iTimeStep.getSeconds());
 	m_visibilityCache.clear();
-	m_layerContentCacheFirst.clear();
-	m_layerContentCacheNotFirst.clear();
+	std::ranges::fill(m_layerContentCache, int8_t{-1});
 	m_inUpdatePass = true;
 
 	// find camera
@@ -696,7 +769,9 @@ void Scene::onUpdateRuntime(const core::Timestep& iTimeStep, const bool iRender)
 			camTransform = getWorldTransform(camEntity);
 			cameraTransform = camTransform();
 		}
-		updateVoxelStreaming(camTransform.translation());
+		const math::mat4 camMatrix = camTransform();
+		updateVoxelStreaming(camTransform.translation(),
+							 math::vec3{-camMatrix(0, 2), -camMatrix(1, 2), -camMatrix(2, 2)});
 		mainCamera->setTransform(cameraTransform);
 		// Compute inverse(projection * viewRotation) for skybox (includes FOV/aspect ratio)
 		math::mat4 viewRotation = mainCamera->getView();
@@ -799,8 +874,7 @@ void Scene::onUpdateEditor(const core::Timestep& iTimeStep, const renderer::Came
 
 	m_toastTimer = std::max(0.f, m_toastTimer - iTimeStep.getSeconds());
 	m_visibilityCache.clear();
-	m_layerContentCacheFirst.clear();
-	m_layerContentCacheNotFirst.clear();
+	std::ranges::fill(m_layerContentCache, int8_t{-1});
 	m_worldTransformCache.clear();
 	m_inUpdatePass = true;
 	m_worldTransformCacheActive = true;
@@ -815,7 +889,8 @@ void Scene::onUpdateEditor(const core::Timestep& iTimeStep, const renderer::Came
 	m_inverseViewRotation = inverse(iCamera.getProjection() * viewRotation);
 	// Stream procedural voxel terrain around the editor camera (its world position is the inverse-view translation).
 	const math::mat4 camToWorld = inverse(iCamera.getView());
-	updateVoxelStreaming(math::vec3{camToWorld(0, 3), camToWorld(1, 3), camToWorld(2, 3)});
+	updateVoxelStreaming(math::vec3{camToWorld(0, 3), camToWorld(1, 3), camToWorld(2, 3)},
+						 math::vec3{-camToWorld(0, 2), -camToWorld(1, 2), -camToWorld(2, 2)});
 	renderWithStack(iCamera);
 	// Disarm per-pass caches; the next tick repopulates from scratch.
 	m_inUpdatePass = false;
@@ -833,11 +908,9 @@ auto Scene::layerAccepts(const Entity& iEntity) const -> bool {
 auto Scene::layerHasContent(const std::string& iLayerName, const bool iIsFirst) const -> bool {
 	OWL_PROFILE_FUNCTION()
 
-	auto& cache = iIsFirst ? m_layerContentCacheFirst : m_layerContentCacheNotFirst;
-	if (m_inUpdatePass) {
-		if (const auto it = cache.find(iLayerName); it != cache.end())
-			return it->second;
-	}
+	const size_t cacheIndex = 2 * static_cast<size_t>(internLayerName(iLayerName)) + (iIsFirst ? 1 : 0);
+	if (m_inUpdatePass && m_layerContentCache[cacheIndex] >= 0)
+		return m_layerContentCache[cacheIndex] != 0;
 
 	auto* self = const_cast<Scene*>(this);// NOLINT(cppcoreguidelines-pro-type-const-cast)
 	const auto matches = [&](const entt::entity e) -> bool {
@@ -880,10 +953,19 @@ auto Scene::layerHasContent(const std::string& iLayerName, const bool iIsFirst)
 	};
 	const bool result = scan();
 	if (m_inUpdatePass)
-		cache.emplace(iLayerName, result);
+		m_layerContentCache[cacheIndex] = result ? 1 : 0;
 	return result;
 }
 
+auto Scene::internLayerName(const std::string& iLayerName) const -> uint32_t {
+	// A render stack holds a handful of layers: a linear scan beats hashing the name.
+	if (const auto it = std::ranges::find(m_layerNames, iLayerName); it != m_layerNames.end())
+		return static_cast<uint32_t>(std::distance(m_layerNames.begin(), it));
+	m_layerNames.push_back(iLayerName);
+	m_layerContentCache.resize(2 * m_layerNames.size(), -1);
+	return static_cast<uint32_t>(m_layerNames.size() - 1);
+}
+
 void Scene::renderWithStack(const renderer::Camera& iCamera) {
 	OWL_PROFILE_FUNCTION()
 
@@ -1158,7 +1240,7 @@ void Scene::renderVoxelWorlds(const bool iEditorMode) {
 	}
 }
 
-void Scene::updateVoxelStreaming(const math::vec3& iCameraWorldPos) {
+void Scene::updateVoxelStreaming(const math::vec3& iCameraWorldPos, const math::vec3& iViewDirection) {
 	OWL_PROFILE_FUNCTION()
 
 	bool anyProcedural = false;
@@ -1182,29 +1264,52 @@ void Scene::updateVoxelStreaming(const math::vec3& iCameraWorldPos) {
 
 	// Install chunks finished on worker threads (main thread; the worlds are only mutated here).
 	std::vector<CompletedVoxelChunk> done;
+	double averageChunkMs = 0.0;
 	{
 		const std::lock_guard<std::mutex> lock{stream.mutex};
 		done.swap(stream.completed);
+		averageChunkMs = stream.averageChunkMs;
 	}
-	for (const auto& finished: done) {
+	for (auto& finished: done) {
 		const auto entity = static_cast<entt::entity>(finished.entityId);
 		if (!registry.valid(entity) || !registry.any_of<component::VoxelWorld>(entity))
 			continue;
 		auto& vw = registry.get<component::VoxelWorld>(entity);
-		vw.pendingChunks.erase(key(finished.coord));
-		if (!vw.proceduralTerrain || !finished.chunk)
+		// A missing key means the world was regenerated (or the chunk unloaded) while this one was in flight.
+		if (vw.pendingChunks.erase(key(finished.coord)) == 0 || !vw.proceduralTerrain || !finished.chunk)
 			continue;
-		const auto chunk = vw.world.getOrCreateChunk(finished.coord);
-		*chunk = *finished.chunk;
-		chunk->markDirty();
+		finished.chunk->markDirty();
+		vw.world.insertChunk(std::move(finished.chunk));
+	}
+	std::erase_if(stream.planners, [this](const auto& iPlanner) -> bool {
+		const auto entity = static_cast<entt::entity>(iPlanner.first);
+		return !registry.valid(entity) || !registry.any_of<component::VoxelWorld>(entity);
+	});
+
+	// Adaptive budget: size the batch so the pool clears it in about `kTargetBatchMs`.
+	constexpr double kTargetBatchMs = 8.0;
+	constexpr size_t kInitialBudget = 16;
+	constexpr size_t kMinBudget = 4;
+	constexpr size_t kMaxBudget = 256;
+	auto& scheduler = app::Application::get().getTaskScheduler();
+	const bool canQueue = !stream.batchInFlight.load(std::memory_order_acquire);
+	if (canQueue) {
+		stream.batchToken.reset();
+		stream.batchCenters.clear();
+	}
+	size_t budget = kInitialBudget;
+	if (averageChunkMs > 0.0) {
+		const double workers = static_cast<double>(std::max(1u, std::thread::hardware_concurrency()));
+		budget = std::clamp(static_cast<size_t>(workers * kTargetBatchMs / averageChunkMs), kMinBudget, kMaxBudget);
 	}
 
-	constexpr int32_t kMaxPushPerFrame = 16;
-	int32_t budget = kMaxPushPerFrame;
 	const math::vec3i camBlock{static_cast<int32_t>(std::floor(iCameraWorldPos.x())),
 							   static_cast<int32_t>(std::floor(iCameraWorldPos.y())),
 							   static_cast<int32_t>(std::floor(iCameraWorldPos.z()))};
-	auto& scheduler = app::Application::get().getTaskScheduler();
+	math::vec3 viewDirection = iViewDirection;
+	viewDirection.normalize();
+	std::vector<VoxelChunkRequest> requests;
+	std::unordered_map<int, math::vec3i> centers;
 	for (const auto view = registry.view<component::VoxelWorld>(); const auto entity: view) {
 		auto& vw = view.get<component::VoxelWorld>(entity);
 		if (!vw.proceduralTerrain)
@@ -1214,37 +1319,91 @@ void Scene::updateVoxelStreaming(const math::vec3& iCameraWorldPos) {
 		const int32_t r = std::max(0, editorMode ? vw.editorStreamRadius : vw.streamRadius);
 		const int32_t h = std::max(0, editorMode ? vw.editorStreamHeight : vw.streamHeight);
 		const math::vec3i camChunk = data::voxel::worldToChunk(camBlock);
-		// Queue missing chunks for async generation (budgeted; pendingChunks avoids re-queuing in-flight ones).
-		for (int32_t dy = -h; dy <= h && budget > 0; ++dy) {
-			for (int32_t dz = -r; dz <= r && budget > 0; ++dz) {
-				for (int32_t dx = -r; dx <= r && budget > 0; ++dx) {
-					const math::vec3i coord{camChunk.x() + dx, camChunk.y() + dy, camChunk.z() + dz};
-					const uint64_t k = key(coord);
-					if (vw.world.getChunk(coord) || vw.pendingChunks.contains(k))
-						continue;
-					vw.pendingChunks.insert(k);
-					--budget;
-					const data::voxel::TerrainParams params = vw.terrain;
-					auto sink = m_voxelStream;
-					scheduler.pushTask(core::task::Task{[params, coord, sink, entityId]() -> void {
-						auto chunk = mkShared<data::voxel::Chunk>(coord);
-						data::voxel::TerrainGenerator{params}.generateChunk(*chunk, coord);
-						const std::lock_guard<std::mutex> lock{sink->mutex};
-						sink->completed.push_back(
-								CompletedVoxelChunk{.entityId = entityId, .coord = coord, .chunk = chunk});
-					}});
-				}
-			}
-		}
+		// Past one chunk of drift, part of the batch in flight falls behind the unload radius: drop what remains.
+		if (const auto center = stream.batchCenters.find(entityId);
+			stream.batchToken && center != stream.batchCenters.end() &&
+			(std::abs(center->second.x() - camChunk.x()) > 1 || std::abs(center->second.y() - camChunk.y()) > 1 ||
+			 std::abs(center->second.z() - camChunk.z()) > 1))
+			stream.batchToken->cancel();
 		// Unload chunks (and forget pending) that drifted outside the radius (+1 chunk of hysteresis).
+		bool unloaded = false;
 		for (const auto& coord: vw.world.chunkCoordinates()) {
 			if (std::abs(coord.x() - camChunk.x()) > r + 1 || std::abs(coord.z() - camChunk.z()) > r + 1 ||
 				std::abs(coord.y() - camChunk.y()) > h + 1) {
 				vw.world.removeChunk(coord);
 				vw.pendingChunks.erase(key(coord));
+				unloaded = true;
 			}
 		}
+		auto& planner = stream.planners[entityId];
+		planner.configure(r, h);
+		// Every chunk before the cursor is resident or pending; fewer of those than the cursor means chunks were
+		// dropped behind the planner's back (regeneration), so the volume must be rescanned.
+		if (unloaded || vw.world.chunkCount() + vw.pendingChunks.size() < planner.getCursor())
+			planner.reset();
+		if (!canQueue || requests.size() >= budget)
+			continue;
+		// Queue missing chunks nearest-first (pendingChunks avoids re-queuing in-flight ones).
+		const auto coords = planner.plan(camChunk, viewDirection, budget - requests.size(),
+										 [&vw, &key](const math::vec3i& iCoord) -> bool {
+											 return vw.pendingChunks.contains(key(iCoord)) || vw.world.hasChunk(iCoord);
+										 });
+		for (const auto& coord: coords) {
+			vw.pendingChunks.insert(key(coord));
+			requests.push_back(VoxelChunkRequest{.entityId = entityId, .coord = coord, .params = vw.terrain});
+		}
+		if (!coords.empty())
+			centers[entityId] = camChunk;
 	}
+	if (requests.empty())
+		return;
+
+	// One batched job per frame: the task fans the requests out over the executor and reports its timing.
+	stream.batchInFlight.store(true, std::memory_order_release);
+	const core::task::CancellationToken token;
+	stream.batchToken = token;
+	stream.batchCenters = std::move(centers);
+	core::task::Task batchTask{[batch = mkShared<VoxelBatch>(m_voxelStream, std::move(requests), token),
+								&scheduler]() -> void {
+		const auto start = std::chrono::steady_clock::now();
+		const auto& batchRequests = batch->requests;
+		// Chunks skipped after a cancellation stay null: the main thread only releases their pending keys.
+		std::vector<CompletedVoxelChunk> generated;
+		generated.reserve(batchRequests.size());
+		for (const auto& request: batchRequests)
+			generated.push_back(
+					CompletedVoxelChunk{.entityId = request.entityId, .coord = request.coord, .chunk = nullptr});
+		core::task::parallelForIndex(scheduler, size_t{0}, batchRequests.size(), size_t{1},
+									 [&](const size_t iIndex) -> void {
+										 if (batch->token.isCancelled())
+											 return;
+										 const auto& request = batchRequests[iIndex];
+										 auto chunk = mkShared<data::voxel::Chunk>(request.coord);
+										 data::voxel::TerrainGenerator{request.params}.generateChunk(*chunk,
+																									 request.coord);
+										 generated[iIndex].chunk = std::move(chunk);
+									 });
+		const double elapsedMs =
+				std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+		// Wall time across the pool, scaled back to the cost of one chunk on one worker.
+		const double workers = static_cast<double>(std::max(1u, std::thread::hardware_concurrency()));
+		const double perChunkMs = elapsedMs * std::min(workers, static_cast<double>(batchRequests.size())) /
+								  static_cast<double>(batchRequests.size());
+		auto& sink = *batch->sink;
+		{
+			const std::lock_guard<std::mutex> lock{sink.mutex};
+			std::ranges::move(generated, std::back_inserter(sink.completed));
+			// A cancelled batch did not generate everything: its timing says nothing of the cost.
+			if (!batch->token.isCancelled())
+				sink.averageChunkMs =
+						sink.averageChunkMs > 0.0 ? 0.75 * sink.averageChunkMs + 0.25 * perChunkMs : perChunkMs;
+		}
+		batch->delivered = true;
+		sink.batchInFlight.store(false, std::memory_order_release);
+	}};
+	batchTask.setPriority(core::task::Task::Priority::Streaming);
+	batchTask.setCancellationToken(token);
+	scheduler.pushTask(std::move(batchTask));
 }
 
 namespace {
@@ -2044,6 +2203,16 @@ auto Scene::getAllEntities() const -> std::vector<Entity> {
 	return entities;
 }
 
+auto Scene::getAllEntities(core::FrameArena& ioArena) const -> std::span<Entity> {
+	const auto* storage = registry.storage<entt::entity>();
+	const auto entities = ioArena.allocateSpan<Entity>(storage->size());
+	size_t count = 0;
+	for (auto&& [e]: storage->each()) {
+		entities[count++] = Entity{e, const_cast<Scene*>(this)};
+	}// NOLINT(cppcoreguidelines-pro-type-const-cast)
+	return entities.first(count);
+}
+
 auto Scene::duplicateEntity(const Entity& iEntity) -> Entity {
 	const std::string name = iEntity.getName();
 	Entity newEntity = createEntity(name);
@@ -2093,17 +2262,11 @@ auto Scene::getEntityCount() const -> uint32_t {
 auto Scene::findEntityByUUID(const core::UUID iUuid) const -> Entity {
 	auto* self = const_cast<Scene*>(this);// NOLINT(cppcoreguidelines-pro-type-const-cast)
 	if (const auto it = m_uuidIndex.find(iUuid); it != m_uuidIndex.end()) {
-		if (registry.valid(it->second) && registry.try_get<component::ID>(it->second) != nullptr &&
-			registry.get<component::ID>(it->second).id == iUuid)
+		// An ID rewritten in place (no registry signal) leaves a stale entry behind.
+		if (const auto* id = registry.try_get<component::ID>(it->second); id != nullptr && id->id == iUuid)
 			return Entity{it->second, self};
 		m_uuidIndex.erase(it);
 	}
-	for (const auto view = registry.view<component::ID>(); const auto entity: view) {
-		if (view.get<component::ID>(entity).id == iUuid) {
-			m_uuidIndex.insert_or_assign(iUuid, entity);
-			return Entity{entity, self};
-		}
-	}
 	return {};
 }
 
@@ -2117,6 +2280,18 @@ auto Scene::getRootEntities() const -> std::vector<Entity> {
 	return entities;
 }
 
+auto Scene::getRootEntities(core::FrameArena& ioArena) const -> std::span<Entity> {
+	const auto* storage = registry.storage<entt::entity>();
+	const auto entities = ioArena.allocateSpan<Entity>(storage->size());
+	size_t count = 0;
+	for (auto&& [e]: storage->each()) {
+		if (const Entity entity{e, const_cast<Scene*>(this)};
+			entity.getComponent<component::Hierarchy>().parentId == core::UUID{0})
+			entities[count++] = entity;
+	}
+	return entities.first(count);
+}
+
 auto Scene::getChildren(const Entity& iEntity) const -> std::vector<Entity> {
 	std::vector<Entity> children;
 	const auto& [parentId, childrenIds] = iEntity.getComponent<component::Hierarchy>();
@@ -2128,11 +2303,27 @@ auto Scene::getChildren(const Entity& iEntity) const -> std::vector<Entity> {
 	return children;
 }
 
+auto Scene::getChildren(const Entity& iEntity, core::FrameArena& ioArena) const -> std::span<Entity> {
+	const auto& [parentId, childrenIds] = iEntity.getComponent<component::Hierarchy>();
+	const auto children = ioArena.allocateSpan<Entity>(childrenIds.size());
+	size_t count = 0;
+	for (const auto childId: childrenIds) {
+		if (const Entity child = findEntityByUUID(childId); child)
+			children[count++] = child;
+	}
+	return children.first(count);
+}
+
 auto Scene::getWorldTransform(const Entity& iEntity) const -> math::Transform {
 	const auto handle = static_cast<entt::entity>(iEntity);
 	if (m_worldTransformCacheActive) {
-		if (const auto it = m_worldTransformCache.find(handle); it != m_worldTransformCache.end())
-			return it->second;
+		if (mp_transformHierarchy) {
+			if (const uint32_t index = mp_transformHierarchy->indexOf(handle);
+				index != TransformHierarchy::g_invalidIndex)
+				return mp_transformHierarchy->getWorldTransform(index);
+		}
+		if (const auto* cached = m_worldTransformCache.find(handle); cached != nullptr)
+			return *cached;
 	}
 	constexpr uint32_t maxDepth = 64;
 	const auto& localTransform = iEntity.getComponent<component::Transform>().transform;
@@ -2159,7 +2350,7 @@ auto Scene::getWorldTransform(const Entity& iEntity) const -> math::Transform {
 	};
 	const math::Transform result = compute();
 	if (m_worldTransformCacheActive)
-		m_worldTransformCache.emplace(handle, result);
+		m_worldTransformCache.set(handle, result);
 	return result;
 }
 
@@ -2171,61 +2362,18 @@ void Scene::prepareWorldTransforms() const {
 		mp_worldTransformPass->init();
 	}
 
-	m_entityToWorldIndex.clear();
-
-	thread_local std::vector<renderer::utils::WorldTransformPass::Entry> entries;
-	thread_local std::vector<math::mat4> cpuWorlds;
-	entries.clear();
-	cpuWorlds.clear();
-
-	// Pre-order traversal stack — children pushed in reverse so siblings are visited left-to-right.
-	thread_local std::vector<entt::entity> stack;
-	stack.clear();
-	for (const auto e: registry.view<component::Transform, component::Hierarchy>()) {
-		if (const auto& [parentId, childrenIds] = registry.get<component::Hierarchy>(e); parentId == core::UUID{0})
-			stack.push_back(e);
-	}
-
-	while (!stack.empty()) {
-		const entt::entity e = stack.back();
-		stack.pop_back();
-
-		const auto& localTransform = registry.get<component::Transform>(e).transform;
-		const auto& hierarchy = registry.get<component::Hierarchy>(e);
-
-		const math::mat4 localMat = localTransform();
-		int32_t parentIdx = -1;
-		math::mat4 worldMat = localMat;
-		if (hierarchy.parentId != core::UUID{0}) {
-			if (const Entity parentEnt = findEntityByUUID(hierarchy.parentId); parentEnt) {
-				const auto parentHandle = static_cast<entt::entity>(parentEnt);
-				if (const auto it = m_entityToWorldIndex.find(parentHandle); it != m_entityToWorldIndex.end()) {
-					parentIdx = static_cast<int32_t>(it->second);
-					worldMat = cpuWorlds[it->second] * localMat;
-				}
-			}
-		}
-
-		const auto slot = static_cast<uint32_t>(entries.size());
-		m_entityToWorldIndex.emplace(e, slot);
-		entries.push_back({.local = localMat, .parentIdx = parentIdx});
-		cpuWorlds.push_back(worldMat);
-		m_worldTransformCache.insert_or_assign(e, math::Transform{worldMat});
-
-		for (const auto& childId: hierarchy.childrenIds | std::views::reverse) {
-			if (const Entity childEnt = findEntityByUUID(childId); childEnt)
-				stack.push_back(static_cast<entt::entity>(childEnt));
-		}
-	}
-
-	mp_worldTransformPass->compute(entries);
+	if (!mp_transformHierarchy)
+		mp_transformHierarchy = mkUniq<TransformHierarchy>();
+	auto& hierarchy = *mp_transformHierarchy;
+	hierarchy.update(*this);
+	mp_worldTransformPass->compute(hierarchy.getLocalMatrices(), hierarchy.getParents(), hierarchy.getDirtyRanges(),
+								   hierarchy.isStructureChanged());
 }
 
 auto Scene::getWorldIndex(const Entity& iEntity) const -> uint32_t {
-	const auto handle = static_cast<entt::entity>(iEntity);
-	if (const auto it = m_entityToWorldIndex.find(handle); it != m_entityToWorldIndex.end())
-		return it->second;
-	return std::numeric_limits<uint32_t>::max();
+	if (!mp_transformHierarchy)
+		return std::numeric_limits<uint32_t>::max();
+	return mp_transformHierarchy->indexOf(static_cast<entt::entity>(iEntity));
 }
 
 auto Scene::getWorldsBuffer() const -> shared<renderer::gpu::StorageBuffer> {
@@ -2250,10 +2398,12 @@ auto Scene::wantsCursorCapture() const -> bool {
 
 auto Scene::isEffectivelyVisible(const Entity& iEntity, const bool iEditorMode) const -> bool {
 	const auto handle = static_cast<entt::entity>(iEntity);
-	const uint64_t key = (static_cast<uint64_t>(static_cast<uint32_t>(handle)) << 1) | (iEditorMode ? 1ULL : 0ULL);
+	// Two bits per mode in the cached mask: "known" then "visible".
+	const uint8_t knownBit = iEditorMode ? 0x4 : 0x1;
+	const auto visibleBit = static_cast<uint8_t>(knownBit << 1);
 	if (m_inUpdatePass) {
-		if (const auto it = m_visibilityCache.find(key); it != m_visibilityCache.end())
-			return it->second;
+		if (const auto* bits = m_visibilityCache.find(handle); bits != nullptr && (*bits & knownBit) != 0)
+			return (*bits & visibleBit) != 0;
 	}
 
 	constexpr uint32_t maxDepth = 64;
@@ -2281,7 +2431,7 @@ auto Scene::isEffectivelyVisible(const Entity& iEntity, const bool iEditorMode)
 	};
 	const bool result = compute();
 	if (m_inUpdatePass)
-		m_visibilityCache.emplace(key, result);
+		m_visibilityCache.fetch(handle) |= static_cast<uint8_t>(knownBit | (result ? visibleBit : 0));
 	return result;
 }
 
@@ -2366,8 +2516,6 @@ void Scene::destroyEntityWithChildren(Entity& ioEntity) {// NOLINT(misc-no-recur
 	for (const auto handle: toDestroy) {
 		if (m_primaryPlayerCache == handle)
 			m_primaryPlayerCache = entt::null;
-		if (const auto* idComp = registry.try_get<component::ID>(handle); idComp != nullptr)
-			m_uuidIndex.erase(idComp->id);
 		registry.destroy(handle);
 	}
 	ioEntity.m_entityHandle = entt::null;
@@ -10,6 +10,7 @@
 #include "core/external/yaml.h"
 #include "scene/TilemapAsset.h"
 
+#include <atomic>
 #include <charconv>
 #include <fstream>
 #include <sstream>
@@ -65,14 +66,51 @@ auto decodeTiles(const std::string& iEncoded, const size_t iExpected) -> std::ve
 	return out;
 }
 
+auto chunkCount(const uint32_t iCells) -> uint32_t {
+	return (iCells + TilemapAsset::g_chunkSize - 1) / TilemapAsset::g_chunkSize;
+}
+
 }// namespace
 
+auto TilemapAsset::nextRevision() -> uint64_t {
+	static std::atomic<uint64_t> counter{0};
+	return ++counter;
+}
+
+auto TilemapAsset::getChunkRevision(const uint32_t iLayer, const uint32_t iChunkX, const uint32_t iChunkY) const
+		-> uint64_t {
+	const uint32_t columns = chunkCount(width);
+	const size_t idx = (static_cast<size_t>(iLayer) * chunkCount(height) + iChunkY) * columns + iChunkX;
+	if (iChunkX >= columns || idx >= m_chunkRevisions.size())
+		return m_revision;
+	return std::max(m_revision, m_chunkRevisions[idx]);
+}
+
+void TilemapAsset::markCellDirty(const uint32_t iLayer, const uint32_t iX, const uint32_t iY) {
+	if (iLayer >= layers.size() || iX >= width || iY >= height)
+		return;
+	const uint32_t columns = chunkCount(width);
+	const size_t expected = layers.size() * chunkCount(height) * columns;
+	// First edit since the last layout change: chunks start at the asset revision.
+	if (m_chunkRevisions.size() != expected)
+		m_chunkRevisions.assign(expected, 0);
+	const size_t idx =
+			(static_cast<size_t>(iLayer) * chunkCount(height) + iY / g_chunkSize) * columns + iX / g_chunkSize;
+	m_chunkRevisions[idx] = nextRevision();
+}
+
+void TilemapAsset::markDirty() {
+	m_chunkRevisions.clear();
+	m_revision = nextRevision();
+}
+
 void TilemapAsset::resize(const uint32_t iWidth, const uint32_t iHeight) {
 	const uint32_t newWidth = std::max(1u, iWidth);
 	const uint32_t newHeight = std::max(1u, iHeight);
 	for (auto& layer: layers) resizeLayerStorage(layer.tiles, width, height, newWidth, newHeight);
 	width = newWidth;
 	height = newHeight;
+	markDirty();
 }
 
 auto TilemapAsset::addLayer(const std::string& iName) -> scene::component::TilemapLayer& {
@@ -81,6 +119,7 @@ auto TilemapAsset::addLayer(const std::string& iName) -> scene::component::Tilem
 	layer.visible = true;
 	layer.parallax = math::vec2{1.f, 1.f};
 	layer.tiles.assign(static_cast<size_t>(width) * height, k_Empty);
+	markDirty();
 	return layer;
 }
 
@@ -101,6 +140,7 @@ void TilemapAsset::setTile(const uint32_t iLayer, const uint32_t iX, const uint3
 	if (idx >= tiles.size())
 		tiles.resize(static_cast<size_t>(width) * height, k_Empty);
 	tiles[idx] = iValue;
+	markCellDirty(iLayer, iX, iY);
 }
 
 auto TilemapAsset::serializeToString(const std::string_view iName) const -> std::string {
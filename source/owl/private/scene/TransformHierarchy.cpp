@@ -0,0 +1,210 @@
+/**
+ * @file TransformHierarchy.cpp
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright (c) 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#include "owlpch.h"
+
+#include "TransformHierarchy.h"
+
+#include "scene/Entity.h"
+#include "scene/Scene.h"
+#include "scene/component/Hierarchy.h"
+#include "scene/component/Transform.h"
+
+namespace owl::scene {
+
+namespace {
+/// Same depth limit as `Scene::getWorldTransform`.
+constexpr int32_t k_maxDepth = 64;
+/// Depth marker: not computed yet.
+constexpr int32_t k_unknownDepth = -1;
+/// Depth marker: on the walk currently being resolved.
+constexpr int32_t k_visitingDepth = -2;
+/// Depth marker: part of a cycle, too deep, or below such a node.
+constexpr int32_t k_excludedDepth = -3;
+}// namespace
+
+void TransformHierarchy::clear() {
+	m_slots.clear();
+	m_trackedCount = 0;
+	m_localSnapshots.clear();
+	m_locals.clear();
+	m_parents.clear();
+	m_worlds.clear();
+	m_worldTransforms.clear();
+	m_dirty.clear();
+	m_dirtyRanges.clear();
+	m_structureChanged = false;
+	m_recomputed = 0;
+}
+
+auto TransformHierarchy::indexOf(const entt::entity iEntity) const -> uint32_t {
+	if (iEntity == entt::null)
+		return g_invalidIndex;
+	const auto slot = static_cast<size_t>(entt::to_entity(iEntity));
+	if (slot >= m_slots.size() || m_slots[slot].entity != iEntity)
+		return g_invalidIndex;
+	return m_slots[slot].node;
+}
+
+void TransformHierarchy::update(const Scene& iScene) {
+	OWL_PROFILE_FUNCTION()
+
+	m_dirtyRanges.clear();
+	m_recomputed = 0;
+	m_structureChanged = !refreshLocals(iScene);
+	if (m_structureChanged) {
+		rebuild(iScene);
+		return;
+	}
+	propagate();
+}
+
+auto TransformHierarchy::refreshLocals(const Scene& iScene) -> bool {
+	if (m_slots.empty())
+		return false;
+	std::ranges::fill(m_dirty, uint8_t{0});
+	size_t count = 0;
+	for (auto&& [entity, transform, hierarchy]:
+		 iScene.registry.view<component::Transform, component::Hierarchy>().each()) {
+		const auto slotIndex = static_cast<size_t>(entt::to_entity(entity));
+		if (slotIndex >= m_slots.size())
+			return false;
+		const auto& slot = m_slots[slotIndex];
+		if (slot.entity != entity || slot.parentId != hierarchy.parentId)
+			return false;
+		++count;
+		if (slot.node == g_invalidIndex || m_localSnapshots[slot.node] == transform.transform)
+			continue;
+		m_localSnapshots[slot.node] = transform.transform;
+		m_locals[slot.node] = transform.transform();
+		m_dirty[slot.node] = 1;
+	}
+	return count == m_trackedCount;
+}
+
+void TransformHierarchy::rebuild(const Scene& iScene) {
+	OWL_PROFILE_FUNCTION()
+
+	const auto view = iScene.registry.view<component::Transform, component::Hierarchy>();
+	std::vector<entt::entity> entities;
+	entities.reserve(view.size_hint());
+	size_t slotCount = 0;
+	for (const auto entity: view) {
+		entities.push_back(entity);
+		slotCount = std::max(slotCount, static_cast<size_t>(entt::to_entity(entity)) + 1);
+	}
+	m_slots.assign(slotCount, Slot{});
+	m_trackedCount = entities.size();
+	for (size_t i = 0; i < entities.size(); ++i) {
+		m_slots[static_cast<size_t>(entt::to_entity(entities[i]))] = {
+				.entity = entities[i],
+				.node = static_cast<uint32_t>(i),
+				.parentId = view.get<component::Hierarchy>(entities[i]).parentId};
+	}
+
+	// Resolve the parents once per rebuild (the only UUID lookups of the whole pass).
+	std::vector<int32_t> parentOf(entities.size(), -1);
+	for (size_t i = 0; i < entities.size(); ++i) {
+		const auto parentId = m_slots[static_cast<size_t>(entt::to_entity(entities[i]))].parentId;
+		if (parentId == core::UUID{0})
+			continue;
+		if (const Entity parent = iScene.findEntityByUUID(parentId); parent) {
+			if (const uint32_t index = indexOf(static_cast<entt::entity>(parent)); index != g_invalidIndex)
+				parentOf[i] = static_cast<int32_t>(index);
+		}
+	}
+
+	// Depth of every entity, walking up until a known depth; cycles and over-deep chains are excluded.
+	std::vector<int32_t> depth(entities.size(), k_unknownDepth);
+	std::vector<int32_t> walk;
+	bool truncated = false;
+	for (size_t i = 0; i < entities.size(); ++i) {
+		auto current = static_cast<int32_t>(i);
+		while (current >= 0 && depth[static_cast<size_t>(current)] == k_unknownDepth) {
+			depth[static_cast<size_t>(current)] = k_visitingDepth;
+			walk.push_back(current);
+			current = parentOf[static_cast<size_t>(current)];
+		}
+		int32_t base = current < 0 ? -1 : depth[static_cast<size_t>(current)];
+		if (base == k_visitingDepth ||
+			(base != k_excludedDepth && base + static_cast<int32_t>(walk.size()) >= k_maxDepth)) {
+			truncated = true;
+			base = k_excludedDepth;
+		}
+		while (!walk.empty()) {
+			const auto node = static_cast<size_t>(walk.back());
+			walk.pop_back();
+			if (base != k_excludedDepth)
+				++base;
+			depth[node] = base;
+		}
+	}
+	if (truncated)
+		OWL_CORE_WARN("TransformHierarchy: depth limit reached, possible circular hierarchy.")
+
+	// Counting sort by depth keeps the view order among siblings of the same level.
+	std::vector<uint32_t> levelStart(static_cast<size_t>(k_maxDepth) + 1, 0);
+	for (const int32_t d: depth) {
+		if (d >= 0)
+			++levelStart[static_cast<size_t>(d) + 1];
+	}
+	for (size_t d = 1; d < levelStart.size(); ++d) levelStart[d] += levelStart[d - 1];
+	const size_t nodeCount = levelStart.back();
+	std::vector<uint32_t> nodeOf(entities.size(), g_invalidIndex);
+	for (size_t i = 0; i < entities.size(); ++i) {
+		if (depth[i] >= 0)
+			nodeOf[i] = levelStart[static_cast<size_t>(depth[i])]++;
+	}
+
+	m_localSnapshots.resize(nodeCount);
+	m_locals.resize(nodeCount);
+	m_parents.resize(nodeCount);
+	m_worlds.resize(nodeCount);
+	m_worldTransforms.resize(nodeCount);
+	m_dirty.assign(nodeCount, 1);
+	for (size_t i = 0; i < entities.size(); ++i) {
+		auto& slot = m_slots[static_cast<size_t>(entt::to_entity(entities[i]))];
+		slot.node = nodeOf[i];
+		if (slot.node == g_invalidIndex)
+			continue;
+		const auto& local = view.get<component::Transform>(entities[i]).transform;
+		m_localSnapshots[slot.node] = local;
+		m_locals[slot.node] = local();
+		m_parents[slot.node] =
+				parentOf[i] < 0 ? -1 : static_cast<int32_t>(nodeOf[static_cast<size_t>(parentOf[i])]);
+	}
+	propagate();
+}
+
+void TransformHierarchy::propagate() {
+	const auto count = static_cast<uint32_t>(m_locals.size());
+	for (uint32_t i = 0; i < count; ++i) {
+		const int32_t parent = m_parents[i];
+		const bool localDirty = m_dirty[i] != 0;
+		if (localDirty && !m_structureChanged) {
+			if (!m_dirtyRanges.empty() && m_dirtyRanges.back().first + m_dirtyRanges.back().count == i)
+				++m_dirtyRanges.back().count;
+			else
+				m_dirtyRanges.push_back({.first = i, .count = 1});
+		}
+		// Parents come first, so their flag already includes their own ancestors.
+		if (!localDirty && (parent < 0 || m_dirty[static_cast<size_t>(parent)] == 0))
+			continue;
+		m_dirty[i] = 1;
+		if (parent < 0) {
+			m_worlds[i] = m_locals[i];
+			m_worldTransforms[i] = m_localSnapshots[i];
+		} else {
+			m_worlds[i] = m_worlds[static_cast<size_t>(parent)] * m_locals[i];
+			m_worldTransforms[i] = math::Transform{m_worlds[i]};
+		}
+		++m_recomputed;
+	}
+}
+
+}// namespace owl::scene
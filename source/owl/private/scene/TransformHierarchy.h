@@ -0,0 +1,186 @@
+/**
+ * @file TransformHierarchy.h
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright (c) 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+
+#include "core/UUID.h"
+#include "math/Transform.h"
+#include "math/matrices.h"
+#include "renderer/utils/WorldTransformPass.h"
+
+#include <entt/entt.hpp>
+#include <span>
+#include <vector>
+
+namespace owl::scene {
+
+class Scene;
+
+/**
+ * @brief
+ *  Flattened, depth-sorted scene graph used to compute world transforms.
+ *
+ * Every entity with a `Transform` and a `Hierarchy` becomes a node; nodes are
+ * stored by increasing depth together with the index of their parent, so one
+ * forward sweep computes all world matrices and the arrays satisfy the
+ * `parent < own index` contract of `renderer::utils::WorldTransformPass`.
+ *
+ * The flattening is rebuilt only when the structure changes (entity added or
+ * removed, `Hierarchy::parentId` rewritten). Otherwise `update()` compares each
+ * local transform with the snapshot of the previous update — the component is
+ * written through plain references by scripts, physics and the editor, so a
+ * change is detected rather than flagged — and recomputes only the subtrees
+ * below the changed nodes.
+ *
+ * Entities caught in a parent cycle (or deeper than 64 levels) get no node.
+ */
+class TransformHierarchy final {
+public:
+	/// Index returned for entities without a node.
+	static constexpr uint32_t g_invalidIndex = std::numeric_limits<uint32_t>::max();
+
+	/// Range of nodes whose local matrix changed during the last update.
+	using DirtyRange = renderer::utils::WorldTransformPass::Range;
+
+	/**
+	 * @brief
+	 *  Bring the flattening and the world matrices up to date with the scene.
+	 * @param[in] iScene The scene to mirror.
+	 */
+	void update(const Scene& iScene);
+
+	/**
+	 * @brief
+	 *  Drop every node.
+	 */
+	void clear();
+
+	/**
+	 * @brief
+	 *  Node index of an entity.
+	 * @param[in] iEntity The entity handle.
+	 * @return The node index or `g_invalidIndex` if the entity has no node in the last update.
+	 */
+	[[nodiscard]] auto indexOf(entt::entity iEntity) const -> uint32_t;
+
+	/**
+	 * @brief
+	 *  Number of nodes.
+	 * @return The node count.
+	 */
+	[[nodiscard]] auto size() const -> uint32_t { return static_cast<uint32_t>(m_locals.size()); }
+
+	/**
+	 * @brief
+	 *  World matrix of a node.
+	 * @param[in] iIndex The node index.
+	 * @return The world matrix.
+	 */
+	[[nodiscard]] auto getWorldMatrix(const uint32_t iIndex) const -> const math::mat4& { return m_worlds[iIndex]; }
+
+	/**
+	 * @brief
+	 *  World transformation of a node.
+	 * @param[in] iIndex The node index.
+	 * @return The world transformation.
+	 */
+	[[nodiscard]] auto getWorldTransform(const uint32_t iIndex) const -> const math::Transform& {
+		return m_worldTransforms[iIndex];
+	}
+
+	/**
+	 * @brief
+	 *  Local matrices of all nodes.
+	 * @return The local matrices, in node order.
+	 */
+	[[nodiscard]] auto getLocalMatrices() const -> std::span<const math::mat4> { return m_locals; }
+
+	/**
+	 * @brief
+	 *  Parent index of all nodes (-1 for roots).
+	 * @return The parent indices, in node order.
+	 */
+	[[nodiscard]] auto getParents() const -> std::span<const int32_t> { return m_parents; }
+
+	/**
+	 * @brief
+	 *  Nodes whose local matrix changed in the last update (empty after a rebuild).
+	 * @return The changed ranges.
+	 */
+	[[nodiscard]] auto getDirtyRanges() const -> std::span<const DirtyRange> { return m_dirtyRanges; }
+
+	/**
+	 * @brief
+	 *  Check if the last update rebuilt the flattening.
+	 * @return True if the structure changed.
+	 */
+	[[nodiscard]] auto isStructureChanged() const -> bool { return m_structureChanged; }
+
+	/**
+	 * @brief
+	 *  Number of world matrices computed by the last update.
+	 * @return The recomputed count.
+	 */
+	[[nodiscard]] auto getRecomputedCount() const -> uint32_t { return m_recomputed; }
+
+private:
+	/**
+	 * @brief
+	 *  Check the nodes against the scene and snapshot the changed local transforms.
+	 * @param[in] iScene The scene.
+	 * @return False if the structure changed and a rebuild is needed.
+	 */
+	auto refreshLocals(const Scene& iScene) -> bool;
+
+	/**
+	 * @brief
+	 *  Flatten the whole scene graph again.
+	 * @param[in] iScene The scene.
+	 */
+	void rebuild(const Scene& iScene);
+
+	/**
+	 * @brief
+	 *  Recompute the world matrices of the dirty nodes and their descendants.
+	 */
+	void propagate();
+
+	/// Per-entity slot, indexed by the entity index part of the handle.
+	struct Slot {
+		/// Full handle, to reject recycled entities.
+		entt::entity entity = entt::null;
+		/// Node index or `g_invalidIndex` for an entity without node.
+		uint32_t node = g_invalidIndex;
+		/// Parent UUID at the last rebuild.
+		core::UUID parentId{0};
+	};
+	/// Entity slots.
+	std::vector<Slot> m_slots;
+	/// Number of entities mirrored by the slots (with or without node).
+	size_t m_trackedCount = 0;
+	/// Local transformations at the last update, in node order.
+	std::vector<math::Transform> m_localSnapshots;
+	/// Local matrices, in node order.
+	std::vector<math::mat4> m_locals;
+	/// Parent node indices, in node order.
+	std::vector<int32_t> m_parents;
+	/// World matrices, in node order.
+	std::vector<math::mat4> m_worlds;
+	/// World transformations, in node order.
+	std::vector<math::Transform> m_worldTransforms;
+	/// Dirty flag of each node during `propagate()`.
+	std::vector<uint8_t> m_dirty;
+	/// Changed local matrices of the last update.
+	std::vector<DirtyRange> m_dirtyRanges;
+	/// True if the last update rebuilt the flattening.
+	bool m_structureChanged = false;
+	/// World matrices computed by the last update.
+	uint32_t m_recomputed = 0;
+};
+
+}// namespace owl::scene
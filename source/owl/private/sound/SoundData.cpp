@@ -9,6 +9,7 @@
 
 #include "sound/SoundData.h"
 
+#include "app/Application.h"
 #include "null/SoundData.h"
 #include "openal/SoundData.h"
 #include "sound/SoundSystem.h"
@@ -32,8 +33,39 @@ auto SoundData::create(const Specification& iSpec) -> shared<SoundData> {
 	return nullptr;
 }
 
+auto SoundData::createAsync(const Specification& iSpec, core::task::Scheduler& ioScheduler) -> shared<SoundData> {
+	switch (SoundCommand::getApi()) {
+		case SoundAPI::Type::Null:
+			return mkShared<null::SoundData>(iSpec);
+		case SoundAPI::Type::OpenAl:
+			return openal::SoundData::createAsync(iSpec, ioScheduler);
+	}
+	OWL_CORE_ERROR("Unknown Sound API Type!")
+	return nullptr;
+}
+
 auto SoundData::create(const std::filesystem::path& iPath) -> shared<SoundData> {
 	return create(Specification{.file = iPath});
 }
 
+auto SoundData::packSpecification(const std::string& iName) -> std::optional<Specification> {
+	if (iName.empty() || !app::Application::instanced() || !app::Application::get().hasOpenPack())
+		return std::nullopt;
+	const auto& app = app::Application::get();
+	const std::filesystem::path name(iName);
+	std::vector<std::filesystem::path> candidates;
+	for (const auto& base: {name, std::filesystem::path("sounds") / name}) {
+		if (name.has_extension()) {
+			candidates.push_back(base);
+			continue;
+		}
+		for (const auto& ext: extension()) candidates.push_back(std::filesystem::path(base.string() + ext));
+	}
+	for (const auto& candidate: candidates) {
+		if (const std::string entry = candidate.generic_string(); app.packContains(entry))
+			return Specification{.file = candidate, .packEntry = entry};
+	}
+	return std::nullopt;
+}
+
 }// namespace owl::sound
@@ -63,4 +63,18 @@ void SoundHelper::stopEntitySound(const scene::Entity& iEntity) {
 	}
 }
 
+auto SoundHelper::prefetchSceneSounds(const scene::Scene& iScene) -> size_t {
+	OWL_PROFILE_FUNCTION()
+
+	std::vector<std::string> names;
+	for (const auto view = iScene.registry.view<scene::component::SoundSource>(); const auto entity: view) {
+		if (const auto& [soundComp] = view.get<scene::component::SoundSource>(entity); !soundComp.soundAsset.empty())
+			names.push_back(soundComp.soundAsset);
+	}
+	std::ranges::sort(names);
+	const auto [first, last] = std::ranges::unique(names);
+	names.erase(first, last);
+	return SoundSystem::prefetch(names);
+}
+
 }// namespace owl::sound
@@ -29,6 +29,38 @@ void SoundSystem::init() {
 	m_internalState = State::Running;
 }
 
+auto SoundSystem::prefetch(const std::span<const std::string> iNames) -> size_t {
+	OWL_PROFILE_FUNCTION()
+
+	auto* scheduler = app::Application::instanced() ? &app::Application::get().getTaskScheduler() : nullptr;
+	size_t count = 0;
+	for (const auto& name: iNames) {
+		if (name.empty() || m_soundLibrary->exists(name))
+			continue;
+		if (scheduler == nullptr) {
+			if (m_soundLibrary->load(name) != nullptr)
+				++count;
+			continue;
+		}
+		// Only the lookup happens here, the decoding goes to the workers.
+		auto spec = SoundData::packSpecification(name);
+		if (!spec.has_value()) {
+			if (const auto file = m_soundLibrary->find(name); file.has_value())
+				spec = SoundData::Specification{.file = file.value()};
+		}
+		if (!spec.has_value()) {
+			OWL_CORE_WARN("SoundSystem::prefetch({}) does not exist in asset folders!", name)
+			continue;
+		}
+		auto data = SoundData::createAsync(spec.value(), *scheduler);
+		if (data == nullptr)
+			continue;
+		m_soundLibrary->add(name, data);
+		++count;
+	}
+	return count;
+}
+
 void SoundSystem::shutdown() {
 	reset();
 	m_internalState = State::Stopped;
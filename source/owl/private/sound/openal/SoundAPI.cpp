@@ -8,6 +8,7 @@
 #include "owlpch.h"
 
 #include "SoundAPI.h"
+#include "SoundData.h"
 
 #include "core/external/openal.h"
 #include <debug/Profiler.h>
@@ -29,6 +30,24 @@ struct OpenAlAPI {
 
 namespace {
 internal::OpenAlAPI g_Device;
+/// Time between two refills of the streams, well below the duration of the queued samples.
+constexpr std::chrono::milliseconds g_streamPeriod{50};
+
+/**
+ * @brief
+ *  Predicate matching the deferred play of a handle.
+ */
+struct IsPlayOf {
+	/// The sound handle.
+	SoundHandle handle;
+	/**
+	 * @brief
+	 *  Check a deferred play.
+	 * @param[in] iPlay The deferred play.
+	 * @return True if it plays the handle.
+	 */
+	auto operator()(const auto& iPlay) const -> bool { return iPlay.handle == handle; }
+};
 }// namespace
 
 void SoundAPI::init() {
@@ -79,6 +98,8 @@ void SoundAPI::init() {
 SoundAPI::~SoundAPI() {
 	OWL_PROFILE_FUNCTION()
 
+	m_deferredPlays.clear();
+	stopStreaming();
 	// Stop and delete all active sources
 	for (auto& source: m_handleToSource | std::views::values) {
 		alSourceStop(source);
@@ -97,16 +118,19 @@ SoundAPI::~SoundAPI() {
 	setState(State::Created);
 }
 
-void SoundAPI::playSound(const shared<SoundData>& iData) { play(iData, PlayParams{}); }
+void SoundAPI::playSound(const shared<sound::SoundData>& iData) { play(iData, PlayParams{}); }
 
-auto SoundAPI::play(const shared<SoundData>& iData, const PlayParams& iParams) -> SoundHandle {
+auto SoundAPI::play(const shared<sound::SoundData>& iData, const PlayParams& iParams) -> SoundHandle {
 	OWL_PROFILE_FUNCTION()
 
 	if (iData == nullptr) {
 		OWL_CORE_WARN("SoundAPI(OpenAL)::play: SoundData is null.")
 		return invalidSoundHandle;
 	}
-	const auto bufferId = static_cast<uint32_t>(iData->getSystemId());
+	if (iData->getLoadState() == LoadState::Failed) {
+		OWL_CORE_WARN("SoundAPI(OpenAL)::play: {} failed to load.", iData->getSpecification().file.string())
+		return invalidSoundHandle;
+	}
 	uint32_t source = 0;
 	alGenSources(1, &source);
 	if (const ALenum err = alGetError(); err != AL_NO_ERROR) {
@@ -114,10 +138,8 @@ auto SoundAPI::play(const shared<SoundData>& iData, const PlayParams& iParams) -
 		return invalidSoundHandle;
 	}
 
-	alSourcei(source, AL_BUFFER, static_cast<ALint>(bufferId));
 	alSourcef(source, AL_GAIN, iParams.volume);
 	alSourcef(source, AL_PITCH, iParams.pitch);
-	alSourcei(source, AL_LOOPING, iParams.loop ? AL_TRUE : AL_FALSE);
 
 	if (iParams.spatial) {
 		alSourcei(source, AL_SOURCE_RELATIVE, AL_FALSE);
@@ -131,15 +153,58 @@ auto SoundAPI::play(const shared<SoundData>& iData, const PlayParams& iParams) -
 		alSource3f(source, AL_POSITION, 0.0f, 0.0f, 0.0f);
 	}
 
-	alSourcePlay(source);
-
 	const SoundHandle handle = m_nextHandle++;
 	m_handleToSource[handle] = source;
+	if (iData->getLoadState() == LoadState::Pending) {
+		// The source waits with its parameters; frame() starts it once the samples are uploaded.
+		m_deferredPlays.push_back({.handle = handle, .data = iData, .loop = iParams.loop});
+		return handle;
+	}
+	if (!start(handle, *iData, iParams.loop)) {
+		alDeleteSources(1, &source);
+		m_handleToSource.erase(handle);
+		return invalidSoundHandle;
+	}
 	return handle;
 }
 
+auto SoundAPI::start(const SoundHandle iHandle, const sound::SoundData& iData, const bool iLoop) -> bool {
+	const uint32_t source = m_handleToSource.at(iHandle);
+	if (!iData.isStreaming()) {
+		alSourcei(source, AL_BUFFER, static_cast<ALint>(iData.getSystemId()));
+		alSourcei(source, AL_LOOPING, iLoop ? AL_TRUE : AL_FALSE);
+		alSourcePlay(source);
+		return true;
+	}
+	auto decoder = static_cast<const openal::SoundData&>(iData).openStream();
+	if (decoder == nullptr) {
+		OWL_CORE_WARN("SoundAPI(OpenAL)::play: Unable to stream {}.", iData.getSpecification().file.string())
+		return false;
+	}
+	// The first chunks are decoded here so the source starts right away; the streaming thread does the rest.
+	auto stream = mkUniq<SoundStream>(std::move(decoder), source, iLoop);
+	if (!stream->prime()) {
+		OWL_CORE_WARN("SoundAPI(OpenAL)::play: Nothing to stream from {}.", iData.getSpecification().file.string())
+		return false;
+	}
+	alSourcei(source, AL_LOOPING, AL_FALSE);
+	alSourcePlay(source);
+	const std::scoped_lock lock(m_streamMutex);
+	m_streams.emplace(iHandle, std::move(stream));
+	if (!m_streamThread.joinable()) {
+		m_streamStop = false;
+		m_streamThread = std::thread([this] -> void { streamLoop(); });
+	}
+	return true;
+}
+
 void SoundAPI::stop(const SoundHandle iHandle) {
 	if (const auto it = m_handleToSource.find(iHandle); it != m_handleToSource.end()) {
+		std::erase_if(m_deferredPlays, IsPlayOf{iHandle});
+		{
+			const std::scoped_lock lock(m_streamMutex);
+			m_streams.erase(iHandle);
+		}
 		alSourceStop(it->second);
 		alDeleteSources(1, &it->second);
 		m_handleToSource.erase(it);
@@ -147,11 +212,20 @@ void SoundAPI::stop(const SoundHandle iHandle) {
 }
 
 void SoundAPI::pause(const SoundHandle iHandle) {
+	if (auto* deferred = findDeferred(iHandle); deferred != nullptr) {
+		deferred->paused = true;
+		return;
+	}
 	if (const auto it = m_handleToSource.find(iHandle); it != m_handleToSource.end())
 		alSourcePause(it->second);
 }
 
 void SoundAPI::resume(const SoundHandle iHandle) {
+	if (auto* deferred = findDeferred(iHandle); deferred != nullptr) {
+		// Playing a source without samples would stop it for good.
+		deferred->paused = false;
+		return;
+	}
 	if (const auto it = m_handleToSource.find(iHandle); it != m_handleToSource.end())
 		alSourcePlay(it->second);
 }
@@ -167,8 +241,21 @@ void SoundAPI::setPitch(const SoundHandle iHandle, const float iPitch) {
 }
 
 void SoundAPI::setLoop(const SoundHandle iHandle, const bool iLoop) {
-	if (const auto it = m_handleToSource.find(iHandle); it != m_handleToSource.end())
-		alSourcei(it->second, AL_LOOPING, iLoop ? AL_TRUE : AL_FALSE);
+	const auto it = m_handleToSource.find(iHandle);
+	if (it == m_handleToSource.end())
+		return;
+	if (auto* deferred = findDeferred(iHandle); deferred != nullptr) {
+		deferred->loop = iLoop;
+		return;
+	}
+	{
+		const std::scoped_lock lock(m_streamMutex);
+		if (const auto stream = m_streams.find(iHandle); stream != m_streams.end()) {
+			stream->second->setLoop(iLoop);
+			return;
+		}
+	}
+	alSourcei(it->second, AL_LOOPING, iLoop ? AL_TRUE : AL_FALSE);
 }
 
 void SoundAPI::setPosition(const SoundHandle iHandle, const math::vec3f& iPosition) {
@@ -193,6 +280,11 @@ void SoundAPI::setListenerOrientation(const math::vec3f& iForward, const math::v
 void SoundAPI::setListenerGain(const float iGain) { alListenerf(AL_GAIN, iGain); }
 
 void SoundAPI::stopAll() {
+	m_deferredPlays.clear();
+	{
+		const std::scoped_lock lock(m_streamMutex);
+		m_streams.clear();
+	}
 	for (auto& [handle, source]: m_handleToSource) {
 		alSourceStop(source);
 		alDeleteSources(1, &source);
@@ -212,12 +304,37 @@ auto SoundAPI::isPlaying(const SoundHandle iHandle) const -> bool {
 void SoundAPI::frame(const core::Timestep&) {
 	OWL_PROFILE_FUNCTION()
 
+	// Start the sources whose sound finished loading.
+	std::erase_if(m_deferredPlays, [this](const DeferredPlay& iPlay) -> bool {
+		const auto state = iPlay.data->getLoadState();
+		if (state == LoadState::Pending)
+			return false;
+		if (state == LoadState::Ready && start(iPlay.handle, *iPlay.data, iPlay.loop)) {
+			if (iPlay.paused)
+				alSourcePause(m_handleToSource.at(iPlay.handle));
+			return true;
+		}
+		if (const auto it = m_handleToSource.find(iPlay.handle); it != m_handleToSource.end()) {
+			alDeleteSources(1, &it->second);
+			m_handleToSource.erase(it);
+		}
+		return true;
+	});
+
 	std::vector<SoundHandle> toRemove;
+	const std::scoped_lock lock(m_streamMutex);
 	for (const auto& [handle, source]: m_handleToSource) {
 		ALint state = 0;
 		alGetSourcei(source, AL_SOURCE_STATE, &state);
-		if (state == AL_STOPPED)
-			toRemove.push_back(handle);
+		if (state != AL_STOPPED)
+			continue;
+		// A stream source also stops when starved: it is only over once the whole sound was queued.
+		if (const auto stream = m_streams.find(handle); stream != m_streams.end()) {
+			if (!stream->second->isExhausted())
+				continue;
+			m_streams.erase(stream);
+		}
+		toRemove.push_back(handle);
 	}
 	for (const auto handle: toRemove) {
 		if (const auto it = m_handleToSource.find(handle); it != m_handleToSource.end()) {
@@ -227,5 +344,29 @@ void SoundAPI::frame(const core::Timestep&) {
 	}
 }
 
+auto SoundAPI::findDeferred(const SoundHandle iHandle) -> DeferredPlay* {
+	const auto it = std::ranges::find_if(m_deferredPlays, IsPlayOf{iHandle});
+	return it == m_deferredPlays.end() ? nullptr : &*it;
+}
+
+void SoundAPI::streamLoop() {
+	std::unique_lock lock(m_streamMutex);
+	while (!m_streamStop) {
+		for (const auto& stream: m_streams | std::views::values) stream->update();
+		m_streamWake.wait_for(lock, g_streamPeriod, [this] -> bool { return m_streamStop; });
+	}
+}
+
+void SoundAPI::stopStreaming() {
+	{
+		const std::scoped_lock lock(m_streamMutex);
+		m_streamStop = true;
+	}
+	m_streamWake.notify_all();
+	if (m_streamThread.joinable())
+		m_streamThread.join();
+	m_streams.clear();
+}
+
 
 }// namespace owl::sound::openal
@@ -8,8 +8,12 @@
 
 #pragma once
 
+#include "SoundStream.h"
 #include "sound/SoundAPI.h"
 
+#include <condition_variable>
+#include <mutex>
+#include <thread>
 #include <unordered_map>
 
 /**
@@ -20,6 +24,11 @@ namespace owl::sound::openal {
 /**
  * @brief
  *  Specialized class for OpenAl sound API.
+ *
+ * Streamed sounds get a SoundStream per source, refilled by a background thread
+ * started with the first of them. The stream map is shared with that thread and
+ * only accessed under its mutex. Sounds still loading asynchronously can be
+ * played: their source is created at once and started by `frame()` when ready.
  */
 class OWL_API SoundAPI final : public sound::SoundAPI {
 public:
@@ -106,10 +115,62 @@ public:
 	void frame(const core::Timestep& iTs) override;
 
 private:
+	/**
+	 * @brief
+	 *  A play requested while its sound was still loading.
+	 */
+	struct DeferredPlay {
+		/// Handle of the waiting source.
+		SoundHandle handle = invalidSoundHandle;
+		/// The loading sound.
+		shared<sound::SoundData> data;
+		/// Loop playback.
+		bool loop = false;
+		/// Paused before it could start.
+		bool paused = false;
+	};
+	/**
+	 * @brief
+	 *  Attach the samples of a loaded sound to a handle's source and play it.
+	 * @param[in] iHandle The handle.
+	 * @param[in] iData The sound.
+	 * @param[in] iLoop Loop playback.
+	 * @return False if the sound cannot be played.
+	 */
+	auto start(SoundHandle iHandle, const sound::SoundData& iData, bool iLoop) -> bool;
+	/**
+	 * @brief
+	 *  Look for a play waiting for its sound.
+	 * @param[in] iHandle The handle.
+	 * @return The deferred play or nullptr.
+	 */
+	auto findDeferred(SoundHandle iHandle) -> DeferredPlay*;
+	/**
+	 * @brief
+	 *  Body of the streaming thread: refill the streams until asked to stop.
+	 */
+	void streamLoop();
+	/**
+	 * @brief
+	 *  Stop the streaming thread and drop the streams.
+	 */
+	void stopStreaming();
 	/// Mapping from SoundHandle to OpenAL source ID.
 	std::unordered_map<SoundHandle, uint32_t> m_handleToSource;
 	/// Next handle counter.
 	SoundHandle m_nextHandle = 1;
+	/// Plays waiting for their sound to load.
+	std::vector<DeferredPlay> m_deferredPlays;
+	/// Streams of the sources playing streamed sounds.
+	std::unordered_map<SoundHandle, uniq<SoundStream>> m_streams;
+	/// Protects the streams.
+	mutable std::mutex m_streamMutex;
+	/// Wakes the streaming thread up to stop.
+	std::condition_variable m_streamWake;
+	/// Refills the streams.
+	std::thread m_streamThread;
+	/// Asks the streaming thread to stop.
+	bool m_streamStop = false;
 };
 
 }// namespace owl::sound::openal
@@ -8,12 +8,17 @@
 
 #pragma once
 
+#include "SoundDecoder.h"
 #include "sound/SoundData.h"
 
 namespace owl::sound::openal {
 /**
  * @brief
  *  Class representing what's required for playing sound.
+ *
+ * Short sounds are decoded once into an OpenAL buffer shared by all their sources.
+ * Streamed sounds only keep their format: each playing source gets its own
+ * decoder from `openStream()`, refilled by the sound API's streaming thread.
  */
 class OWL_API SoundData final : public sound::SoundData {
 public:
@@ -21,8 +26,9 @@ public:
 	 * @brief
 	 *  Default constructor.
 	 * @param[in] iSpecifications The specifications.
+	 * @param[in] iDeferred If true, nothing is decoded: the sound stays pending until `upload()`.
 	 */
-	explicit SoundData(const Specification& iSpecifications);
+	explicit SoundData(const Specification& iSpecifications, bool iDeferred = false);
 
 	/**
 	 * @brief
@@ -61,9 +67,80 @@ public:
 	 */
 	[[nodiscard]] auto getSystemId() const -> uint64_t override { return m_buffer; }
 
+	/**
+	 * @brief
+	 *  Check if the sound is decoded while playing.
+	 * @return True for a streamed sound.
+	 */
+	[[nodiscard]] auto isStreaming() const -> bool override { return m_streaming; }
+
+	/**
+	 * @brief
+	 *  Open a new decoder on the sound, for one streaming source.
+	 * @return The decoder, or nullptr if the sound cannot be decoded.
+	 */
+	[[nodiscard]] auto openStream() const -> uniq<SoundDecoder>;
+
+	/**
+	 * @brief
+	 *  Open a decoder on a sound, from the asset pack or from its file.
+	 * @param[in] iSpecifications The sound specifications.
+	 * @param[out] oDecoder The decoder to open.
+	 * @return True if the decoder is ready.
+	 */
+	static auto openDecoder(const Specification& iSpecifications, SoundDecoder& oDecoder) -> bool;
+
+	/**
+	 * @brief
+	 *  Samples decoded off the main thread, waiting for their upload.
+	 */
+	struct Decoded {
+		/// The whole decoded sound (empty for streamed sounds).
+		std::vector<char> samples;
+		/// OpenAL format.
+		int32_t format = 0;
+		/// Readable name of the format.
+		std::string formatName;
+		/// Sample rate in Hz.
+		int32_t sampleRate = 0;
+		/// Frames per block.
+		int32_t blockAlign = 1;
+		/// If the sound is to be streamed.
+		bool streaming = false;
+		/// If the sound could be decoded.
+		bool valid = false;
+	};
+
+	/**
+	 * @brief
+	 *  Decode a sound without creating any OpenAL object: safe on a worker thread.
+	 * @param[in] iSpecifications The sound specifications.
+	 * @return The decoded sound.
+	 */
+	static auto decode(const Specification& iSpecifications) -> Decoded;
+
+	/**
+	 * @brief
+	 *  Hand decoded samples to OpenAL and update the load state (main thread).
+	 * @param[in,out] ioDecoded The decoded sound, its samples are released.
+	 */
+	void upload(Decoded& ioDecoded);
+
+	/**
+	 * @brief
+	 *  Create a pending sound decoded on a scheduler worker and uploaded in the task termination.
+	 * @param[in] iSpecifications The specifications.
+	 * @param[in,out] ioScheduler The scheduler.
+	 * @return The pending sound.
+	 */
+	static auto createAsync(const Specification& iSpecifications, core::task::Scheduler& ioScheduler)
+			-> shared<SoundData>;
+
 private:
-	/// OpenAL buffer object name holding the decoded PCM samples.
-	uint32_t m_buffer;
+	/// OpenAL buffer object name holding the decoded PCM samples (0 for streamed sounds).
+	uint32_t m_buffer = 0;
+	/// If the sound is streamed.
+	bool m_streaming = false;
 };
 
 }// namespace owl::sound::openal
@@ -0,0 +1,379 @@
+/**
+ * @file SoundDecoder.cpp
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright (c) 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "owlpch.h"
+
+#include "SoundDecoder.h"
+#include "core/external/openal.h"
+#include <sndfile.h>
+
+namespace owl::sound::openal {
+
+enum struct SoundDataType : uint8_t {
+	Unsupported,
+	Float,
+	Int16,
+	Ima4,
+	MsAdpcm,
+};
+
+namespace {
+/// Bytes of a pack entry fetched at once, aligned on the default pack frames so each frame is decoded once.
+constexpr uint64_t g_packWindow = data::assets::pack::g_packFrameSize;
+
+auto sfFormatConvert(const int iSfFormat) -> SoundDataType {
+	switch (iSfFormat & SF_FORMAT_SUBMASK) {
+		case SF_FORMAT_PCM_24:
+		case SF_FORMAT_PCM_32:
+		case SF_FORMAT_FLOAT:
+		case SF_FORMAT_DOUBLE:
+		case SF_FORMAT_VORBIS:
+		case SF_FORMAT_OPUS:
+		case SF_FORMAT_ALAC_20:
+		case SF_FORMAT_ALAC_24:
+		case SF_FORMAT_ALAC_32:
+		case 0x0080 /*SF_FORMAT_MPEG_LAYER_I*/:
+		case 0x0081 /*SF_FORMAT_MPEG_LAYER_II*/:
+		case 0x0082 /*SF_FORMAT_MPEG_LAYER_III*/:
+			if (alIsExtensionPresent("AL_EXT_FLOAT32") == AL_TRUE)
+				return SoundDataType::Float;
+			return SoundDataType::Unsupported;
+		case SF_FORMAT_IMA_ADPCM:
+			if ((iSfFormat & SF_FORMAT_TYPEMASK) == SF_FORMAT_WAV && alIsExtensionPresent("AL_EXT_IMA4") == AL_TRUE &&
+				alIsExtensionPresent("AL_SOFT_block_alignment") == AL_TRUE)
+				return SoundDataType::Ima4;
+			return SoundDataType::Unsupported;
+		case SF_FORMAT_MS_ADPCM:
+			if ((iSfFormat & SF_FORMAT_TYPEMASK) == SF_FORMAT_WAV &&
+				alIsExtensionPresent("AL_SOFT_MSADPCM") == AL_TRUE &&
+				alIsExtensionPresent("AL_SOFT_block_alignment") == AL_TRUE)
+				return SoundDataType::MsAdpcm;
+			return SoundDataType::Unsupported;
+		default:
+			return SoundDataType::Int16;
+	}
+}
+
+auto alFormatName(const ALenum iFormat) -> std::string {
+	switch (iFormat) {
+		case AL_FORMAT_MONO8:
+			return "mono8";
+		case AL_FORMAT_MONO16:
+			return "mono16";
+		case AL_FORMAT_STEREO8:
+			return "stereo8";
+		case AL_FORMAT_STEREO16:
+			return "stereo16";
+		case AL_FORMAT_MONO_FLOAT32:
+			return "monoFloat32";
+		case AL_FORMAT_STEREO_FLOAT32:
+			return "stereoFloat32";
+		case AL_FORMAT_MONO_IMA4:
+			return "monoIma4";
+		case AL_FORMAT_STEREO_IMA4:
+			return "stereoIma4";
+		case AL_FORMAT_MONO_MSADPCM_SOFT:
+			return "monoMSADPCM";
+		case AL_FORMAT_STEREO_MSADPCM_SOFT:
+			return "stereoMSADPCM";
+		case AL_FORMAT_BFORMAT2D_16:
+			return "bf2D16";
+		case AL_FORMAT_BFORMAT2D_FLOAT32:
+			return "bf2D32";
+		case AL_FORMAT_BFORMAT3D_16:
+			return "bf3D16";
+		case AL_FORMAT_BFORMAT3D_FLOAT32:
+			return "bf3D32";
+		default:
+			return "unknown";
+	}
+}
+}// namespace
+
+struct SoundDecoder::Source {
+	/// libsndfile handle.
+	SNDFILE* file = nullptr;
+	/// Description of the sound.
+	SF_INFO info{};
+	/// The pack holding the sound, null for plain files.
+	const data::assets::pack::PackReader* pack = nullptr;
+	/// The pack entry.
+	std::string entry;
+	/// Size of the pack entry.
+	sf_count_t size = 0;
+	/// Read position in the pack entry.
+	sf_count_t position = 0;
+	/// Last bytes fetched from the pack.
+	std::vector<uint8_t> window;
+	/// Position of the fetched bytes in the pack entry.
+	sf_count_t windowStart = 0;
+
+	Source() = default;
+	Source(const Source&) = delete;
+	Source(Source&&) = delete;
+	auto operator=(const Source&) -> Source& = delete;
+	auto operator=(Source&&) -> Source& = delete;
+	~Source() {
+		if (file != nullptr)
+			sf_close(file);
+	}
+
+	// libsndfile virtual I/O over the pack entry.
+
+	static auto getLength(void* iUser) -> sf_count_t { return static_cast<Source*>(iUser)->size; }
+
+	static auto seek(const sf_count_t iOffset, const int iWhence, void* iUser) -> sf_count_t {
+		auto* source = static_cast<Source*>(iUser);
+		sf_count_t target = iOffset;
+		if (iWhence == SEEK_CUR)
+			target += source->position;
+		else if (iWhence == SEEK_END)
+			target += source->size;
+		source->position = std::clamp<sf_count_t>(target, 0, source->size);
+		return source->position;
+	}
+
+	static auto read(void* oPtr, const sf_count_t iCount, void* iUser) -> sf_count_t {
+		auto* source = static_cast<Source*>(iUser);
+		auto* out = static_cast<uint8_t*>(oPtr);
+		sf_count_t done = 0;
+		while (done < iCount && source->position < source->size) {
+			const sf_count_t offset = source->position - source->windowStart;
+			const auto available = static_cast<sf_count_t>(source->window.size());
+			if (offset < 0 || offset >= available) {
+				const sf_count_t start = source->position - source->position % static_cast<sf_count_t>(g_packWindow);
+				auto block = source->pack->readRange(source->entry, static_cast<uint64_t>(start), g_packWindow);
+				if (!block.has_value() || static_cast<sf_count_t>(block->size()) <= source->position - start)
+					break;
+				source->window = std::move(*block);
+				source->windowStart = start;
+				continue;
+			}
+			const sf_count_t count = std::min(iCount - done, available - offset);
+			OWL_DIAG_PUSH
+			OWL_DIAG_DISABLE_CLANG19("-Wunsafe-buffer-usage")
+			std::copy_n(source->window.begin() + offset, count, out + done);
+			OWL_DIAG_POP
+			done += count;
+			source->position += count;
+		}
+		return done;
+	}
+
+	static auto write(const void*, sf_count_t, void*) -> sf_count_t { return 0; }
+
+	static auto tell(void* iUser) -> sf_count_t { return static_cast<Source*>(iUser)->position; }
+};
+
+SoundDecoder::SoundDecoder() = default;
+
+SoundDecoder::~SoundDecoder() = default;
+
+auto SoundDecoder::open(const std::filesystem::path& iFile) -> bool {
+	close();
+	mp_source = mkUniq<Source>();
+	mp_source->file = sf_open(reinterpret_cast<const char*>(iFile.u8string().c_str()), SFM_READ, &mp_source->info);
+	if (mp_source->file == nullptr) {
+		OWL_CORE_WARN("SoundData: Failed to open file '{}'.", iFile.string())
+		close();
+		return false;
+	}
+	return setupFormat();
+}
+
+auto SoundDecoder::open(const data::assets::pack::PackReader& iPack, const std::string& iEntry) -> bool {
+	close();
+	const auto size = iPack.entrySize(iEntry);
+	if (!size.has_value()) {
+		OWL_CORE_WARN("SoundData: No entry '{}' in the asset pack.", iEntry)
+		return false;
+	}
+	mp_source = mkUniq<Source>();
+	mp_source->pack = &iPack;
+	mp_source->entry = iEntry;
+	mp_source->size = static_cast<sf_count_t>(*size);
+	SF_VIRTUAL_IO io{.get_filelen = &Source::getLength,
+					 .seek = &Source::seek,
+					 .read = &Source::read,
+					 .write = &Source::write,
+					 .tell = &Source::tell};
+	mp_source->file = sf_open_virtual(&io, SFM_READ, &mp_source->info, mp_source.get());
+	if (mp_source->file == nullptr) {
+		OWL_CORE_WARN("SoundData: Failed to open pack entry '{}'.", iEntry)
+		close();
+		return false;
+	}
+	return setupFormat();
+}
+
+void SoundDecoder::close() {
+	mp_source.reset();
+	m_format = AL_NONE;
+	m_sampleRate = 0;
+	m_frameAlign = 1;
+	m_byteAlign = 0;
+	m_sampleType = static_cast<uint8_t>(SoundDataType::Unsupported);
+}
+
+auto SoundDecoder::isOpen() const -> bool { return mp_source != nullptr && m_format != AL_NONE; }
+
+auto SoundDecoder::getFormatName() const -> std::string { return alFormatName(m_format); }
+
+auto SoundDecoder::setupFormat() -> bool {
+	auto* const file = mp_source->file;
+	const auto& sfInfo = mp_source->info;
+	if (sfInfo.frames < 1) {
+		OWL_CORE_WARN("SoundData: Sound is empty.")
+		close();
+		return false;
+	}
+	auto sampleFormat = sfFormatConvert(sfInfo.format);
+	if (sampleFormat == SoundDataType::Unsupported) {
+		OWL_CORE_WARN("SoundData: unable to load, Unsupported format...")
+		close();
+		return false;
+	}
+	// Compute block align
+	ALint byteblockalign = 0;
+	ALint splblockalign = 0;
+	if (sampleFormat == SoundDataType::Ima4 || sampleFormat == SoundDataType::MsAdpcm) {
+		if (sfInfo.channels > 2) {
+			OWL_CORE_WARN("SoundData: unable to load {} format only supports 2 channel max...",
+						  magic_enum::enum_name(sampleFormat))
+			close();
+			return false;
+		}
+
+		SF_CHUNK_INFO inf = {"fmt ", 4, 0, nullptr};
+		if (const SF_CHUNK_ITERATOR* iter = sf_get_chunk_iterator(file, &inf);
+			iter == nullptr || sf_get_chunk_size(iter, &inf) != SF_ERR_NO_ERROR || inf.datalen < 14)
+			sampleFormat = SoundDataType::Int16;
+		else {
+			std::vector<ALubyte> buffer(inf.datalen);
+			inf.data = buffer.data();
+			if (sf_get_chunk_data(iter, &inf) != SF_ERR_NO_ERROR)
+				sampleFormat = SoundDataType::Int16;
+			else {
+				byteblockalign = buffer[12] | buffer[13] << 8;
+				if (sampleFormat == SoundDataType::Ima4) {
+					splblockalign = (byteblockalign / sfInfo.channels - 4) / 4 * 8 + 1;
+					if (splblockalign < 1 || ((splblockalign - 1) / 2 + 4) * sfInfo.channels != byteblockalign)
+						sampleFormat = SoundDataType::Int16;
+				} else {
+					splblockalign = (byteblockalign / sfInfo.channels - 7) * 2 + 2;
+					if (splblockalign < 2 || ((splblockalign - 2) / 2 + 7) * sfInfo.channels != byteblockalign)
+						sampleFormat = SoundDataType::Int16;
+				}
+			}
+		}
+	}
+	if (sampleFormat == SoundDataType::Int16) {
+		splblockalign = 1;
+		byteblockalign = sfInfo.channels * 2;
+	} else if (sampleFormat == SoundDataType::Float) {
+		splblockalign = 1;
+		byteblockalign = sfInfo.channels * 4;
+	}
+	// Determine OpenAL Format
+	ALenum format = AL_NONE;
+	if (sfInfo.channels == 1) {
+		if (sampleFormat == SoundDataType::Int16)
+			format = AL_FORMAT_MONO16;
+		else if (sampleFormat == SoundDataType::Float)
+			format = AL_FORMAT_MONO_FLOAT32;
+		else if (sampleFormat == SoundDataType::Ima4)
+			format = AL_FORMAT_MONO_IMA4;
+		else if (sampleFormat == SoundDataType::MsAdpcm)
+			format = AL_FORMAT_MONO_MSADPCM_SOFT;
+	} else if (sfInfo.channels == 2) {
+		if (sampleFormat == SoundDataType::Int16)
+			format = AL_FORMAT_STEREO16;
+		else if (sampleFormat == SoundDataType::Float)
+			format = AL_FORMAT_STEREO_FLOAT32;
+		else if (sampleFormat == SoundDataType::Ima4)
+			format = AL_FORMAT_STEREO_IMA4;
+		else if (sampleFormat == SoundDataType::MsAdpcm)
+			format = AL_FORMAT_STEREO_MSADPCM_SOFT;
+	} else if (sfInfo.channels == 3) {
+		if (sf_command(file, SFC_WAVEX_GET_AMBISONIC, nullptr, 0) == SF_AMBISONIC_B_FORMAT) {
+			if (sampleFormat == SoundDataType::Int16)
+				format = AL_FORMAT_BFORMAT2D_16;
+			else if (sampleFormat == SoundDataType::Float)
+				format = AL_FORMAT_BFORMAT2D_FLOAT32;
+		}
+	} else if (sfInfo.channels == 4) {
+		if (sf_command(file, SFC_WAVEX_GET_AMBISONIC, nullptr, 0) == SF_AMBISONIC_B_FORMAT) {
+			if (sampleFormat == SoundDataType::Int16)
+				format = AL_FORMAT_BFORMAT3D_16;
+			else if (sampleFormat == SoundDataType::Float)
+				format = AL_FORMAT_BFORMAT3D_FLOAT32;
+		}
+	}
+	if (format == AL_NONE) {
+		OWL_CORE_WARN("SoundData: Unsupported OpenAL format.")
+		close();
+		return false;
+	}
+	if (sfInfo.frames / splblockalign > static_cast<sf_count_t>(INT_MAX / byteblockalign)) {
+		OWL_CORE_WARN("SoundData: Too many samples.")
+		close();
+		return false;
+	}
+	m_format = format;
+	m_sampleRate = sfInfo.samplerate;
+	m_frameAlign = splblockalign;
+	m_byteAlign = byteblockalign;
+	m_sampleType = static_cast<uint8_t>(sampleFormat);
+	return true;
+}
+
+auto SoundDecoder::getByteSize() const -> size_t {
+	if (!isOpen())
+		return 0;
+	return static_cast<size_t>(mp_source->info.frames / m_frameAlign * m_byteAlign);
+}
+
+auto SoundDecoder::getChunkBytes(const std::chrono::milliseconds iDuration) const -> size_t {
+	if (!isOpen())
+		return 0;
+	const int64_t frames = std::max<int64_t>(int64_t{m_sampleRate} * iDuration.count() / 1000, 1);
+	const int64_t blocks = (frames + m_frameAlign - 1) / m_frameAlign;
+	return static_cast<size_t>(blocks * m_byteAlign);
+}
+
+auto SoundDecoder::read(const std::span<char> oBuffer) -> size_t {
+	if (!isOpen())
+		return 0;
+	auto* const file = mp_source->file;
+	const auto blocks = static_cast<sf_count_t>(oBuffer.size() / static_cast<size_t>(m_byteAlign));
+	if (blocks == 0)
+		return 0;
+	sf_count_t numFrames = 0;
+	OWL_DIAG_PUSH
+	OWL_DIAG_DISABLE_CLANG19("-Wunsafe-buffer-usage")
+	if (const auto sampleFormat = static_cast<SoundDataType>(m_sampleType); sampleFormat == SoundDataType::Int16)
+		numFrames = sf_readf_short(file, reinterpret_cast<int16_t*>(oBuffer.data()), blocks);
+	else if (sampleFormat == SoundDataType::Float)
+		numFrames = sf_readf_float(file, reinterpret_cast<float*>(oBuffer.data()), blocks);
+	else {
+		numFrames = sf_read_raw(file, oBuffer.data(), blocks * m_byteAlign);
+		if (numFrames > 0)
+			numFrames = numFrames / m_byteAlign * m_frameAlign;
+	}
+	OWL_DIAG_POP
+	if (numFrames < 1)
+		return 0;
+	return static_cast<size_t>(numFrames / m_frameAlign * m_byteAlign);
+}
+
+auto SoundDecoder::rewind() -> bool {
+	if (!isOpen())
+		return false;
+	return sf_seek(mp_source->file, 0, SEEK_SET) == 0;
+}
+
+}// namespace owl::sound::openal
@@ -0,0 +1,161 @@
+/**
+ * @file SoundDecoder.h
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright (c) 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+
+#include "core/Core.h"
+#include "data/assets/pack/PackReader.h"
+
+#include <filesystem>
+
+namespace owl::sound::openal {
+
+/**
+ * @brief
+ *  libsndfile decoder delivering samples in a format OpenAL buffers accept.
+ *
+ * The sound is read from a file or from an asset pack entry. Pack entries go
+ * through libsndfile virtual I/O: only the pack frames overlapping what the
+ * codec asks for are decompressed, so a long track never sits whole in memory.
+ * Samples are handed out in blocks of whole frames (whole ADPCM blocks for the
+ * compressed formats OpenAL takes as is), either all at once or chunk by chunk.
+ */
+class OWL_API SoundDecoder final {
+public:
+	/**
+	 * @brief
+	 *  Default constructor.
+	 */
+	SoundDecoder();
+
+	/**
+	 * @brief
+	 *  Destructor.
+	 */
+	~SoundDecoder();
+
+	SoundDecoder(const SoundDecoder&) = delete;
+
+	SoundDecoder(SoundDecoder&&) = delete;
+
+	auto operator=(const SoundDecoder&) -> SoundDecoder& = delete;
+
+	auto operator=(SoundDecoder&&) -> SoundDecoder& = delete;
+
+	/**
+	 * @brief
+	 *  Open a sound file.
+	 * @param[in] iFile The file.
+	 * @return True if the file can be decoded to an OpenAL format.
+	 */
+	auto open(const std::filesystem::path& iFile) -> bool;
+
+	/**
+	 * @brief
+	 *  Open a sound stored in an asset pack.
+	 * @param[in] iPack The pack, that must stay open while decoding.
+	 * @param[in] iEntry The entry path in the pack.
+	 * @return True if the entry can be decoded to an OpenAL format.
+	 */
+	auto open(const data::assets::pack::PackReader& iPack, const std::string& iEntry) -> bool;
+
+	/**
+	 * @brief
+	 *  Release the sound.
+	 */
+	void close();
+
+	/**
+	 * @brief
+	 *  Check for an opened sound.
+	 * @return True if opened.
+	 */
+	[[nodiscard]] auto isOpen() const -> bool;
+
+	/**
+	 * @brief
+	 *  OpenAL buffer format of the decoded samples.
+	 * @return The AL format enum.
+	 */
+	[[nodiscard]] auto getFormat() const -> int32_t { return m_format; }
+
+	/**
+	 * @brief
+	 *  Readable name of the OpenAL format.
+	 * @return The name.
+	 */
+	[[nodiscard]] auto getFormatName() const -> std::string;
+
+	/**
+	 * @brief
+	 *  Sample rate.
+	 * @return The rate in Hz.
+	 */
+	[[nodiscard]] auto getSampleRate() const -> int32_t { return m_sampleRate; }
+
+	/**
+	 * @brief
+	 *  Number of frames per block, to pass as AL_UNPACK_BLOCK_ALIGNMENT_SOFT when greater than one.
+	 * @return The block alignment in frames.
+	 */
+	[[nodiscard]] auto getBlockAlign() const -> int32_t { return m_frameAlign; }
+
+	/**
+	 * @brief
+	 *  Size of the whole decoded sound.
+	 * @return The byte count.
+	 */
+	[[nodiscard]] auto getByteSize() const -> size_t;
+
+	/**
+	 * @brief
+	 *  Size of a chunk of about the given duration, in whole blocks.
+	 * @param[in] iDuration The chunk duration.
+	 * @return The byte count.
+	 */
+	[[nodiscard]] auto getChunkBytes(std::chrono::milliseconds iDuration) const -> size_t;
+
+	/**
+	 * @brief
+	 *  Decode the next samples.
+	 * @param[out] oBuffer Destination, filled with as many whole blocks as fit.
+	 * @return Number of bytes written, 0 at the end of the sound or on error.
+	 */
+	auto read(std::span<char> oBuffer) -> size_t;
+
+	/**
+	 * @brief
+	 *  Go back to the beginning of the sound.
+	 * @return True on success.
+	 */
+	auto rewind() -> bool;
+
+private:
+	/// libsndfile handle and virtual I/O state.
+	struct Source;
+	/**
+	 * @brief
+	 *  Find the OpenAL format of the freshly opened source.
+	 * @return True if the source can be decoded to an OpenAL format.
+	 */
+	auto setupFormat() -> bool;
+	/// The opened sound.
+	uniq<Source> mp_source;
+	/// OpenAL format of the samples.
+	int32_t m_format = 0;
+	/// Sample rate in Hz.
+	int32_t m_sampleRate = 0;
+	/// Frames per block.
+	int32_t m_frameAlign = 1;
+	/// Bytes per block.
+	int32_t m_byteAlign = 0;
+	/// How samples are read from libsndfile.
+	uint8_t m_sampleType = 0;
+};
+
+}// namespace owl::sound::openal
@@ -0,0 +1,81 @@
+/**
+ * @file SoundStream.cpp
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright (c) 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "owlpch.h"
+
+#include "SoundStream.h"
+
+#include "core/external/openal.h"
+
+namespace owl::sound::openal {
+
+SoundStream::SoundStream(uniq<SoundDecoder>&& iDecoder, const uint32_t iSource, const bool iLoop)
+	: mp_decoder{std::move(iDecoder)}, m_source{iSource}, m_loop{iLoop} {
+	m_chunk.resize(mp_decoder->getChunkBytes(g_chunkDuration));
+	alGenBuffers(static_cast<ALsizei>(m_buffers.size()), m_buffers.data());
+	if (mp_decoder->getBlockAlign() > 1) {
+		for (const auto buffer: m_buffers)
+			alBufferi(buffer, AL_UNPACK_BLOCK_ALIGNMENT_SOFT, mp_decoder->getBlockAlign());
+	}
+}
+
+SoundStream::~SoundStream() {
+	// Buffers still queued on the source cannot be deleted.
+	alSourceStop(m_source);
+	alSourcei(m_source, AL_BUFFER, 0);
+	alDeleteBuffers(static_cast<ALsizei>(m_buffers.size()), m_buffers.data());
+}
+
+auto SoundStream::prime() -> bool {
+	OWL_PROFILE_FUNCTION()
+
+	size_t queued = 0;
+	for (const auto buffer: m_buffers) {
+		if (!fill(buffer))
+			break;
+		++queued;
+	}
+	return queued > 0;
+}
+
+void SoundStream::update() {
+	ALint processed = 0;
+	alGetSourcei(m_source, AL_BUFFERS_PROCESSED, &processed);
+	for (; processed > 0; --processed) {
+		ALuint buffer = 0;
+		alSourceUnqueueBuffers(m_source, 1, &buffer);
+		// At the end of the sound the buffer just stays out of the queue.
+		fill(buffer);
+	}
+	ALint state = 0;
+	alGetSourcei(m_source, AL_SOURCE_STATE, &state);
+	if (state != AL_STOPPED)
+		return;
+	// The source ran out of data before this refill: resume with what is queued now.
+	ALint queued = 0;
+	alGetSourcei(m_source, AL_BUFFERS_QUEUED, &queued);
+	if (queued > 0)
+		alSourcePlay(m_source);
+}
+
+auto SoundStream::fill(const uint32_t iBuffer) -> bool {
+	if (m_exhausted)
+		return false;
+	size_t bytes = mp_decoder->read(m_chunk);
+	if (bytes == 0 && m_loop && mp_decoder->rewind())
+		bytes = mp_decoder->read(m_chunk);
+	if (bytes == 0) {
+		m_exhausted = true;
+		return false;
+	}
+	alBufferData(iBuffer, mp_decoder->getFormat(), m_chunk.data(), static_cast<ALsizei>(bytes),
+				 mp_decoder->getSampleRate());
+	alSourceQueueBuffers(m_source, 1, &iBuffer);
+	return true;
+}
+
+}// namespace owl::sound::openal
@@ -0,0 +1,105 @@
+/**
+ * @file SoundStream.h
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright (c) 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+
+#include "SoundDecoder.h"
+
+#include <array>
+
+namespace owl::sound::openal {
+
+/**
+ * @brief
+ *  Playback of a streamed sound on one OpenAL source, through a small ring of queued buffers.
+ *
+ * The source is fed chunks of about `g_chunkDuration`; `update()` refills the
+ * buffers the source has played and restarts it if it starved. Looping rewinds
+ * the decoder instead of using AL_LOOPING, which would only loop the queue.
+ * The stream is not thread-safe: its owner serializes the calls.
+ */
+class OWL_API SoundStream final {
+public:
+	/// Number of buffers queued on the source.
+	static constexpr size_t g_bufferCount = 4;
+	/// Duration of the samples in one buffer.
+	static constexpr std::chrono::milliseconds g_chunkDuration{250};
+
+	/**
+	 * @brief
+	 *  Constructor.
+	 * @param[in] iDecoder The opened decoder.
+	 * @param[in] iSource The OpenAL source, owned by the caller.
+	 * @param[in] iLoop If the sound loops.
+	 */
+	SoundStream(uniq<SoundDecoder>&& iDecoder, uint32_t iSource, bool iLoop);
+
+	/**
+	 * @brief
+	 *  Destructor, stops the source and releases the buffers.
+	 */
+	~SoundStream();
+
+	SoundStream(const SoundStream&) = delete;
+
+	SoundStream(SoundStream&&) = delete;
+
+	auto operator=(const SoundStream&) -> SoundStream& = delete;
+
+	auto operator=(SoundStream&&) -> SoundStream& = delete;
+
+	/**
+	 * @brief
+	 *  Fill and queue all the buffers, ready for the source to play.
+	 * @return False if nothing could be decoded.
+	 */
+	auto prime() -> bool;
+
+	/**
+	 * @brief
+	 *  Refill the played buffers and restart a starved source.
+	 */
+	void update();
+
+	/**
+	 * @brief
+	 *  Change looping.
+	 * @param[in] iLoop If the sound loops.
+	 */
+	void setLoop(const bool iLoop) { m_loop = iLoop; }
+
+	/**
+	 * @brief
+	 *  Check if the whole sound has been queued: once the source stops, it is over.
+	 * @return True when the decoder is exhausted.
+	 */
+	[[nodiscard]] auto isExhausted() const -> bool { return m_exhausted; }
+
+private:
+	/**
+	 * @brief
+	 *  Decode the next chunk into a buffer and queue it.
+	 * @param[in] iBuffer The buffer.
+	 * @return False at the end of the sound.
+	 */
+	auto fill(uint32_t iBuffer) -> bool;
+	/// The decoder.
+	uniq<SoundDecoder> mp_decoder;
+	/// The source.
+	uint32_t m_source = 0;
+	/// The buffer ring.
+	std::array<uint32_t, g_bufferCount> m_buffers{};
+	/// Decoded chunk, reused.
+	std::vector<char> m_chunk;
+	/// If the sound loops.
+	bool m_loop = false;
+	/// If the decoder reached the end of a non-looping sound.
+	bool m_exhausted = false;
+};
+
+}// namespace owl::sound::openal
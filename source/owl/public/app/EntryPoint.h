@@ -28,10 +28,12 @@ auto main(int iArgc, char* iArgv[]) -> int {
 		auto app = owl::app::createApplication(iArgc, iArgv);
 		OWL_PROFILE_END_SESSION()
 		// runtime
-		OWL_PROFILE_BEGIN_SESSION("Runtime", "OwlProfile-runtime.json")
+		// The frame loop is captured in binary (per-thread rings) so profiling does not distort it.
+		OWL_PROFILE_BEGIN_BINARY_SESSION("Runtime", "OwlProfile-runtime.owlprof")
 		OWL_CORE_TRACE("run!")
 		app->run();
 		OWL_PROFILE_END_SESSION()
+		OWL_PROFILE_CONVERT_SESSION("OwlProfile-runtime.owlprof", "OwlProfile-runtime.json")
 		// Shutdown
 		OWL_PROFILE_BEGIN_SESSION("Shutdown", "OwlProfile-shutdown.json")
 		OWL_CORE_TRACE("Terminate application.")
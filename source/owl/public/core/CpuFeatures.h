@@ -0,0 +1,35 @@
+/**
+ * @file CpuFeatures.h
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright (c) 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+
+#include "Core.h"
+
+namespace owl::core {
+
+/**
+ * @brief
+ *  Instruction sets of the SIMD code paths.
+ *
+ * Ordered from the narrowest to the widest, so a requested level is capped
+ * with `std::min(iLevel, getSimdLevel())`.
+ */
+enum struct SimdLevel : uint8_t {
+	Scalar,///< Portable code.
+	Sse41,///< x64 with SSE4.1.
+	Avx2,///< x64 with AVX2.
+};
+
+/**
+ * @brief
+ *  The widest instruction set the running CPU supports (detected once).
+ * @return The SIMD level.
+ */
+OWL_API auto getSimdLevel() -> SimdLevel;
+
+}// namespace owl::core
@@ -0,0 +1,174 @@
+/**
+ * @file FrameArena.h
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright (c) 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+
+#include "Core.h"
+
+#include <algorithm>
+#include <memory>
+#include <memory_resource>
+#include <span>
+#include <vector>
+
+namespace owl::core {
+
+/**
+ * @brief
+ *  Linear allocator for memory that only lives until the end of the frame.
+ *
+ * Allocations are a pointer bump inside a list of blocks, deallocation is a
+ * no-op and `reset()` rewinds everything at once. When a frame overflowed the
+ * first block, the reset merges all blocks into a single one so the following
+ * frames run without touching the heap at all.
+ *
+ * The arena is also a `std::pmr::memory_resource`, so standard `std::pmr`
+ * containers can be pointed at it for frame-local scratch data.
+ *
+ * @note Not thread-safe: the `frame()` arena belongs to the main thread, which
+ * resets it at the start of every `app::Application` frame. Without a running
+ * frame loop (headless renderer, tools, tests), `renderer::Renderer2D::endScene`
+ * resets it instead, so the spans it hands out then only live until the end of
+ * the 2D scene.
+ */
+class OWL_API FrameArena final : public std::pmr::memory_resource {
+public:
+	/// Default size of a block in bytes.
+	static constexpr size_t g_defaultBlockSize = 256 * 1024;
+
+	/**
+	 * @brief
+	 *  Constructor.
+	 * @param[in] iBlockSize Size of the blocks requested from the heap.
+	 */
+	explicit FrameArena(size_t iBlockSize = g_defaultBlockSize);
+
+	/**
+	 * @brief
+	 *  Destructor.
+	 */
+	~FrameArena() override;
+
+	FrameArena(const FrameArena&) = delete;
+
+	FrameArena(FrameArena&&) = delete;
+
+	auto operator=(const FrameArena&) -> FrameArena& = delete;
+
+	auto operator=(FrameArena&&) -> FrameArena& = delete;
+
+	/**
+	 * @brief
+	 *  Allocate a default-initialized array valid until the next `reset()`.
+	 * @tparam T Type of the elements, must be trivially destructible since destructors are never run.
+	 * @param[in] iCount Number of elements.
+	 * @return The array.
+	 */
+	template<typename T>
+	[[nodiscard]] auto allocateSpan(const size_t iCount) -> std::span<T> {
+		static_assert(std::is_trivially_destructible_v<T>, "Frame arena memory is released without destruction.");
+		if (iCount == 0)
+			return {};
+		auto* data = static_cast<T*>(allocate(iCount * sizeof(T), alignof(T)));
+		std::uninitialized_default_construct_n(data, iCount);
+		return {data, iCount};
+	}
+
+	/**
+	 * @brief
+	 *  Release every allocation at once, coalescing the blocks if the frame needed more than one.
+	 */
+	void reset();
+
+	/**
+	 * @brief
+	 *  Bytes handed out since the last reset.
+	 * @return Used bytes.
+	 */
+	[[nodiscard]] auto getUsedBytes() const -> size_t { return m_used; }
+
+	/**
+	 * @brief
+	 *  Highest number of bytes used during a single frame.
+	 * @return Peak bytes.
+	 */
+	[[nodiscard]] auto getPeakBytes() const -> size_t { return std::max(m_peak, m_used); }
+
+	/**
+	 * @brief
+	 *  Total size of the blocks owned by the arena.
+	 * @return Capacity in bytes.
+	 */
+	[[nodiscard]] auto getCapacity() const -> size_t;
+
+	/**
+	 * @brief
+	 *  Number of heap blocks owned by the arena.
+	 * @return Block count.
+	 */
+	[[nodiscard]] auto getBlockCount() const -> size_t { return m_blocks.size(); }
+
+	/**
+	 * @brief
+	 *  Define if a frame loop resets the arena at the start of every frame.
+	 * @param[in] iFrameLoop True while a frame loop owns the arena.
+	 */
+	void setFrameLoop(const bool iFrameLoop) { m_frameLoop = iFrameLoop; }
+
+	/**
+	 * @brief
+	 *  Check if a frame loop resets the arena at the start of every frame.
+	 * @return True while a frame loop owns the arena.
+	 */
+	[[nodiscard]] auto hasFrameLoop() const -> bool { return m_frameLoop; }
+
+	/**
+	 * @brief
+	 *  The main thread per-frame arena.
+	 * @return The arena.
+	 */
+	static auto frame() -> FrameArena&;
+
+private:
+	auto do_allocate(size_t iBytes, size_t iAlignment) -> void* override;
+	void do_deallocate(void* iPtr, size_t iBytes, size_t iAlignment) override;
+	[[nodiscard]] auto do_is_equal(const memory_resource& iOther) const noexcept -> bool override;
+
+	/**
+	 * @brief
+	 *  Try to carve an allocation from the current block.
+	 * @param[in] iBytes Requested size.
+	 * @param[in] iAlignment Requested alignment.
+	 * @return The memory or nullptr if the block is too small.
+	 */
+	auto tryBump(size_t iBytes, size_t iAlignment) -> void*;
+
+	/// A heap block.
+	struct Block {
+		/// Block memory.
+		uniq<std::byte[]> data;
+		/// Block size in bytes.
+		size_t size = 0;
+	};
+	/// The owned blocks.
+	std::vector<Block> m_blocks;
+	/// Index of the block currently filled.
+	size_t m_current = 0;
+	/// Offset of the first free byte in the current block.
+	size_t m_offset = 0;
+	/// Bytes handed out since the last reset.
+	size_t m_used = 0;
+	/// Peak of the previous frames.
+	size_t m_peak = 0;
+	/// Size of the newly created blocks.
+	size_t m_blockSize;
+	/// If a frame loop resets the arena.
+	bool m_frameLoop = false;
+};
+
+}// namespace owl::core
@@ -0,0 +1,50 @@
+/**
+ * @file CancellationToken.h
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright (c) 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+#include "core/Core.h"
+#include <atomic>
+
+namespace owl::core::task {
+
+/**
+ * @brief
+ *  Shared flag to cancel queued or running tasks.
+ *
+ * Copies share the same flag: the owner keeps one copy and gives the others to
+ * its tasks. A task whose token is cancelled before it starts is skipped; a
+ * running task stops only if its action checks `isCancelled()`. Either way, the
+ * termination callback of a cancelled task is not run.
+ */
+class CancellationToken final {
+public:
+	/**
+	 * @brief
+	 *  Create a new token, not cancelled.
+	 */
+	CancellationToken() : mp_flag{mkShared<std::atomic_bool>(false)} {}
+
+	/**
+	 * @brief
+	 *  Cancel the tasks holding this token.
+	 */
+	void cancel() const { mp_flag->store(true, std::memory_order_release); }
+
+	/**
+	 * @brief
+	 *  Check if the token has been cancelled.
+	 * @return True if cancelled.
+	 */
+	[[nodiscard]] auto isCancelled() const -> bool { return mp_flag->load(std::memory_order_acquire); }
+
+private:
+	/// The shared flag.
+	shared<std::atomic_bool> mp_flag;
+};
+
+}// namespace owl::core::task
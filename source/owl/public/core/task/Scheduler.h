@@ -30,6 +30,13 @@ public:
 	 */
 	Scheduler();
 
+	/**
+	 * @brief
+	 *  Constructor with a given number of worker threads.
+	 * @param[in] iWorkerCount Number of worker threads (at least 1).
+	 */
+	explicit Scheduler(uint32_t iWorkerCount);
+
 	/**
 	 * @brief
 	 *  Default destructor.
@@ -62,7 +69,13 @@ public:
 
 	/**
 	 * @brief
-	 *  Insert Task to the queue.
+	 *  Submit a Task to the worker threads.
+	 *
+	 * The task starts as soon as a worker is free and its dependencies are done,
+	 * without waiting for the next frame; free workers take the tasks of the
+	 * highest priority class first. Its termination callback runs on the main
+	 * thread, in `frame()` or in one of the wait functions. Tasks can be pushed
+	 * from any thread, including from another task.
 	 * @param iTask Task to push.
 	 * @return The task ID for external follow.
 	 */
@@ -78,20 +91,20 @@ public:
 
 	/**
 	 * @brief
-	 *  Execute each frame.
+	 *  Execute each frame: run the termination callbacks of the finished tasks, then the timers.
 	 */
 	void frame(const Timestep& iTimestep);
 
 	/**
 	 * @brief
-	 *  Wait for all running tasks to finish.
-	 * @note The tasks in queue will not be launched.
+	 *  Wait for all running tasks to finish and run their termination callbacks.
+	 * @note The tasks still waiting for a worker are not waited for.
 	 */
 	void waitRunning();
 
 	/**
 	 * @brief
-	 *  Wait for all known tasks to run and finish.
+	 *  Wait for all known tasks to run and finish, and run their termination callbacks.
 	 */
 	void waitEmptyQueue();
 
@@ -105,23 +118,25 @@ public:
 
 	/**
 	 * @brief
-	 *  Check if the task with given ID is finished.
+	 *  Check if the task with given ID is running, or waits for its termination callback.
 	 * @param[in] iTaskId The task's ID.
-	 * @return true if finished.
+	 * @return true if running.
 	 */
 	[[nodiscard]] auto isTaskRunning(size_t iTaskId) const -> bool;
 
 	/**
 	 * @brief
-	 *  Check if the task with given ID is in queue.
+	 *  Check if the task with given ID waits for a worker or for its dependencies.
 	 * @param[in] iTaskId The task's ID.
-	 * @return true if finished.
+	 * @return true if in queue.
 	 */
 	[[nodiscard]] auto isTaskInQueue(size_t iTaskId) const -> bool;
 
 	/**
 	 * @brief
-	 *  Clear the tasks queue.
+	 *  Cancel the tasks not taken by a worker yet, and the tasks depending on them.
+	 *
+	 * The termination callbacks of the cancelled tasks are not run.
 	 */
 	void clearQueue();
 
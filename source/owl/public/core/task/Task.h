@@ -7,9 +7,12 @@
  */
 
 #pragma once
+#include "CancellationToken.h"
+#include "TaskFunction.h"
 #include "core/Core.h"
-#include <functional>
-#include <future>
+#include <atomic>
+#include <mutex>
+#include <optional>
 
 namespace owl::core::task {
 
@@ -19,16 +22,34 @@ struct SchedulerImpl;
 /**
  * @brief
  *  Class defining a simple task for multithreading.
+ *
+ * Before being pushed to a scheduler, a task can be given a priority class,
+ * a cancellation token, and the IDs of tasks it must wait for. The action and
+ * the termination callback are stored inline when small enough, see `TaskFunction`.
  */
 class OWL_API Task final {
 public:
 	/**
 	 * @brief
-	 *  Default constructor.
+	 *  Constructor.
+	 * @tparam Exec Type of the action.
 	 * @param[in] iExec The action to execute on the worker thread.
-	 * @param[in] iEnds Callback executed on the main thread once the worker finishes (default: no-op).
 	 */
-	explicit Task(const std::function<void()>& iExec, const std::function<void()>& iEnds = []() -> void {});
+	template<typename Exec>
+		requires(!std::same_as<std::decay_t<Exec>, Task> && std::invocable<std::decay_t<Exec>&>)
+	explicit Task(Exec&& iExec) : m_action{std::forward<Exec>(iExec)} {}
+
+	/**
+	 * @brief
+	 *  Constructor.
+	 * @tparam Exec Type of the action.
+	 * @tparam Ends Type of the termination callback.
+	 * @param[in] iExec The action to execute on the worker thread.
+	 * @param[in] iEnds Callback executed on the main thread once the worker finishes.
+	 */
+	template<typename Exec, typename Ends>
+		requires(std::invocable<std::decay_t<Exec>&> && std::invocable<std::decay_t<Ends>&>)
+	Task(Exec&& iExec, Ends&& iEnds) : m_action{std::forward<Exec>(iExec)}, m_termination{std::forward<Ends>(iEnds)} {}
 
 	/**
 	 * @brief
@@ -53,9 +74,19 @@ public:
 	 *  The task state.
 	 */
 	enum struct State : uint8_t {
-		Waiting,///< Task created, not yet running.
-		Running,///< Task is running on the worker thread.
-		Terminated,///< Task has finished (and termination callback has run).
+		Waiting,///< Task created or submitted, not yet taken by a worker thread.
+		Running,///< Task is running on a worker thread, or waits for its termination callback.
+		Terminated,///< Task has finished (and termination callback has run), or was cancelled.
+	};
+
+	/**
+	 * @brief
+	 *  Priority classes: workers always take the waiting task of the highest class first.
+	 */
+	enum struct Priority : uint8_t {
+		Interactive,///< Work the current frame or the user waits for.
+		Streaming,///< Content streamed in: chunks, assets, sounds.
+		Background,///< Work nobody waits for: caches, prefetching.
 	};
 
 	/**
@@ -63,25 +94,75 @@ public:
 	 *  Access to the task's state.
 	 * @return The task's state.
 	 */
-	[[nodiscard]] auto getState() const noexcept -> const State& { return m_state; }
+	[[nodiscard]] auto getState() const noexcept -> State { return m_state.load(std::memory_order_acquire); }
+
+	/**
+	 * @brief
+	 *  Define the priority class.
+	 * @param[in] iPriority The priority.
+	 */
+	void setPriority(const Priority iPriority) { m_priority = iPriority; }
+
+	/**
+	 * @brief
+	 *  Access to the priority class.
+	 * @return The priority.
+	 */
+	[[nodiscard]] auto getPriority() const noexcept -> Priority { return m_priority; }
+
+	/**
+	 * @brief
+	 *  Attach a cancellation token.
+	 * @param[in] iToken The token.
+	 */
+	void setCancellationToken(const CancellationToken& iToken) { m_token = iToken; }
+
+	/**
+	 * @brief
+	 *  Check if the task's token has been cancelled.
+	 * @return True if cancelled, false if not or without token.
+	 */
+	[[nodiscard]] auto isCancelled() const -> bool { return m_token.has_value() && m_token->isCancelled(); }
 
 	/**
 	 * @brief
-	 *  Check if process is still running. If terminated, execute its corresponding termination program.
+	 *  Start the task only after the action of another one has finished.
+	 *
+	 * A dependency that is already finished, or unknown, is satisfied. If a
+	 * dependency is cancelled, this task is cancelled too, as long as the
+	 * scheduler still knows it: a task dropped by `clearQueue()`, or drained
+	 * after a cancellation, is unknown and no longer cancels new dependents.
+	 * @param[in] iTaskId The ID of the task to wait for.
 	 */
-	void poll();
+	void addDependency(const size_t iTaskId) { m_dependencies.push_back(iTaskId); }
 
 private:
-	/// The Task state.
-	State m_state = State::Waiting;
-	/// The future function.
-	std::future<void> m_future;
+	/// The Task state, updated by the worker threads.
+	std::atomic<State> m_state = State::Waiting;
+	/// Next task in the scheduler's list of finished tasks.
+	Task* mp_nextCompleted = nullptr;
 	/// What to run.
-	std::function<void()> m_action;
+	TaskFunction m_action;
 	/// What to do when terminated.
-	std::function<void()> m_termination;
+	TaskFunction m_termination;
 	/// The task ID given by the scheduler.
 	size_t m_taskId = 0;
+	/// The priority class.
+	Priority m_priority = Priority::Interactive;
+	/// The cancellation token, if any.
+	std::optional<CancellationToken> m_token;
+	/// IDs of the tasks to wait for.
+	std::vector<size_t> m_dependencies;
+	/// Dependencies not finished yet, plus one while the task is being pushed.
+	std::atomic<uint32_t> m_pendingDependencies = 0;
+	/// If a dependency has been cancelled.
+	std::atomic_bool m_dependencyCancelled = false;
+	/// Lock of the successor list.
+	std::mutex m_successorsMutex;
+	/// Tasks waiting for this one, released when its action is done.
+	std::vector<shared<Task>> m_successors;
+	/// If the action is done (or skipped): new successors do not wait for it.
+	bool m_actionDone = false;
 
 	friend class Scheduler;
 	friend struct SchedulerImpl;
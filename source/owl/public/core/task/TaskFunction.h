@@ -0,0 +1,177 @@
+/**
+ * @file TaskFunction.h
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright (c) 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+#include "core/Core.h"
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <new>
+
+namespace owl::core::task {
+
+/**
+ * @brief
+ *  Move-only `void()` callable with inline storage.
+ *
+ * Closures up to `g_inlineSize` bytes are stored inside the object, so wrapping
+ * the usual task lambdas (a few shared pointers and values) does not touch the
+ * heap; larger ones fall back to a heap allocation. An empty function does nothing
+ * when called.
+ */
+class TaskFunction final {
+public:
+	/// Size of the inline storage in bytes.
+	static constexpr size_t g_inlineSize = 96;
+
+	/**
+	 * @brief
+	 *  Default constructor: an empty function.
+	 */
+	TaskFunction() = default;
+
+	/**
+	 * @brief
+	 *  Wrap a callable.
+	 * @tparam Callable The callable type.
+	 * @param[in] iCallable The callable.
+	 */
+	template<typename Callable>
+		requires(!std::same_as<std::decay_t<Callable>, TaskFunction> && std::invocable<std::decay_t<Callable>&>)
+	explicit TaskFunction(Callable&& iCallable) {
+		using Stored = std::decay_t<Callable>;
+		if constexpr (isInlinable<Stored>()) {
+			new (m_storage.data()) Stored(std::forward<Callable>(iCallable));
+			mp_operations = &g_inlineOperations<Stored>;
+		} else {
+			*reinterpret_cast<Stored**>(m_storage.data()) = new Stored(std::forward<Callable>(iCallable));
+			mp_operations = &g_heapOperations<Stored>;
+		}
+	}
+
+	/**
+	 * @brief
+	 *  Destructor.
+	 */
+	~TaskFunction() { reset(); }
+
+	/**
+	 * @brief
+	 *  Move constructor.
+	 * @param[in,out] ioOther The function to move from, left empty.
+	 */
+	TaskFunction(TaskFunction&& ioOther) noexcept : mp_operations{ioOther.mp_operations} {
+		if (mp_operations != nullptr)
+			mp_operations->relocate(ioOther.m_storage.data(), m_storage.data());
+		ioOther.mp_operations = nullptr;
+	}
+
+	/**
+	 * @brief
+	 *  Move affectation operator.
+	 * @param[in,out] ioOther The function to move from, left empty.
+	 * @return This function.
+	 */
+	auto operator=(TaskFunction&& ioOther) noexcept -> TaskFunction& {
+		if (this == &ioOther)
+			return *this;
+		reset();
+		mp_operations = ioOther.mp_operations;
+		if (mp_operations != nullptr)
+			mp_operations->relocate(ioOther.m_storage.data(), m_storage.data());
+		ioOther.mp_operations = nullptr;
+		return *this;
+	}
+
+	TaskFunction(const TaskFunction&) = delete;
+
+	auto operator=(const TaskFunction&) -> TaskFunction& = delete;
+
+	/**
+	 * @brief
+	 *  Call the wrapped callable, if any.
+	 */
+	void operator()() {
+		if (mp_operations != nullptr)
+			mp_operations->invoke(m_storage.data());
+	}
+
+	/**
+	 * @brief
+	 *  Check if a callable is wrapped.
+	 * @return True if not empty.
+	 */
+	explicit operator bool() const { return mp_operations != nullptr; }
+
+	/**
+	 * @brief
+	 *  Check if the callable is stored inline.
+	 * @return True if inline, false if on the heap or empty.
+	 */
+	[[nodiscard]] auto isInline() const -> bool { return mp_operations != nullptr && mp_operations->inlined; }
+
+	/**
+	 * @brief
+	 *  Destroy the wrapped callable.
+	 */
+	void reset() {
+		if (mp_operations != nullptr)
+			mp_operations->destroy(m_storage.data());
+		mp_operations = nullptr;
+	}
+
+private:
+	/// Type-erased operations on the stored callable.
+	struct Operations {
+		/// Call the callable.
+		void (*invoke)(std::byte*);
+		/// Move the callable to another storage, destroying the source.
+		void (*relocate)(std::byte*, std::byte*) noexcept;
+		/// Destroy the callable.
+		void (*destroy)(std::byte*) noexcept;
+		/// If the callable lives in the storage.
+		bool inlined;
+	};
+
+	template<typename Stored>
+	static constexpr auto isInlinable() -> bool {
+		return sizeof(Stored) <= g_inlineSize && alignof(Stored) <= alignof(std::max_align_t) &&
+			   std::is_nothrow_move_constructible_v<Stored>;
+	}
+
+	template<typename Stored>
+	static constexpr Operations g_inlineOperations{
+			.invoke = [](std::byte* iStorage) -> void { (*std::launder(reinterpret_cast<Stored*>(iStorage)))(); },
+			.relocate =
+					[](std::byte* iFrom, std::byte* iTo) noexcept -> void {
+						auto* from = std::launder(reinterpret_cast<Stored*>(iFrom));
+						new (iTo) Stored(std::move(*from));
+						from->~Stored();
+					},
+			.destroy = [](std::byte* iStorage) noexcept -> void {
+				std::launder(reinterpret_cast<Stored*>(iStorage))->~Stored();
+			},
+			.inlined = true};
+
+	template<typename Stored>
+	static constexpr Operations g_heapOperations{
+			.invoke = [](std::byte* iStorage) -> void { (**reinterpret_cast<Stored**>(iStorage))(); },
+			.relocate =
+					[](std::byte* iFrom, std::byte* iTo) noexcept -> void {
+						*reinterpret_cast<Stored**>(iTo) = *reinterpret_cast<Stored**>(iFrom);
+					},
+			.destroy = [](std::byte* iStorage) noexcept -> void { delete *reinterpret_cast<Stored**>(iStorage); },
+			.inlined = false};
+
+	/// Storage of the callable, or of a pointer to it.
+	alignas(std::max_align_t) std::array<std::byte, g_inlineSize> m_storage;
+	/// Operations of the stored callable, nullptr if empty.
+	const Operations* mp_operations = nullptr;
+};
+
+}// namespace owl::core::task
@@ -0,0 +1,317 @@
+/**
+ * @file AssetIndex.h
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright (c) 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+
+#include "core/Core.h"
+
+#include <filesystem>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <unordered_map>
+
+namespace owl::core::task {
+class Scheduler;
+}// namespace owl::core::task
+
+namespace owl::data::assets {
+
+/**
+ * @brief
+ *  Index of the files of the asset directories, shared by every `AssetLibrary`.
+ *
+ * Each asset directory (a root) is crawled once and its files are indexed by
+ * file name, so resolving an asset name costs a hash lookup instead of a
+ * recursive walk. The index then follows the file system: on Linux, inotify
+ * watches every indexed directory and the pending events are applied before
+ * each query. Elsewhere, or when the watches cannot be set, a lookup miss
+ * revalidates the directories by their modification time, at most once per
+ * `g_revalidatePeriod`.
+ *
+ * The index can be saved and loaded back: a cached root is revalidated by
+ * comparing directory modification times, and only the changed directories
+ * are listed again, which makes cold starts of large projects cheap.
+ *
+ * All the functions are thread-safe.
+ */
+class OWL_API AssetIndex final {
+public:
+	/// Minimum delay between two revalidations triggered by lookup misses, without file system notifications.
+	static constexpr std::chrono::milliseconds g_revalidatePeriod{1000};
+
+	/**
+	 * @brief
+	 *  Default constructor.
+	 */
+	AssetIndex();
+
+	/**
+	 * @brief
+	 *  Destructor.
+	 */
+	~AssetIndex();
+
+	AssetIndex(const AssetIndex&) = delete;
+
+	AssetIndex(AssetIndex&&) = delete;
+
+	auto operator=(const AssetIndex&) -> AssetIndex& = delete;
+
+	auto operator=(AssetIndex&&) -> AssetIndex& = delete;
+
+	/**
+	 * @brief
+	 *  Access to the index shared by the asset libraries.
+	 * @return The index.
+	 */
+	static auto get() -> AssetIndex&;
+
+	/**
+	 * @brief
+	 *  Index the given roots now, crawling their sub-directories in parallel on a scheduler.
+	 *
+	 * Roots already indexed, or loaded from a cache, are only revalidated.
+	 * @param[in] iRoots The asset directories.
+	 * @param[in,out] ioScheduler Scheduler whose workers crawl the directories.
+	 */
+	void build(std::span<const std::filesystem::path> iRoots, core::task::Scheduler& ioScheduler);
+
+	/**
+	 * @brief
+	 *  Index the given roots now, in parallel on the application's scheduler if there is one.
+	 * @param[in] iRoots The asset directories.
+	 */
+	void build(std::span<const std::filesystem::path> iRoots);
+
+	/**
+	 * @brief
+	 *  Find the file of an asset.
+	 *
+	 * In each root, in order, the name is first tried right under the root, then
+	 * in the sub-directories, shallowest first. A name without extension is tried
+	 * with each given extension, in order. Roots not indexed yet are indexed first.
+	 * @param[in] iRoots The asset directories, by priority.
+	 * @param[in] iName The asset name, a file name or a relative path.
+	 * @param[in] iExtensions Extensions to try when the name has none.
+	 * @return Path to the file or nullopt if not found.
+	 */
+	[[nodiscard]] auto find(std::span<const std::filesystem::path> iRoots, const std::string& iName,
+							std::span<const std::string> iExtensions) -> std::optional<std::filesystem::path>;
+
+	/**
+	 * @brief
+	 *  List the asset files with one of the given extensions.
+	 * @param[in] iRoots The asset directories.
+	 * @param[in] iExtensions The accepted extensions.
+	 * @return The paths relative to their root, sorted per root.
+	 */
+	[[nodiscard]] auto list(std::span<const std::filesystem::path> iRoots, std::span<const std::string> iExtensions)
+			-> std::vector<std::string>;
+
+	/**
+	 * @brief
+	 *  Apply the pending file system notifications.
+	 */
+	void update();
+
+	/**
+	 * @brief
+	 *  Forget a root.
+	 * @param[in] iRoot The asset directory.
+	 */
+	void removeRoot(const std::filesystem::path& iRoot);
+
+	/**
+	 * @brief
+	 *  Forget every root.
+	 */
+	void clear();
+
+	/**
+	 * @brief
+	 *  Save the index.
+	 * @param[in] iFile The cache file.
+	 * @return True on success.
+	 */
+	auto save(const std::filesystem::path& iFile) const -> bool;
+
+	/**
+	 * @brief
+	 *  Load a saved index; its roots are revalidated on first use.
+	 *
+	 * Roots already indexed are kept as they are.
+	 * @param[in] iFile The cache file.
+	 * @return True if the file was a valid index.
+	 */
+	auto load(const std::filesystem::path& iFile) -> bool;
+
+	/**
+	 * @brief
+	 *  Enable or disable the file system notifications.
+	 * @param[in] iWatch True to follow the file system changes.
+	 */
+	void setWatching(bool iWatch);
+
+	/**
+	 * @brief
+	 *  Check if the file system notifications are active.
+	 * @return True if the indexed directories are watched.
+	 */
+	[[nodiscard]] auto isWatching() const -> bool;
+
+	/**
+	 * @brief
+	 *  Number of files indexed under a root.
+	 * @param[in] iRoot The asset directory.
+	 * @return The file count, 0 for a root not indexed.
+	 */
+	[[nodiscard]] auto getFileCount(const std::filesystem::path& iRoot) const -> size_t;
+
+private:
+	/// Content of an indexed directory.
+	struct Directory {
+		/// Modification time when listed.
+		int64_t stamp = 0;
+		/// File names.
+		std::vector<std::string> files;
+		/// File system watch, -1 if none.
+		int watch = -1;
+	};
+	/// An indexed asset directory.
+	struct Root {
+		/// Absolute path.
+		std::filesystem::path path;
+		/// Directories by path relative to the root, in generic form; the root itself is "".
+		std::map<std::string, Directory> directories;
+		/// Directories holding each file name.
+		std::unordered_map<std::string, std::vector<std::string>> byName;
+		/// If the directories must be checked against the file system before use.
+		bool needValidation = false;
+	};
+	/// Root and directory of a file system watch.
+	struct Watch {
+		/// The root.
+		Root* root = nullptr;
+		/// The directory relative to the root.
+		std::string directory;
+	};
+
+	/**
+	 * @brief
+	 *  Get an indexed root, indexing or revalidating it if needed.
+	 * @param[in] iRoot The root path.
+	 * @param[in] ioScheduler Scheduler for a parallel crawl, may be null.
+	 * @return The root, or nullptr if the directory does not exist.
+	 */
+	auto acquireRoot(const std::filesystem::path& iRoot, core::task::Scheduler* ioScheduler) -> Root*;
+	/**
+	 * @brief
+	 *  List a directory and all its sub-directories into the root.
+	 * @param[in,out] ioRoot The root.
+	 * @param[in] iDirectory The directory relative to the root.
+	 * @param[in] ioScheduler Scheduler for a parallel crawl, may be null.
+	 */
+	void scanTree(Root& ioRoot, const std::string& iDirectory, core::task::Scheduler* ioScheduler);
+	/**
+	 * @brief
+	 *  Replace the content of a directory.
+	 * @param[in,out] ioRoot The root.
+	 * @param[in] iDirectory The directory relative to the root.
+	 * @param[in] iContent The new content.
+	 */
+	void setDirectory(Root& ioRoot, const std::string& iDirectory, Directory&& iContent);
+	/**
+	 * @brief
+	 *  Remove a directory and all its sub-directories from the root.
+	 * @param[in,out] ioRoot The root.
+	 * @param[in] iDirectory The directory relative to the root.
+	 */
+	void removeTree(Root& ioRoot, const std::string& iDirectory);
+	/**
+	 * @brief
+	 *  Add or remove one file.
+	 * @param[in,out] ioRoot The root.
+	 * @param[in] iDirectory The directory relative to the root.
+	 * @param[in] iName The file name.
+	 * @param[in] iPresent True to add, false to remove.
+	 */
+	static void setFile(Root& ioRoot, const std::string& iDirectory, const std::string& iName, bool iPresent);
+	/**
+	 * @brief
+	 *  Remove a directory from the holders of a file name.
+	 * @param[in,out] ioRoot The root.
+	 * @param[in] iDirectory The directory relative to the root.
+	 * @param[in] iName The file name.
+	 */
+	static void unlinkName(Root& ioRoot, const std::string& iDirectory, const std::string& iName);
+	/**
+	 * @brief
+	 *  List again the directories whose modification time changed.
+	 * @param[in,out] ioRoot The root.
+	 */
+	void validate(Root& ioRoot);
+	/**
+	 * @brief
+	 *  Revalidate all the roots after a miss, when nothing else keeps the index up to date.
+	 * @return False if the last revalidation is too recent.
+	 */
+	auto revalidateOnMiss() -> bool;
+	/**
+	 * @brief
+	 *  Open the notification handle if watching is wanted and possible.
+	 */
+	void startNotifications();
+	/**
+	 * @brief
+	 *  Close the notification handle and forget every watch.
+	 */
+	void stopNotifications();
+	/**
+	 * @brief
+	 *  Check if the file system notifications are active, with the lock held.
+	 * @return True if the indexed directories are watched.
+	 */
+	[[nodiscard]] auto isWatchingUnlocked() const -> bool { return m_notifyHandle >= 0; }
+	/**
+	 * @brief
+	 *  Start watching a directory.
+	 * @param[in,out] ioRoot The root.
+	 * @param[in] iDirectory The directory relative to the root.
+	 */
+	void watch(Root& ioRoot, const std::string& iDirectory);
+	/**
+	 * @brief
+	 *  Stop watching a directory.
+	 * @param[in,out] ioDirectory The directory.
+	 */
+	void unwatch(Directory& ioDirectory);
+	/**
+	 * @brief
+	 *  Apply the pending notifications, with the lock held.
+	 */
+	void processEvents();
+
+	/// Indexed roots, by absolute generic path.
+	std::unordered_map<std::string, uniq<Root>> m_roots;
+	/// File system watches.
+	std::unordered_map<int, Watch> m_watches;
+	/// Notification handle, -1 if none.
+	int m_notifyHandle = -1;
+	/// If file system notifications are wanted.
+	bool m_watching = true;
+	/// If file system notifications could not be set up; they are not retried.
+	bool m_notifyFailed = false;
+	/// Time of the last revalidation after a miss.
+	std::chrono::steady_clock::time_point m_lastRevalidation;
+	/// Access lock.
+	mutable std::mutex m_mutex;
+};
+
+}// namespace owl::data::assets
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "data/assets/Asset.h"
+#include "data/assets/AssetIndex.h"
 
 #include "app/Application.h"
 
@@ -21,6 +22,17 @@ concept hasStringSpec = requires {
 	{ T::stringToSpecification(std::declval<const std::string&>()) } -> std::same_as<typename T::Specification>;
 };
 
+/**
+ * @brief
+ *  Concept that check existence of a lookup of the specification in the application's asset pack.
+ */
+template<typename T>
+concept hasPackSpec = requires {
+	{
+		T::packSpecification(std::declval<const std::string&>())
+	} -> std::same_as<std::optional<typename T::Specification>>;
+};
+
 /**
  * @brief
  *  Namespace for asset management.
@@ -92,7 +104,14 @@ public:
 			return m_assets.at(iName).get();
 		}
 		shared<DataType> asset = nullptr;
-		if (!DataType::extension().empty()) {
+		if constexpr (hasPackSpec<DataType>) {
+			// Packed assets take precedence over the asset folders.
+			if (const auto packSpec = DataType::packSpecification(iName); packSpec.has_value())
+				asset = DataType::create(packSpec.value());
+		}
+		if (asset != nullptr) {
+			OWL_CORE_TRACE("Asset {} found in the pack.", iName)
+		} else if (!DataType::extension().empty()) {
 			auto assetFile = find(iName);
 			if (!assetFile.has_value()) {
 				OWL_CORE_WARN("AssetLibrary::load({}) does not exist in asset folders!", iName)
@@ -191,25 +210,7 @@ public:
 	[[nodiscard]] auto list() const -> std::vector<std::string> {
 		if (AssetType::extensions().empty())
 			return {};
-		std::vector<std::string> result;
-		std::vector<std::string> ext = AssetType::extensions();
-		// get a list of directory to search.
-		std::list<app::Application::AssetDirectory> assetDirectories;
-		if (app::Application::instanced()) {
-			assetDirectories = app::Application::get().getAssetDirectories();
-		} else {
-			assetDirectories.push_back({"cwd", std::filesystem::current_path()});
-		}
-		for (const auto& [title, assetsPath]: assetDirectories) {
-			if (!std::filesystem::exists(assetsPath))
-				continue;
-			for (const auto& entry: std::filesystem::recursive_directory_iterator(assetsPath)) {
-				if (std::find(ext.begin(), ext.end(), entry.path().extension()) != ext.end()) {
-					result.push_back(relative(entry.path(), assetsPath).string());
-				}
-			}
-		}
-		return result;
+		return AssetIndex::get().list(assetRoots(), AssetType::extensions());
 	}
 
 	/**
@@ -221,54 +222,24 @@ public:
 	[[nodiscard]] auto find(const std::string& iName) const -> std::optional<std::filesystem::path> {
 		if (AssetType::extensions().empty())
 			return std::nullopt;
-		const std::vector<std::string> ext = AssetType::extensions();
-		// get a list of directory to search.
-		std::list<app::Application::AssetDirectory> assetDirectories;
-		if (app::Application::instanced()) {
-			assetDirectories = app::Application::get().getAssetDirectories();
-		} else {
-			assetDirectories.push_back({"cwd", std::filesystem::current_path()});
-		}
-		const std::filesystem::path name(iName);
-		const bool hasExtension = name.has_extension();
-		for (const auto& [title, assetsPath]: assetDirectories) {
-			// check base folders
-			{
-				std::filesystem::path filePath = assetsPath / name;
-				if (hasExtension) {
-					if (std::filesystem::exists(filePath))
-						return filePath;
-				} else {
-					for (const auto& e: ext) {
-						std::filesystem::path filePathWithExt = filePath.string() + e;
-						if (std::filesystem::exists(filePathWithExt))
-							return filePathWithExt;
-					}
-				}
-			}
-			// Check sub-folders
-			if (!std::filesystem::exists(assetsPath))
-				continue;
-			for (const auto& entry: std::filesystem::recursive_directory_iterator(assetsPath)) {
-				if (!entry.is_directory())
-					continue;
-				std::filesystem::path filePath = entry.path() / name;
-				if (hasExtension) {
-					if (std::filesystem::exists(filePath))
-						return filePath;
-				} else {
-					for (const auto& e: ext) {
-						filePath.replace_extension(e);
-						if (std::filesystem::exists(filePath))
-							return filePath;
-					}
-				}
-			}
-		}
-		return std::nullopt;
+		return AssetIndex::get().find(assetRoots(), iName, AssetType::extensions());
 	}
 
 private:
+	/**
+	 * @brief
+	 *  Directories to search, by priority.
+	 * @return The application's asset directories, or the current directory without application.
+	 */
+	static auto assetRoots() -> std::vector<std::filesystem::path> {
+		if (!app::Application::instanced())
+			return {std::filesystem::current_path()};
+		std::vector<std::filesystem::path> roots;
+		for (const auto& [title, assetsPath]: app::Application::get().getAssetDirectories())
+			roots.push_back(assetsPath);
+		return roots;
+	}
+
 	/// The list of assets.
 	std::unordered_map<std::string, AssetType> m_assets;
 };
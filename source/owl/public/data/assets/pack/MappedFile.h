@@ -0,0 +1,81 @@
+/**
+ * @file MappedFile.h
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright (c) 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+
+#include "core/Core.h"
+
+#include <filesystem>
+#include <span>
+
+namespace owl::data::assets::pack {
+
+/**
+ * @brief
+ *  Read-only memory mapping of a whole file.
+ *
+ * Wraps `mmap` (POSIX) or `CreateFileMapping` / `MapViewOfFile` (Windows). The
+ * mapped bytes stay valid until `unmap()` or destruction, and can be read from
+ * any number of threads at once since nothing is ever written or re-seeked.
+ */
+class OWL_API MappedFile final {
+public:
+	MappedFile() = default;
+
+	/**
+	 * @brief
+	 *  Destructor, releases the mapping.
+	 */
+	~MappedFile();
+
+	MappedFile(const MappedFile&) = delete;
+
+	MappedFile(MappedFile&& ioOther) noexcept;
+
+	auto operator=(const MappedFile&) -> MappedFile& = delete;
+
+	auto operator=(MappedFile&& ioOther) noexcept -> MappedFile&;
+
+	/**
+	 * @brief
+	 *  Map a file in memory, releasing any previous mapping.
+	 * @param[in] iFile Path to the file.
+	 * @return True if the file is mapped (an empty file is never mapped).
+	 */
+	[[nodiscard]] auto map(const std::filesystem::path& iFile) -> bool;
+
+	/**
+	 * @brief
+	 *  Release the mapping.
+	 */
+	void unmap();
+
+	/**
+	 * @brief
+	 *  Check if a file is currently mapped.
+	 * @return True if mapped.
+	 */
+	[[nodiscard]] auto isMapped() const -> bool { return mp_data != nullptr; }
+
+	/**
+	 * @brief
+	 *  Access the mapped bytes.
+	 * @return The whole file content, empty when nothing is mapped.
+	 */
+	[[nodiscard]] auto bytes() const -> std::span<const uint8_t> { return {mp_data, m_size}; }
+
+private:
+	/// First mapped byte.
+	const uint8_t* mp_data = nullptr;
+	/// Size of the mapping in bytes.
+	size_t m_size = 0;
+	/// Native mapping handle (only used on Windows).
+	void* mp_handle = nullptr;
+};
+
+}// namespace owl::data::assets::pack
@@ -12,6 +12,7 @@
 
 #include <array>
 #include <cstdint>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -19,8 +20,14 @@ namespace owl::data::assets::pack {
 /// Magic bytes identifying an Owl pack file.
 constexpr std::array<char, 4> g_packMagic = {'O', 'W', 'L', 'P'};
 
-/// Current pack format version.
-constexpr uint8_t g_packVersion = 1;
+/// Current pack format version (2: large compressed entries are split into independently compressed frames).
+constexpr uint8_t g_packVersion = 2;
+
+/// Oldest pack format version still readable.
+constexpr uint8_t g_packMinVersion = 1;
+
+/// Default uncompressed size of one zstd frame in a framed entry.
+constexpr uint32_t g_packFrameSize = 256 * 1024;
 
 /// Pack file flags.
 enum struct PackFlags : uint8_t {
@@ -79,6 +86,17 @@ struct TocEntry {
 	uint64_t dataSize = 0;
 	uint64_t originalSize = 0;
 	AssetType assetType = AssetType::Other;
+	/// Uncompressed size of each frame (the last one may be shorter), 0 when the entry is a single blob.
+	uint32_t frameSize = 0;
+	/// Offset of each compressed frame relative to `dataOffset` (frame i ends where frame i+1 starts).
+	std::vector<uint64_t> frameOffsets;
+
+	/**
+	 * @brief
+	 *  Check if the entry is stored as independent frames.
+	 * @return True when framed.
+	 */
+	[[nodiscard]] auto isFramed() const -> bool { return frameSize > 0 && !frameOffsets.empty(); }
 };
 
 /**
@@ -89,13 +107,24 @@ struct TocEntry {
  */
 OWL_API auto hashPath(const std::string& iPath) -> uint64_t;
 
+/**
+ * @brief
+ *  Compute a 64-bit hash of an entry's content, used to find duplicated assets.
+ *
+ * Word-wise FNV-1a variant with a final avalanche; equal hashes must still be confirmed byte by byte.
+ * @param[in] iData The bytes to hash.
+ * @return The hash value.
+ */
+OWL_API auto hashContent(std::span<const uint8_t> iData) -> uint64_t;
+
 /**
  * @brief
  *  Obfuscate or deobfuscate a buffer in-place (XOR, symmetric).
  * @param[in,out] ioBuffer The buffer to transform.
  * @param[in] iEntryIndex Entry index used as part of the rolling key.
+ * @param[in] iBlockOffset Position of the buffer inside the entry's block, to transform a slice of it on its own.
  */
-OWL_API void obfuscateBuffer(std::vector<uint8_t>& ioBuffer, uint32_t iEntryIndex);
+OWL_API void obfuscateBuffer(std::span<uint8_t> ioBuffer, uint32_t iEntryIndex, uint64_t iBlockOffset = 0);
 
 /**
  * @brief
@@ -108,26 +137,50 @@ OWL_API auto compressBuffer(const std::vector<uint8_t>& iData) -> std::vector<ui
 /**
  * @brief
  *  Decompress a zstd-compressed buffer.
- * @param[in] iCompressed The compressed data.
+ * @param[in] iCompressed The compressed data (a vector, or a view straight into a mapped pack).
  * @param[in] iOriginalSize The expected original size.
  * @return The decompressed data, or empty on failure.
  */
-OWL_API auto decompressBuffer(const std::vector<uint8_t>& iCompressed, uint64_t iOriginalSize) -> std::vector<uint8_t>;
+OWL_API auto decompressBuffer(std::span<const uint8_t> iCompressed, uint64_t iOriginalSize) -> std::vector<uint8_t>;
+
+/**
+ * @brief
+ *  Decompress a zstd-compressed buffer into caller-provided memory.
+ * @param[in] iCompressed The compressed data.
+ * @param[out] oDestination Destination, sized to the exact original size.
+ * @return True if the whole destination was filled.
+ */
+OWL_API auto decompressInto(std::span<const uint8_t> iCompressed, std::span<uint8_t> oDestination) -> bool;
+
+/**
+ * @brief
+ *  Compress a buffer as a sequence of independent zstd frames.
+ * @param[in] iData The raw data to compress.
+ * @param[in] iFrameSize Uncompressed size of each frame.
+ * @param[out] oFrameOffsets Offset of each frame in the returned buffer.
+ * @return The concatenated frames, or empty on failure.
+ */
+OWL_API auto compressFrames(std::span<const uint8_t> iData, uint32_t iFrameSize, std::vector<uint64_t>& oFrameOffsets)
+		-> std::vector<uint8_t>;
 
 /**
  * @brief
  *  Serialize TOC entries to binary.
  * @param[in] iEntries The entries to serialize.
+ * @param[in] iVersion Pack format version to encode (frame indices exist from version 2).
  * @return The serialized binary data.
  */
-OWL_API auto serializeToc(const std::vector<TocEntry>& iEntries) -> std::vector<uint8_t>;
+OWL_API auto serializeToc(const std::vector<TocEntry>& iEntries, uint16_t iVersion = g_packVersion)
+		-> std::vector<uint8_t>;
 
 /**
  * @brief
  *  Deserialize TOC entries from binary.
  * @param[in] iData The binary data.
+ * @param[in] iVersion Pack format version the data was encoded with.
  * @return The deserialized entries, or empty on failure.
  */
-OWL_API auto deserializeToc(const std::vector<uint8_t>& iData) -> std::vector<TocEntry>;
+OWL_API auto deserializeToc(const std::vector<uint8_t>& iData, uint16_t iVersion = g_packVersion)
+		-> std::vector<TocEntry>;
 
 }// namespace owl::data::assets::pack
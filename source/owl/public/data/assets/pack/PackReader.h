@@ -8,15 +8,22 @@
 
 #pragma once
 
+#include "MappedFile.h"
 #include "PackFormat.h"
 
 #include "core/expected.h"
 
 #include <filesystem>
 #include <fstream>
+#include <mutex>
 #include <optional>
+#include <span>
 #include <unordered_map>
 
+namespace owl::core::task {
+class Scheduler;
+}// namespace owl::core::task
+
 namespace owl::data::assets::pack {
 
 /**
@@ -33,9 +40,23 @@ enum struct PackOpenError : uint8_t {
 	TocSizeMismatch,///< Decoded TOC entry count differs from the header's claim.
 };
 
+/**
+ * @brief
+ *  How a `PackReader` accesses the pack file.
+ */
+enum struct PackReadMode : uint8_t {
+	Stream,///< Seek-and-read through a file stream; concurrent reads are serialised on a mutex.
+	Mapped,///< Memory-map the whole file; reads are lock-free and uncompressed entries are zero-copy.
+};
+
 /**
  * @brief
  *  Reads Owl pack files at runtime.
+ *
+ * Every const member is safe to call from several threads at once, which lets
+ * loaders decode entries from worker tasks. In `Mapped` mode, nothing is shared
+ * but the read-only mapping; in `Stream` mode only the block read itself is
+ * serialised, and de-obfuscation and decompression still run concurrently.
  */
 class OWL_API PackReader final {
 public:
@@ -62,17 +83,24 @@ public:
 	 * Convenience wrapper over `tryOpen` that discards the failure reason. Prefer `tryOpen`
 	 * when the caller needs to react to the specific error.
 	 * @param[in] iPackFile Path to the pack file.
+	 * @param[in] iMode Requested access mode.
 	 * @return True if the pack was opened successfully.
 	 */
-	[[nodiscard]] auto open(const std::filesystem::path& iPackFile) -> bool;
+	[[nodiscard]] auto open(const std::filesystem::path& iPackFile, PackReadMode iMode = PackReadMode::Mapped)
+			-> bool;
 
 	/**
 	 * @brief
 	 *  Open a pack file and read its table of contents, returning a categorised error on failure.
+	 *
+	 * When `Mapped` is requested but the file cannot be mapped, the reader falls back to `Stream`;
+	 * `getReadMode()` reports the mode actually in use.
 	 * @param[in] iPackFile Path to the pack file.
+	 * @param[in] iMode Requested access mode.
 	 * @return Empty success on success, or `owl::unexpected{PackOpenError::*}` on failure.
 	 */
-	[[nodiscard]] auto tryOpen(const std::filesystem::path& iPackFile) -> owl::expected<void, PackOpenError>;
+	[[nodiscard]] auto tryOpen(const std::filesystem::path& iPackFile, PackReadMode iMode = PackReadMode::Mapped)
+			-> owl::expected<void, PackOpenError>;
 
 	/**
 	 * @brief
@@ -96,6 +124,50 @@ public:
 	 */
 	[[nodiscard]] auto readEntry(const std::string& iPath) const -> std::optional<std::vector<uint8_t>>;
 
+	/**
+	 * @brief
+	 *  Zero-copy view of an entry's bytes.
+	 *
+	 * Only available in `Mapped` mode on packs written without compression nor obfuscation,
+	 * where the stored block is the asset itself. The view is valid until the reader is closed.
+	 * @param[in] iPath The asset path.
+	 * @return The entry bytes, or nullopt if the entry is missing or needs decoding (use `readEntry`).
+	 */
+	[[nodiscard]] auto viewEntry(const std::string& iPath) const -> std::optional<std::span<const uint8_t>>;
+
+	/**
+	 * @brief
+	 *  Read part of an entry without decoding the rest of it.
+	 *
+	 * Framed entries (format version 2) only decompress the frames overlapping the range;
+	 * uncompressed entries read just the slice. Single-blob compressed entries still need a full decode.
+	 * @param[in] iPath The asset path.
+	 * @param[in] iOffset First byte to read, in the uncompressed entry.
+	 * @param[in] iLength Number of bytes, clamped to the end of the entry.
+	 * @return The bytes, or nullopt if the entry is missing, the offset is past its end or decoding failed.
+	 */
+	[[nodiscard]] auto readRange(const std::string& iPath, uint64_t iOffset, uint64_t iLength) const
+			-> std::optional<std::vector<uint8_t>>;
+
+	/**
+	 * @brief
+	 *  Read and decompress several entries in parallel on a task scheduler.
+	 * @param[in] iPaths The asset paths.
+	 * @param[in,out] ioScheduler Scheduler whose workers decode the entries.
+	 * @return One result per path, in the same order (nullopt for missing or corrupted entries).
+	 */
+	[[nodiscard]] auto readEntries(std::span<const std::string> iPaths, core::task::Scheduler& ioScheduler) const
+			-> std::vector<std::optional<std::vector<uint8_t>>>;
+
+	/**
+	 * @brief
+	 *  Read and decompress several entries, in parallel on the application's scheduler if there is one.
+	 * @param[in] iPaths The asset paths.
+	 * @return One result per path, in the same order (nullopt for missing or corrupted entries).
+	 */
+	[[nodiscard]] auto readEntries(std::span<const std::string> iPaths) const
+			-> std::vector<std::optional<std::vector<uint8_t>>>;
+
 	/**
 	 * @brief
 	 *  List all entry paths in the pack.
@@ -124,7 +196,14 @@ public:
 	 *  Check if a pack file is currently open.
 	 * @return True if open.
 	 */
-	[[nodiscard]] auto isOpen() const -> bool { return m_fileStream.is_open(); }
+	[[nodiscard]] auto isOpen() const -> bool { return m_mapping.isMapped() || m_fileStream.is_open(); }
+
+	/**
+	 * @brief
+	 *  Get the access mode in use.
+	 * @return The read mode (meaningless when closed).
+	 */
+	[[nodiscard]] auto getReadMode() const -> PackReadMode { return m_mode; }
 
 	/**
 	 * @brief
@@ -142,14 +221,67 @@ private:
 	 */
 	[[nodiscard]] auto findEntry(const std::string& iPath) const -> const TocEntry*;
 
-	/// Open pack file stream — `mutable` so const lookups can re-seek for blob reads.
+	/**
+	 * @brief
+	 *  Obfuscation key of an entry's blob: the TOC index of the first entry stored at its offset.
+	 * @param[in] iEntry The entry.
+	 * @return The key, or nullopt if the entry is not indexed.
+	 */
+	[[nodiscard]] auto obfuscationKey(const TocEntry& iEntry) const -> std::optional<uint32_t>;
+
+	/**
+	 * @brief
+	 *  Bounds-checked view into the mapping.
+	 * @param[in] iOffset Offset in the file.
+	 * @param[in] iSize Number of bytes.
+	 * @return The view, or nullopt when out of the mapped range.
+	 */
+	[[nodiscard]] auto mappedBlock(uint64_t iOffset, uint64_t iSize) const -> std::optional<std::span<const uint8_t>>;
+
+	/**
+	 * @brief
+	 *  Copy raw bytes out of the pack, whatever the read mode.
+	 * @param[in] iOffset Offset in the file.
+	 * @param[in] iSize Number of bytes.
+	 * @return The bytes, or nullopt on a short or failed read.
+	 */
+	[[nodiscard]] auto readRaw(uint64_t iOffset, uint64_t iSize) const -> std::optional<std::vector<uint8_t>>;
+
+	/**
+	 * @brief
+	 *  Turn a stored block back into the asset bytes.
+	 * @param[in] iEntry The entry to decode.
+	 * @return The decoded data, or nullopt on failure.
+	 */
+	[[nodiscard]] auto decodeEntry(const TocEntry& iEntry) const -> std::optional<std::vector<uint8_t>>;
+
+	/**
+	 * @brief
+	 *  Decode one frame of a framed entry.
+	 * @param[in] iEntry The framed entry.
+	 * @param[in] iFrame Frame index.
+	 * @param[out] oDestination Destination, sized to the frame's uncompressed size.
+	 * @return True on success.
+	 */
+	[[nodiscard]] auto decodeFrame(const TocEntry& iEntry, size_t iFrame, std::span<uint8_t> oDestination) const
+			-> bool;
+
+	/// Mapping of the whole pack file (`Mapped` mode).
+	MappedFile m_mapping;
+	/// Open pack file stream (`Stream` mode) — `mutable` so const lookups can re-seek for blob reads.
 	mutable std::ifstream m_fileStream;
+	/// Serialises seek + read on `m_fileStream` (boxed to keep the reader movable).
+	uniq<std::mutex> m_streamMutex = mkUniq<std::mutex>();
+	/// Access mode in use.
+	PackReadMode m_mode = PackReadMode::Mapped;
 	/// Cached pack header (magic, version, TOC offset/size).
 	PackHeader m_header{};
 	/// Table of contents — one entry per packed asset.
 	std::vector<TocEntry> m_toc;
 	/// Path-hash → TOC index, for O(1) `loadEntry()` lookups.
 	std::unordered_map<uint64_t, size_t> m_hashIndex;
+	/// Obfuscation key per TOC entry (differs from the index for deduplicated entries).
+	std::vector<uint32_t> m_obfuscationKeys;
 };
 
 }// namespace owl::data::assets::pack
@@ -12,6 +12,11 @@
 
 #include <filesystem>
 #include <functional>
+#include <optional>
+
+namespace owl::core::task {
+class Scheduler;
+}// namespace owl::core::task
 
 namespace owl::data::assets::pack {
 /**
@@ -58,6 +63,10 @@ public:
 	/**
 	 * @brief
 	 *  Write the pack file to disk.
+	 *
+	 * Entries are compressed and obfuscated in parallel on the task scheduler, then written in
+	 * insertion order, so the file is byte-identical to a serial write. Entries with the same
+	 * content are stored once; their TOC entries all point to the first copy.
 	 * @param[in] iOutputFile The output file path.
 	 * @param[in] iFlags Pack flags (compression, obfuscation).
 	 * @param[in] iProgress Optional progress callback invoked per entry.
@@ -81,6 +90,27 @@ public:
 	 */
 	void clear() { m_entries.clear(); }
 
+	/**
+	 * @brief
+	 *  Set the uncompressed frame size used to split large compressed entries.
+	 * @param[in] iFrameSize Frame size in bytes; 0 stores every entry as a single blob.
+	 */
+	void setFrameSize(const uint32_t iFrameSize) { m_frameSize = iFrameSize; }
+
+	/**
+	 * @brief
+	 *  Get the uncompressed frame size used to split large compressed entries.
+	 * @return Frame size in bytes (0 when framing is disabled).
+	 */
+	[[nodiscard]] auto getFrameSize() const -> uint32_t { return m_frameSize; }
+
+	/**
+	 * @brief
+	 *  Set the scheduler used to encode entries in parallel.
+	 * @param[in] ioScheduler The scheduler, or nullptr to use the application's one (serial without application).
+	 */
+	void setScheduler(core::task::Scheduler* ioScheduler) { mp_scheduler = ioScheduler; }
+
 private:
 	/**
 	 * @brief
@@ -94,8 +124,37 @@ private:
 		/// Type of asset.
 		AssetType assetType;
 	};
+	/**
+	 * @brief
+	 *  Entry block as stored in the pack.
+	 */
+	struct EncodedBlock {
+		/// Compressed and/or obfuscated bytes.
+		std::vector<uint8_t> data;
+		/// Uncompressed frame size (0 for a single blob).
+		uint32_t frameSize = 0;
+		/// Offset of each frame in `data`.
+		std::vector<uint64_t> frameOffsets;
+	};
+
+	/**
+	 * @brief
+	 *  Compress and obfuscate one entry.
+	 * @param[in] iRawData The entry bytes.
+	 * @param[in] iEntryIndex TOC index of the entry (obfuscation key).
+	 * @param[in] iCompress Compress the entry.
+	 * @param[in] iObfuscate Obfuscate the entry.
+	 * @return The block, or nullopt if compression failed.
+	 */
+	[[nodiscard]] auto encodeBlock(const std::vector<uint8_t>& iRawData, uint32_t iEntryIndex, bool iCompress,
+								   bool iObfuscate) const -> std::optional<EncodedBlock>;
+
 	/// The entries.
 	std::vector<PendingEntry> m_entries;
+	/// Uncompressed frame size of large compressed entries.
+	uint32_t m_frameSize = g_packFrameSize;
+	/// Scheduler used for parallel encoding (nullptr: the application's one).
+	core::task::Scheduler* mp_scheduler = nullptr;
 };
 
 }// namespace owl::data::assets::pack
@@ -0,0 +1,93 @@
+/**
+ * @file ChunkSnapshot.h
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright (c) 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+
+#include "data/voxel/ChunkMesher.h"
+#include "data/voxel/VoxelWorld.h"
+
+#include <vector>
+
+namespace owl::data::voxel {
+
+/**
+ * @brief
+ *  Immutable copy of a chunk and the one-block border of its neighbours, meshable off the main thread.
+ *
+ * `capture` copies the chunk and reads the blocks of the 26 surrounding chunks
+ * that the mesher can sample (face culling uses the 6 face neighbours, ambient
+ * occlusion also reaches edge and corner cells) into a padded
+ * `(g_ChunkSize + 2)³` apron. Once captured, the snapshot no longer touches the
+ * `VoxelWorld`, so a worker can mesh it while the main thread keeps editing and
+ * streaming the world.
+ */
+class OWL_API ChunkSnapshot final {
+public:
+	ChunkSnapshot() = default;
+
+	~ChunkSnapshot() = default;
+
+	ChunkSnapshot(const ChunkSnapshot&) = default;
+
+	ChunkSnapshot(ChunkSnapshot&&) = default;
+
+	auto operator=(const ChunkSnapshot&) -> ChunkSnapshot& = default;
+
+	auto operator=(ChunkSnapshot&&) -> ChunkSnapshot& = default;
+
+	/**
+	 * @brief
+	 *  Capture a chunk and its neighbour border from a world.
+	 * @param[in] iWorld The world to read from.
+	 * @param[in] iCoord The chunk coordinate (an absent chunk captures as all air).
+	 * @return The snapshot.
+	 */
+	[[nodiscard]] static auto capture(const VoxelWorld& iWorld, const math::vec3i& iCoord) -> ChunkSnapshot;
+
+	/**
+	 * @brief
+	 *  The captured chunk.
+	 * @return The chunk copy.
+	 */
+	[[nodiscard]] auto getChunk() const noexcept -> const Chunk& { return m_chunk; }
+
+	/**
+	 * @brief
+	 *  The captured chunk coordinate.
+	 * @return The chunk coordinate.
+	 */
+	[[nodiscard]] auto getCoord() const noexcept -> const math::vec3i& { return m_chunk.getCoord(); }
+
+	/**
+	 * @brief
+	 *  Read a block at chunk-local coordinates, including the one-block border.
+	 * @param[in] iX Local x in `[-1, g_ChunkSize]`.
+	 * @param[in] iY Local y in `[-1, g_ChunkSize]`.
+	 * @param[in] iZ Local z in `[-1, g_ChunkSize]`.
+	 * @return The block id (air outside the captured range).
+	 */
+	[[nodiscard]] auto getBlock(int32_t iX, int32_t iY, int32_t iZ) const -> BlockId;
+
+	/**
+	 * @brief
+	 *  Mesh the snapshot into opaque and transparent geometry (see `ChunkMesher::meshByKind`).
+	 * @param[in] iRegistry The block registry resolving render kind and face textures.
+	 * @param[in] iAmbientOcclusion When true, bake per-vertex ambient occlusion.
+	 * @return The opaque and transparent meshes (either may be empty).
+	 */
+	[[nodiscard]] auto meshByKind(const BlockRegistry& iRegistry, bool iAmbientOcclusion = true) const
+			-> ChunkMeshSet;
+
+private:
+	/// Copy of the meshed chunk.
+	Chunk m_chunk;
+	/// Padded `(g_ChunkSize + 2)³` block ids; only the border shell is filled (the interior reads `m_chunk`).
+	std::vector<BlockId> m_apron;
+};
+
+}// namespace owl::data::voxel
@@ -0,0 +1,105 @@
+/**
+ * @file ChunkStreamPlanner.h
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright (c) 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+
+#include "core/Core.h"
+#include "math/vectors.h"
+
+#include <functional>
+#include <vector>
+
+namespace owl::data::voxel {
+
+/**
+ * @brief
+ *  Chooses which missing chunks a streamed voxel world should generate next.
+ *
+ * The planner owns a table of chunk offsets covering the streaming volume
+ * (`(2r+1)² · (2h+1)` cells) sorted once by distance from the centre, so the
+ * table reads as concentric rings. Each frame it resumes from a scan cursor:
+ * every offset before the cursor is known to be resident or in flight, so in
+ * the steady state the per-frame cost is proportional to the budget instead of
+ * the whole volume. The nearest missing candidates are then re-ranked by the
+ * view direction so chunks in front of the camera are requested first.
+ *
+ * The cursor is reset whenever the centre chunk moves or the streaming extent
+ * changes; callers that drop chunks behind the planner's back (e.g. a world
+ * regeneration) must call `reset()`.
+ */
+class OWL_API ChunkStreamPlanner final {
+public:
+	ChunkStreamPlanner() = default;
+
+	~ChunkStreamPlanner() = default;
+
+	ChunkStreamPlanner(const ChunkStreamPlanner&) = default;
+
+	ChunkStreamPlanner(ChunkStreamPlanner&&) = default;
+
+	auto operator=(const ChunkStreamPlanner&) -> ChunkStreamPlanner& = default;
+
+	auto operator=(ChunkStreamPlanner&&) -> ChunkStreamPlanner& = default;
+
+	/// Predicate telling whether a chunk coordinate is already resident or being generated.
+	using KnownPredicate = std::function<bool(const math::vec3i&)>;
+
+	/**
+	 * @brief
+	 *  Set the streaming extent, rebuilding the ring-ordered offset table if it changed.
+	 * @param[in] iRadius Horizontal radius in chunks (X/Z); negative values clamp to 0.
+	 * @param[in] iHeight Vertical half-extent in chunks (Y); negative values clamp to 0.
+	 */
+	void configure(int32_t iRadius, int32_t iHeight);
+
+	/**
+	 * @brief
+	 *  Select up to `iBudget` missing chunks around a centre, nearest and most in view first.
+	 * @param[in] iCenter The chunk coordinate the volume is centred on (usually the camera's chunk).
+	 * @param[in] iViewDirection World-space view direction; a zero vector disables the view bias.
+	 * @param[in] iBudget Maximum number of coordinates to return.
+	 * @param[in] iIsKnown Predicate returning true for chunks that must not be requested.
+	 * @return The chunk coordinates to generate, in priority order.
+	 */
+	[[nodiscard]] auto plan(const math::vec3i& iCenter, const math::vec3& iViewDirection, size_t iBudget,
+							const KnownPredicate& iIsKnown) -> std::vector<math::vec3i>;
+
+	/**
+	 * @brief
+	 *  Forget the scan cursor so the next `plan` rescans the volume from the centre.
+	 */
+	void reset() noexcept { m_cursor = 0; }
+
+	/**
+	 * @brief
+	 *  Number of leading offsets known to be resident or pending.
+	 * @return The scan cursor.
+	 */
+	[[nodiscard]] auto getCursor() const noexcept -> size_t { return m_cursor; }
+
+	/**
+	 * @brief
+	 *  The ring-ordered offset table (nearest first).
+	 * @return The chunk offsets relative to the centre.
+	 */
+	[[nodiscard]] auto getOffsets() const noexcept -> const std::vector<math::vec3i>& { return m_offsets; }
+
+private:
+	/// Chunk offsets of the streaming volume, sorted by distance from the centre.
+	std::vector<math::vec3i> m_offsets;
+	/// Index of the first offset that may still be missing.
+	size_t m_cursor = 0;
+	/// Centre chunk of the previous plan (the cursor is only valid for this centre).
+	math::vec3i m_center{0, 0, 0};
+	/// Horizontal radius the table was built for (-1 before the first `configure`).
+	int32_t m_radius = -1;
+	/// Vertical half-extent the table was built for (-1 before the first `configure`).
+	int32_t m_height = -1;
+};
+
+}// namespace owl::data::voxel
@@ -13,6 +13,8 @@
 #include "math/PerlinNoise.h"
 #include "math/vectors.h"
 
+#include <span>
+
 namespace owl::data::voxel {
 
 /**
@@ -105,6 +107,15 @@ public:
 	 */
 	[[nodiscard]] auto heightAt(int32_t iWorldX, int32_t iWorldZ) const -> int32_t;
 
+	/**
+	 * @brief
+	 *  Get the surface heights of a chunk's whole column footprint in one batched noise call.
+	 * @param[in] iBaseX World X of the first column.
+	 * @param[in] iBaseZ World Z of the first column.
+	 * @param[out] oHeights `g_ChunkSize²` heights laid out `lz * g_ChunkSize + lx` (same values as `heightAt`).
+	 */
+	void chunkHeights(int32_t iBaseX, int32_t iBaseZ, std::span<int32_t> oHeights) const;
+
 	/**
 	 * @brief
 	 *  Fill a chunk with generated terrain for its coordinate.
@@ -139,12 +150,11 @@ private:
 
 	/**
 	 * @brief
-	 *  Pick the surface block for a column from the biome field.
-	 * @param[in] iWorldX World X column.
-	 * @param[in] iWorldZ World Z column.
+	 *  Pick the surface block for a column from its biome field value.
+	 * @param[in] iBiome The biome fBm value of the column.
 	 * @return The surface block id for that column's biome.
 	 */
-	[[nodiscard]] auto surfaceBlock(int32_t iWorldX, int32_t iWorldZ) const -> BlockId;
+	[[nodiscard]] auto surfaceBlock(float iBiome) const -> BlockId;
 };
 
 }// namespace owl::data::voxel
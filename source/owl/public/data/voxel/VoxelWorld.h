@@ -96,6 +96,16 @@ public:
 	 */
 	auto getOrCreateChunk(const math::vec3i& iCoord) -> shared<Chunk>;
 
+	/**
+	 * @brief
+	 *  Install a fully built chunk at its own coordinate, replacing any resident one.
+	 *
+	 * The world takes the shared chunk as is (no block copy), which lets chunks
+	 * generated off-thread be handed over in O(1).
+	 * @param[in] iChunk The chunk to install (ignored if null).
+	 */
+	void insertChunk(shared<Chunk> iChunk);
+
 	/**
 	 * @brief
 	 *  Whether a chunk exists at a chunk coordinate.
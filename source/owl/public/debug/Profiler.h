@@ -8,6 +8,8 @@
 #pragma once
 
 #include "core/Log.h"
+#include <atomic>
+#include <filesystem>
 #include <fstream>
 #include <thread>
 
@@ -35,9 +37,24 @@ struct ProfileSession {
 	std::string name;/// Session's name.
 };
 
+/**
+ * @brief
+ *  Output format of a profiling session.
+ */
+enum struct ProfileFormat : uint8_t {
+	Json,///< Chrome trace JSON, written and flushed scope by scope.
+	Binary,///< Fixed-size events buffered per thread, drained to a compact file by a background thread.
+};
+
 /**
  * @brief
  *  class for accessing to the internal profiler.
+ *
+ * In `Binary` sessions a scope costs two clock reads and a push into the calling
+ * thread's lock-free ring buffer: no lock, no allocation, no formatting. A background
+ * thread drains the rings into the session file, which `convertToChromeTrace` turns
+ * into the same JSON as a `Json` session. Events are dropped (and counted) when a
+ * ring is full rather than blocking the producer.
  */
 class OWL_API Profiler {
 public:
@@ -54,8 +71,10 @@ public:
 	 *  Begins a new profiling session.
 	 * @param[in] iName Session's name.
 	 * @param[in] iFilepath Session File path to store information.
+	 * @param[in] iFormat Output format.
 	 */
-	void beginSession(const std::string& iName, const std::string& iFilepath = "results.json");
+	void beginSession(const std::string& iName, const std::string& iFilepath = "results.json",
+					  ProfileFormat iFormat = ProfileFormat::Json);
 
 	/**
 	 * @brief
@@ -70,6 +89,50 @@ public:
 	 */
 	void writeProfile(const ProfileResult& iResult);
 
+	/**
+	 * @brief
+	 *  Record a finished scope in the current session.
+	 * @param[in] iName Scope's name; in `Binary` sessions it must outlive the session (string literal).
+	 * @param[in] iStart Scope's starting time point.
+	 * @param[in] iEnd Scope's ending time point.
+	 */
+	void recordScope(const char* iName, std::chrono::steady_clock::time_point iStart,
+					 std::chrono::steady_clock::time_point iEnd);
+
+	/**
+	 * @brief
+	 *  Copy a scope name into the profiler's name table.
+	 *
+	 * Equal names give the same pointer, which stays valid until the end of the program.
+	 * @param[in] iName The name.
+	 * @return The stored name.
+	 */
+	static auto internName(std::string_view iName) -> const char*;
+
+	/**
+	 * @brief
+	 *  Number of events dropped because a thread's ring buffer was full, in the current or last binary session.
+	 * @return The dropped event count.
+	 */
+	[[nodiscard]] auto getDroppedEvents() const -> uint64_t;
+
+	/**
+	 * @brief
+	 *  Number of per-thread event buffers alive; the buffer of an exited thread goes once drained.
+	 * @return The buffer count.
+	 */
+	[[nodiscard]] static auto getThreadBufferCount() -> size_t;
+
+	/**
+	 * @brief
+	 *  Convert a binary session file to Chrome trace JSON.
+	 * @param[in] iBinaryFile The binary session file.
+	 * @param[in] iJsonFile The JSON file to write.
+	 * @return True on success.
+	 */
+	static auto convertToChromeTrace(const std::filesystem::path& iBinaryFile, const std::filesystem::path& iJsonFile)
+			-> bool;
+
 	/**
 	 * @brief
 	 *  Singleton accessor.
@@ -112,8 +175,18 @@ private:
 	 * @note: you must already own lock on m_Mutex before calling InternalEndSession().
 	 */
 	void internalEndSession();
+
+	/// Binary capture state (rings drain thread, output file, name table).
+	struct BinaryCapture;
+
 	/// Mutex.
 	std::mutex m_profilerMutex;
+	/// True while a binary session accepts events (checked without lock on the hot path).
+	std::atomic<bool> m_binaryActive{false};
+	/// Running binary capture, if any.
+	uniq<BinaryCapture> m_binaryCapture;
+	/// Events dropped by the current or last binary session.
+	std::atomic<uint64_t> m_droppedEvents{0};
 	/// Actual running session.
 	uniq<ProfileSession> m_currentSession{nullptr};
 	/// Output file stream.
@@ -126,12 +199,25 @@ private:
  */
 class OWL_API ProfileTimer {
 public:
+	/// A scope name with static storage duration, used as is (the profiling macros' names).
+	struct StaticName {
+		/// The name.
+		const char* name;
+	};
+
 	/**
 	 * @brief
 	 *  Constructor.
-	 * @param[in] iName Scope's name.
+	 * @param[in] iName Scope's name, copied into the profiler's name table.
+	 */
+	explicit ProfileTimer(std::string_view iName);
+
+	/**
+	 * @brief
+	 *  Constructor without copy of the name.
+	 * @param[in] iName Scope's name, it must live until the end of the program.
 	 */
-	explicit ProfileTimer(const char* iName);
+	explicit ProfileTimer(StaticName iName);
 
 	ProfileTimer(const ProfileTimer&) = delete;
 
@@ -239,16 +325,22 @@ OWL_DIAG_POP
 #endif
 
 #define OWL_PROFILE_BEGIN_SESSION(name, filepath) ::owl::debug::Profiler::get().beginSession(name, filepath);
+#define OWL_PROFILE_BEGIN_BINARY_SESSION(name, filepath)                                                               \
+	::owl::debug::Profiler::get().beginSession(name, filepath, ::owl::debug::ProfileFormat::Binary);
 #define OWL_PROFILE_END_SESSION() ::owl::debug::Profiler::get().endSession();
+#define OWL_PROFILE_CONVERT_SESSION(binaryFile, jsonFile)                                                              \
+	::owl::debug::Profiler::convertToChromeTrace(binaryFile, jsonFile);
 #define OWL_PROFILE_SCOPE_LINE2(name, line)                                                                            \
-	constexpr auto fixedName##line = ::owl::debug::utils::cleanupOutputString(name, "__cdecl ");                       \
-	::owl::debug::ProfileTimer timer##line(fixedName##line.data);
+	static constexpr auto fixedName##line = ::owl::debug::utils::cleanupOutputString(name, "__cdecl ");                \
+	::owl::debug::ProfileTimer timer##line(::owl::debug::ProfileTimer::StaticName{fixedName##line.data});
 #define OWL_PROFILE_SCOPE_LINE(name, line) OWL_PROFILE_SCOPE_LINE2(name, line)
 #define OWL_PROFILE_SCOPE(name) OWL_PROFILE_SCOPE_LINE(name, __LINE__)
 #define OWL_PROFILE_FUNCTION() OWL_PROFILE_SCOPE(OWL_FUNC_SIG)
 #else
 #define OWL_PROFILE_BEGIN_SESSION(name, filepath)
+#define OWL_PROFILE_BEGIN_BINARY_SESSION(name, filepath)
 #define OWL_PROFILE_END_SESSION()
+#define OWL_PROFILE_CONVERT_SESSION(binaryFile, jsonFile)
 #define OWL_PROFILE_SCOPE(name)
 #define OWL_PROFILE_FUNCTION()
 #endif
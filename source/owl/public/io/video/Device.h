@@ -10,6 +10,13 @@
 #include "core/Core.h"
 #include "renderer/gpu/Texture.h"
 
+#include <chrono>
+#include <span>
+
+namespace owl::core::task {
+class Scheduler;
+}// namespace owl::core::task
+
 namespace owl::io::video {
 /**
  * @brief
@@ -73,9 +80,98 @@ public:
 	/**
 	 * @brief
 	 *  Retrieve a frame.
-	 * @param[in] iFrame The frame to update.
+	 *
+	 * Without capture, grabs and converts a frame on the calling thread. While
+	 * capturing, uploads the latest frame of the grab thread, if a new one is
+	 * available, and never waits.
+	 * @param[in,out] ioFrame The frame to update.
+	 */
+	void fillFrame(shared<renderer::gpu::Texture>& ioFrame);
+
+	/// A converted frame.
+	struct Frame {
+		/// RGB24 pixels.
+		std::vector<uint8_t> pixels;
+		/// Size of the frame.
+		math::vec2ui size{0, 0};
+		/// Time of the capture.
+		std::chrono::steady_clock::time_point timestamp;
+		/// Number of the frame since the start of the capture (first is 1).
+		uint64_t sequence = 0;
+	};
+
+	/// Counters of the capture.
+	struct CaptureStats {
+		/// Frames converted by the grab thread.
+		uint64_t grabbed = 0;
+		/// Frames taken by the consumer.
+		uint64_t delivered = 0;
+		/// Frames lost: skipped in the driver queue or replaced before being taken.
+		uint64_t dropped = 0;
+		/// Failed grabs or conversions.
+		uint64_t failed = 0;
+	};
+
+	/**
+	 * @brief
+	 *  Start grabbing frames on a dedicated thread.
+	 *
+	 * The device must be opened. Frames are converted by the grab thread and
+	 * published in a lock-free latest-frame slot.
+	 */
+	void startCapture();
+
+	/**
+	 * @brief
+	 *  Stop the grab thread.
+	 */
+	void stopCapture();
+
+	/**
+	 * @brief
+	 *  Stop the grab thread of every capturing device.
+	 *
+	 * Called by the application before its task scheduler is destroyed.
+	 */
+	static void stopAllCaptures();
+
+	/**
+	 * @brief
+	 *  Check if the grab thread runs.
+	 * @return True if capturing.
+	 */
+	[[nodiscard]] auto isCapturing() const -> bool;
+
+	/**
+	 * @brief
+	 *  Take the latest frame of the grab thread.
+	 *
+	 * The frame belongs to the caller until its next call, so it can be
+	 * uploaded without copy. Must be called from a single thread.
+	 * @return The frame or nullptr if no new frame was grabbed since the last call.
 	 */
-	virtual void fillFrame(shared<renderer::gpu::Texture>& iFrame) = 0;
+	auto acquireLatestFrame() -> Frame*;
+
+	/**
+	 * @brief
+	 *  Counters of the current (or last) capture.
+	 * @return The counters.
+	 */
+	[[nodiscard]] auto getCaptureStats() const -> CaptureStats;
+
+	/**
+	 * @brief
+	 *  Define the number of buffers queued in the driver, applied at the next opening.
+	 * @param[in] iCount The buffer count (at least 1).
+	 */
+	void setBufferCount(const uint32_t iCount) { m_bufferCount = std::max(iCount, 1u); }
+
+	/**
+	 * @brief
+	 *  Get the number of buffers queued in the driver.
+	 * @return The buffer count.
+	 */
+	[[nodiscard]] auto getBufferCount() const -> uint32_t { return m_bufferCount; }
 
 	/**
 	 * @brief
@@ -122,15 +218,68 @@ protected:
 	PixelFormat m_pixFormat = PixelFormat::Unknown;
 	/// The size of the frame.
 	math::vec2ui m_size;
+	/// Number of buffers queued in the driver.
+	uint32_t m_bufferCount = 4;
+
+	/// A raw frame borrowed from the device until `releaseRaw()`.
+	struct RawFrame {
+		/// Raw bytes.
+		const uint8_t* data = nullptr;
+		/// Number of bytes.
+		size_t size = 0;
+		/// Time of the capture.
+		std::chrono::steady_clock::time_point timestamp;
+		/// Older frames skipped by the device to return this one.
+		uint32_t skipped = 0;
+	};
+
+	/**
+	 * @brief
+	 *  Wait for the next raw frame.
+	 *
+	 * Called by one thread at a time: the caller of `fillFrame()` or the grab thread.
+	 * @param[out] oFrame The frame.
+	 * @param[in] iTimeout Maximal waiting time.
+	 * @return False if no frame is available.
+	 */
+	virtual auto acquireRaw(RawFrame& oFrame, std::chrono::milliseconds iTimeout) -> bool = 0;
+
+	/**
+	 * @brief
+	 *  Give the last acquired raw frame back to the device.
+	 */
+	virtual void releaseRaw() = 0;
 
 	/**
 	 * @brief
 	 *  Convert a raw buffer of pixel to RGB24 format.
+	 *
+	 * The conversion runs on the application task scheduler (when any) and
+	 * writes into a buffer owned by the device, reused from frame to frame.
 	 * @param[in] iInputBuffer The input buffer.
 	 * @param[in] iBufferSize The size of the buffer.
-	 * @return A converted RGB24 buffer.
+	 * @return The converted RGB24 frame, valid until the next call; empty on failure.
 	 */
-	[[nodiscard]] auto getRgbBuffer(const uint8_t* iInputBuffer, int32_t iBufferSize) const -> std::vector<uint8_t>;
+	[[nodiscard]] auto getRgbBuffer(const uint8_t* iInputBuffer, int32_t iBufferSize) -> std::span<uint8_t>;
+
+	/**
+	 * @brief
+	 *  Convert a raw buffer of pixel to RGB24 format.
+	 * @param[in] iInput The input buffer.
+	 * @param[out] oRgb24 The output, resized to the frame.
+	 * @param[in,out] ioScheduler Scheduler splitting the conversion, or nullptr to convert on the calling thread.
+	 * @return False if the conversion failed.
+	 */
+	auto convertToRgb(std::span<const uint8_t> iInput, std::vector<uint8_t>& oRgb24,
+					  core::task::Scheduler* ioScheduler) const -> bool;
+
+private:
+	/// State of the grab thread.
+	struct Capture;
+	/// Converted frame, reused from frame to frame.
+	std::vector<uint8_t> m_rgbBuffer;
+	/// Grab thread, if capturing.
+	uniq<Capture> mp_capture;
 };
 
 }// namespace owl::io::video
@@ -0,0 +1,131 @@
+/**
+ * @file FileDevice.h
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright (c) 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+
+#include "Device.h"
+
+#include <filesystem>
+
+namespace owl::io::video {
+
+/**
+ * @brief
+ *  Stand-in video device replaying recorded raw frames from a file.
+ *
+ * The file is a plain concatenation of frames of fixed size in the given
+ * pixel format (as written by `ffmpeg -f rawvideo`), so only the formats with
+ * a fixed frame size (Rgb24, Nv12, YuYv) can be replayed. Frames are paced at
+ * the given frame rate and loop at the end of the file; a null frame rate
+ * replays as fast as frames are requested, for benchmarks.
+ */
+class OWL_API FileDevice final : public Device {
+public:
+	/**
+	 * @brief
+	 *  Constructor.
+	 * @param[in] iFile The recording.
+	 * @param[in] iPixelFormat Pixel format of the recorded frames.
+	 * @param[in] iSize Size of the recorded frames.
+	 * @param[in] iFrameRate Replay rate in frames per second, 0 for no pacing.
+	 */
+	FileDevice(std::filesystem::path iFile, PixelFormat iPixelFormat, const math::vec2ui& iSize,
+			   float iFrameRate = 30.f);
+
+	FileDevice(const FileDevice&) = delete;
+
+	FileDevice(FileDevice&&) = delete;
+
+	auto operator=(const FileDevice&) -> FileDevice& = delete;
+
+	auto operator=(FileDevice&&) -> FileDevice& = delete;
+
+	/**
+	 * @brief
+	 *  Destructor.
+	 */
+	~FileDevice() override;
+
+	/**
+	 * @brief
+	 *  Load the recording.
+	 */
+	void open() override;
+
+	/**
+	 * @brief
+	 *  Drop the recording.
+	 */
+	void close() override;
+
+	/**
+	 * @brief
+	 *  Check if the device is open.
+	 * @return True if open.
+	 */
+	[[nodiscard]] auto isOpened() const -> bool override { return m_frameCount > 0; }
+
+	/**
+	 * @brief
+	 *  Check the validity of the device.
+	 * @return True if the recording exists and its format can be replayed.
+	 */
+	[[nodiscard]] auto isValid() const -> bool override;
+
+	/**
+	 * @brief
+	 *  Number of frames in the loaded recording.
+	 * @return The frame count.
+	 */
+	[[nodiscard]] auto getFrameCount() const -> size_t { return m_frameCount; }
+
+	/**
+	 * @brief
+	 *  Size in bytes of one raw frame.
+	 * @param[in] iPixelFormat The pixel format.
+	 * @param[in] iSize The frame size.
+	 * @return The byte count, 0 for formats without fixed frame size.
+	 */
+	[[nodiscard]] static auto getFrameBytes(PixelFormat iPixelFormat, const math::vec2ui& iSize) -> size_t;
+
+protected:
+	/**
+	 * @brief
+	 *  Wait for the time of the next frame of the recording.
+	 * @param[out] oFrame The frame.
+	 * @param[in] iTimeout Maximal waiting time.
+	 * @return False if the next frame is not due within the timeout.
+	 */
+	auto acquireRaw(RawFrame& oFrame, std::chrono::milliseconds iTimeout) -> bool override;
+
+	/**
+	 * @brief
+	 *  Nothing to give back: frames live in the loaded recording.
+	 */
+	void releaseRaw() override {}
+
+private:
+	/// The recording.
+	std::filesystem::path m_file;
+	/// Size of the recorded frames.
+	math::vec2ui m_recordSize;
+	/// Pixel format of the recorded frames.
+	PixelFormat m_recordFormat;
+	/// Time between two frames (zero for no pacing).
+	std::chrono::steady_clock::duration m_period{0};
+	/// The loaded frames.
+	std::vector<uint8_t> m_frames;
+	/// Number of loaded frames.
+	size_t m_frameCount = 0;
+	/// Index of the next frame.
+	size_t m_cursor = 0;
+	/// Time of the next frame.
+	std::chrono::steady_clock::time_point m_nextFrame;
+};
+
+}// namespace owl::io::video
@@ -9,9 +9,11 @@
 #pragma once
 
 #include "core/Core.h"
+#include "core/CpuFeatures.h"
 
 #include <array>
 #include <cstdint>
+#include <span>
 
 namespace owl::math {
 /**
@@ -24,9 +26,18 @@ namespace owl::math {
  * third-party noise library. A given seed always produces the same field, so
  * worlds are reproducible. The raw `noise` samplers return values in roughly
  * `[-1, 1]`; the `fbm` helpers normalise their octave sum back to that range.
+ *
+ * The span overloads evaluate many 2D samples per call. On x64 they run 4
+ * (SSE4.1) or 8 (AVX2) samples per instruction, picking the widest path the
+ * CPU supports at runtime, with a scalar fallback elsewhere. Every path
+ * performs the same float operations in the same order as the scalar
+ * samplers, so batched and per-sample results are identical.
  */
 class OWL_API PerlinNoise {
 public:
+	/// Instruction set used by the batched samplers: 4 samples per step with SSE4.1, 8 with AVX2.
+	using SimdLevel = core::SimdLevel;
+
 	PerlinNoise(const PerlinNoise&) = default;
 
 	PerlinNoise(PerlinNoise&&) = default;
@@ -106,8 +117,55 @@ public:
 	[[nodiscard]] auto fbm(float iX, float iY, float iZ, uint32_t iOctaves, float iLacunarity, float iPersistence) const
 			-> float;
 
+	/**
+	 * @brief
+	 *  Sample 2D gradient noise for a batch of points.
+	 * @param[in] iXs X coordinates.
+	 * @param[in] iYs Y coordinates (same size as `iXs`).
+	 * @param[out] oOut Noise values (same size as `iXs`).
+	 * @param[in] iLevel Instruction set to use (clamped to what the CPU supports).
+	 */
+	void noise(std::span<const float> iXs, std::span<const float> iYs, std::span<float> oOut,
+			   SimdLevel iLevel = getSimdLevel()) const;
+
+	/**
+	 * @brief
+	 *  Sample 2D fractal Brownian motion for a batch of points.
+	 * @param[in] iXs X coordinates.
+	 * @param[in] iYs Y coordinates (same size as `iXs`).
+	 * @param[out] oOut Noise values normalised to roughly `[-1, 1]` (same size as `iXs`).
+	 * @param[in] iOctaves Number of noise layers summed (>= 1).
+	 * @param[in] iLacunarity Frequency multiplier between octaves.
+	 * @param[in] iPersistence Amplitude multiplier between octaves.
+	 * @param[in] iLevel Instruction set to use (clamped to what the CPU supports).
+	 */
+	void fbm(std::span<const float> iXs, std::span<const float> iYs, std::span<float> oOut, uint32_t iOctaves,
+			 float iLacunarity, float iPersistence, SimdLevel iLevel = getSimdLevel()) const;
+
+	/**
+	 * @brief
+	 *  The widest instruction set the running CPU supports (detected once).
+	 * @return The SIMD level used by default by the batched samplers.
+	 */
+	[[nodiscard]] static auto getSimdLevel() -> SimdLevel;
+
 private:
 	/// Permutation table, doubled to 512 to avoid index wrapping in the lookups.
 	std::array<uint8_t, 512> m_perm{};
+	/// The same table widened to 32 bits, the element size AVX2 gathers read.
+	std::array<int32_t, 512> m_permWide{};
+
+	/**
+	 * @brief
+	 *  Add one octave of 2D noise to a batch: `ioOut[i] += iAmplitude * noise(x * iFrequency, y * iFrequency)`.
+	 * @param[in] iXs X coordinates.
+	 * @param[in] iYs Y coordinates.
+	 * @param[in,out] ioOut Accumulated values.
+	 * @param[in] iFrequency Coordinate scale of the octave.
+	 * @param[in] iAmplitude Weight of the octave.
+	 * @param[in] iLevel Instruction set to use (already clamped).
+	 */
+	void accumulateOctave(std::span<const float> iXs, std::span<const float> iYs, std::span<float> ioOut,
+						  float iFrequency, float iAmplitude, SimdLevel iLevel) const;
 };
 }// namespace owl::math
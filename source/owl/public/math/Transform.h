@@ -75,6 +75,14 @@ public:
 	 */
 	constexpr auto operator=(Transform&&) -> Transform& = default;
 
+	/**
+	 * @brief
+	 *  Exact comparison of the translation, rotation and scale.
+	 * @param[in] iOther The other transformation.
+	 * @return True if all components are equal.
+	 */
+	constexpr auto operator==(const Transform& iOther) const -> bool = default;
+
 	// NOLINTBEGIN(google-explicit-constructor)
 	// NOLINTBEGIN(hicpp-explicit-conversions)
 	/**
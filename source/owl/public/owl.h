@@ -35,6 +35,7 @@
 #include "event/KeyEvent.h"
 #include "event/MouseEvent.h"
 #include "input/Input.h"
+#include "io/video/FileDevice.h"
 #include "io/video/Manager.h"
 #include "math/math.h"
 #include "renderer/CameraOrthoController.h"
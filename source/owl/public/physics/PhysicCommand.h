@@ -11,6 +11,10 @@
 #include "core/Core.h"
 #include "scene/Scene.h"
 
+namespace owl::core::task {
+class Scheduler;
+}// namespace owl::core::task
+
 /**
  * @brief
  *  Namespace for phyisics management.
@@ -45,10 +49,108 @@ public:
 	/**
 	 * @brief
 	 *  Initialize the physical world based on the given scene.
+	 *
+	 * The world steps on the application's task scheduler if there is one,
+	 * single-threaded otherwise.
 	 * @param iScene The Scene onto apply physics.
 	 */
 	static void init(scene::Scene* iScene);
 
+	/**
+	 * @brief
+	 *  Initialize the physical world based on the given scene, stepping it on a scheduler's workers.
+	 *
+	 * Box2D's tasks are split over the scheduler's executor; `frame()` must then
+	 * be called from a thread that is not one of its workers.
+	 * @param iScene The Scene onto apply physics.
+	 * @param ioScheduler The scheduler; it must outlive the world.
+	 */
+	static void init(scene::Scene* iScene, core::task::Scheduler& ioScheduler);
+
+	/**
+	 * @brief
+	 *  Define the number of workers of the worlds created next.
+	 *
+	 * Clamped to the scheduler's worker count, and to 64. Box2D advises to count
+	 * only the performance cores.
+	 * @param iCount The worker count, 0 for one per scheduler worker but one.
+	 */
+	static void setWorkerCount(uint32_t iCount) { m_workerCount = iCount; }
+
+	/**
+	 * @brief
+	 *  Get the requested number of workers.
+	 * @return The worker count, 0 for one per scheduler worker but one.
+	 */
+	[[nodiscard]] static auto getWorkerCount() -> uint32_t { return m_workerCount; }
+
+	/**
+	 * @brief
+	 *  How `frame()` advances the world.
+	 *
+	 * By default, the world advances by the frame duration. In fixed-step mode,
+	 * the frame durations are accumulated and the world advances by whole steps
+	 * of `fixedDelta`: the simulation no longer depends on the frame rate, and a
+	 * long frame costs at most `maxStepsPerFrame` steps (the time beyond is
+	 * dropped, the simulation then runs slower than real time). The transforms
+	 * are then interpolated between the last two steps by the time left in the
+	 * accumulator.
+	 */
+	struct StepSettings {
+		/// If the world advances by fixed steps.
+		bool fixedStep = false;
+		/// Duration of a fixed step, in seconds.
+		float fixedDelta = 1.f / 60.f;
+		/// Maximum number of fixed steps in a frame.
+		uint32_t maxStepsPerFrame = 4;
+		/// Number of Box2D sub-steps in a step.
+		uint32_t subSteps = 4;
+		/// If the transforms are interpolated between the last two fixed steps.
+		bool interpolate = true;
+	};
+
+	/**
+	 * @brief
+	 *  Define how `frame()` advances the world.
+	 *
+	 * Zero or negative values are raised to their minimum.
+	 * @param iSettings The settings.
+	 */
+	static void setStepSettings(const StepSettings& iSettings);
+
+	/**
+	 * @brief
+	 *  Get how `frame()` advances the world.
+	 * @return The settings.
+	 */
+	[[nodiscard]] static auto getStepSettings() -> const StepSettings& { return m_stepSettings; }
+
+	/**
+	 * @brief
+	 *  Timings of the last physical frame.
+	 */
+	struct StepStats {
+		/// Whole step, in milliseconds.
+		float stepMs = 0.f;
+		/// Collision detection, in milliseconds.
+		float collideMs = 0.f;
+		/// Constraint solver, in milliseconds.
+		float solveMs = 0.f;
+		/// Number of workers of the world.
+		uint32_t workerCount = 0;
+		/// Number of steps taken by the last frame.
+		uint32_t stepCount = 0;
+		/// Interpolation factor between the last two steps applied to the transforms.
+		float interpolation = 1.f;
+	};
+
+	/**
+	 * @brief
+	 *  Get the timings of the last physical frame, summed over its steps.
+	 * @return The timings, zero if physics is not initialized.
+	 */
+	[[nodiscard]] static auto getStepStats() -> StepStats;
+
 	/**
 	 * @brief
 	 *  Destroy the world and unlink scene.
@@ -65,6 +167,9 @@ public:
 	/**
 	 * @brief
 	 *  Compute One physical frame.
+	 *
+	 * One step of the frame duration, or in fixed-step mode as many fixed steps
+	 * as the accumulated time holds (see `StepSettings`).
 	 * @param iTimestep The time step.
 	 */
 	static void frame(const core::Timestep& iTimestep);
@@ -142,12 +247,24 @@ public:
 	static void applySnapshot(const scene::Entity& iEntity, const PhysicsSnapshot& iSnapshot);
 
 private:
+	/**
+	 * @brief
+	 *  Create the physical world of a scene.
+	 * @param iScene The Scene onto apply physics.
+	 * @param ioScheduler Scheduler for the Box2D tasks, nullptr for a single-threaded world.
+	 */
+	static void createWorld(scene::Scene* iScene, core::task::Scheduler* ioScheduler);
+
 	/// Implementation class.
 	class Impl;
 	/// Pointer to the implementation.
 	static shared<Impl> m_impl;
 	/// pointer to the active scene.
 	static scene::Scene* m_scene;
+	/// Requested number of workers, 0 for one per scheduler worker.
+	static uint32_t m_workerCount;
+	/// How `frame()` advances the world.
+	static StepSettings m_stepSettings;
 };
 
 }// namespace owl::physics
@@ -287,6 +287,10 @@ public:
 		uint32_t quadCount = 0;
 		/// Amount of lines drawn.
 		uint32_t lineCount = 0;
+		/// Amount of batches ended because every texture slot was taken.
+		uint32_t textureBatchBreaks = 0;
+		/// Amount of texture-slot batch breaks saved by the atlas pages (versus one slot per texture).
+		uint32_t batchBreaksAvoided = 0;
 
 		/**
 		 * @brief
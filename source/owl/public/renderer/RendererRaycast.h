@@ -25,6 +25,11 @@ namespace owl::math {
 class Transform;
 }// namespace owl::math
 
+namespace owl::core::task {
+
+class Scheduler;
+}// namespace owl::core::task
+
 /**
  * @brief
  *  Wolfenstein-style raycaster family.
@@ -261,6 +266,13 @@ struct OWL_API RaycastSpriteData {
  * the existing 2D pipeline. A future revision will move the inner loop to a
  * dedicated full-screen Slang shader.
  *
+ * The per-column CPU work — the DDA fallback used when the GPU stripe path is
+ * unavailable (Null backend), pushwalls, doors and CPU sprite stripes — runs in
+ * blocks of 64 columns on the task scheduler, the DDA stepping 4 rays at a
+ * time with SSE2. Each block records its stripes in its own buffer; the
+ * buffers are submitted to `Renderer2D` in column order by the calling
+ * thread, so the output matches a serial walk.
+ *
  * Thread-safety: main thread only.
  */
 class OWL_API RendererRaycast {
@@ -293,6 +305,13 @@ public:
 	 */
 	static void shutdown();
 
+	/**
+	 * @brief
+	 *  Set the scheduler running the per-column CPU work.
+	 * @param[in] ioScheduler The scheduler, or nullptr to use the application's one (serial without application).
+	 */
+	static void setScheduler(core::task::Scheduler* ioScheduler);
+
 	/**
 	 * @brief
 	 *  Open a raycast scene.
@@ -379,6 +398,12 @@ public:
 	 *    `drawTilemapWalls` is compared against the sprite depth, hidden columns
 	 *    are skipped.
 	 *
+	 * On GPU backends each visible sprite is one compact instance record and the
+	 * whole batch is drawn with one instanced call (per 32 distinct textures) by
+	 * the `raycast_sprite` shader, which resolves the per-column occlusion
+	 * against the uploaded zBuffer. The Null backend emits the column strips
+	 * through `Renderer2D`.
+	 *
 	 * Must be called between `beginScene` and `endScene`. An empty span is a
 	 * silent no-op.
 	 * @param[in] iSprites Sprite payloads to render.
@@ -26,7 +26,7 @@ namespace owl::renderer {
  *  `glDrawElementsInstanced(GL_TRIANGLES, 6, cellCount, …)`.
  *
  *  The per-vertex VBO carries a single 4-vertex quad (corner indices 0..3).
- *  The per-instance VBO is rebuilt every frame, one entry per non-empty cell
+ *  The per-instance VBO holds one entry per non-empty cell
  *  carrying everything that cell needs — `{cellWorldPos.xy, tileIndex,
  *  entityId, layerZ, cellSize, atlasColumns, atlasRows, halfTexel,
  *  textureSlot}`. The vertex shader synthesises the world corner position and
@@ -34,6 +34,14 @@ namespace owl::renderer {
  *  per-draw UBO); distinct tilesets bind to distinct slots of the shader's
  *  32-texture array.
  *
+ *  Cells are expanded per `TilemapAsset::g_chunkSize`² chunk of each layer and
+ *  cached across frames: a chunk is rebuilt only when its asset chunk revision
+ *  changes (tile edit) or the tilemap moves, chunks outside the camera frustum
+ *  are skipped, and the instance buffers are not uploaded again while the
+ *  list of visible chunks stays the same. Chunks off screen for a few seconds
+ *  release their cells. Beyond 16384 visible cells the instances spill into
+ *  further draws instead of being truncated.
+ *
  * Lifecycle mirrors `Renderer2D`:
  *   - `init()` builds the pipeline / shader / static per-vertex buffer once
  *     at engine startup.
@@ -104,7 +112,9 @@ public:
 	 * `Scene::render`, before the batch opens) would record into a command
 	 * buffer with no active render pass — on Vulkan that hangs the GPU.
 	 * @param[in] iAsset The tilemap asset (must have a resolved tileset). The
-	 *  reference must stay valid until `flushPending` runs this frame.
+	 *  reference must stay valid until `flushPending` runs this frame. Edit
+	 *  its tiles through `setTile` (or flag direct writes with `markCellDirty` /
+	 *  `markDirty`) so the cached chunks see the change.
 	 * @param[in] iWorldTransform Entity world transform — translation of the
 	 *  tilemap origin, no per-cell scaling.
 	 * @param[in] iEntityId Entity id written into the picking render target.
@@ -113,9 +123,10 @@ public:
 
 	/**
 	 * @brief
-	 *  Emit every tilemap queued by `drawTilemap` this frame in a single
-	 *  instanced drawcall. All entities and all their visible layers share one
-	 *  instance buffer — each cell carries its own painter's-order `layerZ`,
+	 *  Emit every tilemap queued by `drawTilemap` this frame in as few
+	 *  instanced drawcalls as the instance capacity allows (one up to 16384
+	 *  visible cells). All entities and all their visible chunks share the
+	 *  instance buffers — each cell carries its own painter's-order `layerZ`,
 	 *  atlas metadata and texture slot, and distinct tilesets are bound to
 	 *  distinct slots in the shader's texture array (up to 32). Must be called
 	 *  from inside an active `beginBatch`/`endBatch` render pass —
@@ -131,7 +142,7 @@ public:
 	 *  Exposed for profiling overlays.
 	 */
 	struct Statistics {
-		/// Number of instanced drawcalls (0 if no cells, else 1 — all tilemaps combine into one draw).
+		/// Number of instanced drawcalls (0 if no cells, else one per 16384 cells — all tilemaps share them).
 		uint32_t drawCallCount = 0;
 		/// Total non-empty cells drawn across every queued tilemap this frame.
 		uint32_t instanceCount = 0;
@@ -141,6 +152,14 @@ public:
 		 *  short-circuit before drawing.
 		 */
 		uint32_t layerCount = 0;
+		/// Non-empty chunks inside the camera frustum.
+		uint32_t chunkCount = 0;
+		/// Chunks rejected by the camera frustum.
+		uint32_t culledChunkCount = 0;
+		/// Visible chunks whose cells had to be expanded again (first sight, tile edit, tilemap moved).
+		uint32_t rebuiltChunkCount = 0;
+		/// Instance buffer uploads (0 when the visible chunks are the same as in the previous flush).
+		uint32_t uploadCount = 0;
 	};
 
 	/**
@@ -32,7 +32,11 @@ struct VoxelConfig {
  *
  * Each chunk is greedy-meshed (`ChunkMesher`) and uploaded once via
  * `Renderer3D::createMesh` using the frac-tiled `voxel` shader; the GPU mesh is
- * cached per entity+chunk and rebuilt only when the chunk is dirty. Block
+ * cached per entity+chunk and rebuilt only when the chunk is dirty. When an
+ * application is running, dirty chunks are captured as `ChunkSnapshot`s and
+ * meshed on the task scheduler; the previous mesh keeps drawing until the new
+ * one is uploaded, a per-frame budget bounds the uploads, and re-dirtied or
+ * unloaded chunks cancel their stale jobs. Block
  * textures are resolved (Nearest filtering) and bound per draw. A static facade
  * mirroring the other renderers; the actual GPU work is delegated to
  * `Renderer3D`.
@@ -72,7 +76,7 @@ public:
 	 *  Must be called **outside** any render pass (e.g. from `Scene::onStartRuntime`): it creates GPU buffers,
 	 *  pipelines and textures, which submit single-time command buffers and therefore must not run while a frame's
 	 *  command buffer is being recorded. `drawVoxelWorld` then only binds and draws these cached resources.
-	 * @param[in,out] ioComponent The voxel world component (chunks are marked clean as they are meshed).
+	 * @param[in,out] ioComponent The voxel world component (chunks are marked clean once captured for meshing).
 	 * @param[in] iEntityId The entity id (keys the per-entity mesh cache).
 	 */
 	static void prepareWorld(scene::component::VoxelWorld& ioComponent, int iEntityId);
@@ -92,6 +96,20 @@ public:
 	 *  Drop all cached meshes (call on scene transitions to avoid stale geometry).
 	 */
 	static void clearCache();
+
+	/**
+	 * @brief
+	 *  Set how many meshed chunks `prepareWorld` may upload per frame (nearest first).
+	 * @param[in] iChunksPerFrame The upload budget (clamped to at least 1; default 8).
+	 */
+	static void setMeshUploadBudget(uint32_t iChunksPerFrame);
+
+	/**
+	 * @brief
+	 *  Number of chunks whose mesh is being built or waits for upload, over all entities.
+	 * @return The pending mesh job count.
+	 */
+	[[nodiscard]] static auto getPendingMeshJobs() -> size_t;
 };
 
 }// namespace owl::renderer
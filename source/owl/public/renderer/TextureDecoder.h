@@ -18,6 +18,17 @@
 #include <vector>
 
 namespace owl::renderer {
+/**
+ * @brief
+ *  One reduced level of a decoded image.
+ */
+struct OWL_API MipLevel {
+	/// Width and height in pixels.
+	math::vec2ui size{0, 0};
+	/// Tightly packed pixel data, in the format of the full image.
+	std::vector<uint8_t> pixels;
+};
+
 /**
  * @brief
  *  Result of decoding an image buffer or file on the CPU.
@@ -34,6 +45,8 @@ struct OWL_API DecodedImage {
 	std::vector<uint8_t> pixels;
 	/// True when decoding succeeded; callers should gate any usage on this flag.
 	bool valid{false};
+	/// Levels 1 and beyond, each half the previous one; empty unless `generateMipChain` ran.
+	std::vector<MipLevel> mips;
 };
 
 /**
@@ -68,4 +81,22 @@ OWL_API auto decodeImageBytes(std::span<const uint8_t> iBytes, int iDesiredChann
  */
 OWL_API auto decodeImageFile(const std::filesystem::path& iPath, int iDesiredChannels = 0) -> DecodedImage;
 
+/**
+ * @brief
+ *  Number of levels of a full mip chain, down to one pixel.
+ * @param[in] iSize Size of the full image.
+ * @return The level count, 0 for an empty size.
+ */
+OWL_API auto getMipLevelCount(const math::vec2ui& iSize) -> uint32_t;
+
+/**
+ * @brief
+ *  Compute the reduced levels of a decoded image with a 2x2 box filter.
+ * @param[in,out] ioImage The decoded image, whose `mips` get levels 1 to `iLevelCount - 1`.
+ * @param[in] iLevelCount Wanted level count including the full image, clamped to the full chain.
+ *
+ * CPU only, so it runs on the decoding worker; odd sizes clamp the last row and column.
+ */
+OWL_API void generateMipChain(DecodedImage& ioImage, uint32_t iLevelCount);
+
 }// namespace owl::renderer
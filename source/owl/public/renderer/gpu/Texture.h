@@ -99,6 +99,8 @@ public:
 		bool generateMips = true;
 		/// Sampler filtering — `Nearest` disables mipmaps and snaps to texels.
 		FilterMode filterMode = FilterMode::Linear;
+		/// Mip levels allocated for explicit uploads through `setMipData`; not serialized.
+		uint32_t mipLevels = 1;
 
 		/**
 		 * @brief
@@ -180,6 +182,34 @@ public:
 	 */
 	virtual void setData(void* iData, uint32_t iSize) = 0;
 
+	/**
+	 * @brief
+	 *  Upload a rectangle of one mip level.
+	 * @param[in] iLevel The mip level, below `getMipLevelCount()`.
+	 * @param[in] iOffset Origin of the rectangle in the level.
+	 * @param[in] iSize Size of the rectangle.
+	 * @param[in] iData Tightly packed pixels of the rectangle.
+	 */
+	virtual void setMipData(uint32_t iLevel, const math::vec2ui& iOffset, const math::vec2ui& iSize,
+							const void* iData) = 0;
+
+	/**
+	 * @brief
+	 *  Number of mip levels the GPU storage holds.
+	 * @return The level count, 1 for textures without mips.
+	 */
+	[[nodiscard]] virtual auto getMipLevelCount() const -> uint32_t { return 1; }
+
+	/**
+	 * @brief
+	 *  Restrict sampling to the levels from the given one down to the smallest.
+	 *
+	 * Lets a texture whose small levels are uploaded first be drawn before its
+	 * large levels arrive. Backends without mip storage ignore it.
+	 * @param[in] iLevel The largest level holding valid pixels.
+	 */
+	virtual void setBaseMipLevel([[maybe_unused]] uint32_t iLevel) {}
+
 	/**
 	 * @brief
 	 *  Switch the sampler filter mode at runtime.
@@ -284,10 +314,14 @@ public:
 	 *  Create a texture from a serialized name without blocking on decode.
 	 * @param[in] iTextureSerializedName Serialized reference (`nam:`, `pat:`, `siz:`, `emp:`).
 	 * @param[in] ioScheduler Scheduler used to run the decode on a worker thread.
-	 * @return A valid texture with `LoadState::Pending` whose GPU contents currently hold a 1-channel
-	 *         white placeholder sized to the peeked image dimensions. Contents are swapped on the
-	 *         main thread when the decode termination callback fires, moving the state to
-	 *         `Ready` (on success) or `Failed` (placeholder kept).
+	 * @return A valid texture with `LoadState::Pending`, sized to the peeked image dimensions.
+	 *
+	 * The worker decodes the image and computes its mip chain. When it is done, the small
+	 * levels are uploaded at once as a placeholder and the large ones are queued on the
+	 * `TextureUploadQueue`, which uploads them a few rows at a time under a per-frame byte
+	 * budget. The state moves to `Ready` once the full level lands, or to `Failed` when the
+	 * decode fails. Until the first levels arrive, backends with mip storage show a single
+	 * white texel stretched over the texture.
 	 *
 	 * Falls back to the synchronous `createFromSerialized` when the name does not designate a
 	 * decodable image (`emp:`, `siz:`) or when dimensions cannot be peeked cheaply.
@@ -0,0 +1,98 @@
+/**
+ * @file EntitySideTable.h
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright (c) 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+
+#include <entt/entt.hpp>
+#include <vector>
+
+namespace owl::scene {
+
+/**
+ * @brief
+ *  Dense per-entity cache indexed by the entity slot.
+ *
+ * Values live in a flat array indexed by the index part of the entity handle;
+ * each slot remembers the full handle (so a recycled entity never sees the
+ * value of its predecessor) and the epoch it was written in. `clear()` only
+ * bumps the epoch — the array is wiped once every 2³² clears — so a per-frame
+ * cache costs neither node allocations nor frees.
+ * @tparam T Type of the cached value.
+ */
+template<typename T>
+class EntitySideTable final {
+public:
+	/**
+	 * @brief
+	 *  Forget every value, keeping the memory.
+	 */
+	void clear() {
+		if (++m_epoch != 0)
+			return;
+		for (auto& slot: m_slots) slot.epoch = 0;
+		m_epoch = 1;
+	}
+
+	/**
+	 * @brief
+	 *  Look up the value of an entity.
+	 * @param[in] iEntity The entity.
+	 * @return The value stored since the last clear, or nullptr.
+	 */
+	[[nodiscard]] auto find(const entt::entity iEntity) const -> const T* {
+		const auto index = static_cast<size_t>(entt::to_entity(iEntity));
+		if (iEntity == entt::null || index >= m_slots.size())
+			return nullptr;
+		const auto& slot = m_slots[index];
+		return slot.epoch == m_epoch && slot.entity == iEntity ? &slot.value : nullptr;
+	}
+
+	/**
+	 * @brief
+	 *  Access the value of an entity, value-initializing it when absent.
+	 * @param[in] iEntity The entity (must not be null).
+	 * @return The value.
+	 */
+	auto fetch(const entt::entity iEntity) -> T& {
+		const auto index = static_cast<size_t>(entt::to_entity(iEntity));
+		if (index >= m_slots.size())
+			m_slots.resize(std::max(index + 1, m_slots.size() * 2));
+		auto& slot = m_slots[index];
+		if (slot.epoch != m_epoch || slot.entity != iEntity) {
+			slot.entity = iEntity;
+			slot.epoch = m_epoch;
+			slot.value = T{};
+		}
+		return slot.value;
+	}
+
+	/**
+	 * @brief
+	 *  Store the value of an entity.
+	 * @param[in] iEntity The entity (must not be null).
+	 * @param[in] iValue The value.
+	 */
+	void set(const entt::entity iEntity, const T& iValue) { fetch(iEntity) = iValue; }
+
+private:
+	/// A cached value.
+	struct Slot {
+		/// Full handle of the owner.
+		entt::entity entity = entt::null;
+		/// Epoch of the last write (0 is never current).
+		uint32_t epoch = 0;
+		/// The value.
+		T value{};
+	};
+	/// Values indexed by entity slot.
+	std::vector<Slot> m_slots;
+	/// Current epoch.
+	uint32_t m_epoch = 1;
+};
+
+}// namespace owl::scene
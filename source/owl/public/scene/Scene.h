@@ -8,7 +8,9 @@
 
 #pragma once
 
+#include "EntitySideTable.h"
 #include "GameState.h"
+#include "core/FrameArena.h"
 #include "core/Timestep.h"
 #include "core/UUID.h"
 #include "math/Transform.h"
@@ -33,6 +35,7 @@ namespace owl::scene {
 
 class Entity;
 class ScriptableEntity;
+class TransformHierarchy;
 /// Shared sink for asynchronously generated voxel chunks (defined in Scene.cpp).
 struct VoxelStreamState;
 
@@ -234,6 +237,14 @@ public:
 	 */
 	[[nodiscard]] auto getAllEntities() const -> std::vector<Entity>;
 
+	/**
+	 * @brief
+	 *  Get the list of all entities without heap allocation.
+	 * @param[in,out] ioArena The arena holding the result.
+	 * @return List of all entities, valid until the arena is reset.
+	 */
+	[[nodiscard]] auto getAllEntities(core::FrameArena& ioArena) const -> std::span<Entity>;
+
 	/**
 	 * @brief
 	 *  Get root entities only (those with no parent).
@@ -241,6 +252,14 @@ public:
 	 */
 	[[nodiscard]] auto getRootEntities() const -> std::vector<Entity>;
 
+	/**
+	 * @brief
+	 *  Get root entities only without heap allocation.
+	 * @param[in,out] ioArena The arena holding the result.
+	 * @return List of root entities, valid until the arena is reset.
+	 */
+	[[nodiscard]] auto getRootEntities(core::FrameArena& ioArena) const -> std::span<Entity>;
+
 	/**
 	 * @brief
 	 *  Get the children of an entity.
@@ -249,6 +268,15 @@ public:
 	 */
 	[[nodiscard]] auto getChildren(const Entity& iEntity) const -> std::vector<Entity>;
 
+	/**
+	 * @brief
+	 *  Get the children of an entity without heap allocation.
+	 * @param[in] iEntity The parent entity.
+	 * @param[in,out] ioArena The arena holding the result.
+	 * @return List of child entities, valid until the arena is reset.
+	 */
+	[[nodiscard]] auto getChildren(const Entity& iEntity, core::FrameArena& ioArena) const -> std::span<Entity>;
+
 	/**
 	 * @brief
 	 *  Find an entity by its UUID.
@@ -267,15 +295,17 @@ public:
 
 	/**
 	 * @brief
-	 *  Rebuild the GPU world-transform SSBO and the entity → slot index map
-	 *  for the current frame.
+	 *  Bring the GPU world-transform SSBO and the entity → slot index map
+	 *  up to date for the current frame.
 	 *
-	 * Walks every entity carrying both `Transform` and `Hierarchy` in pre-order
-	 * (root → leaf) so the resulting topo-sorted entry array satisfies the
-	 * `parentIdx < own index` contract that
-	 * `renderer::utils::WorldTransformPass` requires. The same pass populates
-	 * `m_worldTransformCache` and an internal CPU mirror of the world matrices,
-	 * which lets `getWorldTransform()` and other CPU consumers serve cached
+	 * Every entity carrying both `Transform` and `Hierarchy` is kept in a
+	 * persistent `TransformHierarchy`: a depth-sorted flattening storing parent
+	 * indices directly, which satisfies the `parentIdx < own index` contract
+	 * that `renderer::utils::WorldTransformPass` requires. The flattening is
+	 * only rebuilt when the hierarchy structure changes; otherwise only the
+	 * subtrees below changed local transforms are recomputed on the CPU, and
+	 * only the changed local matrices are uploaded. The CPU mirror of the world
+	 * matrices lets `getWorldTransform()` and other CPU consumers serve cached
 	 * data without a GPU readback.
 	 *
 	 * Idempotent within a frame — the prepared state is invalidated when
@@ -295,8 +325,8 @@ public:
 	 *
 	 * Returns `UINT32_MAX` when the entity is missing from the current frame's
 	 * flattening — typically because it lacks a `Transform`/`Hierarchy`
-	 * component, was created after the prepare call, or because no prepare has
-	 * run yet on this tick. Callers that hit the sentinel must fall back to
+	 * component, was created after the prepare call, belongs to a circular
+	 * hierarchy, or because no prepare has run yet on this tick. Callers that hit the sentinel must fall back to
 	 * the transient world path on the renderer (a per-frame scratch SSBO).
 	 * @param[in] iEntity The entity to look up.
 	 * @return The slot index, or `UINT32_MAX` if the entity is not in the
@@ -478,10 +508,10 @@ private:
 	/**
 	 * @brief
 	 *  UUID → entt::entity index, kept warm across the scene's lifetime.
-	 *  Populated by `createEntityWithUUID`, cleared by `destroyEntity` /
-	 *  `destroyEntityWithChildren`. `findEntityByUUID` consults this map
-	 *  first (O(1)) and falls back to a registry scan + repair on miss,
-	 *  so even paths that bypass the canonical create remain correct.
+	 *  Maintained by the registry signals of `component::ID` (construct,
+	 *  replace, destroy), so every path creating an ID is indexed and
+	 *  `findEntityByUUID` never has to scan the registry: a miss means the
+	 *  UUID is not in the scene.
 	 */
 	mutable std::unordered_map<core::UUID, entt::entity> m_uuidIndex;
 	/**
@@ -494,14 +524,14 @@ private:
 	bool m_tilemapAssetsDirty = true;
 	/**
 	 * @brief
-	 *  Per-update-pass cache for `isEffectivelyVisible`. Key packs the entity
-	 *  id with a "is editor mode" bit; the bool value is the effective
-	 *  visibility (current entity + all ancestors). Only consulted when
+	 *  Per-update-pass cache for `isEffectivelyVisible`, one bit mask per
+	 *  entity slot holding the effective visibility (current entity + all
+	 *  ancestors) for the game and editor modes. Only consulted when
 	 *  `m_inUpdatePass` is true — outside an update tick (tests, inspector
 	 *  inspection helpers, …) the cache is bypassed so callers always see
 	 *  fresh `Visibility` state. Cleared at the start of every update tick.
 	 */
-	mutable std::unordered_map<uint64_t, bool> m_visibilityCache;
+	mutable EntitySideTable<uint8_t> m_visibilityCache;
 	/**
 	 * @brief
 	 *  True while `onUpdateRuntime` / `onUpdateEditor` (and the render passes
@@ -512,25 +542,28 @@ private:
 	mutable bool m_inUpdatePass = false;
 	/**
 	 * @brief
-	 *  Per-pass cache for `layerHasContent(name, iIsFirst=true)`. Populated
-	 *  lazily by the render-stack walk, dropped at the start of every update
-	 *  tick along with `m_visibilityCache`. Avoids the 7-view scan being
-	 *  repeated for every render frame of a stable scene.
+	 *  Per-pass cache for `layerHasContent`, indexed by `2 · layerId + iIsFirst`
+	 *  (-1: unknown, 0: empty, 1: has content). Populated lazily by the
+	 *  render-stack walk, reset at the start of every update tick along with
+	 *  `m_visibilityCache`. Avoids the 7-view scan being repeated for every
+	 *  render frame of a stable scene.
 	 */
-	mutable std::unordered_map<std::string, bool> m_layerContentCacheFirst;
-	/// Per-pass cache for `layerHasContent(name, iIsFirst=false)`.
-	mutable std::unordered_map<std::string, bool> m_layerContentCacheNotFirst;
+	mutable std::vector<int8_t> m_layerContentCache;
+	/// Interned layer names, the index is the layer id used by `m_layerContentCache`.
+	mutable std::vector<std::string> m_layerNames;
 	/**
 	 * @brief
-	 *  Per-pass cache for `getWorldTransform`. The same entity transform is
-	 *  recomputed up to ~30× per frame across sprites + circles + text +
-	 *  tilemaps + raycast sprites + dynamic walls + doors + physics sync +
-	 *  sound listener / source paths; caching kills the duplicates. Gated
-	 *  by `m_worldTransformCacheActive` (a narrower window than
-	 *  `m_inUpdatePass`) — only valid after the mutating phases (scripts /
-	 *  physics / entity links) have finished, where transforms are stable.
+	 *  Per-pass cache for `getWorldTransform` of the entities missing from
+	 *  `mp_transformHierarchy` (created after the prepare, circular
+	 *  hierarchies). The same entity transform is recomputed up to ~30× per
+	 *  frame across sprites + circles + text + tilemaps + raycast sprites +
+	 *  dynamic walls + doors + physics sync + sound listener / source paths;
+	 *  caching kills the duplicates. Gated by `m_worldTransformCacheActive`
+	 *  (a narrower window than `m_inUpdatePass`) — only valid after the
+	 *  mutating phases (scripts / physics / entity links) have finished,
+	 *  where transforms are stable.
 	 */
-	mutable std::unordered_map<entt::entity, math::Transform> m_worldTransformCache;
+	mutable EntitySideTable<math::Transform> m_worldTransformCache;
 	/**
 	 * @brief
 	 *  True only during the read-only tail of a tick (sound + render), arming
@@ -550,11 +583,12 @@ private:
 	mutable uniq<renderer::utils::WorldTransformPass> mp_worldTransformPass;
 	/**
 	 * @brief
-	 *  Per-frame entity → slot index in the GPU `worlds[]` SSBO populated by
-	 *  `prepareWorldTransforms()`. Refilled on every prepare call alongside
-	 *  `m_worldTransformCache`; lookup via `getWorldIndex()`.
+	 *  Depth-sorted flattening of the scene graph mirrored by the GPU
+	 *  `worlds[]` SSBO; its node index is the slot returned by
+	 *  `getWorldIndex()`. Updated incrementally by `prepareWorldTransforms()`,
+	 *  it also serves `getWorldTransform()` while the cache is armed.
 	 */
-	mutable std::unordered_map<entt::entity, uint32_t> m_entityToWorldIndex;
+	mutable uniq<TransformHierarchy> mp_transformHierarchy;
 	/**
 	 * @brief
 	 *  Action when component is added to an entity.
@@ -612,12 +646,16 @@ private:
 	 * @brief
 	 *  Stream procedural voxel chunks in and out around a camera position.
 	 *
-	 * For each `VoxelWorld` with `proceduralTerrain`, generates missing chunks
-	 * within the streaming radius (budgeted per frame) from its `TerrainGenerator`
-	 * and removes chunks that fell outside it. No-op for authored voxel worlds.
+	 * For each `VoxelWorld` with `proceduralTerrain`, removes chunks that fell
+	 * outside the streaming radius and queues missing ones nearest-first (biased
+	 * toward the view direction) through a per-world `ChunkStreamPlanner`. The
+	 * requests of all worlds go to the scheduler as one batched job per frame,
+	 * sized from the measured generation cost; finished chunks are moved into
+	 * the world without copying. No-op for authored voxel worlds.
 	 * @param[in] iCameraWorldPos The camera position in world space.
+	 * @param[in] iViewDirection The camera forward direction (zero disables the view bias).
 	 */
-	void updateVoxelStreaming(const math::vec3& iCameraWorldPos);
+	void updateVoxelStreaming(const math::vec3& iCameraWorldPos, const math::vec3& iViewDirection = {});
 
 	/**
 	 * @brief
@@ -747,6 +785,30 @@ private:
 	 */
 	[[nodiscard]] auto layerHasContent(const std::string& iLayerName, bool iIsFirst) const -> bool;
 
+	/**
+	 * @brief
+	 *  Integer id of a layer name, interning it on first use.
+	 * @param[in] iLayerName The layer name.
+	 * @return The layer id.
+	 */
+	[[nodiscard]] auto internLayerName(const std::string& iLayerName) const -> uint32_t;
+
+	/**
+	 * @brief
+	 *  Index the UUID of a newly constructed or replaced `component::ID`.
+	 * @param[in] iRegistry The registry.
+	 * @param[in] iEntity The entity.
+	 */
+	void onIdConstruct(entt::registry& iRegistry, entt::entity iEntity);
+
+	/**
+	 * @brief
+	 *  Drop the UUID of a destroyed `component::ID` from the index.
+	 * @param[in] iRegistry The registry.
+	 * @param[in] iEntity The entity.
+	 */
+	void onIdDestroy(entt::registry& iRegistry, entt::entity iEntity);
+
 	/// The viewport's size.
 	math::vec2ui m_viewportSize = {0, 0};
 	/// Inverse of camera view rotation matrix (for skybox rendering).
@@ -128,6 +128,39 @@ public:
 	 */
 	void setTile(uint32_t iLayer, uint32_t iX, uint32_t iY, int32_t iValue);
 
+	/// Side of the square cell chunks tracked for renderer caching.
+	static constexpr uint32_t g_chunkSize = 32;
+
+	/**
+	 * @brief
+	 *  Revision of a `g_chunkSize`² chunk of a layer.
+	 *
+	 * Changes whenever a cell of the chunk is edited through `setTile` /
+	 * `markCellDirty`, or the whole asset through `resize`, `addLayer`,
+	 * `markDirty` or a load. Revisions are unique across all assets, so a cache
+	 * only has to compare them for equality.
+	 * @param[in] iLayer The 0-based layer index.
+	 * @param[in] iChunkX Chunk column (cell x / `g_chunkSize`).
+	 * @param[in] iChunkY Chunk row (cell y / `g_chunkSize`).
+	 * @return The chunk revision.
+	 */
+	[[nodiscard]] auto getChunkRevision(uint32_t iLayer, uint32_t iChunkX, uint32_t iChunkY) const -> uint64_t;
+
+	/**
+	 * @brief
+	 *  Flag one cell as modified, after writing `layers[].tiles` directly.
+	 * @param[in] iLayer The 0-based layer index.
+	 * @param[in] iX Cell x.
+	 * @param[in] iY Cell y.
+	 */
+	void markCellDirty(uint32_t iLayer, uint32_t iX, uint32_t iY);
+
+	/**
+	 * @brief
+	 *  Flag the whole asset as modified, after writing `layers`, `width` or `height` directly.
+	 */
+	void markDirty();
+
 	/**
 	 * @brief
 	 *  Serialize the tilemap asset to a YAML string.
@@ -160,6 +193,19 @@ public:
 	 * @return True on success.
 	 */
 	[[nodiscard]] auto loadFromFile(const std::filesystem::path& iPath) -> bool;
+
+private:
+	/**
+	 * @brief
+	 *  Draw a revision never returned before.
+	 * @return The revision.
+	 */
+	static auto nextRevision() -> uint64_t;
+
+	/// Revision of the whole asset, floor of every chunk revision.
+	uint64_t m_revision = nextRevision();
+	/// Revision of each edited chunk (layer-major, then row-major); empty until the first cell edit.
+	std::vector<uint64_t> m_chunkRevisions;
 };
 
 }// namespace owl::scene
@@ -11,13 +11,43 @@
 #include "core/Core.h"
 #include <filesystem>
 
+namespace owl::core::task {
+class Scheduler;
+}// namespace owl::core::task
+
 namespace owl::sound {
+/**
+ * @brief
+ *  Load progress of a sound.
+ *
+ * Sounds created through `SoundData::createAsync` start `Pending`; synchronously created ones are
+ * `Ready`, or `Failed` when they could not be decoded.
+ */
+enum struct LoadState : uint8_t {
+	Pending,///< Decoding on a worker; nothing can be heard yet.
+	Ready,///< Samples uploaded (or stream ready to open).
+	Failed,///< The sound could not be read or decoded.
+};
+
 /**
  * @brief
  *  Abstract class representing what's required for playing sound.
  */
 class OWL_API SoundData {
 public:
+	/**
+	 * @brief
+	 *  How the samples of a sound are held.
+	 */
+	enum struct LoadMode : uint8_t {
+		Auto,///< Stream the sounds whose decoded samples exceed streamThreshold, decode the others at once.
+		Static,///< Decode the whole sound into one buffer at creation.
+		Stream,///< Decode while playing, a few chunks ahead of the source.
+	};
+
+	/// Decoded size (in bytes) above which a sound in Auto mode is streamed.
+	static constexpr size_t streamThreshold = 4ull * 1024 * 1024;
+
 	/**
 	 * @brief
 	 *  Definition of a sound.
@@ -25,6 +55,10 @@ public:
 	struct Specification {
 		/// Sound's name, used to find the file in the assets.
 		std::filesystem::path file;
+		/// Entry of the application's asset pack holding the sound, read instead of the file when not empty.
+		std::string packEntry;
+		/// How the samples are held.
+		LoadMode mode = LoadMode::Auto;
 	};
 
 	/**
@@ -78,6 +112,27 @@ public:
 	 */
 	[[nodiscard]] virtual auto getSystemId() const -> uint64_t = 0;
 
+	/**
+	 * @brief
+	 *  Check if the sound is decoded while playing instead of held in one buffer.
+	 * @return True for a streamed sound.
+	 */
+	[[nodiscard]] virtual auto isStreaming() const -> bool { return false; }
+
+	/**
+	 * @brief
+	 *  Access to the specifications.
+	 * @return The specifications.
+	 */
+	[[nodiscard]] auto getSpecification() const -> const Specification& { return m_specification; }
+
+	/**
+	 * @brief
+	 *  Current load state.
+	 * @return The load state (only changes on the main thread).
+	 */
+	[[nodiscard]] auto getLoadState() const -> LoadState { return m_loadState; }
+
 	/**
 	 * @brief
 	 *  Create a new sound data buffer base on specifications.
@@ -94,6 +149,31 @@ public:
 	 */
 	static auto create(const std::filesystem::path& iPath) -> shared<SoundData>;
 
+	/**
+	 * @brief
+	 *  Create a sound data without blocking on its decoding.
+	 *
+	 * The file is decoded on a worker of the scheduler; the samples are handed to the sound API
+	 * in the task's termination callback, on the main thread, which moves the state from `Pending`
+	 * to `Ready` or `Failed`. A pending sound can already be played: the sound API starts it once
+	 * it is ready. Backends without decoding return a ready sound.
+	 * @param[in] iSpec The specifications of the sound.
+	 * @param[in,out] ioScheduler Scheduler running the decoding.
+	 * @return Pointer to the created buffer.
+	 */
+	static auto createAsync(const Specification& iSpec, core::task::Scheduler& ioScheduler) -> shared<SoundData>;
+
+	/**
+	 * @brief
+	 *  Look for a sound in the application's asset pack.
+	 *
+	 * The name is tried as is and under `sounds/`, as the pack builder stores them,
+	 * with each supported extension when it has none.
+	 * @param[in] iName Name of the sound.
+	 * @return The specification reading the pack entry, or nullopt if no pack is open or it lacks the sound.
+	 */
+	static auto packSpecification(const std::string& iName) -> std::optional<Specification>;
+
 	/**
 	 * @brief
 	 *  Defines the possible extensions type for this dta.
@@ -104,6 +184,8 @@ public:
 protected:
 	/// The sound's data specification.
 	Specification m_specification;
+	/// Current load state (only written from the main thread).
+	LoadState m_loadState{LoadState::Ready};
 };
 
 }// namespace owl::sound
@@ -14,6 +14,7 @@
 namespace owl::scene {
 
 class Entity;
+class Scene;
 }
 
 namespace owl::sound {
@@ -37,6 +38,14 @@ public:
 	 * @param[in,out] iEntity The entity with a SoundSource component.
 	 */
 	static void stopEntitySound(const scene::Entity& iEntity);
+
+	/**
+	 * @brief
+	 *  Prefetch the sounds of all the SoundSource components of a scene in one batch.
+	 * @param[in] iScene The scene.
+	 * @return Number of sounds added to the sound library.
+	 */
+	static auto prefetchSceneSounds(const scene::Scene& iScene) -> size_t;
 };
 
 }// namespace owl::sound
@@ -88,6 +88,18 @@ public:
 	 */
 	static auto getSoundLibrary() -> SoundLibrary& { return *m_soundLibrary; }
 
+	/**
+	 * @brief
+	 *  Load sounds into the library ahead of their use, decoding them in parallel.
+	 *
+	 * Names already in the library are skipped. With a running application, the sounds are
+	 * created with `SoundData::createAsync` on its task scheduler and stay `Pending` until their
+	 * upload on the main thread (they can be played meanwhile); otherwise they are loaded in turn.
+	 * @param[in] iNames Names of the sounds, as given to the library.
+	 * @return Number of sounds added to the library.
+	 */
+	static auto prefetch(std::span<const std::string> iNames) -> size_t;
+
 private:
 	/// The state of the renderer.
 	static State m_internalState;
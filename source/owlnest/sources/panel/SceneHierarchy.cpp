@@ -141,7 +141,7 @@ void SceneHierarchy::renderHierarchy() {
 void SceneHierarchy::renderRootEntities() {
 	const auto& stack = renderer::Renderer::getRenderStack();
 	const auto& layers = stack.getLayers();
-	const auto roots = m_context->getRootEntities();
+	const auto roots = m_context->getRootEntities(core::FrameArena::frame());
 	// 0 or 1 layer → flat list (legacy behaviour, no extra nesting).
 	if (layers.size() < 2) {
 		for (auto entity: roots) drawEntityNode(entity);
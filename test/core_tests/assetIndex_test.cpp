@@ -0,0 +1,196 @@
+/**
+ * @file assetIndex_test.cpp
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright (c) 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#include "testHelper.h"
+
+#include <data/assets/AssetIndex.h>
+
+#include <fstream>
+
+using namespace owl::data::assets;
+
+namespace {
+auto getTempDir() -> std::filesystem::path { return std::filesystem::temp_directory_path() / "owl_asset_index_tests"; }
+
+void touch(const std::filesystem::path& iFile) {
+	std::filesystem::create_directories(iFile.parent_path());
+	std::ofstream out(iFile);
+	out << "x";
+}
+
+auto makeTree() -> std::filesystem::path {
+	const auto root = getTempDir() / "assets";
+	std::filesystem::remove_all(getTempDir());
+	touch(root / "logo.png");
+	touch(root / "textures" / "mario.png");
+	touch(root / "textures" / "mario.jpg");
+	touch(root / "textures" / "deep" / "tiles" / "grass.png");
+	touch(root / "other" / "tiles" / "grass.jpg");
+	touch(root / "sounds" / "jump.wav");
+	return root;
+}
+
+const std::vector<std::string> g_imageExtensions{".png", ".jpg"};
+
+auto findIn(AssetIndex& ioIndex, const std::vector<std::filesystem::path>& iRoots, const std::string& iName)
+		-> std::string {
+	return ioIndex.find(iRoots, iName, g_imageExtensions).value_or(std::filesystem::path{}).string();
+}
+}// namespace
+
+TEST(AssetIndex, findLikeTheRecursiveWalk) {
+	owl::core::Log::init(owl::core::Log::Level::Off);
+	const auto root = makeTree();
+	const std::vector roots{root};
+	AssetIndex index;
+	index.setWatching(false);
+
+	// Right under the root: found without indexing.
+	EXPECT_EQ(findIn(index, roots, "logo"), (root / "logo.png").string());
+	EXPECT_EQ(index.getFileCount(root), 0u);
+	// Extension order counts when the name has none.
+	EXPECT_EQ(findIn(index, roots, "mario"), (root / "textures" / "mario.png").string());
+	EXPECT_EQ(index.getFileCount(root), 6u);
+	EXPECT_EQ(findIn(index, roots, "mario.jpg"), (root / "textures" / "mario.jpg").string());
+	// Relative paths match at any depth, the shallowest first.
+	EXPECT_EQ(findIn(index, roots, "tiles/grass"), (root / "other" / "tiles" / "grass.jpg").string());
+	EXPECT_EQ(findIn(index, roots, "deep/tiles/grass"), (root / "textures" / "deep" / "tiles" / "grass.png").string());
+	// A name with an extension is found whatever the extension list.
+	EXPECT_EQ(findIn(index, roots, "jump.wav"), (root / "sounds" / "jump.wav").string());
+	EXPECT_FALSE(index.find(roots, "missing", g_imageExtensions).has_value());
+	EXPECT_FALSE(index.find(roots, "ario", g_imageExtensions).has_value());
+
+	const auto images = index.list(roots, g_imageExtensions);
+	EXPECT_EQ(images.size(), 5u);
+	EXPECT_TRUE(std::ranges::is_sorted(images));
+
+	std::filesystem::remove_all(getTempDir());
+	owl::core::Log::invalidate();
+}
+
+TEST(AssetIndex, rootPriority) {
+	owl::core::Log::init(owl::core::Log::Level::Off);
+	const auto root = makeTree();
+	const auto second = getTempDir() / "more";
+	touch(second / "mario.png");
+	AssetIndex index;
+	index.setWatching(false);
+	// Right under the second root, but the first root wins even from a sub-directory.
+	EXPECT_EQ(findIn(index, std::vector{root, second}, "mario"), (root / "textures" / "mario.png").string());
+	EXPECT_EQ(findIn(index, std::vector{second, root}, "mario"), (second / "mario.png").string());
+	index.removeRoot(second);
+	EXPECT_EQ(index.getFileCount(second), 0u);
+	std::filesystem::remove_all(getTempDir());
+	owl::core::Log::invalidate();
+}
+
+TEST(AssetIndex, revalidationWithoutNotifications) {
+	owl::core::Log::init(owl::core::Log::Level::Off);
+	const auto root = makeTree();
+	const std::vector roots{root};
+	AssetIndex index;
+	index.setWatching(false);
+	EXPECT_FALSE(index.isWatching());
+	index.build(roots);
+	EXPECT_EQ(index.getFileCount(root), 6u);
+
+	// A removed file is skipped, even before the index knows.
+	std::filesystem::remove(root / "textures" / "mario.png");
+	EXPECT_EQ(findIn(index, roots, "mario"), (root / "textures" / "mario.jpg").string());
+	// A miss revalidates the changed directories.
+	touch(root / "textures" / "new" / "luigi.png");
+	EXPECT_EQ(findIn(index, roots, "luigi"), (root / "textures" / "new" / "luigi.png").string());
+	EXPECT_EQ(index.getFileCount(root), 6u);
+	std::filesystem::remove_all(getTempDir());
+	owl::core::Log::invalidate();
+}
+
+TEST(AssetIndex, saveAndLoad) {
+	owl::core::Log::init(owl::core::Log::Level::Off);
+	const auto root = makeTree();
+	const std::vector roots{root};
+	const auto cache = getTempDir() / "cache" / "asset_index.txt";
+	{
+		AssetIndex index;
+		index.setWatching(false);
+		index.build(roots);
+		ASSERT_TRUE(index.save(cache));
+	}
+	// Changes made while no index was alive.
+	std::filesystem::remove_all(root / "other");
+	touch(root / "sounds" / "land.wav");
+
+	AssetIndex index;
+	index.setWatching(false);
+	ASSERT_TRUE(index.load(cache));
+	EXPECT_EQ(index.getFileCount(root), 6u);
+	index.build(roots);
+	EXPECT_EQ(index.getFileCount(root), 6u);
+	EXPECT_EQ(findIn(index, roots, "land.wav"), (root / "sounds" / "land.wav").string());
+	EXPECT_EQ(findIn(index, roots, "tiles/grass"), (root / "textures" / "deep" / "tiles" / "grass.png").string());
+
+	{
+		std::ofstream out(cache);
+		out << "not an index\n";
+	}
+	AssetIndex broken;
+	EXPECT_FALSE(broken.load(cache));
+	EXPECT_FALSE(broken.load(getTempDir() / "missing.txt"));
+	std::filesystem::remove_all(getTempDir());
+	owl::core::Log::invalidate();
+}
+
+TEST(AssetIndex, loadBadStamp) {
+	owl::core::Log::init(owl::core::Log::Level::Off);
+	const auto root = makeTree();
+	const std::vector roots{root};
+	const auto cache = getTempDir() / "cache" / "asset_index.txt";
+	std::filesystem::create_directories(cache.parent_path());
+	for (const auto* stamp: {"12x4", "", "99999999999999999999999"}) {
+		{
+			std::ofstream out(cache);
+			out << "owl-asset-index 1\n";
+			out << "root " << root.generic_string() << "\n";
+			out << "dir " << stamp << " textures\n";
+			out << "file mario.png\n";
+		}
+		AssetIndex index;
+		index.setWatching(false);
+		EXPECT_FALSE(index.load(cache));
+		EXPECT_EQ(index.getFileCount(root), 0u);
+		// The roots are crawled again.
+		index.build(roots);
+		EXPECT_EQ(index.getFileCount(root), 6u);
+	}
+	std::filesystem::remove_all(getTempDir());
+	owl::core::Log::invalidate();
+}
+
+#if defined(OWL_PLATFORM_LINUX)
+TEST(AssetIndex, followsNotifications) {
+	owl::core::Log::init(owl::core::Log::Level::Off);
+	const auto root = makeTree();
+	const std::vector roots{root};
+	AssetIndex index;
+	index.build(roots);
+	ASSERT_TRUE(index.isWatching());
+
+	touch(root / "textures" / "deep" / "peach.png");
+	std::filesystem::create_directories(root / "fonts" / "bold");
+	touch(root / "fonts" / "bold" / "title.ttf");
+	std::filesystem::remove_all(root / "other");
+	std::filesystem::rename(root / "logo.png", root / "sounds" / "logo.png");
+	index.update();
+	EXPECT_EQ(index.getFileCount(root), 7u);
+	EXPECT_EQ(findIn(index, roots, "title.ttf"), (root / "fonts" / "bold" / "title.ttf").string());
+	EXPECT_EQ(findIn(index, roots, "logo"), (root / "sounds" / "logo.png").string());
+	EXPECT_EQ(findIn(index, roots, "tiles/grass"), (root / "textures" / "deep" / "tiles" / "grass.png").string());
+	std::filesystem::remove_all(getTempDir());
+	owl::core::Log::invalidate();
+}
+#endif
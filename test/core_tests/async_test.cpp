@@ -8,6 +8,20 @@
 using namespace owl::core;
 using namespace owl::core::task;
 
+namespace {
+/// Spin until a condition holds, with a timeout.
+template<typename Predicate>
+auto waitFor(Predicate&& iPredicate) -> bool {
+	const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+	while (!iPredicate()) {
+		if (std::chrono::steady_clock::now() > deadline)
+			return false;
+		std::this_thread::yield();
+	}
+	return true;
+}
+}// namespace
+
 TEST(core_task, SchedulerBasic) {
 	Scheduler scheduler;
 	Timestep ts;
@@ -20,28 +34,33 @@ TEST(core_task, SchedulerBasic) {
 	// do a frame with empty queue
 	ts.forceUpdate(std::chrono::milliseconds(100));
 	scheduler.frame(ts);
-	std::this_thread::sleep_for(std::chrono::milliseconds(5));//slowdown a little before checking
 
-	// add an empty task
-	EXPECT_EQ(scheduler.pushTask(Task([&] -> void {})), 1);
+	// add a task that waits to be released
+	std::atomic_bool started = false;
+	std::atomic_bool release = false;
+	std::atomic_bool done = false;
+	EXPECT_EQ(scheduler.pushTask(Task([&] -> void {
+				  started = true;
+				  while (!release) std::this_thread::yield();
+				  done = true;
+			  })),
+			  1);
 	EXPECT_FALSE(scheduler.isTaskFinished(1));
-	EXPECT_FALSE(scheduler.isTaskRunning(1));
-	EXPECT_TRUE(scheduler.isTaskInQueue(1));
-
-	// faking a new frame
-	ts.forceUpdate(std::chrono::milliseconds(100));
-	scheduler.frame(ts);
-	std::this_thread::sleep_for(std::chrono::milliseconds(5));//slowdown a little before checking
 
+	// Started without any frame.
+	ASSERT_TRUE(waitFor([&] -> bool { return started.load(); }));
 	EXPECT_FALSE(scheduler.isTaskFinished(1));
 	EXPECT_TRUE(scheduler.isTaskRunning(1));
 	EXPECT_FALSE(scheduler.isTaskInQueue(1));
 
-	// faking a new frame
-	ts.forceUpdate(std::chrono::milliseconds(100));
-	scheduler.frame(ts);
+	// The action is done, but the task terminates on the next frame.
+	release = true;
+	ASSERT_TRUE(waitFor([&] -> bool { return done.load(); }));
 	std::this_thread::sleep_for(std::chrono::milliseconds(5));//slowdown a little before checking
+	EXPECT_TRUE(scheduler.isTaskRunning(1));
 
+	ts.forceUpdate(std::chrono::milliseconds(100));
+	scheduler.frame(ts);
 	EXPECT_TRUE(scheduler.isTaskFinished(1));
 	EXPECT_FALSE(scheduler.isTaskRunning(1));
 	EXPECT_FALSE(scheduler.isTaskInQueue(1));
@@ -49,32 +68,270 @@ TEST(core_task, SchedulerBasic) {
 
 TEST(core_task, SchedulerTasks) {
 	uint8_t counter = 0;
+	std::atomic_uint32_t actions = 0;
 	{
-		Scheduler scheduler;
+		Scheduler scheduler{1};
 		Timestep ts;
 
-		scheduler.pushTask(Task([&] -> void {}, [&] -> void { counter++; }));
-		ts.forceUpdate(std::chrono::milliseconds(100));
-		scheduler.frame(ts);
+		scheduler.pushTask(Task([&] -> void { ++actions; }, [&] -> void { counter++; }));
+		ASSERT_TRUE(waitFor([&] -> bool { return actions.load() == 1; }));
 		std::this_thread::sleep_for(std::chrono::milliseconds(5));//slowdown a little before checking
+		// The termination callback waits for the main thread.
 		EXPECT_EQ(counter, 0);
 		ts.forceUpdate(std::chrono::milliseconds(100));
 		scheduler.frame(ts);
-		std::this_thread::sleep_for(std::chrono::milliseconds(5));//slowdown a little before checking
 		EXPECT_EQ(counter, 1);
-		scheduler.pushTask(Task([&] -> void {}, [&] -> void { counter++; }));
-		scheduler.pushTask(Task([&] -> void {}, [&] -> void { counter++; }));
-		scheduler.pushTask(Task([&] -> void {}, [&] -> void { counter++; }));
+
+		// Keep the only worker busy, so the next tasks wait in queue.
+		std::atomic_bool release = false;
+		scheduler.pushTask(Task([&] -> void {
+			++actions;
+			while (!release) std::this_thread::yield();
+		}));
+		ASSERT_TRUE(waitFor([&] -> bool { return actions.load() == 2; }));
+		scheduler.pushTask(Task([&] -> void { ++actions; }, [&] -> void { counter++; }));
+		scheduler.pushTask(Task([&] -> void { ++actions; }, [&] -> void { counter++; }));
+		scheduler.pushTask(Task([&] -> void { ++actions; }, [&] -> void { counter++; }));
 		EXPECT_TRUE(scheduler.isTaskInQueue(4));
 		scheduler.clearQueue();
-		EXPECT_EQ(counter, 1);
 		EXPECT_FALSE(scheduler.isTaskInQueue(4));
-		// this task should be destroyed with the scheduler, with no possibility to run.
-		EXPECT_EQ(scheduler.pushTask(Task([&] -> void { counter++; }, [&] -> void { counter++; })), 5);
+		EXPECT_TRUE(scheduler.isTaskFinished(4));
+		EXPECT_TRUE(scheduler.isTaskRunning(2));
+		release = true;
+		// this task should be terminated by the scheduler's destruction.
+		EXPECT_EQ(scheduler.pushTask(Task([&] -> void { ++actions; }, [&] -> void { counter++; })), 6);
+		ASSERT_TRUE(waitFor([&] -> bool { return actions.load() == 3; }));
+		EXPECT_EQ(counter, 1);
 	}
-	EXPECT_EQ(counter, 1);
+	EXPECT_EQ(counter, 2);
+	EXPECT_EQ(actions, 3);
 }
 
+TEST(core_task, SchedulerNestedTasks) {
+	Scheduler scheduler;
+	std::atomic_uint32_t counter = 0;
+	std::vector<std::thread::id> terminations;
+	// Tasks pushed from a worker start at once, and terminate on the main thread.
+	for (size_t i = 0; i < 8; ++i) {
+		scheduler.pushTask(Task([&] -> void {
+			for (size_t j = 0; j < 8; ++j)
+				scheduler.pushTask(
+						Task([&] -> void { ++counter; },
+							 [&] -> void { terminations.push_back(std::this_thread::get_id()); }));
+		}));
+	}
+	scheduler.waitEmptyQueue();
+	EXPECT_EQ(counter, 64u);
+	ASSERT_EQ(terminations.size(), 64u);
+	for (const auto& id: terminations) EXPECT_EQ(id, std::this_thread::get_id());
+	EXPECT_TRUE(scheduler.isTaskFinished(72));
+}
+
+TEST(core_task, SchedulerPriorities) {
+	Scheduler scheduler{1};
+	std::atomic_bool started = false;
+	std::atomic_bool release = false;
+	scheduler.pushTask(Task([&] -> void {
+		started = true;
+		while (!release) std::this_thread::yield();
+	}));
+	ASSERT_TRUE(waitFor([&] -> bool { return started.load(); }));
+	// Only one worker: the waiting tasks run by priority class, then in push order.
+	std::vector<int> order;
+	const auto push = [&](const int iValue, const Task::Priority iPriority) -> void {
+		Task task([&order, iValue] -> void { order.push_back(iValue); });
+		task.setPriority(iPriority);
+		scheduler.pushTask(std::move(task));
+	};
+	push(5, Task::Priority::Background);
+	push(3, Task::Priority::Streaming);
+	push(1, Task::Priority::Interactive);
+	push(4, Task::Priority::Streaming);
+	push(2, Task::Priority::Interactive);
+	release = true;
+	scheduler.waitEmptyQueue();
+	EXPECT_EQ(order, (std::vector{1, 2, 3, 4, 5}));
+}
+
+TEST(core_task, SchedulerDependencies) {
+	Scheduler scheduler;
+	std::atomic_bool release = false;
+	std::vector<std::string> steps;
+	std::mutex stepsMutex;
+	const auto record = [&](const std::string& iStep) -> void {
+		const std::scoped_lock lock{stepsMutex};
+		steps.push_back(iStep);
+	};
+	const size_t generate = scheduler.pushTask(Task([&] -> void {
+		while (!release) std::this_thread::yield();
+		record("generate");
+	}));
+	Task mesh([&] -> void { record("mesh"); });
+	mesh.addDependency(generate);
+	const size_t meshId = scheduler.pushTask(std::move(mesh));
+	Task upload([&] -> void { record("upload"); });
+	upload.addDependency(meshId);
+	upload.addDependency(generate);
+	const size_t uploadId = scheduler.pushTask(std::move(upload));
+	std::this_thread::sleep_for(std::chrono::milliseconds(5));//slowdown a little before checking
+	EXPECT_TRUE(scheduler.isTaskInQueue(meshId));
+	EXPECT_TRUE(scheduler.isTaskInQueue(uploadId));
+
+	release = true;
+	scheduler.waitEmptyQueue();
+	EXPECT_EQ(steps, (std::vector<std::string>{"generate", "mesh", "upload"}));
+
+	// Finished or unknown dependencies are satisfied.
+	bool done = false;
+	Task late([] -> void {}, [&done] -> void { done = true; });
+	late.addDependency(generate);
+	late.addDependency(9999);
+	scheduler.pushTask(std::move(late));
+	scheduler.waitEmptyQueue();
+	EXPECT_TRUE(done);
+}
+
+TEST(core_task, SchedulerCancellation) {
+	Scheduler scheduler{1};
+	std::atomic_bool started = false;
+	std::atomic_bool release = false;
+	std::atomic_uint32_t actions = 0;
+	uint32_t terminations = 0;
+	scheduler.pushTask(Task([&] -> void {
+		started = true;
+		while (!release) std::this_thread::yield();
+	}));
+	ASSERT_TRUE(waitFor([&] -> bool { return started.load(); }));
+
+	// Cancelled before it starts: neither the action nor the termination run, nor do its successors.
+	const CancellationToken token;
+	Task chunk([&] -> void { ++actions; }, [&] -> void { ++terminations; });
+	chunk.setCancellationToken(token);
+	const size_t chunkId = scheduler.pushTask(std::move(chunk));
+	Task mesh([&] -> void { ++actions; }, [&] -> void { ++terminations; });
+	mesh.addDependency(chunkId);
+	const size_t meshId = scheduler.pushTask(std::move(mesh));
+	// Not cancelled.
+	scheduler.pushTask(Task([&] -> void { ++actions; }, [&] -> void { ++terminations; }));
+	token.cancel();
+	release = true;
+	scheduler.waitEmptyQueue();
+	EXPECT_EQ(actions, 1u);
+	EXPECT_EQ(terminations, 1u);
+	EXPECT_TRUE(scheduler.isTaskFinished(chunkId));
+	EXPECT_TRUE(scheduler.isTaskFinished(meshId));
+	// Once drained, the cancelled task is unknown: it no longer cancels new dependents.
+	Task late([&] -> void { ++actions; }, [&] -> void { ++terminations; });
+	late.addDependency(chunkId);
+	scheduler.pushTask(std::move(late));
+	scheduler.waitEmptyQueue();
+	EXPECT_EQ(actions, 2u);
+	EXPECT_EQ(terminations, 2u);
+
+	// Cancelled while running: the action sees it, and the termination is skipped.
+	const CancellationToken running;
+	std::atomic_bool stopped = false;
+	Task loop(
+			[&, running] -> void {
+				while (!running.isCancelled()) std::this_thread::yield();
+				stopped = true;
+			},
+			[&] -> void { ++terminations; });
+	loop.setCancellationToken(running);
+	const size_t loopId = scheduler.pushTask(std::move(loop));
+	ASSERT_TRUE(waitFor([&] -> bool { return scheduler.isTaskRunning(loopId); }));
+	running.cancel();
+	scheduler.waitEmptyQueue();
+	EXPECT_TRUE(stopped);
+	EXPECT_EQ(terminations, 2u);
+}
+
+TEST(core_task, TaskFunction) {
+	const auto shared = owl::mkShared<int>(0);
+	TaskFunction small{[shared] -> void { ++*shared; }};
+	EXPECT_TRUE(small.isInline());
+	small();
+	EXPECT_EQ(*shared, 1);
+	EXPECT_EQ(shared.use_count(), 2);
+
+	// Moving relocates the closure, leaving the source empty.
+	TaskFunction moved{std::move(small)};
+	EXPECT_FALSE(static_cast<bool>(small));// NOLINT(bugprone-use-after-move,hicpp-invalid-access-moved)
+	moved();
+	EXPECT_EQ(*shared, 2);
+	EXPECT_EQ(shared.use_count(), 2);
+
+	// Too large for the inline storage: on the heap.
+	std::array<uint8_t, TaskFunction::g_inlineSize + 1> payload{};
+	payload[0] = 3;
+	TaskFunction large{[shared, payload] -> void { *shared += payload[0]; }};
+	EXPECT_FALSE(large.isInline());
+	moved = std::move(large);
+	EXPECT_EQ(shared.use_count(), 2);
+	moved();
+	EXPECT_EQ(*shared, 5);
+	moved.reset();
+	EXPECT_EQ(shared.use_count(), 1);
+}
+
+TEST(core_task, SchedulerPooledTasks) {
+	Scheduler scheduler{1};
+	const auto& pool = scheduler.getImpl().taskPool;
+	std::atomic_uint32_t counter = 0;
+	for (int round = 0; round < 2; ++round) {
+		std::atomic_bool started = false;
+		std::atomic_bool release = false;
+		scheduler.pushTask(Task([&] -> void {
+			started = true;
+			while (!release) std::this_thread::yield();
+		}));
+		ASSERT_TRUE(waitFor([&] -> bool { return started.load(); }));
+		for (size_t i = 0; i < 1000; ++i) scheduler.pushTask(Task([&counter] -> void { ++counter; }));
+		// Every task in flight holds a slot.
+		EXPECT_EQ(pool.getUsedSlotCount(), 1001u);
+		release = true;
+		scheduler.waitEmptyQueue();
+		ASSERT_TRUE(waitFor([&] -> bool { return pool.getUsedSlotCount() == 0; }));
+		// The second round reuses the slots of the first one.
+		EXPECT_EQ(pool.getSlotCount(), 4 * TaskPool::g_slotsPerBlock);
+	}
+	EXPECT_EQ(counter, 2000u);
+}
+
+// Run on demand only: --gtest_also_run_disabled_tests --gtest_filter=*SchedulerMicroBenchmark.
+TEST(core_task, DISABLED_SchedulerMicroBenchmark) {
+	Scheduler scheduler;
+	using clock = std::chrono::steady_clock;
+
+	// Push-to-start latency, one task at a time on an idle pool.
+	constexpr size_t latencySamples = 200;
+	std::vector<double> latencies;
+	latencies.reserve(latencySamples);
+	for (size_t i = 0; i < latencySamples; ++i) {
+		std::atomic<clock::time_point::rep> startTick = 0;
+		const auto pushed = clock::now();
+		scheduler.pushTask(Task([&startTick] -> void { startTick = clock::now().time_since_epoch().count(); }));
+		ASSERT_TRUE(waitFor([&] -> bool { return startTick.load() != 0; }));
+		const clock::time_point started{clock::duration{startTick.load()}};
+		latencies.push_back(std::chrono::duration<double, std::micro>(started - pushed).count());
+		scheduler.waitEmptyQueue();
+	}
+	std::ranges::sort(latencies);
+	const double medianLatency = latencies[latencySamples / 2];
+
+	// Throughput of empty tasks, from the first push to the last termination.
+	constexpr size_t taskCount = 100000;
+	std::atomic_uint32_t counter = 0;
+	const auto begin = clock::now();
+	for (size_t i = 0; i < taskCount; ++i) scheduler.pushTask(Task([&counter] -> void { ++counter; }));
+	scheduler.waitEmptyQueue();
+	const double seconds = std::chrono::duration<double>(clock::now() - begin).count();
+	EXPECT_EQ(counter, taskCount);
+	const double tasksPerSecond = static_cast<double>(taskCount) / seconds;
+
+	RecordProperty("pushToStartMedianUs", std::to_string(medianLatency));
+	RecordProperty("tasksPerSecond", std::to_string(tasksPerSecond));
+}
 
 TEST(core_task, SchedulerTimers) {
 	Scheduler scheduler;
@@ -92,15 +349,16 @@ TEST(core_task, SchedulerTimers) {
 										 .frequency = std::chrono::milliseconds(100),
 										 .async = false,
 										 .iteration = 3});
-	// all must run once at the beginning! -> task 2 not yet executed but a task should have been created
+	// all must run once at the beginning! -> task 2 runs on a worker, and terminates at the next frame
 	scheduler.frame(ts);// t1, t2->async, t3(1)
-	EXPECT_EQ(counter, 2);
-	EXPECT_TRUE(scheduler.isTaskInQueue(1));
+	std::this_thread::sleep_for(std::chrono::milliseconds(5));//slowdown a little before checking
+	EXPECT_EQ(counter, 3);
+	EXPECT_FALSE(scheduler.isTaskFinished(1));
 
 	ts.forceUpdate(std::chrono::milliseconds(101));
-	scheduler.frame(ts);// a_t2, t3(2)
-	std::this_thread::sleep_for(std::chrono::milliseconds(5));//slowdown a little before checking
+	scheduler.frame(ts);// t3(2)
 	EXPECT_EQ(counter, 4);
+	EXPECT_TRUE(scheduler.isTaskFinished(1));
 
 	t1.lock()->setPaused(true);
 	t1.lock()->togglePaused();
@@ -109,23 +367,23 @@ TEST(core_task, SchedulerTimers) {
 	t3.lock()->pause();
 	ts.forceUpdate(std::chrono::milliseconds(101));// total 202
 	scheduler.frame(ts);// t2->async
-	EXPECT_EQ(counter, 4);
-	EXPECT_TRUE(scheduler.isTaskInQueue(2));
+	std::this_thread::sleep_for(std::chrono::milliseconds(5));//slowdown a little before checking
+	EXPECT_EQ(counter, 5);
 
 	ts.forceUpdate(std::chrono::milliseconds(101));// total 303
-	scheduler.frame(ts);// t1, a_t2
-	std::this_thread::sleep_for(std::chrono::milliseconds(5));//slowdown a little before checking
+	scheduler.frame(ts);// t1
 	EXPECT_EQ(counter, 6);
 
 	t3.lock()->resume();
 	ts.forceUpdate(std::chrono::milliseconds(101));// total 404
 	scheduler.frame(ts);// t2->async, t3(3->X)
-	EXPECT_EQ(counter, 7);
+	std::this_thread::sleep_for(std::chrono::milliseconds(5));//slowdown a little before checking
+	EXPECT_EQ(counter, 8);
 
 
 	scheduler.clearTimers();
 	ts.forceUpdate(std::chrono::milliseconds(101));// total 505
-	scheduler.frame(ts);// a_t2
+	scheduler.frame(ts);
 	std::this_thread::sleep_for(std::chrono::milliseconds(5));//slowdown a little before checking
 	EXPECT_EQ(counter, 8);
 }
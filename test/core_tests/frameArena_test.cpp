@@ -0,0 +1,50 @@
+#include "testHelper.h"
+
+#include <core/FrameArena.h>
+
+using namespace owl::core;
+
+TEST(FrameArena, allocateSpan) {
+	FrameArena arena{1024};
+	EXPECT_EQ(arena.getBlockCount(), 0);
+	EXPECT_TRUE(arena.allocateSpan<int>(0).empty());
+	const auto ints = arena.allocateSpan<int32_t>(16);
+	ASSERT_EQ(ints.size(), 16);
+	for (size_t i = 0; i < ints.size(); ++i) ints[i] = static_cast<int32_t>(i);
+	const auto doubles = arena.allocateSpan<double>(4);
+	EXPECT_EQ(reinterpret_cast<uintptr_t>(doubles.data()) % alignof(double), 0);
+	for (size_t i = 0; i < ints.size(); ++i) EXPECT_EQ(ints[i], static_cast<int32_t>(i));
+	EXPECT_EQ(arena.getBlockCount(), 1);
+	EXPECT_GE(arena.getUsedBytes(), 16 * sizeof(int32_t) + 4 * sizeof(double));
+}
+
+TEST(FrameArena, overflowCoalescesOnReset) {
+	FrameArena arena{256};
+	for (int i = 0; i < 8; ++i) std::ignore = arena.allocateSpan<uint8_t>(200);
+	EXPECT_GT(arena.getBlockCount(), 1);
+	const size_t capacity = arena.getCapacity();
+	arena.reset();
+	EXPECT_EQ(arena.getUsedBytes(), 0);
+	EXPECT_EQ(arena.getBlockCount(), 1);
+	EXPECT_EQ(arena.getCapacity(), capacity);
+	EXPECT_GE(arena.getPeakBytes(), 1600);
+	// The same frame now fits in the merged block.
+	for (int i = 0; i < 8; ++i) std::ignore = arena.allocateSpan<uint8_t>(200);
+	EXPECT_EQ(arena.getBlockCount(), 1);
+}
+
+TEST(FrameArena, largeAllocation) {
+	FrameArena arena{256};
+	const auto big = arena.allocateSpan<uint8_t>(4096);
+	EXPECT_EQ(big.size(), 4096);
+	EXPECT_GE(arena.getCapacity(), 4096);
+}
+
+TEST(FrameArena, pmrContainer) {
+	FrameArena arena{512};
+	std::pmr::vector<int> values{&arena};
+	for (int i = 0; i < 1000; ++i) values.push_back(i);
+	EXPECT_EQ(values.size(), 1000);
+	EXPECT_EQ(values.back(), 999);
+	EXPECT_TRUE(arena.is_equal(arena));
+}
@@ -33,3 +33,123 @@ TEST(profiler, timer) {
 	}
 	owl::core::Log::invalidate();
 }
+
+TEST(profiler, binarySession) {
+	owl::core::Log::init(owl::core::Log::Level::Off);
+	auto& prof = Profiler::get();
+	const std::filesystem::path binary("test_profile.owlprof");
+	const std::filesystem::path json("test_profile_converted.json");
+	prof.beginSession("binary", binary.string(), ProfileFormat::Binary);
+	{
+		std::vector<std::thread> threads;
+		for (int t = 0; t < 3; ++t) {
+			threads.emplace_back([] -> void {
+				for (int i = 0; i < 100; ++i) {
+					const ProfileTimer outer("outer");
+					const ProfileTimer inner("inner \"quoted\"");
+				}
+			});
+		}
+		for (auto& thread: threads) thread.join();
+	}
+	prof.endSession();
+	EXPECT_EQ(prof.getDroppedEvents(), 0u);
+	ASSERT_TRUE(exists(binary));
+
+	ASSERT_TRUE(Profiler::convertToChromeTrace(binary, json));
+	std::ifstream input(json);
+	const std::string content{std::istreambuf_iterator<char>(input), std::istreambuf_iterator<char>()};
+	size_t events = 0;
+	for (size_t pos = content.find("\"ph\":\"X\""); pos != std::string::npos;
+		 pos = content.find("\"ph\":\"X\"", pos + 1))
+		++events;
+	EXPECT_EQ(events, 600u);
+	EXPECT_NE(content.find("\"name\":\"inner 'quoted'\""), std::string::npos);
+	EXPECT_TRUE(content.starts_with("{\"otherData\": {},\"traceEvents\":["));
+	EXPECT_TRUE(content.ends_with("]}"));
+
+	EXPECT_FALSE(Profiler::convertToChromeTrace("missing.owlprof", json));
+	remove(binary);
+	remove(json);
+	owl::core::Log::invalidate();
+}
+
+TEST(profiler, dynamicNames) {
+	owl::core::Log::init(owl::core::Log::Level::Off);
+	// Equal names share one copy, whatever the lifetime of the source string.
+	const char* first = Profiler::internName(std::string("dyn") + "amic");
+	const char* second = Profiler::internName(std::string("dynamic"));
+	EXPECT_EQ(first, second);
+	EXPECT_STREQ(first, "dynamic");
+
+	auto& prof = Profiler::get();
+	const std::filesystem::path binary("test_profile_names.owlprof");
+	const std::filesystem::path json("test_profile_names.json");
+	prof.beginSession("names", binary.string(), ProfileFormat::Binary);
+	for (int i = 0; i < 10; ++i) {
+		std::string name = std::format("scope {}", i % 2);
+		const ProfileTimer timer(name);
+		name.assign(64, 'x');
+	}
+	prof.endSession();
+	ASSERT_TRUE(Profiler::convertToChromeTrace(binary, json));
+	std::ifstream input(json);
+	const std::string content{std::istreambuf_iterator<char>(input), std::istreambuf_iterator<char>()};
+	EXPECT_NE(content.find("\"name\":\"scope 0\""), std::string::npos);
+	EXPECT_NE(content.find("\"name\":\"scope 1\""), std::string::npos);
+	EXPECT_EQ(content.find("xxxx"), std::string::npos);
+	input.close();
+	remove(binary);
+	remove(json);
+	owl::core::Log::invalidate();
+}
+
+TEST(profiler, exitedThreadBuffersAreReleased) {
+	owl::core::Log::init(owl::core::Log::Level::Off);
+	auto& prof = Profiler::get();
+	const std::filesystem::path binary("test_profile_threads.owlprof");
+	const std::filesystem::path json("test_profile_threads.json");
+	prof.beginSession("threads", binary.string(), ProfileFormat::Binary);
+	const size_t before = Profiler::getThreadBufferCount();
+	// Restarting threads, like a capture or stream thread.
+	for (int t = 0; t < 20; ++t) {
+		std::thread([] -> void {
+			for (int i = 0; i < 10; ++i) const ProfileTimer timer(ProfileTimer::StaticName{"restarted"});
+		}).join();
+	}
+	prof.endSession();
+	EXPECT_LE(Profiler::getThreadBufferCount(), before);
+	// Their events were all kept.
+	ASSERT_TRUE(Profiler::convertToChromeTrace(binary, json));
+	std::ifstream input(json);
+	const std::string content{std::istreambuf_iterator<char>(input), std::istreambuf_iterator<char>()};
+	size_t events = 0;
+	for (size_t pos = content.find("\"restarted\""); pos != std::string::npos;
+		 pos = content.find("\"restarted\"", pos + 1))
+		++events;
+	EXPECT_EQ(events, 200u);
+	input.close();
+	remove(binary);
+	remove(json);
+	owl::core::Log::invalidate();
+}
+
+TEST(profiler, truncatedCapture) {
+	owl::core::Log::init(owl::core::Log::Level::Off);
+	auto& prof = Profiler::get();
+	const std::filesystem::path binary("test_profile_truncated.owlprof");
+	const std::filesystem::path json("test_profile_truncated.json");
+	prof.beginSession("trunc", binary.string(), ProfileFormat::Binary);
+	{ const ProfileTimer timer(ProfileTimer::StaticName{"a rather long scope name"}); }
+	prof.endSession();
+	ASSERT_TRUE(Profiler::convertToChromeTrace(binary, json));
+	// Magic (8), session name (2 + 5), then the name record cut after its first 2 characters.
+	std::filesystem::resize_file(binary, 8 + 2 + 5 + 1 + 4 + 2 + 2);
+	EXPECT_FALSE(Profiler::convertToChromeTrace(binary, json));
+	// Cut inside the session name.
+	std::filesystem::resize_file(binary, 8 + 2 + 3);
+	EXPECT_FALSE(Profiler::convertToChromeTrace(binary, json));
+	remove(binary);
+	remove(json);
+	owl::core::Log::invalidate();
+}
@@ -0,0 +1,142 @@
+/**
+ * @file PixelConversion_test.cpp
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright (c) 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#include "testHelper.h"
+
+#include <core/task/Scheduler.h>
+#include <io/video/PixelConversion.h>
+
+#include <random>
+
+using namespace owl;
+using namespace owl::io::video::conversion;
+
+namespace {
+auto clampByte(const int32_t iValue) -> uint8_t { return static_cast<uint8_t>(std::clamp(iValue, 0, 255)); }
+
+// Reference conversion of one pixel, as written by the original per-pixel loops.
+void referencePixel(const int32_t iY, const int32_t iU, const int32_t iV, uint8_t* oRgb) {
+	const int32_t c = iY - 16;
+	const int32_t d = iU - 128;
+	const int32_t e = iV - 128;
+	oRgb[0] = clampByte((298 * c + 409 * e + 128) >> 8);
+	oRgb[1] = clampByte((298 * c - 100 * d - 208 * e + 128) >> 8);
+	oRgb[2] = clampByte((298 * c + 516 * d + 128) >> 8);
+}
+
+auto randomBytes(const size_t iCount, const uint32_t iSeed) -> std::vector<uint8_t> {
+	std::mt19937 gen{iSeed};
+	std::uniform_int_distribution<int> dist{0, 255};
+	std::vector<uint8_t> bytes(iCount);
+	for (auto& byte: bytes) byte = static_cast<uint8_t>(dist(gen));
+	return bytes;
+}
+
+// Full Y plane, then one UV row per pair of rows (the last one alone when the height is odd).
+auto nv12Bytes(const math::vec2ui& iSize) -> size_t {
+	return iSize.surface() + static_cast<size_t>(iSize.x()) * ((iSize.y() + 1) / 2);
+}
+
+auto referenceNv12(const std::vector<uint8_t>& iNv12, const math::vec2ui& iSize, const bool iMirror)
+		-> std::vector<uint8_t> {
+	std::vector<uint8_t> rgb(3ull * iSize.surface());
+	for (uint32_t i = 0; i < iSize.y(); ++i) {
+		for (uint32_t j = 0; j < iSize.x(); ++j) {
+			const size_t uv = iSize.surface() + (i / 2) * iSize.x() + (j & ~1u);
+			const uint32_t col = iMirror ? iSize.x() - 1 - j : j;
+			referencePixel(iNv12[i * iSize.x() + j], iNv12[uv], iNv12[uv + 1], rgb.data() + (i * iSize.x() + col) * 3);
+		}
+	}
+	return rgb;
+}
+
+auto referenceYuyv(const std::vector<uint8_t>& iYuYv, const math::vec2ui& iSize, const bool iMirror)
+		-> std::vector<uint8_t> {
+	std::vector<uint8_t> rgb(3ull * iSize.surface());
+	for (uint32_t i = 0; i < iSize.y(); ++i) {
+		const uint8_t* row = iYuYv.data() + 2ull * i * iSize.x();
+		for (uint32_t j = 0; j < iSize.x(); ++j) {
+			const uint32_t pair = (j & ~1u) * 2;
+			const uint32_t col = iMirror ? iSize.x() - 1 - j : j;
+			referencePixel(row[2 * j], row[pair + 1], row[pair + 3], rgb.data() + (i * iSize.x() + col) * 3);
+		}
+	}
+	return rgb;
+}
+
+// Widths around the 16-pixel SIMD step, to cover the scalar tails.
+const std::vector<math::vec2ui> g_sizes{{2, 1}, {16, 2}, {18, 3}, {64, 5}, {70, 40}};
+const std::vector<SimdLevel> g_levels{SimdLevel::Scalar, SimdLevel::Sse41, SimdLevel::Avx2};
+}// namespace
+
+TEST(PixelConversion, nv12MatchesReference) {
+	for (const auto& size: g_sizes) {
+		const auto nv12 = randomBytes(nv12Bytes(size), size.x());
+		for (const bool mirror: {false, true}) {
+			const auto expected = referenceNv12(nv12, size, mirror);
+			for (const auto level: g_levels) {
+				std::vector<uint8_t> rgb(expected.size());
+				ASSERT_TRUE(nv12ToRgb24(nv12, size, rgb, mirror, nullptr, level));
+				EXPECT_EQ(rgb, expected) << size.x() << "x" << size.y() << " level " << static_cast<int>(level);
+			}
+		}
+	}
+}
+
+TEST(PixelConversion, yuyvMatchesReference) {
+	for (const auto& size: g_sizes) {
+		const auto yuyv = randomBytes(size.surface() * 2, size.y());
+		for (const bool mirror: {false, true}) {
+			const auto expected = referenceYuyv(yuyv, size, mirror);
+			for (const auto level: g_levels) {
+				std::vector<uint8_t> rgb(expected.size());
+				ASSERT_TRUE(yuyvToRgb24(yuyv, size, rgb, mirror, nullptr, level));
+				EXPECT_EQ(rgb, expected) << size.x() << "x" << size.y() << " level " << static_cast<int>(level);
+			}
+		}
+	}
+}
+
+TEST(PixelConversion, knownColors) {
+	// Y U Y V: video white then video black.
+	const std::vector<uint8_t> yuyv{235, 128, 16, 128};
+	std::vector<uint8_t> rgb(6);
+	ASSERT_TRUE(yuyvToRgb24(yuyv, {2, 1}, rgb, false));
+	EXPECT_EQ(rgb, (std::vector<uint8_t>{255, 255, 255, 0, 0, 0}));
+	ASSERT_TRUE(yuyvToRgb24(yuyv, {2, 1}, rgb, true));
+	EXPECT_EQ(rgb, (std::vector<uint8_t>{0, 0, 0, 255, 255, 255}));
+}
+
+TEST(PixelConversion, rowBlocksOnScheduler) {
+	const math::vec2ui size{96, 3 * g_rowBlock + 6};
+	const auto nv12 = randomBytes(nv12Bytes(size), 7);
+	const auto yuyv = randomBytes(size.surface() * 2, 11);
+	core::task::Scheduler scheduler;
+	std::vector<uint8_t> rgb(3ull * size.surface());
+	ASSERT_TRUE(nv12ToRgb24(nv12, size, rgb, true, &scheduler));
+	EXPECT_EQ(rgb, referenceNv12(nv12, size, true));
+	ASSERT_TRUE(yuyvToRgb24(yuyv, size, rgb, false, &scheduler));
+	EXPECT_EQ(rgb, referenceYuyv(yuyv, size, false));
+}
+
+TEST(PixelConversion, rejectsShortBuffers) {
+	const math::vec2ui size{16, 4};
+	const auto input = randomBytes(size.surface(), 3);
+	std::vector<uint8_t> rgb(3ull * size.surface(), 42);
+	EXPECT_FALSE(nv12ToRgb24(input, size, rgb, false));
+	EXPECT_FALSE(yuyvToRgb24(input, size, rgb, false));
+	EXPECT_FALSE(mjpegToRgb24(input, size, rgb, false));
+	std::vector<uint8_t> small(10);
+	const auto yuyv = randomBytes(size.surface() * 2, 5);
+	EXPECT_FALSE(yuyvToRgb24(yuyv, size, small, false));
+	// Odd height: the last luma row still reads a full chroma row, beyond 1.5 bytes per pixel.
+	const math::vec2ui oddSize{16, 3};
+	const auto nv12 = randomBytes(nv12Bytes(oddSize), 9);
+	EXPECT_FALSE(nv12ToRgb24(std::span{nv12}.first(oddSize.surface() * 3 / 2), oddSize, rgb, false));
+	EXPECT_TRUE(std::ranges::all_of(rgb, [](const uint8_t iByte) -> bool { return iByte == 42; }));
+}
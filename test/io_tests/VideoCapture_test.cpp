@@ -0,0 +1,195 @@
+/**
+ * @file VideoCapture_test.cpp
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright (c) 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#include "testHelper.h"
+
+#include <io/video/FileDevice.h>
+#include <io/video/LatestFrameSlot.h>
+
+#include <fstream>
+#include <thread>
+
+using namespace owl;
+using namespace owl::io::video;
+
+namespace {
+constexpr math::vec2ui g_frameSize{32, 4};
+constexpr uint8_t g_frameCount = 3;
+
+// Video luma of the recorded frame.
+auto frameLuma(const uint8_t iFrame) -> uint8_t { return static_cast<uint8_t>(40 + 60 * iFrame); }
+
+// Gray level of a frame after conversion (neutral chroma).
+auto frameGray(const uint8_t iFrame) -> uint8_t {
+	return static_cast<uint8_t>(std::clamp((298 * (frameLuma(iFrame) - 16) + 128) >> 8, 0, 255));
+}
+
+// Record gray YUYV frames of increasing luma.
+auto writeRecording(const std::string& iName) -> std::filesystem::path {
+	const auto path = std::filesystem::temp_directory_path() / iName;
+	std::ofstream file(path, std::ios::binary);
+	for (uint8_t frame = 0; frame < g_frameCount; ++frame) {
+		for (uint32_t pair = 0; pair < g_frameSize.surface() / 2; ++pair) {
+			const std::array<char, 4> bytes{static_cast<char>(frameLuma(frame)), static_cast<char>(128),
+											static_cast<char>(frameLuma(frame)), static_cast<char>(128)};
+			file.write(bytes.data(), bytes.size());
+		}
+	}
+	return path;
+}
+
+auto waitFrame(Device& ioDevice) -> Device::Frame* {
+	for (int attempt = 0; attempt < 400; ++attempt) {
+		if (auto* frame = ioDevice.acquireLatestFrame(); frame != nullptr)
+			return frame;
+		std::this_thread::sleep_for(std::chrono::milliseconds{5});
+	}
+	return nullptr;
+}
+}// namespace
+
+TEST(LatestFrameSlot, keepsTheLatestItem) {
+	LatestFrameSlot<int> slot;
+	EXPECT_EQ(slot.consume(), nullptr);
+	slot.back() = 1;
+	EXPECT_FALSE(slot.publish());
+	EXPECT_TRUE(slot.hasFresh());
+	slot.back() = 2;
+	EXPECT_TRUE(slot.publish());
+	const int* item = slot.consume();
+	ASSERT_NE(item, nullptr);
+	EXPECT_EQ(*item, 2);
+	EXPECT_FALSE(slot.hasFresh());
+	EXPECT_EQ(slot.consume(), nullptr);
+	// The consumed item is never handed back to the producer while held.
+	slot.back() = 3;
+	EXPECT_FALSE(slot.publish());
+	slot.back() = 4;
+	EXPECT_TRUE(slot.publish());
+	EXPECT_EQ(*item, 2);
+	EXPECT_EQ(*slot.consume(), 4);
+}
+
+TEST(LatestFrameSlot, concurrentProducer) {
+	LatestFrameSlot<uint64_t> slot;
+	constexpr uint64_t count = 20000;
+	std::thread producer([&slot] -> void {
+		for (uint64_t value = 1; value <= count; ++value) {
+			slot.back() = value;
+			slot.publish();
+		}
+	});
+	uint64_t last = 0;
+	while (last < count) {
+		if (const uint64_t* item = slot.consume(); item != nullptr) {
+			EXPECT_GT(*item, last);
+			last = *item;
+		}
+	}
+	producer.join();
+	EXPECT_EQ(last, count);
+}
+
+TEST(VideoFileDevice, rejectsUnsupportedRecordings) {
+	const auto path = writeRecording("owl_video_invalid.yuv");
+	FileDevice mjpeg(path, Device::PixelFormat::MJpeg, g_frameSize);
+	EXPECT_FALSE(mjpeg.isValid());
+	mjpeg.open();
+	EXPECT_FALSE(mjpeg.isOpened());
+	mjpeg.startCapture();
+	EXPECT_FALSE(mjpeg.isCapturing());
+
+	FileDevice missing(std::filesystem::temp_directory_path() / "owl_video_missing.yuv", Device::PixelFormat::YuYv,
+					   g_frameSize);
+	EXPECT_FALSE(missing.isValid());
+	std::filesystem::remove(path);
+}
+
+TEST(VideoFileDevice, captureThreadPublishesFrames) {
+	const auto path = writeRecording("owl_video_capture.yuv");
+	FileDevice device(path, Device::PixelFormat::YuYv, g_frameSize, 0.f);
+	EXPECT_TRUE(device.isValid());
+	EXPECT_EQ(device.getBusInfo(), std::format("file:{}", path.string()));
+	device.open();
+	ASSERT_TRUE(device.isOpened());
+	EXPECT_EQ(device.getFrameCount(), g_frameCount);
+	EXPECT_EQ(device.acquireLatestFrame(), nullptr);
+
+	device.startCapture();
+	EXPECT_TRUE(device.isCapturing());
+	uint64_t lastSequence = 0;
+	std::chrono::steady_clock::time_point lastTime;
+	for (int round = 0; round < 3; ++round) {
+		const auto* frame = waitFrame(device);
+		ASSERT_NE(frame, nullptr);
+		EXPECT_EQ(frame->size, g_frameSize);
+		ASSERT_EQ(frame->pixels.size(), g_frameSize.surface() * 3ull);
+		EXPECT_GT(frame->sequence, lastSequence);
+		EXPECT_GE(frame->timestamp, lastTime);
+		// Frames loop over the recording: the sequence tells which one was converted.
+		const auto recorded = static_cast<uint8_t>((frame->sequence - 1) % g_frameCount);
+		EXPECT_TRUE(std::ranges::all_of(frame->pixels,
+										[&](const uint8_t iByte) -> bool { return iByte == frameGray(recorded); }));
+		lastSequence = frame->sequence;
+		lastTime = frame->timestamp;
+	}
+	device.stopCapture();
+	EXPECT_FALSE(device.isCapturing());
+
+	const auto stats = device.getCaptureStats();
+	EXPECT_EQ(stats.delivered, 3u);
+	EXPECT_GE(stats.grabbed, lastSequence);
+	EXPECT_EQ(stats.failed, 0u);
+	// Unpaced replay outruns the consumer: everything grabbed is either delivered, dropped or still waiting.
+	EXPECT_LE(stats.delivered + stats.dropped, stats.grabbed);
+	EXPECT_GE(stats.delivered + stats.dropped + 1, stats.grabbed);
+
+	device.close();
+	EXPECT_FALSE(device.isOpened());
+	std::filesystem::remove(path);
+}
+
+TEST(VideoFileDevice, pacedReplay) {
+	const auto path = writeRecording("owl_video_paced.yuv");
+	FileDevice device(path, Device::PixelFormat::YuYv, g_frameSize, 50.f);
+	device.open();
+	ASSERT_TRUE(device.isOpened());
+	device.startCapture();
+	const auto* first = waitFrame(device);
+	ASSERT_NE(first, nullptr);
+	const auto firstTime = first->timestamp;
+	const auto* second = waitFrame(device);
+	ASSERT_NE(second, nullptr);
+	EXPECT_GE(second->timestamp - firstTime, std::chrono::milliseconds{15});
+	device.close();
+	EXPECT_FALSE(device.isCapturing());
+	std::filesystem::remove(path);
+}
+
+TEST(VideoFileDevice, stopAllCaptures) {
+	const auto path = writeRecording("owl_video_stop_all.yuv");
+	FileDevice first(path, Device::PixelFormat::YuYv, g_frameSize, 0.f);
+	FileDevice second(path, Device::PixelFormat::YuYv, g_frameSize, 0.f);
+	first.open();
+	second.open();
+	ASSERT_TRUE(first.isOpened());
+	ASSERT_TRUE(second.isOpened());
+	first.startCapture();
+	second.startCapture();
+	EXPECT_TRUE(first.isCapturing());
+	EXPECT_TRUE(second.isCapturing());
+	Device::stopAllCaptures();
+	EXPECT_FALSE(first.isCapturing());
+	EXPECT_FALSE(second.isCapturing());
+	// A stopped device can capture again.
+	first.startCapture();
+	EXPECT_NE(waitFrame(first), nullptr);
+	first.close();
+	second.close();
+	std::filesystem::remove(path);
+}
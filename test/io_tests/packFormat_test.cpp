@@ -86,9 +86,11 @@ TEST(PackFormat, decompress_wrong_size) {
 
 TEST(PackFormat, toc_round_trip) {
 	std::vector<TocEntry> entries;
-	entries.push_back({hashPath("scenes/test.owl"), "scenes/test.owl", 32, 1024, 2048, AssetType::Scene});
-	entries.push_back({hashPath("textures/hero.png"), "textures/hero.png", 1056, 4096, 8192, AssetType::Texture});
-	entries.push_back({hashPath("sounds/click.wav"), "sounds/click.wav", 5152, 512, 1024, AssetType::Sound});
+	entries.push_back({hashPath("scenes/test.owl"), "scenes/test.owl", 32, 1024, 2048, AssetType::Scene, 0, {}});
+	entries.push_back({hashPath("textures/hero.png"), "textures/hero.png", 1056, 4096, 8192, AssetType::Texture, 0,
+					   {}});
+	entries.push_back(
+			{hashPath("sounds/click.wav"), "sounds/click.wav", 5152, 512, 1024, AssetType::Sound, 512, {0, 200}});
 
 	auto serialized = serializeToc(entries);
 	ASSERT_FALSE(serialized.empty());
@@ -103,9 +105,54 @@ TEST(PackFormat, toc_round_trip) {
 		EXPECT_EQ(deserialized[i].dataSize, entries[i].dataSize);
 		EXPECT_EQ(deserialized[i].originalSize, entries[i].originalSize);
 		EXPECT_EQ(deserialized[i].assetType, entries[i].assetType);
+		EXPECT_EQ(deserialized[i].frameSize, entries[i].frameSize);
+		EXPECT_EQ(deserialized[i].frameOffsets, entries[i].frameOffsets);
 	}
 }
 
+TEST(PackFormat, toc_version1_round_trip) {
+	std::vector<TocEntry> entries;
+	entries.push_back({hashPath("a.bin"), "a.bin", 40, 10, 10, AssetType::Other, 0, {}});
+	entries.push_back({hashPath("b.bin"), "b.bin", 50, 20, 30, AssetType::Other, 0, {}});
+
+	const auto v1 = serializeToc(entries, 1);
+	EXPECT_LT(v1.size(), serializeToc(entries).size());
+	const auto deserialized = deserializeToc(v1, 1);
+	ASSERT_EQ(deserialized.size(), entries.size());
+	EXPECT_EQ(deserialized[1].path, "b.bin");
+	EXPECT_EQ(deserialized[1].originalSize, 30u);
+	EXPECT_FALSE(deserialized[1].isFramed());
+}
+
+TEST(PackFormat, obfuscate_slice_matches_whole) {
+	std::vector<uint8_t> whole(100);
+	for (size_t i = 0; i < whole.size(); ++i) whole[i] = static_cast<uint8_t>(i);
+	std::vector<uint8_t> slice(whole.begin() + 30, whole.begin() + 70);
+	obfuscateBuffer(whole, 7);
+	obfuscateBuffer(slice, 7, 30);
+	EXPECT_TRUE(std::equal(slice.begin(), slice.end(), whole.begin() + 30));
+}
+
+TEST(PackFormat, compress_frames) {
+	std::vector<uint8_t> original(10000);
+	for (size_t i = 0; i < original.size(); ++i) original[i] = static_cast<uint8_t>(i % 251);
+
+	std::vector<uint64_t> offsets;
+	const auto frames = compressFrames(original, 4096, offsets);
+	ASSERT_FALSE(frames.empty());
+	ASSERT_EQ(offsets.size(), 3u);
+	EXPECT_EQ(offsets[0], 0u);
+
+	// Each frame decodes on its own.
+	std::vector<uint8_t> last(original.size() - 2 * 4096);
+	const auto lastFrame = std::span<const uint8_t>(frames).subspan(offsets[2]);
+	ASSERT_TRUE(decompressInto(lastFrame, last));
+	EXPECT_TRUE(std::equal(last.begin(), last.end(), original.begin() + 2 * 4096));
+
+	std::vector<uint8_t> wrongSize(100);
+	EXPECT_FALSE(decompressInto(lastFrame, wrongSize));
+}
+
 TEST(PackFormat, toc_empty) {
 	std::vector<TocEntry> empty;
 	auto serialized = serializeToc(empty);
@@ -8,9 +8,12 @@
 
 #include "testHelper.h"
 
+#include <core/task/Scheduler.h>
 #include <data/assets/pack/PackReader.h>
 #include <data/assets/pack/PackWriter.h>
 
+#include <thread>
+
 using namespace owl::data::assets::pack;
 
 namespace {
@@ -374,3 +377,257 @@ TEST_F(PackWriterReaderTest, tryOpen_toc_size_mismatch) {
 	ASSERT_FALSE(result.has_value());
 	EXPECT_EQ(result.error(), PackOpenError::TocSizeMismatch);
 }
+
+// --- Read modes / concurrent reads -------------------------------------------
+
+TEST_F(PackWriterReaderTest, stream_and_mapped_modes_agree) {
+	const auto packPath = m_tempDir / "test_modes.owlpack";
+
+	std::vector<uint8_t> payload(20000);
+	for (size_t i = 0; i < payload.size(); ++i) payload[i] = static_cast<uint8_t>(i * 13);
+
+	for (const auto flags: {PackFlags::None, PackFlags::Compressed, PackFlags::Obfuscated, PackFlags::Default}) {
+		PackWriter writer;
+		writer.addData(payload, "blob.bin", AssetType::Other);
+		writer.addData({}, "empty.bin", AssetType::Other);
+		ASSERT_TRUE(writer.write(packPath, flags));
+
+		for (const auto mode: {PackReadMode::Stream, PackReadMode::Mapped}) {
+			PackReader reader;
+			ASSERT_TRUE(reader.open(packPath, mode));
+			EXPECT_EQ(reader.getReadMode(), mode);
+			auto result = reader.readEntry("blob.bin");
+			ASSERT_TRUE(result.has_value());
+			EXPECT_EQ(result.value(), payload);
+			EXPECT_TRUE(reader.readEntry("empty.bin").has_value());
+		}
+	}
+}
+
+TEST_F(PackWriterReaderTest, view_entry_zero_copy) {
+	const auto packPath = m_tempDir / "test_view.owlpack";
+
+	const std::string data = "Raw entry readable straight from the mapping.";
+	const std::vector<uint8_t> rawData(data.begin(), data.end());
+
+	PackWriter writer;
+	writer.addData(rawData, "raw.txt", AssetType::Other);
+	ASSERT_TRUE(writer.write(packPath, PackFlags::None));
+
+	PackReader reader;
+	ASSERT_TRUE(reader.open(packPath, PackReadMode::Mapped));
+	const auto view = reader.viewEntry("raw.txt");
+	ASSERT_TRUE(view.has_value());
+	EXPECT_TRUE(std::ranges::equal(*view, rawData));
+	EXPECT_FALSE(reader.viewEntry("missing.txt").has_value());
+
+	// No view when the block must be decoded, nor without a mapping.
+	ASSERT_TRUE(writer.write(packPath, PackFlags::Compressed));
+	ASSERT_TRUE(reader.open(packPath, PackReadMode::Mapped));
+	EXPECT_FALSE(reader.viewEntry("raw.txt").has_value());
+	ASSERT_TRUE(writer.write(packPath, PackFlags::None));
+	ASSERT_TRUE(reader.open(packPath, PackReadMode::Stream));
+	EXPECT_FALSE(reader.viewEntry("raw.txt").has_value());
+}
+
+TEST_F(PackWriterReaderTest, read_entries_parallel) {
+	const auto packPath = m_tempDir / "test_batch.owlpack";
+
+	PackWriter writer;
+	constexpr size_t count = 64;
+	std::vector<std::string> paths;
+	for (size_t i = 0; i < count; ++i) {
+		paths.push_back(std::format("entry_{:03d}.dat", i));
+		const auto data = std::format("Batched data for entry {}", i);
+		writer.addData(std::vector<uint8_t>(data.begin(), data.end()), paths.back(), AssetType::Other);
+	}
+	paths.emplace_back("missing.dat");
+	ASSERT_TRUE(writer.write(packPath));
+
+	owl::core::task::Scheduler scheduler;
+	for (const auto mode: {PackReadMode::Stream, PackReadMode::Mapped}) {
+		PackReader reader;
+		ASSERT_TRUE(reader.open(packPath, mode));
+		const auto results = reader.readEntries(paths, scheduler);
+		ASSERT_EQ(results.size(), paths.size());
+		for (size_t i = 0; i < count; ++i) {
+			ASSERT_TRUE(results[i].has_value()) << "Failed to read entry: " << paths[i];
+			const std::string resultStr(results[i]->begin(), results[i]->end());
+			EXPECT_EQ(resultStr, std::format("Batched data for entry {}", i));
+		}
+		EXPECT_FALSE(results.back().has_value());
+		// Without an application the serial path gives the same answer.
+		EXPECT_EQ(reader.readEntries(paths), results);
+	}
+}
+
+TEST_F(PackWriterReaderTest, concurrent_read_entry) {
+	const auto packPath = m_tempDir / "test_threads.owlpack";
+
+	PackWriter writer;
+	const std::vector<uint8_t> payload(4096, static_cast<uint8_t>(0x5A));
+	writer.addData(payload, "a.bin", AssetType::Other);
+	writer.addData({1, 2, 3, 4}, "b.bin", AssetType::Other);
+	ASSERT_TRUE(writer.write(packPath));
+
+	for (const auto mode: {PackReadMode::Stream, PackReadMode::Mapped}) {
+		PackReader reader;
+		ASSERT_TRUE(reader.open(packPath, mode));
+		std::atomic<uint32_t> failures{0};
+		std::vector<std::thread> threads;
+		for (uint32_t t = 0; t < 4; ++t) {
+			threads.emplace_back([&reader, &payload, &failures, t] -> void {
+				for (uint32_t i = 0; i < 50; ++i) {
+					const auto result = reader.readEntry((t + i) % 2 == 0 ? "a.bin" : "b.bin");
+					if (!result.has_value() || result->size() != ((t + i) % 2 == 0 ? payload.size() : 4u))
+						++failures;
+				}
+			});
+		}
+		for (auto& thread: threads) thread.join();
+		EXPECT_EQ(failures.load(), 0u);
+	}
+}
+
+// --- Framed entries / range reads --------------------------------------------
+
+TEST_F(PackWriterReaderTest, framed_entry_read_range) {
+	const auto packPath = m_tempDir / "test_frames.owlpack";
+
+	std::vector<uint8_t> payload(10000);
+	for (size_t i = 0; i < payload.size(); ++i) payload[i] = static_cast<uint8_t>((i * 7) ^ (i >> 5));
+
+	for (const auto flags: {PackFlags::None, PackFlags::Compressed, PackFlags::Default}) {
+		PackWriter writer;
+		writer.setFrameSize(1024);
+		writer.addData(payload, "music.ogg", AssetType::Sound);
+		ASSERT_TRUE(writer.write(packPath, flags));
+
+		for (const auto mode: {PackReadMode::Stream, PackReadMode::Mapped}) {
+			PackReader reader;
+			ASSERT_TRUE(reader.open(packPath, mode));
+			EXPECT_EQ(reader.getHeader().version, g_packVersion);
+			auto whole = reader.readEntry("music.ogg");
+			ASSERT_TRUE(whole.has_value());
+			EXPECT_EQ(whole.value(), payload);
+
+			// Ranges inside a frame, across frame borders and past the end (clamped).
+			for (const auto& [offset, length]: std::vector<std::pair<uint64_t, uint64_t>>{
+						 {0, 10}, {1000, 100}, {1024, 1024}, {3000, 4000}, {9990, 100}, {10000, 5}}) {
+				auto range = reader.readRange("music.ogg", offset, length);
+				ASSERT_TRUE(range.has_value());
+				const auto end = std::min<uint64_t>(offset + length, payload.size());
+				ASSERT_EQ(range->size(), end - offset);
+				const auto first = payload.begin() + static_cast<std::ptrdiff_t>(offset);
+				EXPECT_TRUE(std::equal(range->begin(), range->end(), first));
+			}
+			EXPECT_FALSE(reader.readRange("music.ogg", 10001, 1).has_value());
+			EXPECT_FALSE(reader.readRange("missing.ogg", 0, 1).has_value());
+		}
+	}
+}
+
+TEST_F(PackWriterReaderTest, version1_pack_still_readable) {
+	// Forge a version 1 pack: obfuscated single blob, TOC without frame indices.
+	const auto packPath = m_tempDir / "test_v1.owlpack";
+	const std::vector<uint8_t> payload = {9, 8, 7, 6, 5};
+	{
+		auto block = payload;
+		obfuscateBuffer(block, 0);
+		std::vector<TocEntry> toc;
+		toc.push_back({hashPath("old.bin"), "old.bin", sizeof(PackHeader), block.size(), payload.size(),
+					   AssetType::Other, 0, {}});
+		auto tocData = serializeToc(toc, 1);
+		obfuscateBuffer(tocData, 1);
+
+		PackHeader header{};
+		header.version = 1;
+		header.flags = static_cast<uint16_t>(PackFlags::Obfuscated);
+		header.entryCount = 1;
+		header.tocOffset = sizeof(PackHeader) + block.size();
+		header.tocSize = tocData.size();
+		header.tocOriginalSize = tocData.size();
+		std::ofstream out(packPath, std::ios::binary);
+		out.write(reinterpret_cast<const char*>(&header), sizeof(PackHeader));
+		out.write(reinterpret_cast<const char*>(block.data()), static_cast<std::streamsize>(block.size()));
+		out.write(reinterpret_cast<const char*>(tocData.data()), static_cast<std::streamsize>(tocData.size()));
+	}
+
+	PackReader reader;
+	ASSERT_TRUE(reader.open(packPath));
+	auto result = reader.readEntry("old.bin");
+	ASSERT_TRUE(result.has_value());
+	EXPECT_EQ(result.value(), payload);
+	auto range = reader.readRange("old.bin", 3, 10);
+	ASSERT_TRUE(range.has_value());
+	EXPECT_EQ(range.value(), (std::vector<uint8_t>{6, 5}));
+}
+
+// --- Parallel write / deduplication -------------------------------------------
+
+TEST_F(PackWriterReaderTest, parallel_write_is_deterministic) {
+	const auto serialPath = m_tempDir / "test_serial.owlpack";
+	const auto parallelPath = m_tempDir / "test_parallel.owlpack";
+
+	PackWriter writer;
+	writer.setFrameSize(2048);
+	for (size_t i = 0; i < 150; ++i) {
+		std::vector<uint8_t> data(100 + i * 61);
+		for (size_t j = 0; j < data.size(); ++j) data[j] = static_cast<uint8_t>((i * 31 + j) % 253);
+		writer.addData(data, std::format("entry_{:03d}.dat", i), AssetType::Other);
+	}
+	ASSERT_TRUE(writer.write(serialPath, PackFlags::Default));
+
+	owl::core::task::Scheduler scheduler;
+	writer.setScheduler(&scheduler);
+	uint32_t lastProgress = 0;
+	const auto progress = [&lastProgress](const uint32_t iCurrent, const uint32_t) -> void { lastProgress = iCurrent; };
+	ASSERT_TRUE(writer.write(parallelPath, PackFlags::Default, progress));
+	EXPECT_EQ(lastProgress, 149u);
+
+	const auto readAll = [](const std::filesystem::path& iPath) -> std::vector<char> {
+		std::ifstream in(iPath, std::ios::binary);
+		return {std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>()};
+	};
+	EXPECT_EQ(readAll(serialPath), readAll(parallelPath));
+}
+
+TEST_F(PackWriterReaderTest, duplicate_contents_stored_once) {
+	const auto packPath = m_tempDir / "test_dedup.owlpack";
+	const auto uniquePath = m_tempDir / "test_unique.owlpack";
+
+	std::vector<uint8_t> texture(50000);
+	for (size_t i = 0; i < texture.size(); ++i) texture[i] = static_cast<uint8_t>((i * 17) ^ (i >> 7));
+	const std::vector<uint8_t> other = {4, 5, 6};
+
+	for (const auto flags: {PackFlags::None, PackFlags::Obfuscated, PackFlags::Default}) {
+		PackWriter unique;
+		unique.addData(texture, "textures/a.png", AssetType::Texture);
+		unique.addData(other, "other.bin", AssetType::Other);
+		ASSERT_TRUE(unique.write(uniquePath, flags));
+
+		PackWriter writer;
+		writer.addData(texture, "textures/a.png", AssetType::Texture);
+		writer.addData(other, "other.bin", AssetType::Other);
+		writer.addData(texture, "scenes/b/texture.png", AssetType::Texture);
+		writer.addData(texture, "scenes/c/texture.png", AssetType::Texture);
+		ASSERT_TRUE(writer.write(packPath, flags));
+
+		// Only the two extra TOC entries add to the size, not their blobs.
+		EXPECT_LT(std::filesystem::file_size(packPath), std::filesystem::file_size(uniquePath) + 200);
+
+		for (const auto mode: {PackReadMode::Stream, PackReadMode::Mapped}) {
+			PackReader reader;
+			ASSERT_TRUE(reader.open(packPath, mode));
+			for (const auto* path: {"textures/a.png", "scenes/b/texture.png", "scenes/c/texture.png"}) {
+				auto result = reader.readEntry(path);
+				ASSERT_TRUE(result.has_value()) << path;
+				EXPECT_EQ(result.value(), texture);
+			}
+			auto range = reader.readRange("scenes/c/texture.png", 1000, 10);
+			ASSERT_TRUE(range.has_value());
+			EXPECT_TRUE(std::equal(range->begin(), range->end(), texture.begin() + 1000));
+			EXPECT_EQ(reader.readEntry("other.bin").value(), other);
+		}
+	}
+}
@@ -88,3 +88,32 @@ TEST(PerlinNoise, ReseedChangesField) {
 	const float after = n.noise(1.5f, 2.5f);
 	EXPECT_GT(std::abs(before - after), 1e-4f);
 }
+
+TEST(PerlinNoise, BatchMatchesScalarOnEveryPath) {
+	const math::PerlinNoise n{2024};
+	std::vector<float> xs;
+	std::vector<float> ys;
+	// An odd count exercises the SIMD tails; negative coordinates exercise the floor handling.
+	for (int32_t i = 0; i < 203; ++i) {
+		xs.push_back(-40.f + static_cast<float>(i) * 0.731f);
+		ys.push_back(25.f - static_cast<float>(i) * 0.377f);
+	}
+	std::vector<float> noise(xs.size());
+	std::vector<float> fbm(xs.size());
+	for (const auto level: {math::PerlinNoise::SimdLevel::Scalar, math::PerlinNoise::SimdLevel::Sse41,
+							math::PerlinNoise::SimdLevel::Avx2}) {
+		n.noise(xs, ys, noise, level);
+		n.fbm(xs, ys, fbm, 5, 2.f, 0.5f, level);
+		for (size_t i = 0; i < xs.size(); ++i) {
+			EXPECT_FLOAT_EQ(noise[i], n.noise(xs[i], ys[i]));
+			EXPECT_FLOAT_EQ(fbm[i], n.fbm(xs[i], ys[i], 5, 2.f, 0.5f));
+		}
+	}
+}
+
+TEST(PerlinNoise, BatchEmptyIsNoOp) {
+	const math::PerlinNoise n{3};
+	std::vector<float> empty;
+	n.fbm(empty, empty, empty, 4, 2.f, 0.5f);
+	EXPECT_TRUE(empty.empty());
+}
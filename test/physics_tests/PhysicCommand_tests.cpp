@@ -1,5 +1,6 @@
 #include "testHelper.h"
 
+#include <core/task/Scheduler.h>
 #include <physics/PhysicCommand.h>
 #include <scene/Entity.h>
 #include <scene/Scene.h>
@@ -324,3 +325,164 @@ TEST(PhysicCommand, FrameBeforeInitIsNoOp) {
 	EXPECT_FALSE(PhysicCommand::isInitialized());
 	Log::invalidate();
 }
+
+namespace {
+auto runPile(const uint32_t iWorkerCount) -> std::vector<float> {
+	Scene scene;
+	auto ground = scene.createEntity("ground");
+	ground.addComponent<component::PhysicBody>().body.type = SceneBody::BodyType::Static;
+	auto& [groundTransform] = ground.getComponent<component::Transform>();
+	groundTransform.scale().x() = 100.0f;
+	std::vector<Entity> boxes;
+	for (int i = 0; i < 400; ++i) {
+		auto box = scene.createEntity(std::format("box{}", i));
+		box.addComponent<component::PhysicBody>().body.type = SceneBody::BodyType::Dynamic;
+		auto& [transform] = box.getComponent<component::Transform>();
+		transform.translation().x() = static_cast<float>(i % 20) * 1.1f - 11.0f;
+		transform.translation().y() = static_cast<float>(i / 20) * 1.1f + 1.0f;
+		boxes.push_back(box);
+	}
+	owl::core::task::Scheduler scheduler{4};
+	PhysicCommand::setWorkerCount(iWorkerCount);
+	PhysicCommand::init(&scene, scheduler);
+	Timestep ts;
+	ts.forceUpdate(std::chrono::milliseconds(16));
+	for (int step = 0; step < 60; ++step)
+		PhysicCommand::frame(ts);
+	const auto stats = PhysicCommand::getStepStats();
+	EXPECT_EQ(stats.workerCount, iWorkerCount);
+	EXPECT_GE(stats.stepMs, 0.0f);
+	EXPECT_GE(stats.stepMs, stats.solveMs);
+	std::vector<float> heights;
+	for (auto& box: boxes)
+		heights.push_back(box.getComponent<component::Transform>().transform.translation().y());
+	PhysicCommand::destroy();
+	PhysicCommand::setWorkerCount(0);
+	return heights;
+}
+}// namespace
+
+TEST(PhysicCommand, MultithreadedStepIsDeterministic) {
+	Log::init(Log::Level::Off);
+	EXPECT_EQ(PhysicCommand::getStepStats().workerCount, 0u);
+	const auto single = runPile(1);
+	const auto multi = runPile(4);
+	ASSERT_EQ(single.size(), multi.size());
+	// Box2D results do not depend on the number of workers.
+	for (size_t i = 0; i < single.size(); ++i)
+		EXPECT_EQ(single[i], multi[i]);
+	// The pile fell.
+	EXPECT_LT(multi.back(), 22.0f * 1.1f);
+	Log::invalidate();
+}
+
+TEST(PhysicCommand, DefaultWorkerCountLeavesOneWorker) {
+	Log::init(Log::Level::Off);
+	Scene scene;
+	scene.createEntity("box").addComponent<component::PhysicBody>().body.type = SceneBody::BodyType::Dynamic;
+	owl::core::task::Scheduler scheduler{4};
+	PhysicCommand::init(&scene, scheduler);
+	Timestep ts;
+	ts.forceUpdate(std::chrono::milliseconds(16));
+	PhysicCommand::frame(ts);
+	EXPECT_EQ(PhysicCommand::getStepStats().workerCount, 3u);
+	PhysicCommand::destroy();
+	Log::invalidate();
+}
+
+namespace {
+auto makeFallingBox(Scene& ioScene) -> Entity {
+	auto box = ioScene.createEntity("box");
+	box.addComponent<component::PhysicBody>().body.type = SceneBody::BodyType::Dynamic;
+	return box;
+}
+
+auto heightOf(const Entity& iEntity) -> float {
+	return iEntity.getComponent<component::Transform>().transform.translation().y();
+}
+}// namespace
+
+TEST(PhysicCommand, FixedStepSettings) {
+	Log::init(Log::Level::Off);
+	EXPECT_FALSE(PhysicCommand::getStepSettings().fixedStep);
+	PhysicCommand::setStepSettings({.fixedStep = true, .fixedDelta = 0.f, .maxStepsPerFrame = 0, .subSteps = 0});
+	EXPECT_GT(PhysicCommand::getStepSettings().fixedDelta, 0.f);
+	EXPECT_EQ(PhysicCommand::getStepSettings().maxStepsPerFrame, 1u);
+	EXPECT_EQ(PhysicCommand::getStepSettings().subSteps, 1u);
+	PhysicCommand::setStepSettings({});
+	EXPECT_FALSE(PhysicCommand::getStepSettings().fixedStep);
+	Log::invalidate();
+}
+
+TEST(PhysicCommand, FixedStepBoundsTheCatchUp) {
+	Log::init(Log::Level::Off);
+	Scene scene;
+	const auto box = makeFallingBox(scene);
+	PhysicCommand::setStepSettings({.fixedStep = true, .fixedDelta = 0.02f, .maxStepsPerFrame = 3});
+	PhysicCommand::init(&scene);
+	Timestep ts;
+
+	// Shorter than a step: nothing simulated yet.
+	ts.forceUpdate(std::chrono::milliseconds(15));
+	PhysicCommand::frame(ts);
+	EXPECT_EQ(PhysicCommand::getStepStats().stepCount, 0u);
+	EXPECT_NEAR(PhysicCommand::getStepStats().interpolation, 0.75f, 1e-4f);
+	EXPECT_EQ(heightOf(box), 0.f);
+
+	ts.forceUpdate(std::chrono::milliseconds(15));
+	PhysicCommand::frame(ts);
+	EXPECT_EQ(PhysicCommand::getStepStats().stepCount, 1u);
+	EXPECT_NEAR(PhysicCommand::getStepStats().interpolation, 0.5f, 1e-4f);
+	// Half-way between the start and the first step.
+	const float interpolated = heightOf(box);
+	EXPECT_LT(interpolated, 0.f);
+
+	// A one second hitch costs at most 3 steps, the rest is dropped.
+	ts.forceUpdate(std::chrono::seconds(1));
+	PhysicCommand::frame(ts);
+	EXPECT_EQ(PhysicCommand::getStepStats().stepCount, 3u);
+	EXPECT_LT(PhysicCommand::getStepStats().interpolation, 1.f);
+	EXPECT_LT(heightOf(box), interpolated);
+
+	PhysicCommand::destroy();
+	PhysicCommand::setStepSettings({});
+	Log::invalidate();
+}
+
+TEST(PhysicCommand, FixedStepIndependentOfFrameRate) {
+	Log::init(Log::Level::Off);
+	constexpr uint32_t stepCount = 60;
+	// Reference: one step per frame, the frame time beyond a step being dropped.
+	std::vector<float> reference;
+	{
+		Scene scene;
+		const auto box = makeFallingBox(scene);
+		PhysicCommand::setStepSettings({.fixedStep = true, .maxStepsPerFrame = 1, .interpolate = false});
+		PhysicCommand::init(&scene);
+		Timestep ts;
+		ts.forceUpdate(std::chrono::seconds(1));
+		reference.push_back(heightOf(box));
+		for (uint32_t step = 0; step < stepCount + 4; ++step) {
+			PhysicCommand::frame(ts);
+			reference.push_back(heightOf(box));
+		}
+		PhysicCommand::destroy();
+	}
+	for (const auto frameDuration: {std::chrono::microseconds(6944), std::chrono::microseconds(33333)}) {
+		Scene scene;
+		const auto box = makeFallingBox(scene);
+		PhysicCommand::setStepSettings({.fixedStep = true, .interpolate = false});
+		PhysicCommand::init(&scene);
+		Timestep ts;
+		ts.forceUpdate(frameDuration);
+		uint32_t total = 0;
+		while (total < stepCount) {
+			PhysicCommand::frame(ts);
+			total += PhysicCommand::getStepStats().stepCount;
+			EXPECT_EQ(heightOf(box), reference[total]);
+		}
+		PhysicCommand::destroy();
+	}
+	PhysicCommand::setStepSettings({});
+	Log::invalidate();
+}
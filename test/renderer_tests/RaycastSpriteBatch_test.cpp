@@ -0,0 +1,153 @@
+/**
+ * @file RaycastSpriteBatch_test.cpp
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright (c) 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#include "testHelper.h"
+
+#include <renderer/gpu/RenderCommand.h>
+#include <renderer/utils/RaycastSpriteBatch.h>
+
+using namespace owl;
+using namespace owl::renderer;
+using namespace owl::renderer::utils;
+
+namespace {
+class RaycastSpriteBatchFixture : public testing::Test {
+protected:
+	void SetUp() override {
+		core::Log::init(core::Log::Level::Off);
+		gpu::RenderCommand::create(gpu::RenderAPI::Type::Null);
+	}
+
+	void TearDown() override {
+		gpu::RenderCommand::invalidate();
+		core::Log::invalidate();
+	}
+};
+
+// One flushed batch, copied out of the builder.
+struct Flushed {
+	std::vector<RaycastSpriteBatch::Instance> instances;
+	std::vector<const shared<gpu::Texture>*> textures;
+};
+
+auto makeTexture() -> shared<gpu::Texture> {
+	return gpu::Texture2D::create(gpu::Texture2D::Specification{.size = {2, 2}});
+}
+
+auto makeFootprint(const size_t iSprite, const float iDepth, const uint32_t iColStart, const uint32_t iColEnd)
+		-> RaycastSpriteBatch::Footprint {
+	return {.spriteIdx = iSprite,
+			.depth = iDepth,
+			.screenLeft = static_cast<float>(iColStart),
+			.spriteW = static_cast<float>(iColEnd - iColStart),
+			.spriteH = 8.f,
+			.screenCenterY = 4.f,
+			.colStart = iColStart,
+			.colEnd = iColEnd,
+			.uvLeft = 0.f,
+			.uvRight = 1.f,
+			.uvBottom = 0.f,
+			.uvTop = 1.f,
+			.tint = {1.f, 1.f, 1.f, 1.f}};
+}
+
+auto build(RaycastSpriteBatch& ioBatch, const std::vector<RaycastSpriteData>& iSprites,
+		   const std::vector<RaycastSpriteBatch::Footprint>& iFootprints, const std::vector<float>& iZBuffer,
+		   RendererRaycast::Statistics& ioStats) -> std::vector<Flushed> {
+	std::vector<Flushed> flushed;
+	ioBatch.build(iSprites, iFootprints, iZBuffer, ioStats, [&flushed](const RaycastSpriteBatch& iBatch) -> void {
+		flushed.push_back({.instances = {iBatch.getInstances().begin(), iBatch.getInstances().end()},
+						   .textures = {iBatch.getTextures().begin(), iBatch.getTextures().end()}});
+	});
+	return flushed;
+}
+}// namespace
+
+TEST_F(RaycastSpriteBatchFixture, TrimsHiddenColumns) {
+	constexpr float inf = std::numeric_limits<float>::infinity();
+	// Walls at depth 1 on both sides, open in the middle.
+	const std::vector zBuffer{1.f, 1.f, 1.f, inf, inf, inf, inf, 1.f, 1.f, 1.f};
+	const auto texture = makeTexture();
+	std::vector<RaycastSpriteData> sprites(3);
+	for (auto& sprite: sprites) sprite.texture = texture;
+	sprites[1].entityId = 7;
+	// Far sprite across the screen, far sprite behind the left wall, near sprite in front of it.
+	const std::vector footprints{makeFootprint(1, 5.f, 0, 10), makeFootprint(0, 5.f, 0, 3),
+								 makeFootprint(2, 0.5f, 0, 2)};
+	RaycastSpriteBatch batch;
+	RendererRaycast::Statistics stats;
+	const auto flushed = build(batch, sprites, footprints, zBuffer, stats);
+
+	ASSERT_EQ(flushed.size(), 1u);
+	const auto& instances = flushed[0].instances;
+	ASSERT_EQ(instances.size(), 2u);
+	EXPECT_EQ(instances[0].colStart, 3u);
+	EXPECT_EQ(instances[0].colEnd, 7u);
+	EXPECT_EQ(instances[0].entityId, 7);
+	EXPECT_FLOAT_EQ(instances[0].depth, 5.f);
+	EXPECT_FLOAT_EQ(instances[0].rect.z(), 0.f);
+	EXPECT_FLOAT_EQ(instances[0].rect.w(), 10.f);
+	EXPECT_EQ(instances[1].colStart, 0u);
+	EXPECT_EQ(instances[1].colEnd, 2u);
+	EXPECT_EQ(instances[0].texIndex, 0u);
+	EXPECT_EQ(instances[1].texIndex, 0u);
+	ASSERT_EQ(flushed[0].textures.size(), 1u);
+	EXPECT_EQ(flushed[0].textures[0]->get(), texture.get());
+	EXPECT_EQ(stats.spriteCount, 2u);
+	EXPECT_EQ(stats.spriteStripeCount, 6u);
+	EXPECT_EQ(stats.spriteOccludedCount, 9u);
+}
+
+TEST_F(RaycastSpriteBatchFixture, NewBatchPastTheTextureSlots) {
+	const std::vector zBuffer(4, std::numeric_limits<float>::infinity());
+	constexpr uint32_t spriteCount = RaycastSpriteBatch::g_maxTextures + 2;
+	std::vector<RaycastSpriteData> sprites(spriteCount);
+	std::vector<RaycastSpriteBatch::Footprint> footprints;
+	for (uint32_t i = 0; i < RaycastSpriteBatch::g_maxTextures + 1; ++i) {
+		sprites[i].texture = makeTexture();
+		footprints.push_back(makeFootprint(i, 2.f, 0, 4));
+	}
+	// The last one shares the texture of the 33rd.
+	sprites.back().texture = sprites[RaycastSpriteBatch::g_maxTextures].texture;
+	footprints.push_back(makeFootprint(spriteCount - 1, 2.f, 0, 4));
+	RaycastSpriteBatch batch;
+	RendererRaycast::Statistics stats;
+	const auto flushed = build(batch, sprites, footprints, zBuffer, stats);
+
+	ASSERT_EQ(flushed.size(), 2u);
+	ASSERT_EQ(flushed[0].instances.size(), RaycastSpriteBatch::g_maxTextures);
+	EXPECT_EQ(flushed[0].textures.size(), RaycastSpriteBatch::g_maxTextures);
+	for (uint32_t i = 0; i < RaycastSpriteBatch::g_maxTextures; ++i) EXPECT_EQ(flushed[0].instances[i].texIndex, i);
+	// Painter's order is kept across the split, and slots start over.
+	ASSERT_EQ(flushed[1].instances.size(), 2u);
+	ASSERT_EQ(flushed[1].textures.size(), 1u);
+	EXPECT_EQ(flushed[1].instances[0].texIndex, 0u);
+	EXPECT_EQ(flushed[1].instances[1].texIndex, 0u);
+	EXPECT_EQ(flushed[1].textures[0], &sprites[RaycastSpriteBatch::g_maxTextures].texture);
+	EXPECT_EQ(stats.spriteCount, spriteCount);
+}
+
+TEST_F(RaycastSpriteBatchFixture, NewBatchPastTheRecordLimit) {
+	const std::vector zBuffer(2, std::numeric_limits<float>::infinity());
+	constexpr uint32_t spriteCount = RaycastSpriteBatch::g_maxSprites + 1;
+	std::vector<RaycastSpriteData> sprites(1);
+	sprites[0].texture = makeTexture();
+	const std::vector footprints(spriteCount, makeFootprint(0, 1.f, 0, 2));
+	RaycastSpriteBatch batch;
+	RendererRaycast::Statistics stats;
+	const auto flushed = build(batch, sprites, footprints, zBuffer, stats);
+
+	ASSERT_EQ(flushed.size(), 2u);
+	EXPECT_EQ(flushed[0].instances.size(), RaycastSpriteBatch::g_maxSprites);
+	EXPECT_EQ(flushed[1].instances.size(), 1u);
+	EXPECT_EQ(stats.spriteStripeCount, 2u * spriteCount);
+
+	// Nothing visible: no batch at all.
+	const std::vector walls(2, 0.5f);
+	EXPECT_TRUE(build(batch, sprites, {makeFootprint(0, 1.f, 0, 2)}, walls, stats).empty());
+}
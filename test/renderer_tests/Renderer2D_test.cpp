@@ -2,6 +2,7 @@
 #include "testHelper.h"
 
 #include <app/Application.h>
+#include <core/FrameArena.h>
 #include <renderer/Renderer.h>
 #include <renderer/Renderer2D.h>
 
@@ -59,6 +60,41 @@ TEST(Renderer2D, fakeLineScene) {
 	Log::invalidate();
 }
 
+TEST(Renderer2D, frameArenaRewoundWithoutFrameLoop) {
+	Log::init(owl::core::Log::Level::Off);
+	RenderCommand::create(RenderAPI::Type::Null);
+	Renderer::init();
+	const CameraEditor cam;
+	auto& arena = FrameArena::frame();
+	arena.reset();
+	PolyLineData data{.transform = owl::math::Transform{owl::math::identity<float, 4>()},
+					  .points = std::vector<owl::math::vec3>{}};
+	data.points.emplace_back(0.f, 0.f, 0.f);
+	data.points.emplace_back(1.f, 0.f, 0.f);
+	data.points.emplace_back(1.f, 1.f, 0.f);
+	// No frame loop: every 2D scene rewinds the arena.
+	ASSERT_FALSE(arena.hasFrameLoop());
+	for (int frame = 0; frame < 3; ++frame) {
+		Renderer2D::beginScene(cam);
+		Renderer2D::drawPolyLine(data);
+		EXPECT_GT(arena.getUsedBytes(), 0u);
+		Renderer2D::endScene();
+		EXPECT_EQ(arena.getUsedBytes(), 0u);
+	}
+	// A frame loop owns the arena: the scene leaves it alone.
+	arena.setFrameLoop(true);
+	Renderer2D::beginScene(cam);
+	Renderer2D::drawPolyLine(data);
+	Renderer2D::endScene();
+	EXPECT_GT(arena.getUsedBytes(), 0u);
+	arena.setFrameLoop(false);
+	arena.reset();
+
+	Renderer2D::shutdown();
+	RenderCommand::invalidate();
+	Log::invalidate();
+}
+
 TEST(Renderer2D, fakeCircleRectScene) {
 	Log::init(owl::core::Log::Level::Off);
 	RenderCommand::create(RenderAPI::Type::Null);
@@ -177,3 +213,45 @@ TEST(Renderer2D, fakeTextScene) {
 	app.reset();
 	Log::invalidate();
 }
+
+TEST(Renderer2D, atlasPagesRemoveTextureBatchBreaks) {
+	Log::init(owl::core::Log::Level::Off);
+	RenderCommand::create(RenderAPI::Type::Null);
+	Renderer::init();
+	const CameraEditor cam;
+	const auto checker = owl::test::getRootPath() / "engine_assets" / "textures" / "CheckerBoard.png";
+	std::vector<owl::shared<Texture2D>> sprites;
+	for (uint32_t i = 0; i < 40; ++i) sprites.push_back(Texture2D::create(checker));
+	const auto drawFrame = [&]() -> Renderer2D::Statistics {
+		Renderer2D::resetStats();
+		Renderer2D::beginScene(cam);
+		for (const auto& sprite: sprites) Renderer2D::drawQuad({.transform = Transform{}, .texture = sprite});
+		Renderer2D::endScene();
+		return Renderer2D::getStats();
+	};
+
+	// First use: one slot per texture, 40 textures overflow the 31 free slots.
+	const auto first = drawFrame();
+	EXPECT_EQ(first.textureBatchBreaks, 1u);
+	EXPECT_EQ(first.drawCalls, 2u);
+
+	// Packing runs at the start of the next scenes, then every sprite samples the same page.
+	drawFrame();
+	const auto packed = drawFrame();
+	EXPECT_EQ(packed.quadCount, 40u);
+	EXPECT_EQ(packed.textureBatchBreaks, 0u);
+	EXPECT_EQ(packed.batchBreaksAvoided, 1u);
+	EXPECT_EQ(packed.drawCalls, 1u);
+
+	// A tiled quad cannot sample an atlas page and keeps its own slot.
+	Renderer2D::resetStats();
+	Renderer2D::beginScene(cam);
+	for (const auto& sprite: sprites)
+		Renderer2D::drawQuad({.transform = Transform{}, .texture = sprite, .tilingFactor = {2.f, 2.f}});
+	Renderer2D::endScene();
+	EXPECT_EQ(Renderer2D::getStats().textureBatchBreaks, 1u);
+
+	sprites.clear();
+	RenderCommand::invalidate();
+	Log::invalidate();
+}
@@ -9,6 +9,7 @@
 #include "testHelper.h"
 
 #include <app/Application.h>
+#include <core/task/Scheduler.h>
 #include <renderer/CameraOrtho.h>
 #include <renderer/RenderLayerFactory.h>
 #include <renderer/Renderer.h>
@@ -751,3 +752,57 @@ TEST(RendererRaycast, backdropFallsBackToSolidWhenNoTexture) {
 	EXPECT_EQ(stats.backdropScanlineCount, 0u);
 	teardownRendererStack();
 }
+
+TEST(RendererRaycast, parallelColumnsMatchSerialWalk) {
+	// 803 rays: several column blocks plus a tail that is neither a full block nor a full ray packet.
+	bootRendererStack();
+	const CameraOrtho cam(0, 800, 0, 600);
+	const TilemapAsset tm = makeCorridorTilemap();
+	const RaycastConfig config = makeTestConfig(75.f, 16.f, 803);
+	RaycastDynamicWallData wall{};
+	wall.worldCenter = {-0.5f, 1.5f};
+	wall.texture = makeSpriteTexture();
+	owl::renderer::RaycastDoorData door{};
+	door.cellCenter = {1.f, 1.5f};
+	door.faceTexture = makeSpriteTexture();
+	door.lateralTexture = door.faceTexture;
+	RaycastSpriteData near{};
+	near.worldPosition = {0.5f, 1.f};
+	near.texture = makeSpriteTexture();
+	RaycastSpriteData far = near;
+	far.worldPosition = {0.f, 2.f};
+	const std::array walls{wall};
+	const std::array doors{door};
+	const std::array sprites{near, far};
+	const auto renderFrame = [&]() -> RendererRaycast::Statistics {
+		RendererRaycast::resetStats();
+		RendererRaycast::beginScene(cam, {800, 600}, config);
+		RendererRaycast::drawTilemapWalls(tm, math::Transform{}, 1);
+		RendererRaycast::drawDynamicWalls(walls);
+		RendererRaycast::drawDoors(doors);
+		RendererRaycast::drawSprites(sprites);
+		RendererRaycast::endScene();
+		return RendererRaycast::getStats();
+	};
+
+	const auto serial = renderFrame();
+	core::task::Scheduler scheduler;
+	RendererRaycast::setScheduler(&scheduler);
+	const auto parallel = renderFrame();
+	RendererRaycast::setScheduler(nullptr);
+
+	EXPECT_EQ(serial.stripeCount, 803u);
+	EXPECT_GT(serial.dynamicWallStripeCount, 0u);
+	EXPECT_GT(serial.spriteStripeCount, 0u);
+	EXPECT_EQ(parallel.stripeCount, serial.stripeCount);
+	EXPECT_EQ(parallel.hitCount, serial.hitCount);
+	EXPECT_EQ(parallel.missCount, serial.missCount);
+	EXPECT_EQ(parallel.dynamicWallCount, serial.dynamicWallCount);
+	EXPECT_EQ(parallel.dynamicWallStripeCount, serial.dynamicWallStripeCount);
+	EXPECT_EQ(parallel.doorCount, serial.doorCount);
+	EXPECT_EQ(parallel.doorStripeCount, serial.doorStripeCount);
+	EXPECT_EQ(parallel.spriteCount, serial.spriteCount);
+	EXPECT_EQ(parallel.spriteStripeCount, serial.spriteStripeCount);
+	EXPECT_EQ(parallel.spriteOccludedCount, serial.spriteOccludedCount);
+	teardownRendererStack();
+}
@@ -229,3 +229,78 @@ TEST(RendererTilemap, multipleEntitiesCombineIntoOneDrawcall) {
 	EXPECT_EQ(stats.instanceCount, 3u);
 	teardownRendererStack();
 }
+
+TEST(RendererTilemap, staticChunksAreReusedUntilEdited) {
+	bootRendererStack();
+	const CameraOrtho cam(-100, 100, -100, 100);
+
+	TilemapAsset tm;
+	tm.resize(64, 64);
+	tm.tileset = makeTileset();
+	tm.addLayer("ground").tiles.assign(64u * 64u, 0);
+
+	const auto drawFrame = [&]() -> RendererTilemap::Statistics {
+		RendererTilemap::beginScene(cam);
+		RendererTilemap::drawTilemap(tm, math::Transform{}, /*iEntityId=*/-1);
+		RendererTilemap::flushPending();
+		return RendererTilemap::getStatistics();
+	};
+
+	const auto first = drawFrame();
+	EXPECT_EQ(first.chunkCount, 4u);
+	EXPECT_EQ(first.rebuiltChunkCount, 4u);
+	EXPECT_EQ(first.uploadCount, 1u);
+	EXPECT_EQ(first.instanceCount, 64u * 64u);
+
+	const auto still = drawFrame();
+	EXPECT_EQ(still.rebuiltChunkCount, 0u);
+	EXPECT_EQ(still.uploadCount, 0u);
+	EXPECT_EQ(still.drawCallCount, 1u);
+	EXPECT_EQ(still.instanceCount, 64u * 64u);
+
+	tm.setTile(0, 40, 3, scene::component::g_EmptyTileIndex);
+	const auto edited = drawFrame();
+	EXPECT_EQ(edited.rebuiltChunkCount, 1u);
+	EXPECT_EQ(edited.uploadCount, 1u);
+	EXPECT_EQ(edited.instanceCount, 64u * 64u - 1u);
+	teardownRendererStack();
+}
+
+TEST(RendererTilemap, chunksOutsideTheCameraAreCulled) {
+	bootRendererStack();
+	// 256×256 cells centred on the origin; the camera sees the four chunks around it.
+	const CameraOrtho cam(-10, 10, -10, 10);
+	RendererTilemap::beginScene(cam);
+
+	TilemapAsset tm;
+	tm.resize(256, 256);
+	tm.tileset = makeTileset();
+	tm.addLayer("ground").tiles.assign(256u * 256u, 1);
+
+	RendererTilemap::drawTilemap(tm, math::Transform{}, /*iEntityId=*/-1);
+	RendererTilemap::flushPending();
+	const auto stats = RendererTilemap::getStatistics();
+	EXPECT_EQ(stats.chunkCount, 4u);
+	EXPECT_EQ(stats.culledChunkCount, 60u);
+	EXPECT_EQ(stats.instanceCount, 4u * TilemapAsset::g_chunkSize * TilemapAsset::g_chunkSize);
+	teardownRendererStack();
+}
+
+TEST(RendererTilemap, largeVisibleMapSpillsIntoSeveralDraws) {
+	bootRendererStack();
+	const CameraOrtho cam(-1000, 1000, -1000, 1000);
+	RendererTilemap::beginScene(cam);
+
+	TilemapAsset tm;
+	tm.resize(200, 100);
+	tm.tileset = makeTileset();
+	tm.addLayer("ground").tiles.assign(200u * 100u, 2);
+
+	RendererTilemap::drawTilemap(tm, math::Transform{}, /*iEntityId=*/-1);
+	RendererTilemap::flushPending();
+	const auto stats = RendererTilemap::getStatistics();
+	EXPECT_EQ(stats.culledChunkCount, 0u);
+	EXPECT_EQ(stats.instanceCount, 20000u);
+	EXPECT_EQ(stats.drawCallCount, 2u);
+	teardownRendererStack();
+}
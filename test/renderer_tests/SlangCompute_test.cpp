@@ -180,3 +180,16 @@ TEST(SlangCompute, shippedRaycastStripeShaderCompiles) {
 	EXPECT_TRUE(resultGl.success);
 	owl::core::Log::invalidate();
 }
+
+TEST(SlangCompute, shippedRaycastSpriteShaderCompiles) {
+	owl::core::Log::init(owl::core::Log::Level::Off);
+	const auto source = loadShipped("raycast_sprite", "raycast_sprite");
+	ASSERT_FALSE(source.empty());
+	const auto resultVk =
+			owl::renderer::utils::compileSlangToSpirv(source, "raycast_sprite_vk_check", /*iForVulkan=*/true);
+	EXPECT_TRUE(resultVk.success);
+	const auto resultGl =
+			owl::renderer::utils::compileSlangToSpirv(source, "raycast_sprite_gl_check", /*iForVulkan=*/false);
+	EXPECT_TRUE(resultGl.success);
+	owl::core::Log::invalidate();
+}
@@ -10,6 +10,7 @@
 #include "core/task/Scheduler.h"
 #include "renderer/gpu/RenderCommand.h"
 #include "renderer/gpu/Texture.h"
+#include "renderer/utils/TextureUploadQueue.h"
 
 using namespace owl::renderer;
 using namespace owl::renderer::gpu;
@@ -27,6 +28,7 @@ protected:
 	}
 
 	void TearDown() override {
+		utils::TextureUploadQueue::get().clear();
 		RenderCommand::invalidate();
 		owl::core::Log::invalidate();
 	}
@@ -53,9 +55,35 @@ TEST_F(TextureAsyncFixture, SuccessfulLoadFlipsToReady) {
 	ASSERT_NE(tex, nullptr);
 	EXPECT_EQ(tex->getLoadState(), LoadState::Pending);
 	m_scheduler.waitEmptyQueue();
+	// The small levels are uploaded, the large ones wait for the per-frame budget.
+	EXPECT_EQ(tex->getLoadState(), LoadState::Pending);
+	auto& queue = utils::TextureUploadQueue::get();
+	EXPECT_EQ(queue.size(), 1u);
+	EXPECT_GT(queue.getPendingBytes(), 0u);
+	queue.flush();
+	EXPECT_TRUE(queue.empty());
 	EXPECT_EQ(tex->getLoadState(), LoadState::Ready);
 }
 
+TEST_F(TextureAsyncFixture, MipStorageSpansTheFullChain) {
+	const auto tex = Texture2D::createFromSerializedAsync("pat:" + getFixturePathStr(), m_scheduler);
+	ASSERT_NE(tex, nullptr);
+	// 1500x1917: levels down to 1x1.
+	EXPECT_EQ(tex->getMipLevelCount(), 11u);
+	m_scheduler.waitEmptyQueue();
+}
+
+TEST_F(TextureAsyncFixture, ReleasedTextureLeavesTheQueue) {
+	auto tex = Texture2D::createFromSerializedAsync("pat:" + getFixturePathStr(), m_scheduler);
+	ASSERT_NE(tex, nullptr);
+	m_scheduler.waitEmptyQueue();
+	tex.reset();
+	auto& queue = utils::TextureUploadQueue::get();
+	EXPECT_EQ(queue.getPendingBytes(), 0u);
+	EXPECT_EQ(queue.process(), 0u);
+	EXPECT_TRUE(queue.empty());
+}
+
 TEST_F(TextureAsyncFixture, EmptyPrefixFallsBackToSync) {
 	const auto tex = Texture2D::createFromSerializedAsync("emp:", m_scheduler);
 	ASSERT_NE(tex, nullptr);
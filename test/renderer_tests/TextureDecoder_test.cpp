@@ -101,3 +101,43 @@ TEST(TextureDecoder, DecodeMissingFileReturnsInvalid) {
 	EXPECT_TRUE(decoded.pixels.empty());
 	owl::core::Log::invalidate();
 }
+
+TEST(TextureDecoder, MipLevelCount) {
+	EXPECT_EQ(getMipLevelCount({0, 0}), 0u);
+	EXPECT_EQ(getMipLevelCount({1, 1}), 1u);
+	EXPECT_EQ(getMipLevelCount({256, 256}), 9u);
+	EXPECT_EQ(getMipLevelCount({1500, 1917}), 11u);
+}
+
+TEST(TextureDecoder, MipChainBoxFilter) {
+	DecodedImage image;
+	image.size = {3, 2};
+	image.format = ImageFormat::Rgb8;
+	image.valid = true;
+	// One channel ramp, the others constant.
+	for (uint8_t value: {0, 40, 80, 120, 160, 200}) image.pixels.insert(image.pixels.end(), {value, 255, 0});
+	generateMipChain(image, 8);
+	// A 3x2 image has a 2 levels chain, whatever the request.
+	ASSERT_EQ(image.mips.size(), 1u);
+	EXPECT_EQ(image.mips[0].size, (owl::math::vec2ui{1, 1}));
+	// Average of the top-left 2x2 block.
+	EXPECT_EQ(image.mips[0].pixels, (std::vector<uint8_t>{80, 255, 0}));
+
+	generateMipChain(image, 1);
+	EXPECT_TRUE(image.mips.empty());
+}
+
+TEST(TextureDecoder, MipChainOfDecodedFile) {
+	auto decoded = decodeImageFile(getFixturePath(), 4);
+	ASSERT_TRUE(decoded.valid);
+	generateMipChain(decoded, getMipLevelCount(decoded.size));
+	ASSERT_EQ(decoded.mips.size(), getMipLevelCount(decoded.size) - 1);
+	auto previous = decoded.size;
+	for (const auto& mip: decoded.mips) {
+		EXPECT_EQ(mip.size.x(), std::max(previous.x() / 2, 1u));
+		EXPECT_EQ(mip.size.y(), std::max(previous.y() / 2, 1u));
+		EXPECT_EQ(mip.pixels.size(), static_cast<size_t>(mip.size.surface()) * 4);
+		previous = mip.size;
+	}
+	EXPECT_EQ(decoded.mips.back().size, (owl::math::vec2ui{1, 1}));
+}
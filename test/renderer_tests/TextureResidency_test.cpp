@@ -0,0 +1,132 @@
+/**
+ * @file TextureResidency_test.cpp
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright (c) 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#include "testHelper.h"
+
+#include <core/task/Scheduler.h>
+#include <renderer/gpu/RenderCommand.h>
+#include <renderer/utils/TextureResidency.h>
+#include <renderer/utils/TextureUploadQueue.h>
+
+using namespace owl;
+using namespace owl::renderer;
+using namespace owl::renderer::utils;
+
+namespace {
+class TextureResidencyFixture : public testing::Test {
+protected:
+	void SetUp() override {
+		core::Log::init(core::Log::Level::Off);
+		gpu::RenderCommand::create(gpu::RenderAPI::Type::Null);
+	}
+
+	void TearDown() override {
+		TextureUploadQueue::get().clear();
+		gpu::RenderCommand::invalidate();
+		core::Log::invalidate();
+	}
+};
+
+auto texturePath(const std::string& iName) -> std::filesystem::path {
+	return test::getRootPath() / "engine_assets" / "textures" / iName;
+}
+}// namespace
+
+TEST_F(TextureResidencyFixture, HandlesAreStableAndSlotsPerBatch) {
+	TextureResidency residency;
+	const auto a = gpu::Texture2D::create(gpu::Texture2D::Specification{.size = {2, 2}});
+	const auto b = gpu::Texture2D::create(gpu::Texture2D::Specification{.size = {2, 2}});
+	const uint32_t ha = residency.acquire(a);
+	const uint32_t hb = residency.acquire(b);
+	EXPECT_NE(ha, hb);
+	EXPECT_EQ(residency.acquire(a), ha);
+	EXPECT_EQ(residency.acquire(nullptr), TextureResidency::g_invalidHandle);
+	// Generated textures have no source file to pack.
+	EXPECT_FALSE(residency.hasPending());
+
+	residency.beginBatch();
+	EXPECT_EQ(residency.findSlot(ha), TextureResidency::g_noSlot);
+	residency.setSlot(ha, 3);
+	EXPECT_EQ(residency.findSlot(ha), 3u);
+	EXPECT_EQ(residency.findSlot(hb), TextureResidency::g_noSlot);
+	residency.beginBatch();
+	EXPECT_EQ(residency.findSlot(ha), TextureResidency::g_noSlot);
+}
+
+TEST_F(TextureResidencyFixture, SmallFileTexturesArePacked) {
+	TextureResidency residency;
+	const auto small = gpu::Texture2D::create(texturePath("CheckerBoard.png"));
+	const auto big = gpu::Texture2D::create(texturePath("mario.png"));
+	ASSERT_NE(small, nullptr);
+	ASSERT_NE(big, nullptr);
+	const uint32_t hs = residency.acquire(small);
+	const uint32_t hb = residency.acquire(big);
+	EXPECT_TRUE(residency.hasPending());
+	EXPECT_EQ(residency.findAtlasRegion(hs), nullptr);
+
+	EXPECT_EQ(residency.update(), 1u);
+	EXPECT_FALSE(residency.hasPending());
+	EXPECT_EQ(residency.getPackedCount(), 1u);
+	EXPECT_EQ(residency.getPageCount(), 1u);
+	EXPECT_EQ(residency.findAtlasRegion(hb), nullptr);
+	const auto* region = residency.findAtlasRegion(hs);
+	ASSERT_NE(region, nullptr);
+	EXPECT_EQ(region->page, 0u);
+	constexpr float texel = 1.f / static_cast<float>(TextureResidency::g_pageSize);
+	EXPECT_NEAR(region->offset.x(), texel, 1e-7f);
+	EXPECT_NEAR(region->offset.y(), texel, 1e-7f);
+	EXPECT_NEAR(region->scale.x(), 64.f * texel, 1e-7f);
+	EXPECT_NEAR(region->scale.y(), 64.f * texel, 1e-7f);
+	EXPECT_NE(residency.getPageTexture(0), nullptr);
+	EXPECT_NE(residency.getPageHandle(0), TextureResidency::g_invalidHandle);
+}
+
+TEST_F(TextureResidencyFixture, StreamingTexturesArePackedOnceLoaded) {
+	core::task::Scheduler scheduler;
+	TextureResidency residency;
+	const auto texture = gpu::Texture2D::createFromSerializedAsync(
+			std::format("pat:{}", texturePath("CheckerBoard.png").string()), scheduler);
+	ASSERT_NE(texture, nullptr);
+	ASSERT_EQ(texture->getLoadState(), gpu::LoadState::Pending);
+	const uint32_t handle = residency.acquire(texture);
+	EXPECT_FALSE(residency.hasPending());
+
+	scheduler.waitEmptyQueue();
+	TextureUploadQueue::get().flush();
+	ASSERT_EQ(texture->getLoadState(), gpu::LoadState::Ready);
+	EXPECT_EQ(residency.acquire(texture), handle);
+	EXPECT_TRUE(residency.hasPending());
+	EXPECT_EQ(residency.update(), 1u);
+	EXPECT_NE(residency.findAtlasRegion(handle), nullptr);
+}
+
+TEST_F(TextureResidencyFixture, SourcesDecodeOnTheScheduler) {
+	core::task::Scheduler scheduler;
+	TextureResidency residency;
+	const auto texture = gpu::Texture2D::create(texturePath("CheckerBoard.png"));
+	ASSERT_NE(texture, nullptr);
+	const uint32_t handle = residency.acquire(texture);
+	// The decode lands in a later update, or in the same one if a worker is fast enough.
+	uint32_t packed = residency.update(&scheduler);
+	scheduler.waitEmptyQueue();
+	packed += residency.update(&scheduler);
+	EXPECT_EQ(packed, 1u);
+	EXPECT_FALSE(residency.hasPending());
+	EXPECT_NE(residency.findAtlasRegion(handle), nullptr);
+
+	// Decodes still in flight when cleared are dropped.
+	residency.clear();
+	const auto other = gpu::Texture2D::create(texturePath("CheckerBoard.png"));
+	const uint32_t otherHandle = residency.acquire(other);
+	residency.update(&scheduler);
+	residency.clear();
+	EXPECT_FALSE(residency.hasPending());
+	scheduler.waitEmptyQueue();
+	EXPECT_EQ(residency.update(&scheduler), 0u);
+	EXPECT_EQ(residency.findAtlasRegion(otherHandle), nullptr);
+}
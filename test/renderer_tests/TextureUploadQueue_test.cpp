@@ -0,0 +1,148 @@
+/**
+ * @file TextureUploadQueue_test.cpp
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright (c) 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "testHelper.h"
+
+#include "renderer/utils/TextureUploadQueue.h"
+
+using namespace owl::renderer;
+using namespace owl::renderer::gpu;
+using namespace owl::renderer::utils;
+
+namespace {
+/// Texture recording the uploads it receives.
+class RecordingTexture final : public Texture {
+public:
+	struct Upload {
+		uint32_t level;
+		owl::math::vec2ui offset;
+		owl::math::vec2ui size;
+	};
+
+	RecordingTexture(const owl::math::vec2ui& iSize, const uint32_t iLevels)
+		: Texture{Specification{.size = iSize,
+								.format = ImageFormat::Rgba8,
+								.generateMips = false,
+								.filterMode = FilterMode::Linear,
+								.mipLevels = iLevels}} {}
+	auto operator==(const Texture& iOther) const -> bool override { return this == &iOther; }
+	[[nodiscard]] auto getRendererId() const -> uint64_t override { return 0; }
+	void bind(uint32_t) const override {}
+	void setData(void*, uint32_t) override {}
+	void setMipData(const uint32_t iLevel, const owl::math::vec2ui& iOffset, const owl::math::vec2ui& iSize,
+					const void*) override {
+		uploads.push_back({iLevel, iOffset, iSize});
+	}
+	[[nodiscard]] auto getMipLevelCount() const -> uint32_t override { return m_specification.mipLevels; }
+	void setBaseMipLevel(const uint32_t iLevel) override { baseLevels.push_back(iLevel); }
+
+	std::vector<Upload> uploads;
+	std::vector<uint32_t> baseLevels;
+};
+
+auto makeImage(const owl::math::vec2ui& iSize, const uint32_t iLevels) -> owl::shared<DecodedImage> {
+	auto image = owl::mkShared<DecodedImage>();
+	image->size = iSize;
+	image->format = ImageFormat::Rgba8;
+	image->pixels.assign(static_cast<size_t>(iSize.surface()) * 4, 0x80);
+	image->valid = true;
+	generateMipChain(*image, iLevels);
+	return image;
+}
+
+}// namespace
+
+TEST(TextureUploadQueue, smallTextureCompletesOnPush) {
+	TextureUploadQueue queue;
+	const auto texture = owl::mkShared<RecordingTexture>(owl::math::vec2ui{64, 32}, 7);
+	bool done = false;
+	queue.push(texture, makeImage({64, 32}, 7), [&done] -> void { done = true; });
+	EXPECT_TRUE(done);
+	EXPECT_TRUE(queue.empty());
+	// Smallest level first, each one made visible once uploaded.
+	ASSERT_EQ(texture->uploads.size(), 7u);
+	EXPECT_EQ(texture->uploads.front().level, 6u);
+	EXPECT_EQ(texture->uploads.back().level, 0u);
+	EXPECT_EQ(texture->baseLevels, (std::vector<uint32_t>{6, 5, 4, 3, 2, 1, 0}));
+}
+
+TEST(TextureUploadQueue, budgetSplitsLevelsInRowBands) {
+	TextureUploadQueue queue;
+	const auto texture = owl::mkShared<RecordingTexture>(owl::math::vec2ui{256, 256}, 9);
+	bool done = false;
+	queue.push(texture, makeImage({256, 256}, 9), [&done] -> void { done = true; });
+	// Levels up to 64x64 are the placeholder.
+	EXPECT_FALSE(done);
+	EXPECT_EQ(texture->baseLevels.back(), 2u);
+	EXPECT_EQ(queue.getPendingBytes(), (128u * 128u + 256u * 256u) * 4u);
+
+	// 128x128 level: 512 bytes per row, 16 rows per frame.
+	texture->uploads.clear();
+	EXPECT_EQ(queue.process(8192), 8192u);
+	ASSERT_EQ(texture->uploads.size(), 1u);
+	EXPECT_EQ(texture->uploads[0].level, 1u);
+	EXPECT_EQ(texture->uploads[0].size, (owl::math::vec2ui{128, 16}));
+	EXPECT_EQ(queue.process(8192), 8192u);
+	EXPECT_EQ(texture->uploads[1].offset, (owl::math::vec2ui{0, 16}));
+
+	// A row larger than the budget still progresses, one row at a time.
+	texture->uploads.clear();
+	while (texture->baseLevels.back() != 1) queue.process(8192);
+	EXPECT_EQ(queue.process(100), 1024u);
+	EXPECT_EQ(texture->uploads.back().level, 0u);
+	EXPECT_EQ(texture->uploads.back().size, (owl::math::vec2ui{256, 1}));
+
+	queue.flush();
+	EXPECT_TRUE(done);
+	EXPECT_TRUE(queue.empty());
+	EXPECT_EQ(texture->baseLevels.back(), 0u);
+}
+
+TEST(TextureUploadQueue, smallestLevelFirstAcrossTextures) {
+	TextureUploadQueue queue;
+	const auto big = owl::mkShared<RecordingTexture>(owl::math::vec2ui{512, 512}, 10);
+	const auto small = owl::mkShared<RecordingTexture>(owl::math::vec2ui{128, 128}, 8);
+	queue.push(big, makeImage({512, 512}, 10), {});
+	queue.push(small, makeImage({128, 128}, 8), {});
+	big->uploads.clear();
+	small->uploads.clear();
+	// Both 128x128 levels before any larger one.
+	queue.process(2u * 128u * 128u * 4u);
+	ASSERT_EQ(big->uploads.size(), 1u);
+	EXPECT_EQ(big->uploads[0].size, (owl::math::vec2ui{128, 128}));
+	ASSERT_EQ(small->uploads.size(), 1u);
+	EXPECT_EQ(small->uploads[0].level, 0u);
+	EXPECT_EQ(queue.size(), 1u);
+}
+
+TEST(TextureUploadQueue, singleLevelTexture) {
+	TextureUploadQueue queue;
+	// Like the Vulkan backend: no mip storage, the full level is streamed in bands.
+	const auto texture = owl::mkShared<RecordingTexture>(owl::math::vec2ui{128, 128}, 1);
+	bool done = false;
+	queue.push(texture, makeImage({128, 128}, 8), [&done] -> void { done = true; });
+	EXPECT_TRUE(texture->uploads.empty());
+	EXPECT_EQ(queue.getPendingBytes(), 128u * 128u * 4u);
+	queue.process(128u * 64u * 4u);
+	EXPECT_FALSE(done);
+	queue.process(128u * 64u * 4u);
+	EXPECT_TRUE(done);
+	for (const auto& upload: texture->uploads) EXPECT_EQ(upload.level, 0u);
+}
+
+TEST(TextureUploadQueue, releasedTextureIsDropped) {
+	TextureUploadQueue queue;
+	auto texture = owl::mkShared<RecordingTexture>(owl::math::vec2ui{256, 256}, 9);
+	bool done = false;
+	queue.push(texture, makeImage({256, 256}, 9), [&done] -> void { done = true; });
+	EXPECT_EQ(queue.size(), 1u);
+	texture.reset();
+	EXPECT_EQ(queue.getPendingBytes(), 0u);
+	EXPECT_EQ(queue.process(), 0u);
+	EXPECT_TRUE(queue.empty());
+	EXPECT_FALSE(done);
+}
@@ -0,0 +1,43 @@
+/**
+ * @file EntitySideTable_test.cpp
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright (c) 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#include "testHelper.h"
+
+#include <scene/EntitySideTable.h>
+
+using namespace owl::scene;
+
+TEST(EntitySideTable, setFindClear) {
+	entt::registry registry;
+	const auto a = registry.create();
+	const auto b = registry.create();
+	EntitySideTable<int> table;
+	EXPECT_EQ(table.find(a), nullptr);
+	EXPECT_EQ(table.find(entt::null), nullptr);
+	table.set(a, 3);
+	table.fetch(b) += 5;
+	ASSERT_NE(table.find(a), nullptr);
+	EXPECT_EQ(*table.find(a), 3);
+	EXPECT_EQ(*table.find(b), 5);
+	table.clear();
+	EXPECT_EQ(table.find(a), nullptr);
+	EXPECT_EQ(table.find(b), nullptr);
+	EXPECT_EQ(table.fetch(a), 0);
+}
+
+TEST(EntitySideTable, recycledEntityIsRejected) {
+	entt::registry registry;
+	const auto a = registry.create();
+	EntitySideTable<int> table;
+	table.set(a, 7);
+	registry.destroy(a);
+	const auto recycled = registry.create();
+	ASSERT_EQ(entt::to_entity(recycled), entt::to_entity(a));
+	EXPECT_EQ(table.find(recycled), nullptr);
+	EXPECT_EQ(table.fetch(recycled), 0);
+}
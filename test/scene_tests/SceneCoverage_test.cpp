@@ -145,6 +145,20 @@ TEST(SceneCoverage, FindEntityByUUIDExplicitZero) {
 	EXPECT_EQ(found.getName(), "zero_ent");
 }
 
+TEST(SceneCoverage, FindEntityByUUIDTracksRegistrySignals) {
+	Scene sc;
+	// An ID emplaced straight in the registry is indexed without any scan.
+	const auto raw = sc.registry.create();
+	sc.registry.emplace<ID>(raw, core::UUID{424242});
+	EXPECT_EQ(static_cast<entt::entity>(sc.findEntityByUUID(core::UUID{424242})), raw);
+	// Replacing the ID moves the index entry.
+	sc.registry.replace<ID>(raw, core::UUID{434343});
+	EXPECT_FALSE(sc.findEntityByUUID(core::UUID{424242}));
+	EXPECT_EQ(static_cast<entt::entity>(sc.findEntityByUUID(core::UUID{434343})), raw);
+	sc.registry.destroy(raw);
+	EXPECT_FALSE(sc.findEntityByUUID(core::UUID{434343}));
+}
+
 // ============================================================================
 // Scene::isEffectivelyVisible — deeply nested and root
 // ============================================================================
@@ -789,6 +803,25 @@ TEST(SceneCoverage, AllEntitiesVsRootEntitiesWithHierarchy) {
 	EXPECT_EQ(sc.getRootEntities().size(), 2u);
 }
 
+TEST(SceneCoverage, ArenaQueriesMatchVectorQueries) {
+	Scene sc;
+	auto root = sc.createEntity("root");
+	sc.createEntity("other");
+	auto child1 = sc.createEntity("child1");
+	auto child2 = sc.createEntity("child2");
+	sc.setParent(child1, root);
+	sc.setParent(child2, root);
+
+	core::FrameArena arena;
+	EXPECT_EQ(sc.getAllEntities(arena).size(), sc.getAllEntities().size());
+	EXPECT_EQ(sc.getRootEntities(arena).size(), 2u);
+	const auto children = sc.getChildren(root, arena);
+	ASSERT_EQ(children.size(), 2u);
+	EXPECT_EQ(children[0].getUUID(), child1.getUUID());
+	EXPECT_EQ(children[1].getUUID(), child2.getUUID());
+	EXPECT_TRUE(sc.getChildren(child1, arena).empty());
+}
+
 // ============================================================================
 // Scene::createEntityWithUUID — preserve UUID
 // ============================================================================
@@ -83,6 +83,29 @@ TEST_F(TilemapAssetFixture, GetSetTileBoundsHandling) {
 	EXPECT_EQ(asset.getTile(5, 1, 1), scene::component::g_EmptyTileIndex);
 }
 
+TEST_F(TilemapAssetFixture, ChunkRevisionsFollowEdits) {
+	TilemapAsset asset;
+	asset.resize(64, 40);
+	asset.addLayer("a");
+	asset.addLayer("b");
+	const auto before00 = asset.getChunkRevision(0, 0, 0);
+	const auto before11 = asset.getChunkRevision(0, 1, 1);
+	const auto beforeOther = asset.getChunkRevision(1, 1, 1);
+
+	asset.setTile(0, 40, 35, 4);
+	EXPECT_EQ(asset.getChunkRevision(0, 0, 0), before00);
+	EXPECT_NE(asset.getChunkRevision(0, 1, 1), before11);
+	EXPECT_EQ(asset.getChunkRevision(1, 1, 1), beforeOther);
+
+	// Whole-asset changes touch every chunk; other assets never share a revision.
+	const auto edited = asset.getChunkRevision(0, 1, 1);
+	asset.markDirty();
+	EXPECT_NE(asset.getChunkRevision(0, 0, 0), before00);
+	EXPECT_NE(asset.getChunkRevision(0, 1, 1), edited);
+	const TilemapAsset other;
+	EXPECT_NE(other.getChunkRevision(0, 0, 0), asset.getChunkRevision(0, 0, 0));
+}
+
 TEST_F(TilemapAssetFixture, RoundTripDefaults) {
 	TilemapAsset asset;
 	asset.width = 8;
@@ -0,0 +1,120 @@
+/**
+ * @file TransformHierarchy_test.cpp
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright (c) 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#include "testHelper.h"
+
+#include <scene/Entity.h>
+#include <scene/Scene.h>
+#include <scene/TransformHierarchy.h>
+#include <scene/component/components.h>
+
+using namespace owl;
+
+namespace {
+class TransformHierarchyFixture : public testing::Test {
+protected:
+	void SetUp() override { core::Log::init(core::Log::Level::Off); }
+
+	void TearDown() override { core::Log::invalidate(); }
+};
+
+auto totalDirty(const scene::TransformHierarchy& iHierarchy) -> uint32_t {
+	uint32_t total = 0;
+	for (const auto& range: iHierarchy.getDirtyRanges()) total += range.count;
+	return total;
+}
+}// namespace
+
+TEST_F(TransformHierarchyFixture, StaticSceneRecomputesNothing) {
+	scene::Scene sc;
+	const auto parent = sc.createEntity("parent");
+	const auto child = sc.createEntity("child");
+	sc.createEntity("other");
+	sc.setParent(child, parent);
+
+	scene::TransformHierarchy hierarchy;
+	hierarchy.update(sc);
+	EXPECT_TRUE(hierarchy.isStructureChanged());
+	EXPECT_EQ(hierarchy.size(), 3u);
+	EXPECT_EQ(hierarchy.getRecomputedCount(), 3u);
+	EXPECT_LT(hierarchy.indexOf(static_cast<entt::entity>(parent)),
+			  hierarchy.indexOf(static_cast<entt::entity>(child)));
+
+	hierarchy.update(sc);
+	EXPECT_FALSE(hierarchy.isStructureChanged());
+	EXPECT_EQ(hierarchy.getRecomputedCount(), 0u);
+	EXPECT_TRUE(hierarchy.getDirtyRanges().empty());
+}
+
+TEST_F(TransformHierarchyFixture, ChangedParentRecomputesItsSubtree) {
+	scene::Scene sc;
+	const auto parent = sc.createEntity("parent");
+	const auto child = sc.createEntity("child");
+	const auto other = sc.createEntity("other");
+	sc.setParent(child, parent);
+	child.getComponent<scene::component::Transform>().transform.translation() = math::vec3{1.f, 0.f, 0.f};
+
+	scene::TransformHierarchy hierarchy;
+	hierarchy.update(sc);
+	parent.getComponent<scene::component::Transform>().transform.translation() = math::vec3{2.f, 3.f, 0.f};
+	hierarchy.update(sc);
+
+	EXPECT_FALSE(hierarchy.isStructureChanged());
+	EXPECT_EQ(hierarchy.getRecomputedCount(), 2u);
+	EXPECT_EQ(totalDirty(hierarchy), 1u);
+	const auto& childWorld = hierarchy.getWorldTransform(hierarchy.indexOf(static_cast<entt::entity>(child)));
+	EXPECT_NEAR(childWorld.translation().x(), 3.f, 1e-5f);
+	EXPECT_NEAR(childWorld.translation().y(), 3.f, 1e-5f);
+	const auto& otherWorld = hierarchy.getWorldTransform(hierarchy.indexOf(static_cast<entt::entity>(other)));
+	EXPECT_NEAR(otherWorld.translation().x(), 0.f, 1e-5f);
+}
+
+TEST_F(TransformHierarchyFixture, StructureChangesRebuild) {
+	scene::Scene sc;
+	const auto a = sc.createEntity("a");
+	auto b = sc.createEntity("b");
+
+	scene::TransformHierarchy hierarchy;
+	hierarchy.update(sc);
+	sc.setParent(a, b);
+	hierarchy.update(sc);
+	EXPECT_TRUE(hierarchy.isStructureChanged());
+	EXPECT_LT(hierarchy.indexOf(static_cast<entt::entity>(b)), hierarchy.indexOf(static_cast<entt::entity>(a)));
+
+	const auto bHandle = static_cast<entt::entity>(b);
+	sc.destroyEntityWithChildren(b);
+	hierarchy.update(sc);
+	EXPECT_TRUE(hierarchy.isStructureChanged());
+	EXPECT_EQ(hierarchy.indexOf(bHandle), scene::TransformHierarchy::g_invalidIndex);
+	EXPECT_EQ(hierarchy.size(), 0u);
+
+	sc.createEntity("late");
+	hierarchy.update(sc);
+	EXPECT_TRUE(hierarchy.isStructureChanged());
+	EXPECT_EQ(hierarchy.size(), 1u);
+}
+
+TEST_F(TransformHierarchyFixture, CircularHierarchyIsExcluded) {
+	scene::Scene sc;
+	const auto a = sc.createEntity("a");
+	const auto b = sc.createEntity("b");
+	const auto root = sc.createEntity("root");
+	a.getComponent<scene::component::Hierarchy>().parentId = b.getUUID();
+	b.getComponent<scene::component::Hierarchy>().parentId = a.getUUID();
+
+	scene::TransformHierarchy hierarchy;
+	hierarchy.update(sc);
+	EXPECT_EQ(hierarchy.size(), 1u);
+	EXPECT_EQ(hierarchy.indexOf(static_cast<entt::entity>(a)), scene::TransformHierarchy::g_invalidIndex);
+	EXPECT_EQ(hierarchy.indexOf(static_cast<entt::entity>(b)), scene::TransformHierarchy::g_invalidIndex);
+	EXPECT_EQ(hierarchy.indexOf(static_cast<entt::entity>(root)), 0u);
+
+	// Excluded entities are still tracked: an unchanged cycle does not rebuild every frame.
+	hierarchy.update(sc);
+	EXPECT_FALSE(hierarchy.isStructureChanged());
+}
@@ -0,0 +1,174 @@
+/**
+ * @file SoundDecoder_test.cpp
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright (c) 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#include "testHelper.h"
+
+#include <data/assets/pack/PackReader.h>
+#include <data/assets/pack/PackWriter.h>
+#include <sound/openal/SoundData.h>
+#include <sound/openal/SoundDecoder.h>
+
+#include <fstream>
+
+using namespace owl::sound::openal;
+using namespace owl::data::assets::pack;
+
+namespace {
+constexpr uint32_t g_sampleRate = 8000;
+constexpr uint32_t g_frames = 3000;
+
+void putLe(std::vector<uint8_t>& ioBytes, const uint32_t iValue, const size_t iSize) {
+	for (size_t i = 0; i < iSize; ++i) ioBytes.push_back(static_cast<uint8_t>(iValue >> (8 * i)));
+}
+
+// Interleaved stereo 16 bits samples: a ramp on the left, its opposite on the right.
+auto makeSamples() -> std::vector<int16_t> {
+	std::vector<int16_t> samples;
+	for (uint32_t frame = 0; frame < g_frames; ++frame) {
+		samples.push_back(static_cast<int16_t>(frame * 7));
+		samples.push_back(static_cast<int16_t>(-static_cast<int32_t>(frame * 7)));
+	}
+	return samples;
+}
+
+auto makeWav(const std::vector<int16_t>& iSamples) -> std::vector<uint8_t> {
+	const auto dataBytes = static_cast<uint32_t>(iSamples.size() * sizeof(int16_t));
+	std::vector<uint8_t> wav{'R', 'I', 'F', 'F'};
+	putLe(wav, 36 + dataBytes, 4);
+	for (const char c: std::string_view{"WAVEfmt "}) wav.push_back(static_cast<uint8_t>(c));
+	putLe(wav, 16, 4);
+	putLe(wav, 1, 2);// PCM
+	putLe(wav, 2, 2);// channels
+	putLe(wav, g_sampleRate, 4);
+	putLe(wav, g_sampleRate * 4, 4);
+	putLe(wav, 4, 2);
+	putLe(wav, 16, 2);
+	for (const char c: std::string_view{"data"}) wav.push_back(static_cast<uint8_t>(c));
+	putLe(wav, dataBytes, 4);
+	for (const auto sample: iSamples) putLe(wav, static_cast<uint16_t>(sample), 2);
+	return wav;
+}
+
+auto asBytes(const std::vector<int16_t>& iSamples) -> std::vector<char> {
+	std::vector<char> bytes(iSamples.size() * sizeof(int16_t));
+	std::memcpy(bytes.data(), iSamples.data(), bytes.size());
+	return bytes;
+}
+
+// Decode the rest of the sound chunk by chunk.
+auto readChunks(SoundDecoder& ioDecoder, const size_t iChunkBytes) -> std::vector<char> {
+	std::vector<char> result;
+	std::vector<char> chunk(iChunkBytes);
+	while (const size_t bytes = ioDecoder.read(chunk)) {
+		EXPECT_EQ(bytes % 4, 0u);
+		result.insert(result.end(), chunk.begin(), chunk.begin() + static_cast<std::ptrdiff_t>(bytes));
+	}
+	return result;
+}
+
+auto getTempDir() -> std::filesystem::path {
+	auto dir = std::filesystem::temp_directory_path() / "owl_sound_decoder_tests";
+	std::filesystem::create_directories(dir);
+	return dir;
+}
+}// namespace
+
+TEST(SoundDecoder, fileInOneGoAndInChunks) {
+	owl::core::Log::init(owl::core::Log::Level::Off);
+	const auto samples = makeSamples();
+	const auto expected = asBytes(samples);
+	const auto path = getTempDir() / "ramp.wav";
+	{
+		const auto wav = makeWav(samples);
+		std::ofstream file(path, std::ios::binary);
+		file.write(reinterpret_cast<const char*>(wav.data()), static_cast<std::streamsize>(wav.size()));
+	}
+
+	SoundDecoder decoder;
+	ASSERT_TRUE(decoder.open(path));
+	EXPECT_TRUE(decoder.isOpen());
+	EXPECT_EQ(decoder.getFormatName(), "stereo16");
+	EXPECT_EQ(decoder.getSampleRate(), static_cast<int32_t>(g_sampleRate));
+	EXPECT_EQ(decoder.getBlockAlign(), 1);
+	EXPECT_EQ(decoder.getByteSize(), expected.size());
+	// 25 ms at 8 kHz: 200 stereo frames.
+	EXPECT_EQ(decoder.getChunkBytes(std::chrono::milliseconds{25}), 800u);
+
+	std::vector<char> whole(decoder.getByteSize());
+	EXPECT_EQ(decoder.read(whole), expected.size());
+	EXPECT_EQ(whole, expected);
+	EXPECT_EQ(decoder.read(whole), 0u);
+
+	ASSERT_TRUE(decoder.rewind());
+	// A chunk that is not a whole number of frames only gets whole frames.
+	EXPECT_EQ(readChunks(decoder, 1001), expected);
+
+	decoder.close();
+	EXPECT_FALSE(decoder.isOpen());
+	EXPECT_EQ(decoder.read(whole), 0u);
+	EXPECT_FALSE(decoder.open(getTempDir() / "missing.wav"));
+	std::filesystem::remove_all(getTempDir());
+	owl::core::Log::invalidate();
+}
+
+TEST(SoundDecoder, packEntry) {
+	owl::core::Log::init(owl::core::Log::Level::Off);
+	const auto samples = makeSamples();
+	const auto expected = asBytes(samples);
+	const auto packPath = getTempDir() / "sounds.owlpack";
+	for (const auto flags: {PackFlags::Default, PackFlags::None}) {
+		{
+			PackWriter writer;
+			// Small frames, so the codec reads span several of them.
+			writer.setFrameSize(1024);
+			writer.addData(makeWav(samples), "sounds/ramp.wav", AssetType::Sound);
+			ASSERT_TRUE(writer.write(packPath, flags));
+		}
+		PackReader reader;
+		ASSERT_TRUE(reader.open(packPath));
+		SoundDecoder decoder;
+		EXPECT_FALSE(decoder.open(reader, "sounds/missing.wav"));
+		ASSERT_TRUE(decoder.open(reader, "sounds/ramp.wav"));
+		EXPECT_EQ(decoder.getByteSize(), expected.size());
+		EXPECT_EQ(readChunks(decoder, decoder.getChunkBytes(std::chrono::milliseconds{50})), expected);
+		ASSERT_TRUE(decoder.rewind());
+		std::vector<char> whole(decoder.getByteSize());
+		EXPECT_EQ(decoder.read(whole), expected.size());
+		EXPECT_EQ(whole, expected);
+	}
+	std::filesystem::remove_all(getTempDir());
+	owl::core::Log::invalidate();
+}
+
+TEST(SoundDecoder, decodeOffTheMainThread) {
+	owl::core::Log::init(owl::core::Log::Level::Off);
+	const auto samples = makeSamples();
+	const auto expected = asBytes(samples);
+	const auto path = getTempDir() / "ramp.wav";
+	{
+		const auto wav = makeWav(samples);
+		std::ofstream file(path, std::ios::binary);
+		file.write(reinterpret_cast<const char*>(wav.data()), static_cast<std::streamsize>(wav.size()));
+	}
+	// 16 bits PCM decodes without any OpenAL call, so no sound device is needed.
+	const auto decoded = SoundData::decode({.file = path});
+	EXPECT_TRUE(decoded.valid);
+	EXPECT_FALSE(decoded.streaming);
+	EXPECT_EQ(decoded.formatName, "stereo16");
+	EXPECT_EQ(decoded.sampleRate, static_cast<int32_t>(g_sampleRate));
+	EXPECT_EQ(decoded.samples, expected);
+
+	const auto streamed = SoundData::decode({.file = path, .mode = SoundData::LoadMode::Stream});
+	EXPECT_TRUE(streamed.valid);
+	EXPECT_TRUE(streamed.streaming);
+	EXPECT_TRUE(streamed.samples.empty());
+
+	EXPECT_FALSE(SoundData::decode({.file = getTempDir() / "missing.wav"}).valid);
+	std::filesystem::remove_all(getTempDir());
+	owl::core::Log::invalidate();
+}
@@ -1,6 +1,7 @@
 
 #include "testHelper.h"
 
+#include <core/task/Scheduler.h>
 #include <scene/Entity.h>
 #include <scene/Scene.h>
 #include <scene/component/SoundSource.h>
@@ -195,3 +196,30 @@ TEST(SoundHelper, emptyAsset) {
 	SoundCommand::invalidate();
 	owl::core::Log::invalidate();
 }
+
+TEST(SoundSystem, asyncCreationAndPrefetch) {
+	owl::core::Log::init(owl::core::Log::Level::Off);
+	SoundCommand::create(SoundAPI::Type::Null);
+	SoundSystem::init();
+	owl::core::task::Scheduler scheduler;
+	const auto data = SoundData::createAsync({.file = "music.ogg"}, scheduler);
+	ASSERT_NE(data, nullptr);
+	// Nothing to decode with the null backend: ready at once.
+	EXPECT_EQ(data->getLoadState(), LoadState::Ready);
+	EXPECT_FALSE(data->isStreaming());
+	EXPECT_EQ(SoundData::create("")->getLoadState(), LoadState::Ready);
+
+	// Without application, no pack nor scheduler: missing sounds are skipped.
+	const std::vector<std::string> names{"", "missing.wav", "missing.wav"};
+	EXPECT_EQ(SoundSystem::prefetch(names), 0u);
+	EXPECT_FALSE(SoundSystem::getSoundLibrary().exists("missing.wav"));
+	EXPECT_FALSE(SoundData::packSpecification("missing.wav").has_value());
+
+	auto scene = owl::mkShared<owl::scene::Scene>();
+	auto entity = scene->createEntity("Music");
+	entity.addComponent<owl::scene::component::SoundSource>().sound.soundAsset = "missing.ogg";
+	EXPECT_EQ(SoundHelper::prefetchSceneSounds(*scene), 0u);
+
+	SoundCommand::invalidate();
+	owl::core::Log::invalidate();
+}
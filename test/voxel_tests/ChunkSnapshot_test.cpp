@@ -0,0 +1,89 @@
+/**
+ * @file ChunkSnapshot_test.cpp
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright (c) 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#include "testHelper.h"
+
+#include <core/Log.h>
+#include <data/voxel/ChunkSnapshot.h>
+
+using namespace owl;
+using namespace owl::data::voxel;
+
+namespace {
+class ChunkSnapshotFixture : public testing::Test {
+protected:
+	static void SetUpTestSuite() { core::Log::init(core::Log::Level::Off); }
+};
+
+auto makeRegistry() -> BlockRegistry {
+	BlockRegistry reg;
+	BlockType stone;
+	stone.name = "stone";
+	stone.renderKind = BlockRenderKind::Opaque;
+	stone.solid = true;
+	stone.setAllFaces(1);
+	reg.registerBlock(stone);
+	return reg;
+}
+}// namespace
+
+TEST_F(ChunkSnapshotFixture, CapturesChunkAndBorder) {
+	VoxelWorld world;
+	world.setBlock(math::vec3i{3, 4, 5}, 1);
+	world.setBlock(math::vec3i{16, 0, 0}, 1); // +X face neighbour
+	world.setBlock(math::vec3i{-1, -1, 0}, 1);// -X/-Y edge neighbour
+	world.setBlock(math::vec3i{16, 16, 16}, 1);// corner neighbour
+	world.setBlock(math::vec3i{17, 0, 0}, 1);// beyond the border: not captured
+	const auto snapshot = ChunkSnapshot::capture(world, math::vec3i{0, 0, 0});
+	EXPECT_EQ(snapshot.getCoord(), math::vec3i(0, 0, 0));
+	EXPECT_EQ(snapshot.getBlock(3, 4, 5), 1u);
+	EXPECT_EQ(snapshot.getBlock(16, 0, 0), 1u);
+	EXPECT_EQ(snapshot.getBlock(-1, -1, 0), 1u);
+	EXPECT_EQ(snapshot.getBlock(16, 16, 16), 1u);
+	EXPECT_EQ(snapshot.getBlock(17, 0, 0), g_AirBlock);
+	EXPECT_EQ(snapshot.getBlock(-1, 0, 0), g_AirBlock);
+}
+
+TEST_F(ChunkSnapshotFixture, SnapshotIsIndependentOfLaterEdits) {
+	VoxelWorld world;
+	world.setBlock(math::vec3i{0, 0, 0}, 1);
+	const auto snapshot = ChunkSnapshot::capture(world, math::vec3i{0, 0, 0});
+	world.setBlock(math::vec3i{0, 0, 0}, g_AirBlock);
+	world.setBlock(math::vec3i{-1, 0, 0}, 1);
+	EXPECT_EQ(snapshot.getBlock(0, 0, 0), 1u);
+	EXPECT_EQ(snapshot.getBlock(-1, 0, 0), g_AirBlock);
+}
+
+TEST_F(ChunkSnapshotFixture, MeshMatchesWorldNeighbourMeshing) {
+	const BlockRegistry reg = makeRegistry();
+	VoxelWorld world;
+	for (int32_t x = 0; x < 16; ++x)
+		for (int32_t z = 0; z < 16; ++z) world.setBlock(math::vec3i{x, 0, z}, 1);
+	world.setBlock(math::vec3i{-1, 0, 4}, 1);
+	world.setBlock(math::vec3i{-1, 1, -1}, 1);
+	const math::vec3i coord{0, 0, 0};
+	const auto chunk = world.getChunk(coord);
+	ASSERT_NE(chunk, nullptr);
+	const auto expected = ChunkMesher::meshByKind(
+			*chunk, reg, [&world](const int32_t iX, const int32_t iY, const int32_t iZ) -> BlockId {
+				return world.getBlock(math::vec3i{iX, iY, iZ});
+			});
+	const auto actual = ChunkSnapshot::capture(world, coord).meshByKind(reg);
+	EXPECT_EQ(actual.opaque.quadCount(), expected.opaque.quadCount());
+	EXPECT_EQ(actual.opaque.vertices.size(), expected.opaque.vertices.size());
+	for (size_t i = 0; i < actual.opaque.vertices.size() && i < expected.opaque.vertices.size(); ++i)
+		EXPECT_FLOAT_EQ(actual.opaque.vertices[i].ao, expected.opaque.vertices[i].ao);
+}
+
+TEST_F(ChunkSnapshotFixture, MissingChunkCapturesAsAir) {
+	const VoxelWorld world;
+	const auto snapshot = ChunkSnapshot::capture(world, math::vec3i{2, -1, 3});
+	EXPECT_EQ(snapshot.getCoord(), math::vec3i(2, -1, 3));
+	EXPECT_TRUE(snapshot.getChunk().isEmpty());
+	EXPECT_TRUE(snapshot.meshByKind(makeRegistry()).opaque.isEmpty());
+}
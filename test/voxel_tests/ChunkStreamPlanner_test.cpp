@@ -0,0 +1,88 @@
+/**
+ * @file ChunkStreamPlanner_test.cpp
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright (c) 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#include "testHelper.h"
+
+#include <core/Log.h>
+#include <data/voxel/ChunkStreamPlanner.h>
+
+#include <set>
+
+using namespace owl;
+using namespace owl::data::voxel;
+
+namespace {
+class ChunkStreamPlannerFixture : public testing::Test {
+protected:
+	static void SetUpTestSuite() { core::Log::init(core::Log::Level::Off); }
+};
+
+auto packed(const math::vec3i& iCoord) -> std::tuple<int32_t, int32_t, int32_t> {
+	return {iCoord.x(), iCoord.y(), iCoord.z()};
+}
+}// namespace
+
+TEST_F(ChunkStreamPlannerFixture, OffsetsAreRingOrdered) {
+	ChunkStreamPlanner planner;
+	planner.configure(2, 1);
+	const auto& offsets = planner.getOffsets();
+	ASSERT_EQ(offsets.size(), 5u * 5u * 3u);
+	EXPECT_EQ(offsets.front(), math::vec3i(0, 0, 0));
+	for (size_t i = 1; i < offsets.size(); ++i) EXPECT_LE(offsets[i - 1].normSq(), offsets[i].normSq());
+}
+
+TEST_F(ChunkStreamPlannerFixture, NegativeExtentClampsToCenter) {
+	ChunkStreamPlanner planner;
+	planner.configure(-3, -1);
+	EXPECT_EQ(planner.getOffsets().size(), 1u);
+}
+
+TEST_F(ChunkStreamPlannerFixture, PlanRespectsBudgetAndSkipsKnown) {
+	ChunkStreamPlanner planner;
+	planner.configure(1, 0);
+	std::set<std::tuple<int32_t, int32_t, int32_t>> known;
+	const math::vec3i center{10, 0, -4};
+	const auto isKnown = [&known](const math::vec3i& iCoord) -> bool { return known.contains(packed(iCoord)); };
+	const auto first = planner.plan(center, math::vec3{}, 3, isKnown);
+	ASSERT_EQ(first.size(), 3u);
+	EXPECT_EQ(first.front(), center);
+	for (const auto& coord: first) known.insert(packed(coord));
+	const auto second = planner.plan(center, math::vec3{}, 100, isKnown);
+	EXPECT_EQ(second.size(), 6u);
+	for (const auto& coord: second) {
+		EXPECT_FALSE(known.contains(packed(coord)));
+		known.insert(packed(coord));
+	}
+	EXPECT_TRUE(planner.plan(center, math::vec3{}, 100, isKnown).empty());
+	EXPECT_EQ(planner.getCursor(), 9u);
+}
+
+TEST_F(ChunkStreamPlannerFixture, ViewDirectionPrefersChunksAhead) {
+	ChunkStreamPlanner planner;
+	planner.configure(1, 0);
+	std::set<std::tuple<int32_t, int32_t, int32_t>> known{{0, 0, 0}};
+	const auto isKnown = [&known](const math::vec3i& iCoord) -> bool { return known.contains(packed(iCoord)); };
+	const auto coords = planner.plan(math::vec3i{0, 0, 0}, math::vec3{1.f, 0.f, 0.f}, 1, isKnown);
+	ASSERT_EQ(coords.size(), 1u);
+	EXPECT_EQ(coords.front(), math::vec3i(1, 0, 0));
+}
+
+TEST_F(ChunkStreamPlannerFixture, MovingCenterResetsCursor) {
+	ChunkStreamPlanner planner;
+	planner.configure(1, 1);
+	const auto allKnown = [](const math::vec3i&) -> bool { return true; };
+	EXPECT_TRUE(planner.plan(math::vec3i{0, 0, 0}, math::vec3{}, 4, allKnown).empty());
+	EXPECT_EQ(planner.getCursor(), planner.getOffsets().size());
+	const auto noneKnown = [](const math::vec3i&) -> bool { return false; };
+	const auto coords = planner.plan(math::vec3i{5, 0, 0}, math::vec3{}, 4, noneKnown);
+	ASSERT_EQ(coords.size(), 4u);
+	EXPECT_EQ(coords.front(), math::vec3i(5, 0, 0));
+	EXPECT_EQ(planner.getCursor(), 0u);
+	planner.reset();
+	EXPECT_EQ(planner.getCursor(), 0u);
+}
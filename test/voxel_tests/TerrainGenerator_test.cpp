@@ -158,3 +158,17 @@ TEST(TerrainGenerator, BiomesVarySurface) {
 	plain.generateChunk(c);
 	EXPECT_EQ(c.getBlock(3, 4, 3), flat.grass);// biomes off -> grass everywhere
 }
+
+TEST(TerrainGenerator, ChunkHeightsMatchHeightAt) {
+	TerrainParams p;
+	p.octaves = 5;
+	const TerrainGenerator gen{p};
+	const auto size = static_cast<int32_t>(g_ChunkSize);
+	std::vector<int32_t> heights(g_ChunkSize * g_ChunkSize);
+	for (const int32_t chunkX: {-2, 0, 3}) {
+		gen.chunkHeights(chunkX * size, -size, heights);
+		for (int32_t lz = 0; lz < size; ++lz)
+			for (int32_t lx = 0; lx < size; ++lx)
+				EXPECT_EQ(heights[static_cast<size_t>(lz * size + lx)], gen.heightAt(chunkX * size + lx, lz - size));
+	}
+}
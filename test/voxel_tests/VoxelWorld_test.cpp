@@ -120,3 +120,18 @@ TEST_F(VoxelWorldFixture, EnumerationHelpers) {
 	world.clear();
 	EXPECT_EQ(world.chunkCount(), 0u);
 }
+
+TEST_F(VoxelWorldFixture, InsertChunkTakesOwnershipWithoutCopy) {
+	VoxelWorld world;
+	world.setBlock(math::vec3i{16, 0, 0}, 1);
+	auto chunk = mkShared<Chunk>(math::vec3i{1, 0, 0});
+	chunk->setBlock(2, 3, 4, 9);
+	const Chunk* raw = chunk.get();
+	world.insertChunk(std::move(chunk));
+	EXPECT_EQ(world.chunkCount(), 1u);
+	EXPECT_EQ(world.getChunk(math::vec3i{1, 0, 0}).get(), raw);
+	EXPECT_EQ(world.getBlock(math::vec3i{18, 3, 4}), 9u);
+	EXPECT_EQ(world.getBlock(math::vec3i{16, 0, 0}), g_AirBlock);// the previous chunk was replaced
+	world.insertChunk(nullptr);
+	EXPECT_EQ(world.chunkCount(), 1u);
+}